@@ -0,0 +1,232 @@
+/*******************************************************************************
+ * Name        : intreader.h
+ * Author      : agent
+ * Version     : 1.0
+ * Date        : 10/19/2026
+ * Description : Fast reader for a line of integers on stdin. Shared by HW5 (inversioncounter) and Lab8 (quickselect).
+ ******************************************************************************/
+#ifndef INTREADER_H_
+#define INTREADER_H_
+
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <cerrno>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unistd.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/**
+ * Returns whether c is whitespace the way isspace() sees it in the C locale: space, \t, \n, \v, \f or \r
+*/
+inline bool is_whitespace(char c) {
+    return c == ' ' || (unsigned char)(c - '\t') <= '\r' - '\t';
+}
+
+#ifdef __SSE2__
+/**
+ * Returns a mask with all 1s in every byte of chunk that's whitespace (see is_whitespace()).
+ * \t to \r are 9 to 13, so c - 9 is at most 4 exactly for those. Saturating subtraction turns that into a compare with 0.
+*/
+inline __m128i whitespace_mask(__m128i chunk) {
+    const __m128i control = _mm_cmpeq_epi8(
+        _mm_subs_epu8(_mm_sub_epi8(chunk, _mm_set1_epi8('\t')), _mm_set1_epi8('\r' - '\t')), _mm_setzero_si128());
+    return _mm_or_si128(control, _mm_cmpeq_epi8(chunk, _mm_set1_epi8(' ')));
+}
+#endif
+
+/**
+ * Finds the first whitespace character in [p, end), 16 bytes at a time when we have SSE2
+ * @return Where it is, or end if there isn't one
+*/
+inline const char* find_whitespace(const char *p, const char *end) {
+#ifdef __SSE2__
+    for (; p + 16 <= end; p += 16) {
+        const int mask = _mm_movemask_epi8(whitespace_mask(_mm_loadu_si128((const __m128i*)p)));
+        if (mask != 0) {
+            return p + __builtin_ctz(mask);
+        }
+    }
+#endif
+    while (p < end && !is_whitespace(*p)) {
+        p++;
+    }
+    return p;
+}
+
+/**
+ * Skips spaces, tabs, \v and \f in [p, end), 16 bytes at a time when we have SSE2. Newlines don't get skipped.
+ * @return The first character that isn't one of those, or end
+*/
+inline const char* skip_blanks(const char *p, const char *end) {
+#ifdef __SSE2__
+    const __m128i newline = _mm_set1_epi8('\n');
+    const __m128i carriage_return = _mm_set1_epi8('\r');
+    for (; p + 16 <= end; p += 16) {
+        const __m128i chunk = _mm_loadu_si128((const __m128i*)p);
+        const __m128i eol = _mm_or_si128(_mm_cmpeq_epi8(chunk, newline), _mm_cmpeq_epi8(chunk, carriage_return));
+        const int blanks = _mm_movemask_epi8(_mm_andnot_si128(eol, whitespace_mask(chunk)));
+        if (blanks != 0xFFFF) {
+            return p + __builtin_ctz(~blanks);
+        }
+    }
+#endif
+    while (p < end && is_whitespace(*p) && *p != '\n' && *p != '\r') {
+        p++;
+    }
+    return p;
+}
+
+/**
+ * Parses a token the same way istringstream >> int does: an optional + or -, then digits. Anything after the digits
+ * is ignored ("12abc" is 12), but there has to be at least one digit and the number has to fit in an int.
+ * @param token The token. It can't have whitespace in it
+ * @param value Gets the integer
+ * @return Whether the token was an integer
+*/
+inline bool parse_int_token(std::string_view token, int &value) {
+    const char *p = token.data();
+    const char *end = p + token.size();
+
+    // from_chars takes a - but not a +. "+-5" isn't a number, so a + has to be followed by a digit.
+    if (p < end && *p == '+') {
+        p++;
+        if (p == end || *p == '-') {
+            return false;
+        }
+    }
+    return std::from_chars(p, end, value).ec == std::errc();
+}
+
+/**
+ * Reads lines of integers straight from a file descriptor in big blocks.
+ * This replaces reading one getchar() at a time, copying every token into a string and running it through an istringstream.
+ * The results are the same (see read_line()), it's just a lot less work per character.
+*/
+class IntLineReader {
+public:
+    explicit IntLineReader(int fd = STDIN_FILENO)
+        : fd_{fd}, buffer_(1 << 16), begin_{0}, end_{0}, eof_{false}, line_index_{0}, line_finished_{false} { }
+
+    /**
+     * Reads integers up to the end of the line (\n or \r) or the end of the input, whichever comes first.
+     * Tokens are separated by whitespace. Each one goes through parse_int_token(), and the first one that isn't an
+     * integer stops the reading.
+     * With max_values, it also stops once it has read that many, and the next call picks up the same line where this
+     * one stopped. That way a line too long to hold in memory can be read a piece at a time (see line_finished()).
+     * @param values Gets every integer on the line, added to the end
+     * @param bad_token Gets the first token that wasn't an integer
+     * @param bad_index Gets the index of that token on the line (the first token is 0)
+     * @param max_values The most integers to read in this call
+     * @return False if there was a token that wasn't an integer
+    */
+    bool read_line(std::vector<int> &values, std::string &bad_token, size_t &bad_index,
+                   size_t max_values = std::numeric_limits<size_t>::max()) {
+        line_finished_ = false;
+        for (size_t count = 0; count < max_values; count++) {
+            // Skip to the next token
+            const char *p;
+            while ((p = skip_blanks(buffer_.data() + begin_, buffer_.data() + end_)) == buffer_.data() + end_) {
+                begin_ = end_;
+                if (!refill()) {
+                    finish_line();
+                    return true;
+                }
+            }
+            begin_ = p - buffer_.data();
+
+            if (*p == '\n' || *p == '\r') {
+                begin_++;
+                finish_line();
+                return true;
+            }
+
+            // Find where the token ends. If it runs off the end of what we have, read more and keep looking.
+            size_t scanned = begin_;
+            const char *token_end;
+            while ((token_end = find_whitespace(buffer_.data() + scanned, buffer_.data() + end_)) == buffer_.data() + end_) {
+                scanned = end_ - begin_;
+                if (!refill()) {
+                    // The token goes to the end of the input. refill() may have moved it, so find the end again.
+                    token_end = buffer_.data() + end_;
+                    break;
+                }
+                scanned += begin_;
+            }
+
+            const std::string_view token(buffer_.data() + begin_, token_end - (buffer_.data() + begin_));
+            begin_ = token_end - buffer_.data();
+
+            int value;
+            if (!parse_int_token(token, value)) {
+                bad_token = std::string(token);
+                bad_index = line_index_;
+                return false;
+            }
+            values.push_back(value);
+            line_index_++;
+        }
+        return true;
+    }
+
+    /**
+     * Returns whether the last read_line() got to the end of the line, instead of stopping at max_values
+    */
+    bool line_finished() const {
+        return line_finished_;
+    }
+
+private:
+    /**
+     * Starts the index over for the next line
+    */
+    void finish_line() {
+        line_index_ = 0;
+        line_finished_ = true;
+    }
+
+    /**
+     * Moves what we haven't used yet to the front of the buffer and reads as much as fits after it.
+     * If the buffer is full of one token, the buffer doubles first.
+     * @return False if there's nothing more to read
+    */
+    bool refill() {
+        if (eof_) {
+            return false;
+        }
+        memmove(buffer_.data(), buffer_.data() + begin_, end_ - begin_);
+        end_ -= begin_;
+        begin_ = 0;
+        if (end_ == buffer_.size()) {
+            buffer_.resize(buffer_.size() * 2);
+        }
+
+        ssize_t bytes_read;
+        do {
+            bytes_read = read(fd_, buffer_.data() + end_, buffer_.size() - end_);
+        } while (bytes_read < 0 && errno == EINTR);
+
+        if (bytes_read <= 0) {
+            eof_ = true;
+            return false;
+        }
+        end_ += bytes_read;
+        return true;
+    }
+
+    int fd_;
+    std::vector<char> buffer_;
+    size_t begin_;  // The first byte we haven't used yet
+    size_t end_;    // One past the last byte we've read
+    bool eof_;
+    size_t line_index_;     // The index on the current line of the next token
+    bool line_finished_;
+};
+
+#endif /* INTREADER_H_ */
@@ -10,15 +10,63 @@
 #include <algorithm>
 #include <sstream>
 #include <vector>
-#include <cstdio>
-#include <cctype>
 #include <cstring>
+#include <future>
+#include <thread>
+#include <random>
+#include <chrono>
+#include <iomanip>
+#include <functional>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <queue>
+#include <numeric>
+#include <cstdio>
+#include <cerrno>
+#include "../Common/intreader.h"
 
 using namespace std;
 
 // Function prototype.
 static long mergesort(int array[], int scratch[], int low, int high);
 
+// Subarrays smaller than this are sorted by one thread. Forking a task costs a few microseconds, which is about
+// how long it takes to merge sort this many ints anyway.
+const int PARALLEL_CUTOFF = 1 << 16;
+
+// count_inversions_bottom_up() insertion sorts runs this long before it starts merging.
+// Below this, the shifting in insertion sort is cheaper than the bookkeeping of merging.
+const size_t INSERTION_SORT_RUN = 16;
+
+// The external counter reads and writes its temporary files through buffers at least this big (in bytes), so the disk
+// still sees long sequential reads when a merge has a lot of runs open. Runs past that get merged in more than one pass.
+const size_t EXTERNAL_MIN_BUFFER = 1 << 16;
+
+// How much memory (in MB) "external" gets when it isn't told
+const size_t EXTERNAL_DEFAULT_BUDGET_MB = 256;
+
+// The templated counters count in 128 bits. n values can have n(n - 1)/2 inversions, which doesn't fit in a long
+// once n gets past about 4 billion. __extension__ keeps -pedantic-errors from rejecting __int128.
+__extension__ typedef unsigned __int128 inversion_count_t;
+
+/**
+ * Turns an inversion count into a string. cout doesn't know how to print an unsigned __int128.
+ * @param count The count
+ * @return Its digits in base 10
+*/
+string inversion_count_to_string(inversion_count_t count)
+{
+    string digits;
+    do
+    {
+        digits += (char)('0' + (int)(count % 10));
+        count /= 10;
+    } while (count != 0);
+    reverse(digits.begin(), digits.end());
+    return digits;
+}
+
 /**
  * Counts the number of inversions in an array in Theta(n^2) time using two nested loops.
  * Inversions happen when a larger number appears before a smaller number.
@@ -159,12 +207,1093 @@ static long mergesort(int array[], int scratch[], int low, int high) {
     return num_inversions;
 }
 
+/**
+ * Insertion sorts array[low...high) and counts its inversions. Every time a value shifts right past a bigger one,
+ * that's exactly one inversion (the bigger one came first), so the count is just the number of shifts.
+ * @param array[] The array to sort
+ * @param low The first index of the run
+ * @param high One past the last index of the run
+ * @param is_less The comparator. is_less(a, b) is true when a goes before b
+ * @return The number of inversions in array[low...high)
+*/
+template <typename T, typename Compare>
+static inversion_count_t insertion_sort_run(T array[], size_t low, size_t high, Compare is_less)
+{
+    inversion_count_t num_inversions = 0;
+    for (size_t i = low + 1; i < high; i++)
+    {
+        T value = move(array[i]);
+        size_t j = i;
+        while (j > low && is_less(value, array[j - 1]))
+        {
+            array[j] = move(array[j - 1]);
+            j--;
+        }
+        num_inversions += i - j;
+        array[j] = move(value);
+    }
+    return num_inversions;
+}
+
+/**
+ * Merges src[low...mid) and src[mid...high) (both sorted) into dst[low...high) and counts the inversions between them.
+ * It's the same merge as in mergesort(), but without the if: which side we take is a 0 or 1 that gets added to the indexes,
+ * and the inversions get added as (mid - i) times that. On random data, mergesort()'s branch guesses wrong about half
+ * the time. This compiles to conditional moves instead, so there's nothing to guess.
+ * Sorted and reverse sorted input is where the branch always guesses right, so we check for those two cases up front:
+ * if the runs are already in order, or the whole right run goes before the whole left run, it's just two copies.
+ * Values get moved instead of copied, so merging strings doesn't copy every string on every pass.
+ * @param src[] Where the two sorted runs are. The values in it get moved out
+ * @param dst[] Where the merged run goes. It can't be src
+ * @param low The start of the left run
+ * @param mid The start of the right run
+ * @param high One past the end of the right run
+ * @param is_less The comparator. is_less(a, b) is true when a goes before b
+ * @return The number of inversions between the two runs
+*/
+template <typename T, typename Compare>
+static inversion_count_t merge_branchless(T src[], T dst[], size_t low, size_t mid, size_t high, Compare is_less)
+{
+    //Already in order (this also covers a last run with no partner)
+    if (mid == high || !is_less(src[mid], src[mid - 1]))
+    {
+        move(src + low, src + high, dst + low);
+        return 0;
+    }
+
+    //Every right value is smaller than every left value, so each one is an inversion with the whole left run
+    if (is_less(src[high - 1], src[low]))
+    {
+        move(src + mid, src + high, dst + low);
+        move(src + low, src + mid, dst + low + (high - mid));
+        return (inversion_count_t)(mid - low) * (high - mid);
+    }
+
+    inversion_count_t num_inversions = 0;
+    size_t i = low;
+    size_t j = mid;
+    size_t k = low;
+
+    while (i < mid && j < high)
+    {
+        const bool take_right = is_less(src[j], src[i]);   //Ties take the left one, like mergesort()
+
+        dst[k++] = move(take_right ? src[j] : src[i]);
+        num_inversions += (mid - i) & -(size_t)take_right;
+        i += !take_right;
+        j += take_right;
+    }
+
+    //Whatever's left over is already in order, and none of it adds inversions
+    move(src + i, src + mid, dst + k);
+    move(src + j, src + high, dst + k + (mid - i));
+    return num_inversions;
+}
+
+/**
+ * Bottom-up merge sort that counts inversions.
+ * mergesort() recurses all the way down to single values and copies scratch back into the array after every merge.
+ * Here, we insertion sort runs of INSERTION_SORT_RUN values first, then merge runs of 16, 32, 64, ... in a loop.
+ * Each pass merges from one buffer into the other and then they swap roles (ping-pong), so nothing gets copied back
+ * until the very end, and only if the last pass ended up in scratch.
+ * @param array[] The array to "merge sort"
+ * @param scratch[] Scratch space, at least as long as the array
+ * @param length The length of the array
+ * @param is_less The comparator. is_less(a, b) is true when a goes before b
+ * @return The number of inversions in the array
+*/
+template <typename T, typename Compare>
+static inversion_count_t bottom_up_mergesort(T array[], T scratch[], size_t length, Compare is_less)
+{
+    inversion_count_t num_inversions = 0;
+    for (size_t low = 0; low < length; low += INSERTION_SORT_RUN)
+    {
+        num_inversions += insertion_sort_run(array, low, low + min(INSERTION_SORT_RUN, length - low), is_less);
+    }
+
+    T* src = array;
+    T* dst = scratch;
+
+    for (size_t width = INSERTION_SORT_RUN; width < length; width *= 2)
+    {
+        for (size_t low = 0; low < length; low += 2 * width)
+        {
+            //The last run might not have a partner. merge_branchless() then just copies it over.
+            const size_t mid = low + min(width, length - low);
+            const size_t high = low + min(2 * width, length - low);
+            num_inversions += merge_branchless(src, dst, low, mid, high, is_less);
+        }
+        swap(src, dst);
+    }
+
+    if (src != array)
+    {
+        move(src, src + length, array);
+    }
+    return num_inversions;
+}
+
+/**
+ * Counts the inversions of any array we can sort: i < j is an inversion when is_less(array[j], array[i]).
+ * This is the bottom-up merge sort again, but for any element type and comparator (long, double, string, ...).
+ * Indexes are size_t, so it isn't stuck below 2^31 values, and the count is 128 bits, since n values can have
+ * n(n - 1)/2 inversions and that stops fitting in a long at about 4 billion values.
+ * The comparator has to be a strict weak ordering, so doubles can't have NaNs in them with less<double>.
+ * Like count_inversions_fast(), this sorts the array.
+ * @param array[] The array to count inversions for
+ * @param length The length of the array
+ * @param is_less The comparator. is_less(a, b) is true when a goes before b
+ * @return Number of Inversions
+ */
+template <typename T, typename Compare = less<T>>
+inversion_count_t count_inversions(T array[], size_t length, Compare is_less = Compare())
+{
+    if (length == 0)
+    {
+        return 0;
+    }
+    vector<T> scratch(length);
+    return bottom_up_mergesort(array, scratch.data(), length, is_less);
+}
+
+/**
+ * Counts the number of inversions in an array in Theta(n lg n) time with a bottom-up merge sort (see count_inversions()).
+ * It gets the same answer as count_inversions_fast() and sorts the array the same way.
+ * @param array[] The array to count inversions for
+ * @param length The length of the array
+ * @return Number of Inversions
+ */
+long count_inversions_bottom_up(int array[], int length)
+{
+    return (long)count_inversions(array, (size_t)length);
+}
+
+/**
+ * MSD binary radix sort that counts inversions. It splits array[0...length) on one bit at a time, from the top:
+ * values with a 0 go first and values with a 1 go after them, both in the order they were in.
+ * A value with a 0 that comes after a value with a 1 is smaller than it, no matter what the lower bits are, so every 0
+ * is an inversion with every 1 before it. That's one pass with a counter of the 1s so far, and no comparisons at all.
+ * Then the 0s and the 1s are split again on the next bit, down to runs short enough to insertion sort.
+ * The 0s get compacted where they are and the 1s go into scratch and get copied back behind them. Each value gets
+ * written to both places, and only one of the two indexes moves, so there's no branch in the loop.
+ * @param array[] The array to sort
+ * @param scratch[] Scratch space, at least as long as the array
+ * @param length The length of the array
+ * @param bit The highest bit the values can still differ in
+ * @return The number of inversions in the array
+*/
+template <typename T>
+static inversion_count_t radix_inversions(T array[], T scratch[], size_t length, int bit)
+{
+    using Key = make_unsigned_t<T>;
+    //Flipping the sign bit puts negative values before positive ones when we read them as unsigned
+    const Key sign_flip = is_signed_v<T> ? (Key)((Key)1 << (numeric_limits<Key>::digits - 1)) : 0;
+
+    inversion_count_t num_inversions = 0;
+    while (length > INSERTION_SORT_RUN && bit >= 0)
+    {
+        size_t zeros = 0;
+        size_t ones = 0;
+        inversion_count_t split_inversions = 0;
+        for (size_t i = 0; i < length; i++)
+        {
+            const T value = array[i];
+            const size_t one = (((Key)value ^ sign_flip) >> bit) & 1;
+            array[zeros] = value;
+            scratch[ones] = value;
+            split_inversions += ones & (one - 1);   //one - 1 is all 1s for a 0 and all 0s for a 1
+            zeros += 1 - one;
+            ones += one;
+        }
+        copy(scratch, scratch + ones, array + zeros);
+
+        //The 0s are done with this bit. Recurse on them, and keep going on the 1s in this loop.
+        num_inversions += split_inversions + radix_inversions(array, scratch, zeros, bit - 1);
+        array += zeros;
+        length = ones;
+        bit--;
+    }
+
+    //If we ran out of bits, what's left is all the same value
+    return bit < 0 ? num_inversions : num_inversions + insertion_sort_run(array, 0, length, less<T>());
+}
+
+/**
+ * Counts the number of inversions in an array of integers with an MSD binary radix sort (see radix_inversions()).
+ * It starts at the highest bit the values actually differ in, so small values don't pay for all 32 or 64 bits.
+ * It works for every integer type and sorts the array the same way count_inversions() does.
+ * @param array[] The array to count inversions for
+ * @param length The length of the array
+ * @return Number of Inversions
+ */
+template <typename T>
+inversion_count_t count_inversions_radix(T array[], size_t length)
+{
+    static_assert(is_integral_v<T> && !is_same_v<T, bool>, "count_inversions_radix() needs an integer type");
+    using Key = make_unsigned_t<T>;
+
+    //Every bit that's set in here is a bit where some value differs from the first one
+    Key differences = 0;
+    for (size_t i = 1; i < length; i++)
+    {
+        differences |= (Key)array[i] ^ (Key)array[0];
+    }
+    if (differences == 0)
+    {
+        return 0;
+    }
+
+    int bit = 0;
+    while (differences >> bit >> 1)
+    {
+        bit++;
+    }
+    vector<T> scratch(length);
+    return radix_inversions(array, scratch.data(), length, bit);
+}
+
+/**
+ * Finds where the merge path crosses diagonal d: in the merged output of left[0...left_length) and
+ * right[0...right_length), the first d values are left[0...i) and right[0...d - i). This returns i.
+ * Ties go to the left side, the same way mergesort() breaks them, so the merge stays stable and the inversion count is the same.
+ * @param left The sorted left half
+ * @param left_length The length of the left half
+ * @param right The sorted right half
+ * @param right_length The length of the right half
+ * @param d How many values of the merged output we want to split off
+ * @return How many of those come from the left half
+*/
+static int merge_path_split(const int left[], int left_length, const int right[], int right_length, int d)
+{
+    int lo = max(0, d - right_length);
+    int hi = min(d, left_length);
+
+    //Binary search on the diagonal. If left[mid] <= right[d - mid - 1], left[mid] comes out first, so more than mid come from the left
+    while (lo < hi)
+    {
+        int mid = lo + (hi - lo) / 2;
+        if (left[mid] <= right[d - mid - 1])
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/**
+ * Merges array[low...mid] and array[mid + 1...high] (both already sorted) with num_threads threads, and counts the inversions
+ * between the two halves. This is the same merge as the one in mergesort(), just cut into num_threads equal pieces of output.
+ * merge_path_split() tells each piece where in the two halves it starts, so the pieces don't depend on each other.
+ * A right value still adds (mid - i + 1) inversions when it gets merged, since i is an index into the whole left half.
+ * @param array[] The array with the two sorted halves
+ * @param scratch[] Scratch space, at least as long as the array
+ * @param low The start of the left half
+ * @param mid The end of the left half
+ * @param high The end of the right half
+ * @param num_threads How many threads to merge with
+ * @return The number of inversions between the two halves
+*/
+static long merge_parallel(int array[], int scratch[], int low, int mid, int high, int num_threads)
+{
+    const int left_length = mid - low + 1;
+    const int right_length = high - mid;
+    const int total = left_length + right_length;
+
+    //Runs work(d_begin, d_end) on each piece of the output at the same time and adds up what they return.
+    //The calling thread takes the last piece.
+    auto for_each_piece = [=](auto work) {
+        vector<future<long>> pieces;
+        for (int t = 0; t < num_threads - 1; t++)
+        {
+            pieces.push_back(async(launch::async, work, (int)((long)total * t / num_threads), (int)((long)total * (t + 1) / num_threads)));
+        }
+        long sum = work((int)((long)total * (num_threads - 1) / num_threads), total);
+
+        for (future<long> &piece : pieces)
+        {
+            sum += piece.get();
+        }
+        return sum;
+    };
+
+    //Merges output positions [d_begin, d_end) into scratch
+    auto merge_piece = [=](int d_begin, int d_end) {
+        int i = low + merge_path_split(array + low, left_length, array + mid + 1, right_length, d_begin);
+        int j = mid + 1 + (d_begin - (i - low));
+        long num_inversions = 0;
+
+        for (int k = low + d_begin; k < low + d_end; k++)
+        {
+            //Same as mergesort(): take the right value only when it's strictly smaller
+            if (j <= high && (i > mid || array[j] < array[i]))
+            {
+                scratch[k] = array[j++];
+                num_inversions += mid - i + 1;
+            }
+            else
+            {
+                scratch[k] = array[i++];
+            }
+        }
+        return num_inversions;
+    };
+    long num_inversions = for_each_piece(merge_piece);
+
+    //Every piece reads all over both halves, so we can only copy back once they're all done
+    for_each_piece([=](int d_begin, int d_end) {
+        copy(scratch + low + d_begin, scratch + low + d_end, array + low + d_begin);
+        return 0L;
+    });
+
+    return num_inversions;
+}
+
+/**
+ * Parallel version of mergesort(). The left half gets forked off as its own task and the right half runs in this thread,
+ * with the threads split between them, until a subarray only has one thread or is smaller than PARALLEL_CUTOFF. Then it's
+ * just bottom_up_mergesort(). Splitting the threads is what limits the depth: there are never more than num_threads tasks running.
+ * The merges at the top are the biggest ones, so they use merge_parallel() instead of one thread.
+ * @param array[] The array to "merge sort"
+ * @param scratch[] Scratch space, at least as long as the array
+ * @param low The low index to merge
+ * @param high The high index to merge
+ * @param num_threads How many threads this subarray gets
+ * @return The number of inversions in array[low...high]
+*/
+static long mergesort_parallel(int array[], int scratch[], int low, int high, int num_threads)
+{
+    if (num_threads <= 1 || high - low + 1 < PARALLEL_CUTOFF)
+    {
+        return bottom_up_mergesort(array + low, scratch + low, high - low + 1, less<int>());
+    }
+
+    int mid = low + (high - low) / 2;
+    const int left_threads = num_threads / 2;
+
+    //The two halves only touch their own part of array and scratch, so they can run at the same time
+    future<long> left = async(launch::async, mergesort_parallel, array, scratch, low, mid, left_threads);
+    long right = mergesort_parallel(array, scratch, mid + 1, high, num_threads - left_threads);
+    long num_inversions = left.get() + right;
+
+    return num_inversions + merge_parallel(array, scratch, low, mid, high, num_threads);
+}
+
+/**
+ * Counts the number of inversions in an array in Theta(n lg n) time, using num_threads threads.
+ * It gets the same answer as count_inversions_fast() (and sorts the array the same way).
+ * @param array[] The array to count inversions for
+ * @param length The length of the array
+ * @param num_threads How many threads to use. Anything below 1 counts as 1
+ * @return Number of Inversions
+ */
+long count_inversions_parallel(int array[], int length, int num_threads)
+{
+    int* scratch = new int[length];
+    long result = mergesort_parallel(array, scratch, 0, length - 1, max(num_threads, 1));
+
+    delete[] scratch;
+    return result;
+}
+
+/**
+ * Replaces every value with its rank among the distinct values: the smallest value becomes 0, the next smallest 1, and
+ * so on, with equal values getting the same rank. Inversions only care about which of two values is bigger, so the ranks
+ * have exactly the same inversions as the values, but they're small enough to index a Fenwick tree with.
+ * We sort (value, index) pairs with an LSD radix sort, 16 bits of the value per pass, instead of a comparison sort.
+ * Flipping the sign bit makes negative values sort before positive ones when they're treated as unsigned.
+ * @param array[] The values. This doesn't change them
+ * @param length The number of values
+ * @param num_ranks Gets the number of distinct values
+ * @return The rank of every value
+*/
+vector<int> compress_coordinates(const int array[], int length, int &num_ranks)
+{
+    //The value goes in the top 32 bits and the index in the bottom 32, so both travel together through the sort
+    vector<uint64_t> items(length);
+    vector<uint64_t> sorted(length);
+    for (int i = 0; i < length; i++)
+    {
+        items[i] = (uint64_t)((uint32_t)array[i] ^ 0x80000000u) << 32 | (uint32_t)i;
+    }
+
+    for (int shift : {32, 48})
+    {
+        //Counting sort on one 16-bit digit. It's stable, so the previous pass's order survives among equal digits.
+        vector<int> start(1 << 16 | 1, 0);
+        for (uint64_t item : items)
+        {
+            start[(item >> shift & 0xFFFF) + 1]++;
+        }
+        for (int digit = 0; digit < 1 << 16; digit++)
+        {
+            start[digit + 1] += start[digit];
+        }
+        for (uint64_t item : items)
+        {
+            sorted[start[item >> shift & 0xFFFF]++] = item;
+        }
+        items.swap(sorted);
+    }
+
+    //Walk the values in order and bump the rank every time the value changes
+    vector<int> ranks(length);
+    num_ranks = 0;
+    for (int i = 0; i < length; i++)
+    {
+        if (i > 0 && items[i] >> 32 != items[i - 1] >> 32)
+        {
+            num_ranks++;
+        }
+        ranks[(uint32_t)items[i]] = num_ranks;
+    }
+    num_ranks += length > 0;
+    return ranks;
+}
+
+/**
+ * A Fenwick tree (binary indexed tree) of counts over ranks 0...size-1.
+ * Adding to a rank and counting everything at or below a rank both take O(lg size).
+ * It's one flat vector of Counts, so the top levels that every query touches stay in cache. int is plenty for counts
+ * of values we're holding in memory; the external counter needs long.
+*/
+template <typename Count>
+class FenwickTree {
+public:
+    explicit FenwickTree(int size) : tree_(size + 1, 0) { }
+
+    /**
+     * Adds delta to the count at rank
+    */
+    void add(int rank, Count delta) {
+        for (int i = rank + 1; i < (int)tree_.size(); i += i & -i) {
+            tree_[i] += delta;
+        }
+    }
+
+    /**
+     * Returns the total count of ranks 0...rank. A rank of -1 gives 0.
+    */
+    Count count_at_most(int rank) const {
+        Count total = 0;
+        for (int i = rank + 1; i > 0; i -= i & -i) {
+            total += tree_[i];
+        }
+        return total;
+    }
+
+private:
+    vector<Count> tree_;
+};
+
+/**
+ * Counts the number of inversions in array[0...i] for every i, in Theta(n lg n) time, without changing the array.
+ * Going left to right, every value is an inversion with each value before it that's bigger. The Fenwick tree holds the
+ * ranks we've seen so far, so that's (how many we've seen) - (how many were at most this one).
+ * Merge sort can't do this, because it only knows the total once everything is merged.
+ * @param array[] The array to count inversions for. This doesn't change it
+ * @param length The length of the array
+ * @return The number of inversions in each prefix of the array
+ */
+vector<long> count_prefix_inversions(const int array[], int length)
+{
+    int num_ranks;
+    const vector<int> ranks = compress_coordinates(array, length, num_ranks);
+    FenwickTree<int> seen(num_ranks);
+
+    vector<long> prefix_inversions(length);
+    long num_inversions = 0;
+    for (int i = 0; i < length; i++)
+    {
+        num_inversions += i - seen.count_at_most(ranks[i]);
+        seen.add(ranks[i], 1);
+        prefix_inversions[i] = num_inversions;
+    }
+    return prefix_inversions;
+}
+
+/**
+ * Counts the number of inversions in an array in Theta(n lg n) time with a Fenwick tree (see count_prefix_inversions()).
+ * Unlike count_inversions_fast(), this doesn't sort the array.
+ * @param array[] The array to count inversions for. This doesn't change it
+ * @param length The length of the array
+ * @return Number of Inversions
+ */
+long count_inversions_fenwick(const int array[], int length)
+{
+    int num_ranks;
+    const vector<int> ranks = compress_coordinates(array, length, num_ranks);
+    FenwickTree<int> seen(num_ranks);
+
+    long num_inversions = 0;
+    for (int i = 0; i < length; i++)
+    {
+        num_inversions += i - seen.count_at_most(ranks[i]);
+        seen.add(ranks[i], 1);
+    }
+    return num_inversions;
+}
+
+/**
+ * Counts the number of inversions in every window of window_size values: array[0...window_size), array[1...window_size + 1), ...
+ * in Theta(n lg n) time total, without changing the array.
+ * The Fenwick tree holds the ranks in the current window. When the window slides right, the value coming in is an
+ * inversion with every bigger value already in the window, and the value going out was an inversion with every
+ * smaller value still in the window.
+ * @param array[] The array to count inversions for. This doesn't change it
+ * @param length The length of the array
+ * @param window_size The number of values in each window. It has to be between 1 and length
+ * @return The number of inversions in each of the length - window_size + 1 windows
+ */
+vector<long> count_window_inversions(const int array[], int length, int window_size)
+{
+    int num_ranks;
+    const vector<int> ranks = compress_coordinates(array, length, num_ranks);
+    FenwickTree<int> window(num_ranks);
+
+    vector<long> window_inversions;
+    window_inversions.reserve(length - window_size + 1);
+    long num_inversions = 0;
+    for (int i = 0; i < length; i++)
+    {
+        //The value coming in, against everything bigger that's already in the window
+        num_inversions += min(i, window_size - 1) - window.count_at_most(ranks[i]);
+        window.add(ranks[i], 1);
+
+        if (i >= window_size - 1)
+        {
+            window_inversions.push_back(num_inversions);
+
+            //The value going out, against everything smaller that stays in the window
+            const int out = i - window_size + 1;
+            window.add(ranks[out], -1);
+            num_inversions -= window.count_at_most(ranks[out] - 1);
+        }
+    }
+    return window_inversions;
+}
+
+/**
+ * Writes count values to fd, however many write() calls that takes
+ * @param fd Where to write
+ * @param values The values
+ * @param count How many values
+ * @return Whether everything got written
+*/
+static bool write_values(int fd, const int values[], size_t count)
+{
+    const char *bytes = (const char*)values;
+    size_t left = count * sizeof(int);
+    while (left > 0)
+    {
+        const ssize_t written = write(fd, bytes, left);
+        if (written < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (written <= 0)
+        {
+            return false;
+        }
+        bytes += written;
+        left -= written;
+    }
+    return true;
+}
+
+/**
+ * Reads count values from fd, starting at a byte offset, however many pread() calls that takes
+ * @param fd Where to read from
+ * @param values Gets the values
+ * @param count How many values
+ * @param offset The byte offset in the file of the first value
+ * @return Whether all of them got read
+*/
+static bool read_values_at(int fd, int values[], size_t count, off_t offset)
+{
+    char *bytes = (char*)values;
+    size_t left = count * sizeof(int);
+    while (left > 0)
+    {
+        const ssize_t bytes_read = pread(fd, bytes, left, offset);
+        if (bytes_read < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (bytes_read <= 0)
+        {
+            return false;
+        }
+        bytes += bytes_read;
+        left -= bytes_read;
+        offset += bytes_read;
+    }
+    return true;
+}
+
+/**
+ * One sorted run in a temporary file, read one buffer at a time while it gets merged
+*/
+class RunReader {
+public:
+    RunReader(int fd, off_t offset, size_t length, size_t buffer_values)
+        : fd_{fd}, offset_{offset}, unread_{length}, buffer_(min(length, buffer_values)), position_{0}, filled_{0}, failed_{false} { }
+
+    /**
+     * Returns whether the run has a value left, reading the next buffer from the file if this one is used up.
+     * A read that fails also returns false. failed() tells the two apart.
+    */
+    bool has_next() {
+        if (position_ < filled_) {
+            return true;
+        }
+        if (unread_ == 0 || failed_) {
+            return false;
+        }
+        filled_ = min(unread_, buffer_.size());
+        if (!read_values_at(fd_, buffer_.data(), filled_, offset_)) {
+            failed_ = true;
+            return false;
+        }
+        offset_ += filled_ * sizeof(int);
+        unread_ -= filled_;
+        position_ = 0;
+        return true;
+    }
+
+    /**
+     * Returns the next value. has_next() has to have said there is one.
+    */
+    int front() const {
+        return buffer_[position_];
+    }
+
+    /**
+     * Moves past the next value
+    */
+    void pop() {
+        position_++;
+    }
+
+    bool failed() const {
+        return failed_;
+    }
+
+private:
+    int fd_;
+    off_t offset_;          // Where the next value we haven't buffered is in the file
+    size_t unread_;         // How many values are still only in the file
+    vector<int> buffer_;
+    size_t position_;       // The next value in buffer_
+    size_t filled_;         // How much of buffer_ has values in it
+    bool failed_;
+};
+
+/**
+ * Merges sorted runs that sit back to back in in_fd and counts the inversions between them (the ones inside each run
+ * got counted when the run was sorted).
+ * When a value comes out of run r, every value still waiting in runs 0...r - 1 is bigger than it and came before it,
+ * so that's how many inversions it adds. Equal values come out of the earlier run first, so they never count.
+ * A Fenwick tree over the run numbers keeps how many values each run has left, which makes that sum one query.
+ * @param in_fd The file with the runs
+ * @param offset The byte offset of the first run
+ * @param run_lengths How many values are in each run
+ * @param out_fd Where the merged run gets written, or -1 if it isn't needed (the last merge)
+ * @param buffer_values How many values each run (and the output) gets to buffer
+ * @param num_inversions Gets the inversions between the runs added to it
+ * @return Whether all the reading and writing worked
+*/
+static bool merge_external_runs(int in_fd, off_t offset, const vector<size_t> &run_lengths, int out_fd,
+                                size_t buffer_values, inversion_count_t &num_inversions)
+{
+    const int num_runs = run_lengths.size();
+    vector<RunReader> runs;
+    runs.reserve(num_runs);
+    FenwickTree<long> remaining(num_runs);
+
+    //Smallest value on top, and the earlier run when they tie
+    priority_queue<pair<int, int>, vector<pair<int, int>>, greater<pair<int, int>>> heap;
+    for (int r = 0; r < num_runs; r++)
+    {
+        runs.emplace_back(in_fd, offset, run_lengths[r], buffer_values);
+        offset += run_lengths[r] * sizeof(int);
+        remaining.add(r, run_lengths[r]);
+        if (runs[r].has_next())
+        {
+            heap.push({runs[r].front(), r});
+        }
+    }
+
+    vector<int> output;
+    output.reserve(out_fd >= 0 ? buffer_values : 0);
+    while (!heap.empty())
+    {
+        const int value = heap.top().first;
+        const int r = heap.top().second;
+        heap.pop();
+
+        num_inversions += remaining.count_at_most(r - 1);
+        remaining.add(r, -1);
+
+        if (out_fd >= 0)
+        {
+            output.push_back(value);
+            if (output.size() == buffer_values)
+            {
+                if (!write_values(out_fd, output.data(), output.size()))
+                {
+                    return false;
+                }
+                output.clear();
+            }
+        }
+
+        runs[r].pop();
+        if (runs[r].has_next())
+        {
+            heap.push({runs[r].front(), r});
+        }
+    }
+
+    if (any_of(runs.begin(), runs.end(), [](const RunReader &run) { return run.failed(); }))
+    {
+        return false;
+    }
+    return out_fd < 0 || write_values(out_fd, output.data(), output.size());
+}
+
+/**
+ * Counts the inversions in the rest of the reader's line and prints them, while holding about budget_bytes of values
+ * at a time at most. That's for inputs too big to fit in memory (count_inversions_fast() needs the values plus a scratch
+ * array just as big).
+ * First, the input gets cut into runs that fit in the budget along with their scratch arrays. Each run gets its
+ * inversions counted by bottom_up_mergesort(), which also sorts it, and then it goes into a temporary file.
+ * Then merge_external_runs() merges the runs and counts the inversions between them. If there are too many runs to give
+ * each one a buffer of at least EXTERNAL_MIN_BUFFER bytes, groups of neighboring runs get merged into a second temporary
+ * file first. A group is a contiguous piece of the input, so the merged groups are just longer runs, and the
+ * inversions between groups get counted on the next pass.
+ * @param reader Where the values come from
+ * @param budget_bytes About how much memory the values get
+ * @return The exit code for main()
+*/
+int run_external(IntLineReader &reader, size_t budget_bytes)
+{
+    //A run and its scratch array have to fit in the budget
+    const size_t run_values = max(budget_bytes / (2 * sizeof(int)), INSERTION_SORT_RUN);
+    //Every run being merged gets a buffer, and so does the output
+    const size_t max_runs_per_merge = max<size_t>(2, budget_bytes / EXTERNAL_MIN_BUFFER - 1);
+
+    FILE *files[2] = {tmpfile(), tmpfile()};
+    auto close_files = [&files]() {
+        for (FILE *file : files)
+        {
+            if (file != nullptr)
+            {
+                fclose(file);
+            }
+        }
+    };
+    if (files[0] == nullptr || files[1] == nullptr)
+    {
+        cerr << "Error: Cannot create a temporary file." << endl;
+        close_files();
+        return 1;
+    }
+
+    inversion_count_t num_inversions = 0;
+    vector<size_t> run_lengths;
+    {
+        vector<int> values;
+        vector<int> scratch(run_values);
+        values.reserve(run_values);
+        string bad_token;
+        size_t bad_index;
+        do
+        {
+            values.clear();
+            if (!reader.read_line(values, bad_token, bad_index, run_values))
+            {
+                cerr << "Error: Non-integer value '" << bad_token
+                     << "' received at index " << bad_index << "." << endl;
+                close_files();
+                return 1;
+            }
+            if (values.empty())
+            {
+                break;
+            }
+
+            num_inversions += bottom_up_mergesort(values.data(), scratch.data(), values.size(), less<int>());
+            if (run_lengths.empty() && reader.line_finished())
+            {
+                //It all fit in one run, so there's nothing to merge
+                run_lengths.push_back(values.size());
+                break;
+            }
+            if (!write_values(fileno(files[0]), values.data(), values.size()))
+            {
+                cerr << "Error: Cannot write to the temporary file." << endl;
+                close_files();
+                return 1;
+            }
+            run_lengths.push_back(values.size());
+        } while (!reader.line_finished());
+    }
+
+    if (run_lengths.empty())
+    {
+        cerr << "Error: Sequence of integers not received." << endl;
+        close_files();
+        return 1;
+    }
+
+    //Merge groups of runs from one file into the other until they all fit in one merge
+    int in = 0;
+    while (run_lengths.size() > 1)
+    {
+        const bool last_merge = run_lengths.size() <= max_runs_per_merge;
+        const size_t runs_per_merge = last_merge ? run_lengths.size() : max_runs_per_merge;
+        const size_t buffer_values = max<size_t>(1, budget_bytes / sizeof(int) / (runs_per_merge + 1));
+        const int in_fd = fileno(files[in]);
+        const int out_fd = last_merge ? -1 : fileno(files[1 - in]);
+        if (out_fd >= 0 && (ftruncate(out_fd, 0) != 0 || lseek(out_fd, 0, SEEK_SET) != 0))
+        {
+            cerr << "Error: Cannot write to the temporary file." << endl;
+            close_files();
+            return 1;
+        }
+
+        vector<size_t> merged_lengths;
+        off_t offset = 0;
+        for (size_t first = 0; first < run_lengths.size(); first += runs_per_merge)
+        {
+            const vector<size_t> group(run_lengths.begin() + first,
+                                       run_lengths.begin() + min(first + runs_per_merge, run_lengths.size()));
+            if (!merge_external_runs(in_fd, offset, group, out_fd, buffer_values, num_inversions))
+            {
+                cerr << "Error: Cannot read or write the temporary files." << endl;
+                close_files();
+                return 1;
+            }
+            const size_t merged_length = accumulate(group.begin(), group.end(), (size_t)0);
+            offset += merged_length * sizeof(int);
+            merged_lengths.push_back(merged_length);
+        }
+
+        run_lengths = merged_lengths;
+        in = 1 - in;
+    }
+
+    close_files();
+    cout << "Number of inversions (external): " << inversion_count_to_string(num_inversions) << endl;
+    return 0;
+}
+
+/**
+ * Counts inversions with two nested loops, like count_inversions_slow(), but for any element type and comparator.
+ * run_self_check() checks the templated counters against it.
+ * @param values The values to count inversions for
+ * @param is_less The comparator. is_less(a, b) is true when a goes before b
+ * @return The number of inversions
+*/
+template <typename T, typename Compare>
+inversion_count_t count_inversions_nested(const vector<T> &values, Compare is_less)
+{
+    inversion_count_t num_inversions = 0;
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        for (size_t j = i + 1; j < values.size(); j++)
+        {
+            num_inversions += is_less(values[j], values[i]);
+        }
+    }
+    return num_inversions;
+}
+
+/**
+ * Checks one templated counter on arrays made by make_values() with lengths 0 to 300, against count_inversions_nested().
+ * The counter also has to leave the array sorted. Prints "<name>: ok" or the first array length that went wrong.
+ * @param name What to call the check in the output
+ * @param make_values Makes a random array of the length it's given
+ * @param counter Counts the inversions of an array (and sorts it)
+ * @param is_less The comparator the counter should be sorting with
+ * @return Whether every array passed
+*/
+template <typename T, typename MakeValues, typename Counter, typename Compare>
+bool check_counter(const string &name, MakeValues make_values, Counter counter, Compare is_less)
+{
+    for (size_t length = 0; length <= 300; length++)
+    {
+        vector<T> values = make_values(length);
+        const inversion_count_t expected = count_inversions_nested(values, is_less);
+        if (counter(values.data(), values.size()) != expected || !is_sorted(values.begin(), values.end(), is_less))
+        {
+            cout << name << ": wrong for " << length << " values" << endl;
+            return false;
+        }
+    }
+    cout << name << ": ok" << endl;
+    return true;
+}
+
+/**
+ * Checks the templated counters on element types and comparators that the int command-line paths never use.
+ * Run it with ./inversioncounter check
+ * count_inversions() gets doubles, long longs sorted biggest first with greater<>, and strings sorted by length with
+ * a lambda, which also means lots of ties. count_inversions_radix() gets 64-bit and 8-bit integers.
+ * Every array has duplicates in it, since that's where a merge that isn't stable would go wrong.
+ * @return The exit code for main()
+*/
+int run_self_check()
+{
+    mt19937 rng(385);
+    auto shortest_first = [](const string &a, const string &b) { return a.size() < b.size(); };
+
+    auto make_doubles = [&](size_t length) {
+        vector<double> values(length);
+        for (double &value : values)
+        {
+            value = (int)(rng() % 50) / 4.0 - 5;
+        }
+        return values;
+    };
+    auto make_long_longs = [&](size_t length) {
+        vector<long long> values(length);
+        for (long long &value : values)
+        {
+            value = (long long)(rng() % 100) * 100000000000LL - 5000000000000LL;
+        }
+        return values;
+    };
+    auto make_strings = [&](size_t length) {
+        vector<string> values(length);
+        for (string &value : values)
+        {
+            value = string(rng() % 8, (char)('a' + rng() % 26));
+        }
+        return values;
+    };
+    auto make_int64s = [&](size_t length) {
+        vector<int64_t> values(length);
+        for (int64_t &value : values)
+        {
+            value = (int64_t)(((uint64_t)rng() << 32) | rng()) >> (rng() % 64);
+        }
+        return values;
+    };
+    auto make_uint8s = [&](size_t length) {
+        vector<uint8_t> values(length);
+        for (uint8_t &value : values)
+        {
+            value = rng();
+        }
+        return values;
+    };
+
+    //Stop at the first one that fails
+    bool passed = check_counter<double>("count_inversions<double>", make_doubles,
+        [](double array[], size_t length) { return count_inversions(array, length); }, less<double>());
+    passed = passed && check_counter<long long>("count_inversions<long long, greater>", make_long_longs,
+        [](long long array[], size_t length) { return count_inversions(array, length, greater<long long>()); },
+        greater<long long>());
+    passed = passed && check_counter<string>("count_inversions<string, by length>", make_strings,
+        [&](string array[], size_t length) { return count_inversions(array, length, shortest_first); }, shortest_first);
+    passed = passed && check_counter<int64_t>("count_inversions_radix<int64_t>", make_int64s,
+        [](int64_t array[], size_t length) { return count_inversions_radix(array, length); }, less<int64_t>());
+    passed = passed && check_counter<uint8_t>("count_inversions_radix<uint8_t>", make_uint8s,
+        [](uint8_t array[], size_t length) { return count_inversions_radix(array, length); }, less<uint8_t>());
+
+    return passed ? 0 : 1;
+}
+
+/**
+ * Benchmarks the fast inversion counters. Run it with ./inversioncounter bench
+ * Every size gets a descending input (n down to 1, like donut.py makes, so it has the most inversions possible) and a
+ * random one. Each input is timed with count_inversions_fast(), count_inversions_bottom_up(), count_inversions_fenwick(),
+ * count_inversions_radix(), and count_inversions_parallel() with 1, 2, 4, ... threads up to the number of hardware threads.
+ * The speedups are relative to count_inversions_fast(), and every count is checked against it.
+ * @return The exit code for main()
+*/
+int run_benchmark()
+{
+    const int max_threads = max(1u, thread::hardware_concurrency());
+    vector<int> thread_counts;
+    for (int t = 1; t < max_threads; t *= 2)
+    {
+        thread_counts.push_back(t);
+    }
+    thread_counts.push_back(max_threads);
+
+    //Every counter we time and what to call it. The first one is the baseline.
+    vector<pair<string, function<long(int[], int)>>> engines = {
+        {"fast", count_inversions_fast},
+        {"bottom-up", count_inversions_bottom_up},
+        {"fenwick", count_inversions_fenwick},
+        {"radix", [](int array[], int length) { return (long)count_inversions_radix(array, length); }},
+    };
+    for (int t : thread_counts)
+    {
+        engines.push_back({"parallel x" + to_string(t), [t](int array[], int length) {
+            return count_inversions_parallel(array, length, t);
+        }});
+    }
+
+    cout << setw(10) << "n" << setw(12) << "input" << setw(14) << "engine" << setw(12) << "time (s)" << setw(10) << "speedup" << endl;
+    cout << fixed << setprecision(3);
+
+    mt19937 rng(385);
+    for (int n : {1000000, 10000000, 100000000})
+    {
+        for (const string input : {"descending", "random"})
+        {
+            vector<int> original(n);
+            for (int i = 0; i < n; i++)
+            {
+                original[i] = input == "descending" ? n - i : (int)rng();
+            }
+
+            long expected = 0;
+            double baseline_time = 0;
+            for (size_t e = 0; e < engines.size(); e++)
+            {
+                vector<int> values = original;
+                auto start = chrono::steady_clock::now();
+                long result = engines[e].second(&values[0], n);
+                double time = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+                if (e == 0)
+                {
+                    expected = result;
+                    baseline_time = time;
+                }
+                else if (result != expected)
+                {
+                    cerr << "Error: " << engines[e].first << " counted " << result << " inversions instead of " << expected << "." << endl;
+                    return 1;
+                }
+                cout << setw(10) << n << setw(12) << input << setw(14) << engines[e].first << setw(12) << time
+                     << setw(9) << baseline_time / time << "x" << endl;
+            }
+        }
+    }
+
+    return 0;
+}
+
 int main(int argc, char *argv[]) {
     // Parse command-line argument
-    //If there's too many (or too few) arguments
-    if (argc < 0 || argc > 2)
+    //If there's too many (or too few) arguments. "window" needs a second one, and "external" and "parallel" can have one.
+    const bool window_option = argc >= 2 && strcmp(argv[1], "window") == 0;
+    const bool external_option = argc >= 2 && strcmp(argv[1], "external") == 0;
+    const bool parallel_option = argc >= 2 && strcmp(argv[1], "parallel") == 0;
+    if (argc < 0 || argc > 3 || (window_option && argc != 3) ||
+        (argc == 3 && !window_option && !external_option && !parallel_option))
     {
-        cerr << "Usage: ./inversioncounter [slow]" << endl;
+        cerr << "Usage: ./inversioncounter [slow | parallel [threads] | bottomup | fenwick | prefix | window <size> | radix |"
+                " external [MB] | check | bench]" << endl;
         return 1;
     }
 
@@ -172,67 +1301,155 @@ int main(int argc, char *argv[]) {
     //I got an error when using != because it says "comparison with string literal results in unspecified behavior"
     //I took the solution from https://stackoverflow.com/questions/2603039/warning-comparison-with-string-literals-results-in-unspecified-behaviour
     //and decided to use strcmp()
-    if (argc == 2 && strcmp(argv[1], "slow") != 0)
+    //"parallel [threads]" runs the multithreaded merge sort (on every core by default), and "bench" times the fast counters instead of reading any input.
+    //"fenwick" counts with a Fenwick tree, and "prefix" and "window <size>" print the count for every prefix or window.
+    //"radix" counts with the MSD binary radix sort, and "external [MB]" counts input too big for memory in that many MB.
+    //"check" tests the templated counters on other element types and comparators instead of reading any input.
+    //"bottomup" runs the bottom-up merge sort instead of the recursive one.
+    const char *options[] = {"slow", "parallel", "bench", "fenwick", "prefix", "window", "radix", "external", "check",
+                             "bottomup"};
+    if (argc >= 2 && none_of(begin(options), end(options), [&](const char *option) { return strcmp(argv[1], option) == 0; }))
     {
         cerr << "Error: Unrecognized option '" << argv[1] << "'." << endl;
         return 1;
     }
 
+    int window_size = 0;
+    if (window_option)
+    {
+        istringstream window_iss(argv[2]);
+        if (!(window_iss >> window_size) || window_size < 1)
+        {
+            cerr << "Error: Invalid window size '" << argv[2] << "'." << endl;
+            return 1;
+        }
+    }
+
+    int num_threads = thread::hardware_concurrency();
+    if (parallel_option && argc == 3)
+    {
+        istringstream threads_iss(argv[2]);
+        if (!(threads_iss >> num_threads) || num_threads < 1)
+        {
+            cerr << "Error: Invalid thread count '" << argv[2] << "'." << endl;
+            return 1;
+        }
+    }
+
+    size_t budget_mb = EXTERNAL_DEFAULT_BUDGET_MB;
+    if (external_option && argc == 3)
+    {
+        istringstream budget_iss(argv[2]);
+        long budget;
+        if (!(budget_iss >> budget) || budget < 1 || (size_t)budget > (numeric_limits<size_t>::max() >> 20))
+        {
+            cerr << "Error: Invalid memory budget '" << argv[2] << "'." << endl;
+            return 1;
+        }
+        budget_mb = budget;
+    }
+
+    if (argc == 2 && strcmp(argv[1], "bench") == 0)
+    {
+        return run_benchmark();
+    }
+
+    if (argc == 2 && strcmp(argv[1], "check") == 0)
+    {
+        return run_self_check();
+    }
+
     cout << "Enter sequence of integers, each followed by a space: " << flush;
 
-    istringstream iss;
-    int value, index = 0;
+    //Read the first line of integers. IntLineReader reads stdin in big blocks instead of one getchar() at a time.
+    //"external" reads it a piece at a time instead, since the whole line won't fit.
+    IntLineReader reader;
+    if (external_option)
+    {
+        return run_external(reader, budget_mb << 20);
+    }
+
     vector<int> values;
-    string str;
-    str.reserve(11);
-    char c;
-    while (true) {
-        c = getchar();
-        const bool eoln = c == '\r' || c == '\n';
-        if (isspace(c) || eoln) {
-            if (str.length() > 0) {
-                iss.str(str);
-                if (iss >> value) {
-                    values.push_back(value);
-                } else {
-                    cerr << "Error: Non-integer value '" << str
-                         << "' received at index " << index << "." << endl;
-                    return 1;
-                }
-                iss.clear();
-                ++index;
-            }
-            if (eoln) {
-                break;
-            }
-            str.clear();
-        } else {
-            str += c;
-        }
+    string bad_token;
+    size_t bad_index;
+    if (!reader.read_line(values, bad_token, bad_index)) {
+        cerr << "Error: Non-integer value '" << bad_token
+             << "' received at index " << bad_index << "." << endl;
+        return 1;
     }
     
     
     //ERROR CHECKING-------------------------------------
     //Check if we actually have a sequence of integers
-    int arr_len = values.size();
+    const size_t arr_len = values.size();
     if (arr_len == 0)
     {
         cerr << "Error: Sequence of integers not received." << endl;
         return 1;
     }
 
-    //This produces output. It runs fast inversion counter if there's no arguments, or slow inversion if specified
+    //The default counter and "radix" take size_t lengths. The others still index with ints.
+    const bool int_lengths = argc >= 2 && strcmp(argv[1], "radix") != 0;
+    if (int_lengths && arr_len > (size_t)numeric_limits<int>::max())
+    {
+        cerr << "Error: '" << argv[1] << "' can't count more than " << numeric_limits<int>::max() << " values." << endl;
+        return 1;
+    }
+
+    //This produces output. It runs the templated counter (bottom-up merge sort, size_t lengths, 128-bit count) if
+    //there's no arguments, or slow inversion if specified
 
     long numInversions = 0;
     if (argc == 2 && strcmp(argv[1], "slow") == 0) // Run slow inversion
     {
-        numInversions = count_inversions_slow(&values[0], arr_len);
+        numInversions = count_inversions_slow(&values[0], (int)arr_len);
         cout << "Number of inversions (slow): " << numInversions << endl;
     }
+    else if (parallel_option) // Run fast inversion on num_threads threads
+    {
+        numInversions = count_inversions_parallel(&values[0], (int)arr_len, num_threads);
+        cout << "Number of inversions (parallel): " << numInversions << endl;
+    }
+    else if (argc == 2 && strcmp(argv[1], "bottomup") == 0) // Run the bottom-up merge sort
+    {
+        numInversions = count_inversions_bottom_up(&values[0], (int)arr_len);
+        cout << "Number of inversions (bottomup): " << numInversions << endl;
+    }
+    else if (argc == 2 && strcmp(argv[1], "fenwick") == 0) // Run the Fenwick tree counter
+    {
+        numInversions = count_inversions_fenwick(&values[0], (int)arr_len);
+        cout << "Number of inversions (fenwick): " << numInversions << endl;
+    }
+    else if (argc == 2 && strcmp(argv[1], "radix") == 0) // Run the radix counter
+    {
+        cout << "Number of inversions (radix): " << inversion_count_to_string(count_inversions_radix(&values[0], arr_len)) << endl;
+    }
+    else if (argc == 2 && strcmp(argv[1], "prefix") == 0) // Count every prefix
+    {
+        cout << "Number of inversions in each prefix:";
+        for (long count : count_prefix_inversions(&values[0], (int)arr_len))
+        {
+            cout << " " << count;
+        }
+        cout << endl;
+    }
+    else if (window_option) // Count every window
+    {
+        if ((size_t)window_size > arr_len)
+        {
+            cerr << "Error: Window size " << window_size << " is larger than the " << arr_len << " values received." << endl;
+            return 1;
+        }
+        cout << "Number of inversions in each window of " << window_size << ":";
+        for (long count : count_window_inversions(&values[0], (int)arr_len, window_size))
+        {
+            cout << " " << count;
+        }
+        cout << endl;
+    }
     else                //Run fast inversion
     {
-        numInversions = count_inversions_fast(&values[0], arr_len);
-        cout << "Number of inversions (fast): " << numInversions << endl;
+        cout << "Number of inversions (fast): " << inversion_count_to_string(count_inversions(&values[0], arr_len)) << endl;
     }
 
     return 0;
@@ -143,7 +143,7 @@ run_test_with_input() {
 # TODO - Make sure your C++ code can handle these cases.
 run_test_with_args_and_input "" "x 1 2 3" "Enter sequence of integers, each followed by a space: Error: Non-integer value 'x' received at index 0."
 run_test_with_args_and_input "" "1 2 x 3" "Enter sequence of integers, each followed by a space: Error: Non-integer value 'x' received at index 2."
-run_test_with_args_and_input "lots of args" "" "Usage: ./inversioncounter [slow]"
+run_test_with_args_and_input "lots of args" "" "Usage: ./inversioncounter [slow | parallel [threads] | bottomup | fenwick | prefix | window <size> | radix | external [MB] | check | bench]"
 run_test_with_args_and_input "average" "" "Error: Unrecognized option 'average'."
 run_test_with_args_and_input "" "" "Enter sequence of integers, each followed by a space: Error: Sequence of integers not received."
 run_test_with_args_and_input "" "  " "Enter sequence of integers, each followed by a space: Error: Sequence of integers not received."
@@ -187,6 +187,76 @@ run_test_with_args_and_input "" "5 4 3 2 1" "Enter sequence of integers, each fo
 run_test_with_args_and_input "" "100000 99999 99998 99997 99996 99995 99994 99993 99992 99991 99990 99989 99988 99987 99986 99985 99984 99983 99982 99981 99980 99979 99978 99977 99976 99975 99974 99973 99972 99971 99970 99969 99968 99967 99966 99965 99964 99963 99962 99961 99960 99959 99958 99957 99956 99955 99954 99953 99952 99951 99950 99949 99948 99947 99946 99945 99944 99943 99942 99941 99940 99939 99938 99937 99936 99935 99934 99933 99932 99931 99930 99929 99928 99927 99926 99925 99924 99923 99922 99921 99920 99919 99918 99917 99916 99915 99914 99913 99912 99911 99910 99909 99908 99907 99906 99905 99904 99903 99902 99901 99900 99899 99898 99897 99896 99895 99894 99893 99892 99891 99890 99889 99888 99887 99886 99885 99884 99883 99882 99881 99880 99879 99878 99877 99876 99875 99874 99873 99872 99871 99870 99869 99868 99867 99866 99865 99864 99863 99862 99861 99860 99859 99858 99857 99856 99855 99854 99853 99852 99851 99850 99849 99848 99847 99846 99845 99844 99843 99842 99841 99840 99839 99838 99837 99836 99835 99834 99833 99832 99831 99830 99829 99828 99827 99826 99825 99824 99823 99822 99821 99820 99819 99818 99817 99816 99815 99814 99813 99812 99811 99810 99809 99808 99807 99806 99805 99804 99803 99802 99801 99800 99799 99798 99797 99796 99795 99794 99793 99792 99791 99790 99789 99788 99787 99786 99785 99784 99783 99782 99781 99780 99779 99778 99777 99776 99775 99774 99773 99772 99771 99770 99769 99768 99767 99766 99765 99764 99763 99762 99761 99760 99759 99758 99757 99756 99755 99754 99753 99752 99751 99750 99749 99748 99747 99746 99745 99744 99743 99742 99741 99740 99739 99738 99737 99736 99735 99734 99733 99732 99731 99730 99729 99728 99727 99726 99725 99724 99723 99722 99721 99720 99719 99718 99717 99716 99715 99714 99713 99712 99711 99710 99709 99708 99707 99706 99705 99704 99703 99702 99701 99700 99699 99698 99697 99696 99695 99694 99693 99692 99691 99690 99689 99688 99687 99686 99685 99684 99683 99682 99681 99680 99679 99678 99677 99676 99675 99674 99673 99672 99671 99670 99669 99668 99667 99666 99665 99664 99663 99662 99661 99660 99659 99658 99657 99656 99655 99654 99653 99652 99651 99650 99649 99648 99647 99646 99645 99644 99643 99642 99641 99640 99639 99638 99637 99636 99635 99634 99633 99632 99631 99630 99629 99628 99627 99626 99625 99624 99623 99622 99621 99620 99619 99618 99617 99616 99615 99614 99613 99612 99611 99610 99609 99608 99607 99606 99605 99604 99603 99602 99601 99600 99599 99598 99597 99596 99595 99594 99593 99592 99591 99590 99589 99588 99587 99586 99585 99584 99583 99582 99581 99580 99579 99578 99577 99576 99575 99574 99573 99572 99571 99570 99569 99568 99567 99566 99565 99564 99563 99562 99561 99560 99559 99558 99557 99556 99555 99554 99553 99552 99551 99550 99549 99548 99547 99546 99545 99544 99543 99542 99541 99540 99539 99538 99537 99536 99535 99534 99533 99532 99531 99530 99529 99528 99527 99526 99525 99524 99523 99522 99521 99520 99519 99518 99517 99516 99515 99514 99513 99512 99511 99510 99509 99508 99507 99506 99505 99504 99503 99502 99501 99500 99499 99498 99497 99496 99495 99494 99493 99492 99491 99490 99489 99488 99487 99486 99485 99484 99483 99482 99481 99480 99479 99478 99477 99476 99475 99474 99473 99472 99471 99470 99469 99468 99467 99466 99465 99464 99463 99462 99461 99460 99459 99458 99457 99456 99455 99454 99453 99452 99451 99450 99449 99448 99447 99446 99445 99444 99443 99442 99441 99440 99439 99438 99437 99436 99435 99434 99433 99432 99431 99430 99429 99428 99427 99426 99425 99424 99423 99422 99421 99420 99419 99418 99417 99416 99415 99414 99413 99412 99411 99410 99409 99408 99407 99406 99405 99404 99403 99402 99401 99400 99399 99398 99397 99396 99395 99394 99393 99392 99391 99390 99389 99388 99387 99386 99385 99384 99383 99382 99381 99380 99379 99378 99377 99376 99375 99374 99373 99372 99371 99370 99369 99368 99367 99366 99365 99364 99363 99362 99361 99360 99359 99358 99357 99356 99355 99354 99353 99352 99351 99350 99349 99348 99347 99346 99345 99344 99343 99342 99341 99340 99339 99338 99337 99336 99335 99334 99333 99332 99331 99330 99329 99328 99327 99326 99325 99324 99323 99322 99321 99320 99319 99318 99317 99316 99315 99314 99313 99312 99311 99310 99309 99308 99307 99306 99305 99304 99303 99302 99301 99300 99299 99298 99297 99296 99295 99294 99293 99292 99291 99290 99289 99288 99287 99286 99285 99284 99283 99282 99281 99280 99279 99278 99277 99276 99275 99274 99273 99272 99271 99270 99269 99268 99267 99266 99265 99264 99263 99262 99261 99260 99259 99258 99257 99256 99255 99254 99253 99252 99251 99250 99249 99248 99247 99246 99245 99244 99243 99242 99241 99240 99239 99238 99237 99236 99235 99234 99233 99232 99231 99230 99229 99228 99227 99226 99225 99224 99223 99222 99221 99220 99219 99218 99217 99216 99215 99214 99213 99212 99211 99210 99209 99208 99207 99206 99205 99204 99203 99202 99201 99200 99199 99198 99197 99196 99195 99194 99193 99192 99191 99190 99189 99188 99187 99186 99185 99184 99183 99182 99181 99180 99179 99178 99177 99176 99175 99174 99173 99172 99171 99170 99169 99168 99167 99166 99165 99164 99163 99162 99161 99160 99159 99158 99157 99156 99155 99154 99153 99152 99151 99150 99149 99148 99147 99146 99145 99144 99143 99142 99141 99140 99139 99138 99137 99136 99135 99134 99133 99132 99131 99130 99129 99128 99127 99126 99125 99124 99123 99122 99121 99120 99119 99118 99117 99116 99115 99114 99113 99112 99111 99110 99109 99108 99107 99106 99105 99104 99103 99102 99101 99100 99099 99098 99097 99096 99095 99094 99093 99092 99091 99090 99089 99088 99087 99086 99085 99084 99083 99082 99081 99080 99079 99078 99077 99076 99075 99074 99073 99072 99071 99070 99069 99068 99067 99066 99065 99064 99063 99062 99061 99060 99059 99058 99057 99056 99055 99054 99053 99052 99051 99050 99049 99048 99047 99046 99045 99044 99043 99042 99041 99040 99039 99038 99037 99036 99035 99034 99033 99032 99031 99030 99029 99028 99027 99026 99025 99024 99023 99022 99021 99020 99019 99018 99017 99016 99015 99014 99013 99012 99011 99010 99009 99008 99007 99006 99005 99004 99003 99002 99001 99000 98999 98998 98997 98996 98995 98994 98993 98992 98991 98990 98989 98988 98987 98986 98985 98984 98983 98982 98981 98980 98979 98978 98977 98976 98975 98974 98973 98972 98971 98970 98969 98968 98967 98966 98965 98964 98963 98962 98961 98960 98959 98958 98957 98956 98955 98954 98953 98952 98951 98950 98949 98948 98947 98946 98945 98944 98943 98942 98941 98940 98939 98938 98937 98936 98935 98934 98933 98932 98931 98930 98929 98928 98927 98926 98925 98924 98923 98922 98921 98920 98919 98918 98917 98916 98915 98914 98913 98912 98911 98910 98909 98908 98907 98906 98905 98904 98903 98902 98901 98900 98899 98898 98897 98896 98895 98894 98893 98892 98891 98890 98889 98888 98887 98886 98885 98884 98883 98882 98881 98880 98879 98878 98877 98876 98875 98874 98873 98872 98871 98870 98869 98868 98867 98866 98865 98864 98863 98862 98861 98860 98859 98858 98857 98856 98855 98854 98853 98852 98851 98850 98849 98848 98847 98846 98845 98844 98843 98842 98841 98840 98839 98838 98837 98836 98835 98834 98833 98832 98831 98830 98829 98828 98827 98826 98825 98824 98823 98822 98821 98820 98819 98818 98817 98816 98815 98814 98813 98812 98811 98810 98809 98808 98807 98806 98805 98804 98803 98802 98801 98800 98799 98798 98797 98796 98795 98794 98793 98792 98791 98790 98789 98788 98787 98786 98785 98784 98783 98782 98781 98780 98779 98778 98777 98776 98775 98774 98773 98772 98771 98770 98769 98768 98767 98766 98765 98764 98763 98762 98761 98760 98759 98758 98757 98756 98755 98754 98753 98752 98751 98750 98749 98748 98747 98746 98745 98744 98743 98742 98741 98740 98739 98738 98737 98736 98735 98734 98733 98732 98731 98730 98729 98728 98727 98726 98725 98724 98723 98722 98721 98720 98719 98718 98717 98716 98715 98714 98713 98712 98711 98710 98709 98708 98707 98706 98705 98704 98703 98702 98701 98700 98699 98698 98697 98696 98695 98694 98693 98692 98691 98690 98689 98688 98687 98686 98685 98684 98683 98682 98681 98680 98679 98678 98677 98676 98675 98674 98673 98672 98671 98670 98669 98668 98667 98666 98665 98664 98663 98662 98661 98660 98659 98658 98657 98656 98655 98654 98653 98652 98651 98650 98649 98648 98647 98646 98645 98644 98643 98642 98641 98640 98639 98638 98637 98636 98635 98634 98633 98632 98631 98630 98629 98628 98627 98626 98625 98624 98623 98622 98621 98620 98619 98618 98617 98616 98615 98614 98613 98612 98611 98610 98609 98608 98607 98606 98605 98604 98603 98602 98601 98600 98599 98598 98597 98596 98595 98594 98593 98592 98591 98590 98589 98588 98587 98586 98585 98584 98583 98582 98581 98580 98579 98578 98577 98576 98575 98574 98573 98572 98571 98570 98569 98568 98567 98566 98565 98564 98563 98562 98561 98560 98559 98558 98557 98556 98555 98554 98553 98552 98551 98550 98549 98548 98547 98546 98545 98544 98543 98542 98541 98540 98539 98538 98537 98536 98535 98534 98533 98532 98531 98530 98529 98528 98527 98526 98525 98524 98523 98522 98521 98520 98519 98518 98517 98516 98515 98514 98513 98512 98511 98510 98509 98508 98507 98506 98505 98504 98503 98502 98501 98500 98499 98498 98497 98496 98495 98494 98493 98492 98491 98490 98489 98488 98487 98486 98485 98484 98483 98482 98481 98480 98479 98478 98477 98476 98475 98474 98473 98472 98471 98470 98469 98468 98467 98466 98465 98464 98463 98462 98461 98460 98459 98458 98457 98456 98455 98454 98453 98452 98451 98450 98449 98448 98447 98446 98445 98444 98443 98442 98441 98440 98439 98438 98437 98436 98435 98434 98433 98432 98431 98430 98429 98428 98427 98426 98425 98424 98423 98422 98421 98420 98419 98418 98417 98416 98415 98414 98413 98412 98411 98410 98409 98408 98407 98406 98405 98404 98403 98402 98401 98400 98399 98398 98397 98396 98395 98394 98393 98392 98391 98390 98389 98388 98387 98386 98385 98384 98383 98382 98381 98380 98379 98378 98377 98376 98375 98374 98373 98372 98371 98370 98369 98368 98367 98366 98365 98364 98363 98362 98361 98360 98359 98358 98357 98356 98355 98354 98353 98352 98351 98350 98349 98348 98347 98346 98345 98344 98343 98342 98341 98340 98339 98338 98337 98336 98335 98334 98333 98332 98331 98330 98329 98328 98327 98326 98325 98324 98323 98322 98321 98320 98319 98318 98317 98316 98315 98314 98313 98312 98311 98310 98309 98308 98307 98306 98305 98304 98303 98302 98301 98300 98299 98298 98297 98296 98295 98294 98293 98292 98291 98290 98289 98288 98287 98286 98285 98284 98283 98282 98281 98280 98279 98278 98277 98276 98275 98274 98273 98272 98271 98270 98269 98268 98267 98266 98265 98264 98263 98262 98261 98260 98259 98258 98257 98256 98255 98254 98253 98252 98251 98250 98249 98248 98247 98246 98245 98244 98243 98242 98241 98240 98239 98238 98237 98236 98235 98234 98233 98232 98231 98230 98229 98228 98227 98226 98225 98224 98223 98222 98221 98220 98219 98218 98217 98216 98215 98214 98213 98212 98211 98210 98209 98208 98207 98206 98205 98204 98203 98202 98201 98200 98199 98198 98197 98196 98195 98194 98193 98192 98191 98190 98189 98188 98187 98186 98185 98184 98183 98182 98181 98180 98179 98178 98177 98176 98175 98174 98173 98172 98171 98170 98169 98168 98167 98166 98165 98164 98163 98162 98161 98160 98159 98158 98157 98156 98155 98154 98153 98152 98151 98150 98149 98148 98147 98146 98145 98144 98143 98142 98141 98140 98139 98138 98137 98136 98135 98134 98133 98132 98131 98130 98129 98128 98127 98126 98125 98124 98123 98122 98121 98120 98119 98118 98117 98116 98115 98114 98113 98112 98111 98110 98109 98108 98107 98106 98105 98104 98103 98102 98101 98100 98099 98098 98097 98096 98095 98094 98093 98092 98091 98090 98089 98088 98087 98086 98085 98084 98083 98082 98081 98080 98079 98078 98077 98076 98075 98074 98073 98072 98071 98070 98069 98068 98067 98066 98065 98064 98063 98062 98061 98060 98059 98058 98057 98056 98055 98054 98053 98052 98051 98050 98049 98048 98047 98046 98045 98044 98043 98042 98041 98040 98039 98038 98037 98036 98035 98034 98033 98032 98031 98030 98029 98028 98027 98026 98025 98024 98023 98022 98021 98020 98019 98018 98017 98016 98015 98014 98013 98012 98011 98010 98009 98008 98007 98006 98005 98004 98003 98002 98001 98000 97999 97998 97997 97996 97995 97994 97993 97992 97991 97990 97989 97988 97987 97986 97985 97984 97983 97982 97981 97980 97979 97978 97977 97976 97975 97974 97973 97972 97971 97970 97969 97968 97967 97966 97965 97964 97963 97962 97961 97960 97959 97958 97957 97956 97955 97954 97953 97952 97951 97950 97949 97948 97947 97946 97945 97944 97943 97942 97941 97940 97939 97938 97937 97936 97935 97934 97933 97932 97931 97930 97929 97928 97927 97926 97925 97924 97923 97922 97921 97920 97919 97918 97917 97916 97915 97914 97913 97912 97911 97910 97909 97908 97907 97906 97905 97904 97903 97902 97901 97900 97899 97898 97897 97896 97895 97894 97893 97892 97891 97890 97889 97888 97887 97886 97885 97884 97883 97882 97881 97880 97879 97878 97877 97876 97875 97874 97873 97872 97871 97870 97869 97868 97867 97866 97865 97864 97863 97862 97861 97860 97859 97858 97857 97856 97855 97854 97853 97852 97851 97850 97849 97848 97847 97846 97845 97844 97843 97842 97841 97840 97839 97838 97837 97836 97835 97834 97833 97832 97831 97830 97829 97828 97827 97826 97825 97824 97823 97822 97821 97820 97819 97818 97817 97816 97815 97814 97813 97812 97811 97810 97809 97808 97807 97806 97805 97804 97803 97802 97801 97800 97799 97798 97797 97796 97795 97794 97793 97792 97791 97790 97789 97788 97787 97786 97785 97784 97783 97782 97781 97780 97779 97778 97777 97776 97775 97774 97773 97772 97771 97770 97769 97768 97767 97766 97765 97764 97763 97762 97761 97760 97759 97758 97757 97756 97755 97754 97753 97752 97751 97750 97749 97748 97747 97746 97745 97744 97743 97742 97741 97740 97739 97738 97737 97736 97735 97734 97733 97732 97731 97730 97729 97728 97727 97726 97725 97724 97723 97722 97721 97720 97719 97718 97717 97716 97715 97714 97713 97712 97711 97710 97709 97708 97707 97706 97705 97704 97703 97702 97701 97700 97699 97698 97697 97696 97695 97694 97693 97692 97691 97690 97689 97688 97687 97686 97685 97684 97683 97682 97681 97680 97679 97678 97677 97676 97675 97674 97673 97672 97671 97670 97669 97668 97667 97666 97665 97664 97663 97662 97661 97660 97659 97658 97657 97656 97655 97654 97653 97652 97651 97650 97649 97648 97647 97646 97645 97644 97643 97642 97641 97640 97639 97638 97637 97636 97635 97634 97633 97632 97631 97630 97629 97628 97627 97626 97625 97624 97623 97622 97621 97620 97619 97618 97617 97616 97615 97614 97613 97612 97611 97610 97609 97608 97607 97606 97605 97604 97603 97602 97601 97600 97599 97598 97597 97596 97595 97594 97593 97592 97591 97590 97589 97588 97587 97586 97585 97584 97583 97582 97581 97580 97579 97578 97577 97576 97575 97574 97573 97572 97571 97570 97569 97568 97567 97566 97565 97564 97563 97562 97561 97560 97559 97558 97557 97556 97555 97554 97553 97552 97551 97550 97549 97548 97547 97546 97545 97544 97543 97542 97541 97540 97539 97538 97537 97536 97535 97534 97533 97532 97531 97530 97529 97528 97527 97526 97525 97524 97523 97522 97521 97520 97519 97518 97517 97516 97515 97514 97513 97512 97511 97510 97509 97508 97507 97506 97505 97504 97503 97502 97501 97500 97499 97498 97497 97496 97495 97494 97493 97492 97491 97490 97489 97488 97487 97486 97485 97484 97483 97482 97481 97480 97479 97478 97477 97476 97475 97474 97473 97472 97471 97470 97469 97468 97467 97466 97465 97464 97463 97462 97461 97460 97459 97458 97457 97456 97455 97454 97453 97452 97451 97450 97449 97448 97447 97446 97445 97444 97443 97442 97441 97440 97439 97438 97437 97436 97435 97434 97433 97432 97431 97430 97429 97428 97427 97426 97425 97424 97423 97422 97421 97420 97419 97418 97417 97416 97415 97414 97413 97412 97411 97410 97409 97408 97407 97406 97405 97404 97403 97402 97401 97400 97399 97398 97397 97396 97395 97394 97393 97392 97391 97390 97389 97388 97387 97386 97385 97384 97383 97382 97381 97380 97379 97378 97377 97376 97375 97374 97373 97372 97371 97370 97369 97368 97367 97366 97365 97364 97363 97362 97361 97360 97359 97358 97357 97356 97355 97354 97353 97352 97351 97350 97349 97348 97347 97346 97345 97344 97343 97342 97341 97340 97339 97338 97337 97336 97335 97334 97333 97332 97331 97330 97329 97328 97327 97326 97325 97324 97323 97322 97321 97320 97319 97318 97317 97316 97315 97314 97313 97312 97311 97310 97309 97308 97307 97306 97305 97304 97303 97302 97301 97300 97299 97298 97297 97296 97295 97294 97293 97292 97291 97290 97289 97288 97287 97286 97285 97284 97283 97282 97281 97280 97279 97278 97277 97276 97275 97274 97273 97272 97271 97270 97269 97268 97267 97266 97265 97264 97263 97262 97261 97260 97259 97258 97257 97256 97255 97254 97253 97252 97251 97250 97249 97248 97247 97246 97245 97244 97243 97242 97241 97240 97239 97238 97237 97236 97235 97234 97233 97232 97231 97230 97229 97228 97227 97226 97225 97224 97223 97222 97221 97220 97219 97218 97217 97216 97215 97214 97213 97212 97211 97210 97209 97208 97207 97206 97205 97204 97203 97202 97201 97200 97199 97198 97197 97196 97195 97194 97193 97192 97191 97190 97189 97188 97187 97186 97185 97184 97183 97182 97181 97180 97179 97178 97177 97176 97175 97174 97173 97172 97171 97170 97169 97168 97167 97166 97165 97164 97163 97162 97161 97160 97159 97158 97157 97156 97155 97154 97153 97152 97151 97150 97149 97148 97147 97146 97145 97144 97143 97142 97141 97140 97139 97138 97137 97136 97135 97134 97133 97132 97131 97130 97129 97128 97127 97126 97125 97124 97123 97122 97121 97120 97119 97118 97117 97116 97115 97114 97113 97112 97111 97110 97109 97108 97107 97106 97105 97104 97103 97102 97101 97100 97099 97098 97097 97096 97095 97094 97093 97092 97091 97090 97089 97088 97087 97086 97085 97084 97083 97082 97081 97080 97079 97078 97077 97076 97075 97074 97073 97072 97071 97070 97069 97068 97067 97066 97065 97064 97063 97062 97061 97060 97059 97058 97057 97056 97055 97054 97053 97052 97051 97050 97049 97048 97047 97046 97045 97044 97043 97042 97041 97040 97039 97038 97037 97036 97035 97034 97033 97032 97031 97030 97029 97028 97027 97026 97025 97024 97023 97022 97021 97020 97019 97018 97017 97016 97015 97014 97013 97012 97011 97010 97009 97008 97007 97006 97005 97004 97003 97002 97001 97000 96999 96998 96997 96996 96995 96994 96993 96992 96991 96990 96989 96988 96987 96986 96985 96984 96983 96982 96981 96980 96979 96978 96977 96976 96975 96974 96973 96972 96971 96970 96969 96968 96967 96966 96965 96964 96963 96962 96961 96960 96959 96958 96957 96956 96955 96954 96953 96952 96951 96950 96949 96948 96947 96946 96945 96944 96943 96942 96941 96940 96939 96938 96937 96936 96935 96934 96933 96932 96931 96930 96929 96928 96927 96926 96925 96924 96923 96922 96921 96920 96919 96918 96917 96916 96915 96914 96913 96912 96911 96910 96909 96908 96907 96906 96905 96904 96903 96902 96901 96900 96899 96898 96897 96896 96895 96894 96893 96892 96891 96890 96889 96888 96887 96886 96885 96884 96883 96882 96881 96880 96879 96878 96877 96876 96875 96874 96873 96872 96871 96870 96869 96868 96867 96866 96865 96864 96863 96862 96861 96860 96859 96858 96857 96856 96855 96854 96853 96852 96851 96850 96849 96848 96847 96846 96845 96844 96843 96842 96841 96840 96839 96838 96837 96836 96835 96834 96833 96832 96831 96830 96829 96828 96827 96826 96825 96824 96823 96822 96821 96820 96819 96818 96817 96816 96815 96814 96813 96812 96811 96810 96809 96808 96807 96806 96805 96804 96803 96802 96801 96800 96799 96798 96797 96796 96795 96794 96793 96792 96791 96790 96789 96788 96787 96786 96785 96784 96783 96782 96781 96780 96779 96778 96777 96776 96775 96774 96773 96772 96771 96770 96769 96768 96767 96766 96765 96764 96763 96762 96761 96760 96759 96758 96757 96756 96755 96754 96753 96752 96751 96750 96749 96748 96747 96746 96745 96744 96743 96742 96741 96740 96739 96738 96737 96736 96735 96734 96733 96732 96731 96730 96729 96728 96727 96726 96725 96724 96723 96722 96721 96720 96719 96718 96717 96716 96715 96714 96713 96712 96711 96710 96709 96708 96707 96706 96705 96704 96703 96702 96701 96700 96699 96698 96697 96696 96695 96694 96693 96692 96691 96690 96689 96688 96687 96686 96685 96684 96683 96682 96681 96680 96679 96678 96677 96676 96675 96674 96673 96672 96671 96670 96669 96668 96667 96666 96665 96664 96663 96662 96661 96660 96659 96658 96657 96656 96655 96654 96653 96652 96651 96650 96649 96648 96647 96646 96645 96644 96643 96642 96641 96640 96639 96638 96637 96636 96635 96634 96633 96632 96631 96630 96629 96628 96627 96626 96625 96624 96623 96622 96621 96620 96619 96618 96617 96616 96615 96614 96613 96612 96611 96610 96609 96608 96607 96606 96605 96604 96603 96602 96601 96600 96599 96598 96597 96596 96595 96594 96593 96592 96591 96590 96589 96588 96587 96586 96585 96584 96583 96582 96581 96580 96579 96578 96577 96576 96575 96574 96573 96572 96571 96570 96569 96568 96567 96566 96565 96564 96563 96562 96561 96560 96559 96558 96557 96556 96555 96554 96553 96552 96551 96550 96549 96548 96547 96546 96545 96544 96543 96542 96541 96540 96539 96538 96537 96536 96535 96534 96533 96532 96531 96530 96529 96528 96527 96526 96525 96524 96523 96522 96521 96520 96519 96518 96517 96516 96515 96514 96513 96512 96511 96510 96509 96508 96507 96506 96505 96504 96503 96502 96501 96500 96499 96498 96497 96496 96495 96494 96493 96492 96491 96490 96489 96488 96487 96486 96485 96484 96483 96482 96481 96480 96479 96478 96477 96476 96475 96474 96473 96472 96471 96470 96469 96468 96467 96466 96465 96464 96463 96462 96461 96460 96459 96458 96457 96456 96455 96454 96453 96452 96451 96450 96449 96448 96447 96446 96445 96444 96443 96442 96441 96440 96439 96438 96437 96436 96435 96434 96433 96432 96431 96430 96429 96428 96427 96426 96425 96424 96423 96422 96421 96420 96419 96418 96417 96416 96415 96414 96413 96412 96411 96410 96409 96408 96407 96406 96405 96404 96403 96402 96401 96400 96399 96398 96397 96396 96395 96394 96393 96392 96391 96390 96389 96388 96387 96386 96385 96384 96383 96382 96381 96380 96379 96378 96377 96376 96375 96374 96373 96372 96371 96370 96369 96368 96367 96366 96365 96364 96363 96362 96361 96360 96359 96358 96357 96356 96355 96354 96353 96352 96351 96350 96349 96348 96347 96346 96345 96344 96343 96342 96341 96340 96339 96338 96337 96336 96335 96334 96333 96332 96331 96330 96329 96328 96327 96326 96325 96324 96323 96322 96321 96320 96319 96318 96317 96316 96315 96314 96313 96312 96311 96310 96309 96308 96307 96306 96305 96304 96303 96302 96301 96300 96299 96298 96297 96296 96295 96294 96293 96292 96291 96290 96289 96288 96287 96286 96285 96284 96283 96282 96281 96280 96279 96278 96277 96276 96275 96274 96273 96272 96271 96270 96269 96268 96267 96266 96265 96264 96263 96262 96261 96260 96259 96258 96257 96256 96255 96254 96253 96252 96251 96250 96249 96248 96247 96246 96245 96244 96243 96242 96241 96240 96239 96238 96237 96236 96235 96234 96233 96232 96231 96230 96229 96228 96227 96226 96225 96224 96223 96222 96221 96220 96219 96218 96217 96216 96215 96214 96213 96212 96211 96210 96209 96208 96207 96206 96205 96204 96203 96202 96201 96200 96199 96198 96197 96196 96195 96194 96193 96192 96191 96190 96189 96188 96187 96186 96185 96184 96183 96182 96181 96180 96179 96178 96177 96176 96175 96174 96173 96172 96171 96170 96169 96168 96167 96166 96165 96164 96163 96162 96161 96160 96159 96158 96157 96156 96155 96154 96153 96152 96151 96150 96149 96148 96147 96146 96145 96144 96143 96142 96141 96140 96139 96138 96137 96136 96135 96134 96133 96132 96131 96130 96129 96128 96127 96126 96125 96124 96123 96122 96121 96120 96119 96118 96117 96116 96115 96114 96113 96112 96111 96110 96109 96108 96107 96106 96105 96104 96103 96102 96101 96100 96099 96098 96097 96096 96095 96094 96093 96092 96091 96090 96089 96088 96087 96086 96085 96084 96083 96082 96081 96080 96079 96078 96077 96076 96075 96074 96073 96072 96071 96070 96069 96068 96067 96066 96065 96064 96063 96062 96061 96060 96059 96058 96057 96056 96055 96054 96053 96052 96051 96050 96049 96048 96047 96046 96045 96044 96043 96042 96041 96040 96039 96038 96037 96036 96035 96034 96033 96032 96031 96030 96029 96028 96027 96026 96025 96024 96023 96022 96021 96020 96019 96018 96017 96016 96015 96014 96013 96012 96011 96010 96009 96008 96007 96006 96005 96004 96003 96002 96001 96000 95999 95998 95997 95996 95995 95994 95993 95992 95991 95990 95989 95988 95987 95986 95985 95984 95983 95982 95981 95980 95979 95978 95977 95976 95975 95974 95973 95972 95971 95970 95969 95968 95967 95966 95965 95964 95963 95962 95961 95960 95959 95958 95957 95956 95955 95954 95953 95952 95951 95950 95949 95948 95947 95946 95945 95944 95943 95942 95941 95940 95939 95938 95937 95936 95935 95934 95933 95932 95931 95930 95929 95928 95927 95926 95925 95924 95923 95922 95921 95920 95919 95918 95917 95916 95915 95914 95913 95912 95911 95910 95909 95908 95907 95906 95905 95904 95903 95902 95901 95900 95899 95898 95897 95896 95895 95894 95893 95892 95891 95890 95889 95888 95887 95886 95885 95884 95883 95882 95881 95880 95879 95878 95877 95876 95875 95874 95873 95872 95871 95870 95869 95868 95867 95866 95865 95864 95863 95862 95861 95860 95859 95858 95857 95856 95855 95854 95853 95852 95851 95850 95849 95848 95847 95846 95845 95844 95843 95842 95841 95840 95839 95838 95837 95836 95835 95834 95833 95832 95831 95830 95829 95828 95827 95826 95825 95824 95823 95822 95821 95820 95819 95818 95817 95816 95815 95814 95813 95812 95811 95810 95809 95808 95807 95806 95805 95804 95803 95802 95801 95800 95799 95798 95797 95796 95795 95794 95793 95792 95791 95790 95789 95788 95787 95786 95785 95784 95783 95782 95781 95780 95779 95778 95777 95776 95775 95774 95773 95772 95771 95770 95769 95768 95767 95766 95765 95764 95763 95762 95761 95760 95759 95758 95757 95756 95755 95754 95753 95752 95751 95750 95749 95748 95747 95746 95745 95744 95743 95742 95741 95740 95739 95738 95737 95736 95735 95734 95733 95732 95731 95730 95729 95728 95727 95726 95725 95724 95723 95722 95721 95720 95719 95718 95717 95716 95715 95714 95713 95712 95711 95710 95709 95708 95707 95706 95705 95704 95703 95702 95701 95700 95699 95698 95697 95696 95695 95694 95693 95692 95691 95690 95689 95688 95687 95686 95685 95684 95683 95682 95681 95680 95679 95678 95677 95676 95675 95674 95673 95672 95671 95670 95669 95668 95667 95666 95665 95664 95663 95662 95661 95660 95659 95658 95657 95656 95655 95654 95653 95652 95651 95650 95649 95648 95647 95646 95645 95644 95643 95642 95641 95640 95639 95638 95637 95636 95635 95634 95633 95632 95631 95630 95629 95628 95627 95626 95625 95624 95623 95622 95621 95620 95619 95618 95617 95616 95615 95614 95613 95612 95611 95610 95609 95608 95607 95606 95605 95604 95603 95602 95601 95600 95599 95598 95597 95596 95595 95594 95593 95592 95591 95590 95589 95588 95587 95586 95585 95584 95583 95582 95581 95580 95579 95578 95577 95576 95575 95574 95573 95572 95571 95570 95569 95568 95567 95566 95565 95564 95563 95562 95561 95560 95559 95558 95557 95556 95555 95554 95553 95552 95551 95550 95549 95548 95547 95546 95545 95544 95543 95542 95541 95540 95539 95538 95537 95536 95535 95534 95533 95532 95531 95530 95529 95528 95527 95526 95525 95524 95523 95522 95521 95520 95519 95518 95517 95516 95515 95514 95513 95512 95511 95510 95509 95508 95507 95506 95505 95504 95503 95502 95501 95500 95499 95498 95497 95496 95495 95494 95493 95492 95491 95490 95489 95488 95487 95486 95485 95484 95483 95482 95481 95480 95479 95478 95477 95476 95475 95474 95473 95472 95471 95470 95469 95468 95467 95466 95465 95464 95463 95462 95461 95460 95459 95458 95457 95456 95455 95454 95453 95452 95451 95450 95449 95448 95447 95446 95445 95444 95443 95442 95441 95440 95439 95438 95437 95436 95435 95434 95433 95432 95431 95430 95429 95428 95427 95426 95425 95424 95423 95422 95421 95420 95419 95418 95417 95416 95415 95414 95413 95412 95411 95410 95409 95408 95407 95406 95405 95404 95403 95402 95401 95400 95399 95398 95397 95396 95395 95394 95393 95392 95391 95390 95389 95388 95387 95386 95385 95384 95383 95382 95381 95380 95379 95378 95377 95376 95375 95374 95373 95372 95371 95370 95369 95368 95367 95366 95365 95364 95363 95362 95361 95360 95359 95358 95357 95356 95355 95354 95353 95352 95351 95350 95349 95348 95347 95346 95345 95344 95343 95342 95341 95340 95339 95338 95337 95336 95335 95334 95333 95332 95331 95330 95329 95328 95327 95326 95325 95324 95323 95322 95321 95320 95319 95318 95317 95316 95315 95314 95313 95312 95311 95310 95309 95308 95307 95306 95305 95304 95303 95302 95301 95300 95299 95298 95297 95296 95295 95294 95293 95292 95291 95290 95289 95288 95287 95286 95285 95284 95283 95282 95281 95280 95279 95278 95277 95276 95275 95274 95273 95272 95271 95270 95269 95268 95267 95266 95265 95264 95263 95262 95261 95260 95259 95258 95257 95256 95255 95254 95253 95252 95251 95250 95249 95248 95247 95246 95245 95244 95243 95242 95241 95240 95239 95238 95237 95236 95235 95234 95233 95232 95231 95230 95229 95228 95227 95226 95225 95224 95223 95222 95221 95220 95219 95218 95217 95216 95215 95214 95213 95212 95211 95210 95209 95208 95207 95206 95205 95204 95203 95202 95201 95200 95199 95198 95197 95196 95195 95194 95193 95192 95191 95190 95189 95188 95187 95186 95185 95184 95183 95182 95181 95180 95179 95178 95177 95176 95175 95174 95173 95172 95171 95170 95169 95168 95167 95166 95165 95164 95163 95162 95161 95160 95159 95158 95157 95156 95155 95154 95153 95152 95151 95150 95149 95148 95147 95146 95145 95144 95143 95142 95141 95140 95139 95138 95137 95136 95135 95134 95133 95132 95131 95130 95129 95128 95127 95126 95125 95124 95123 95122 95121 95120 95119 95118 95117 95116 95115 95114 95113 95112 95111 95110 95109 95108 95107 95106 95105 95104 95103 95102 95101 95100 95099 95098 95097 95096 95095 95094 95093 95092 95091 95090 95089 95088 95087 95086 95085 95084 95083 95082 95081 95080 95079 95078 95077 95076 95075 95074 95073 95072 95071 95070 95069 95068 95067 95066 95065 95064 95063 95062 95061 95060 95059 95058 95057 95056 95055 95054 95053 95052 95051 95050 95049 95048 95047 95046 95045 95044 95043 95042 95041 95040 95039 95038 95037 95036 95035 95034 95033 95032 95031 95030 95029 95028 95027 95026 95025 95024 95023 95022 95021 95020 95019 95018 95017 95016 95015 95014 95013 95012 95011 95010 95009 95008 95007 95006 95005 95004 95003 95002 95001 95000 94999 94998 94997 94996 94995 94994 94993 94992 94991 94990 94989 94988 94987 94986 94985 94984 94983 94982 94981 94980 94979 94978 94977 94976 94975 94974 94973 94972 94971 94970 94969 94968 94967 94966 94965 94964 94963 94962 94961 94960 94959 94958 94957 94956 94955 94954 94953 94952 94951 94950 94949 94948 94947 94946 94945 94944 94943 94942 94941 94940 94939 94938 94937 94936 94935 94934 94933 94932 94931 94930 94929 94928 94927 94926 94925 94924 94923 94922 94921 94920 94919 94918 94917 94916 94915 94914 94913 94912 94911 94910 94909 94908 94907 94906 94905 94904 94903 94902 94901 94900 94899 94898 94897 94896 94895 94894 94893 94892 94891 94890 94889 94888 94887 94886 94885 94884 94883 94882 94881 94880 94879 94878 94877 94876 94875 94874 94873 94872 94871 94870 94869 94868 94867 94866 94865 94864 94863 94862 94861 94860 94859 94858 94857 94856 94855 94854 94853 94852 94851 94850 94849 94848 94847 94846 94845 94844 94843 94842 94841 94840 94839 94838 94837 94836 94835 94834 94833 94832 94831 94830 94829 94828 94827 94826 94825 94824 94823 94822 94821 94820 94819 94818 94817 94816 94815 94814 94813 94812 94811 94810 94809 94808 94807 94806 94805 94804 94803 94802 94801 94800 94799 94798 94797 94796 94795 94794 94793 94792 94791 94790 94789 94788 94787 94786 94785 94784 94783 94782 94781 94780 94779 94778 94777 94776 94775 94774 94773 94772 94771 94770 94769 94768 94767 94766 94765 94764 94763 94762 94761 94760 94759 94758 94757 94756 94755 94754 94753 94752 94751 94750 94749 94748 94747 94746 94745 94744 94743 94742 94741 94740 94739 94738 94737 94736 94735 94734 94733 94732 94731 94730 94729 94728 94727 94726 94725 94724 94723 94722 94721 94720 94719 94718 94717 94716 94715 94714 94713 94712 94711 94710 94709 94708 94707 94706 94705 94704 94703 94702 94701 94700 94699 94698 94697 94696 94695 94694 94693 94692 94691 94690 94689 94688 94687 94686 94685 94684 94683 94682 94681 94680 94679 94678 94677 94676 94675 94674 94673 94672 94671 94670 94669 94668 94667 94666 94665 94664 94663 94662 94661 94660 94659 94658 94657 94656 94655 94654 94653 94652 94651 94650 94649 94648 94647 94646 94645 94644 94643 94642 94641 94640 94639 94638 94637 94636 94635 94634 94633 94632 94631 94630 94629 94628 94627 94626 94625 94624 94623 94622 94621 94620 94619 94618 94617 94616 94615 94614 94613 94612 94611 94610 94609 94608 94607 94606 94605 94604 94603 94602 94601 94600 94599 94598 94597 94596 94595 94594 94593 94592 94591 94590 94589 94588 94587 94586 94585 94584 94583 94582 94581 94580 94579 94578 94577 94576 94575 94574 94573 94572 94571 94570 94569 94568 94567 94566 94565 94564 94563 94562 94561 94560 94559 94558 94557 94556 94555 94554 94553 94552 94551 94550 94549 94548 94547 94546 94545 94544 94543 94542 94541 94540 94539 94538 94537 94536 94535 94534 94533 94532 94531 94530 94529 94528 94527 94526 94525 94524 94523 94522 94521 94520 94519 94518 94517 94516 94515 94514 94513 94512 94511 94510 94509 94508 94507 94506 94505 94504 94503 94502 94501 94500 94499 94498 94497 94496 94495 94494 94493 94492 94491 94490 94489 94488 94487 94486 94485 94484 94483 94482 94481 94480 94479 94478 94477 94476 94475 94474 94473 94472 94471 94470 94469 94468 94467 94466 94465 94464 94463 94462 94461 94460 94459 94458 94457 94456 94455 94454 94453 94452 94451 94450 94449 94448 94447 94446 94445 94444 94443 94442 94441 94440 94439 94438 94437 94436 94435 94434 94433 94432 94431 94430 94429 94428 94427 94426 94425 94424 94423 94422 94421 94420 94419 94418 94417 94416 94415 94414 94413 94412 94411 94410 94409 94408 94407 94406 94405 94404 94403 94402 94401 94400 94399 94398 94397 94396 94395 94394 94393 94392 94391 94390 94389 94388 94387 94386 94385 94384 94383 94382 94381 94380 94379 94378 94377 94376 94375 94374 94373 94372 94371 94370 94369 94368 94367 94366 94365 94364 94363 94362 94361 94360 94359 94358 94357 94356 94355 94354 94353 94352 94351 94350 94349 94348 94347 94346 94345 94344 94343 94342 94341 94340 94339 94338 94337 94336 94335 94334 94333 94332 94331 94330 94329 94328 94327 94326 94325 94324 94323 94322 94321 94320 94319 94318 94317 94316 94315 94314 94313 94312 94311 94310 94309 94308 94307 94306 94305 94304 94303 94302 94301 94300 94299 94298 94297 94296 94295 94294 94293 94292 94291 94290 94289 94288 94287 94286 94285 94284 94283 94282 94281 94280 94279 94278 94277 94276 94275 94274 94273 94272 94271 94270 94269 94268 94267 94266 94265 94264 94263 94262 94261 94260 94259 94258 94257 94256 94255 94254 94253 94252 94251 94250 94249 94248 94247 94246 94245 94244 94243 94242 94241 94240 94239 94238 94237 94236 94235 94234 94233 94232 94231 94230 94229 94228 94227 94226 94225 94224 94223 94222 94221 94220 94219 94218 94217 94216 94215 94214 94213 94212 94211 94210 94209 94208 94207 94206 94205 94204 94203 94202 94201 94200 94199 94198 94197 94196 94195 94194 94193 94192 94191 94190 94189 94188 94187 94186 94185 94184 94183 94182 94181 94180 94179 94178 94177 94176 94175 94174 94173 94172 94171 94170 94169 94168 94167 94166 94165 94164 94163 94162 94161 94160 94159 94158 94157 94156 94155 94154 94153 94152 94151 94150 94149 94148 94147 94146 94145 94144 94143 94142 94141 94140 94139 94138 94137 94136 94135 94134 94133 94132 94131 94130 94129 94128 94127 94126 94125 94124 94123 94122 94121 94120 94119 94118 94117 94116 94115 94114 94113 94112 94111 94110 94109 94108 94107 94106 94105 94104 94103 94102 94101 94100 94099 94098 94097 94096 94095 94094 94093 94092 94091 94090 94089 94088 94087 94086 94085 94084 94083 94082 94081 94080 94079 94078 94077 94076 94075 94074 94073 94072 94071 94070 94069 94068 94067 94066 94065 94064 94063 94062 94061 94060 94059 94058 94057 94056 94055 94054 94053 94052 94051 94050 94049 94048 94047 94046 94045 94044 94043 94042 94041 94040 94039 94038 94037 94036 94035 94034 94033 94032 94031 94030 94029 94028 94027 94026 94025 94024 94023 94022 94021 94020 94019 94018 94017 94016 94015 94014 94013 94012 94011 94010 94009 94008 94007 94006 94005 94004 94003 94002 94001 94000 93999 93998 93997 93996 93995 93994 93993 93992 93991 93990 93989 93988 93987 93986 93985 93984 93983 93982 93981 93980 93979 93978 93977 93976 93975 93974 93973 93972 93971 93970 93969 93968 93967 93966 93965 93964 93963 93962 93961 93960 93959 93958 93957 93956 93955 93954 93953 93952 93951 93950 93949 93948 93947 93946 93945 93944 93943 93942 93941 93940 93939 93938 93937 93936 93935 93934 93933 93932 93931 93930 93929 93928 93927 93926 93925 93924 93923 93922 93921 93920 93919 93918 93917 93916 93915 93914 93913 93912 93911 93910 93909 93908 93907 93906 93905 93904 93903 93902 93901 93900 93899 93898 93897 93896 93895 93894 93893 93892 93891 93890 93889 93888 93887 93886 93885 93884 93883 93882 93881 93880 93879 93878 93877 93876 93875 93874 93873 93872 93871 93870 93869 93868 93867 93866 93865 93864 93863 93862 93861 93860 93859 93858 93857 93856 93855 93854 93853 93852 93851 93850 93849 93848 93847 93846 93845 93844 93843 93842 93841 93840 93839 93838 93837 93836 93835 93834 93833 93832 93831 93830 93829 93828 93827 93826 93825 93824 93823 93822 93821 93820 93819 93818 93817 93816 93815 93814 93813 93812 93811 93810 93809 93808 93807 93806 93805 93804 93803 93802 93801 93800 93799 93798 93797 93796 93795 93794 93793 93792 93791 93790 93789 93788 93787 93786 93785 93784 93783 93782 93781 93780 93779 93778 93777 93776 93775 93774 93773 93772 93771 93770 93769 93768 93767 93766 93765 93764 93763 93762 93761 93760 93759 93758 93757 93756 93755 93754 93753 93752 93751 93750 93749 93748 93747 93746 93745 93744 93743 93742 93741 93740 93739 93738 93737 93736 93735 93734 93733 93732 93731 93730 93729 93728 93727 93726 93725 93724 93723 93722 93721 93720 93719 93718 93717 93716 93715 93714 93713 93712 93711 93710 93709 93708 93707 93706 93705 93704 93703 93702 93701 93700 93699 93698 93697 93696 93695 93694 93693 93692 93691 93690 93689 93688 93687 93686 93685 93684 93683 93682 93681 93680 93679 93678 93677 93676 93675 93674 93673 93672 93671 93670 93669 93668 93667 93666 93665 93664 93663 93662 93661 93660 93659 93658 93657 93656 93655 93654 93653 93652 93651 93650 93649 93648 93647 93646 93645 93644 93643 93642 93641 93640 93639 93638 93637 93636 93635 93634 93633 93632 93631 93630 93629 93628 93627 93626 93625 93624 93623 93622 93621 93620 93619 93618 93617 93616 93615 93614 93613 93612 93611 93610 93609 93608 93607 93606 93605 93604 93603 93602 93601 93600 93599 93598 93597 93596 93595 93594 93593 93592 93591 93590 93589 93588 93587 93586 93585 93584 93583 93582 93581 93580 93579 93578 93577 93576 93575 93574 93573 93572 93571 93570 93569 93568 93567 93566 93565 93564 93563 93562 93561 93560 93559 93558 93557 93556 93555 93554 93553 93552 93551 93550 93549 93548 93547 93546 93545 93544 93543 93542 93541 93540 93539 93538 93537 93536 93535 93534 93533 93532 93531 93530 93529 93528 93527 93526 93525 93524 93523 93522 93521 93520 93519 93518 93517 93516 93515 93514 93513 93512 93511 93510 93509 93508 93507 93506 93505 93504 93503 93502 93501 93500 93499 93498 93497 93496 93495 93494 93493 93492 93491 93490 93489 93488 93487 93486 93485 93484 93483 93482 93481 93480 93479 93478 93477 93476 93475 93474 93473 93472 93471 93470 93469 93468 93467 93466 93465 93464 93463 93462 93461 93460 93459 93458 93457 93456 93455 93454 93453 93452 93451 93450 93449 93448 93447 93446 93445 93444 93443 93442 93441 93440 93439 93438 93437 93436 93435 93434 93433 93432 93431 93430 93429 93428 93427 93426 93425 93424 93423 93422 93421 93420 93419 93418 93417 93416 93415 93414 93413 93412 93411 93410 93409 93408 93407 93406 93405 93404 93403 93402 93401 93400 93399 93398 93397 93396 93395 93394 93393 93392 93391 93390 93389 93388 93387 93386 93385 93384 93383 93382 93381 93380 93379 93378 93377 93376 93375 93374 93373 93372 93371 93370 93369 93368 93367 93366 93365 93364 93363 93362 93361 93360 93359 93358 93357 93356 93355 93354 93353 93352 93351 93350 93349 93348 93347 93346 93345 93344 93343 93342 93341 93340 93339 93338 93337 93336 93335 93334 93333 93332 93331 93330 93329 93328 93327 93326 93325 93324 93323 93322 93321 93320 93319 93318 93317 93316 93315 93314 93313 93312 93311 93310 93309 93308 93307 93306 93305 93304 93303 93302 93301 93300 93299 93298 93297 93296 93295 93294 93293 93292 93291 93290 93289 93288 93287 93286 93285 93284 93283 93282 93281 93280 93279 93278 93277 93276 93275 93274 93273 93272 93271 93270 93269 93268 93267 93266 93265 93264 93263 93262 93261 93260 93259 93258 93257 93256 93255 93254 93253 93252 93251 93250 93249 93248 93247 93246 93245 93244 93243 93242 93241 93240 93239 93238 93237 93236 93235 93234 93233 93232 93231 93230 93229 93228 93227 93226 93225 93224 93223 93222 93221 93220 93219 93218 93217 93216 93215 93214 93213 93212 93211 93210 93209 93208 93207 93206 93205 93204 93203 93202 93201 93200 93199 93198 93197 93196 93195 93194 93193 93192 93191 93190 93189 93188 93187 93186 93185 93184 93183 93182 93181 93180 93179 93178 93177 93176 93175 93174 93173 93172 93171 93170 93169 93168 93167 93166 93165 93164 93163 93162 93161 93160 93159 93158 93157 93156 93155 93154 93153 93152 93151 93150 93149 93148 93147 93146 93145 93144 93143 93142 93141 93140 93139 93138 93137 93136 93135 93134 93133 93132 93131 93130 93129 93128 93127 93126 93125 93124 93123 93122 93121 93120 93119 93118 93117 93116 93115 93114 93113 93112 93111 93110 93109 93108 93107 93106 93105 93104 93103 93102 93101 93100 93099 93098 93097 93096 93095 93094 93093 93092 93091 93090 93089 93088 93087 93086 93085 93084 93083 93082 93081 93080 93079 93078 93077 93076 93075 93074 93073 93072 93071 93070 93069 93068 93067 93066 93065 93064 93063 93062 93061 93060 93059 93058 93057 93056 93055 93054 93053 93052 93051 93050 93049 93048 93047 93046 93045 93044 93043 93042 93041 93040 93039 93038 93037 93036 93035 93034 93033 93032 93031 93030 93029 93028 93027 93026 93025 93024 93023 93022 93021 93020 93019 93018 93017 93016 93015 93014 93013 93012 93011 93010 93009 93008 93007 93006 93005 93004 93003 93002 93001 93000 92999 92998 92997 92996 92995 92994 92993 92992 92991 92990 92989 92988 92987 92986 92985 92984 92983 92982 92981 92980 92979 92978 92977 92976 92975 92974 92973 92972 92971 92970 92969 92968 92967 92966 92965 92964 92963 92962 92961 92960 92959 92958 92957 92956 92955 92954 92953 92952 92951 92950 92949 92948 92947 92946 92945 92944 92943 92942 92941 92940 92939 92938 92937 92936 92935 92934 92933 92932 92931 92930 92929 92928 92927 92926 92925 92924 92923 92922 92921 92920 92919 92918 92917 92916 92915 92914 92913 92912 92911 92910 92909 92908 92907 92906 92905 92904 92903 92902 92901 92900 92899 92898 92897 92896 92895 92894 92893 92892 92891 92890 92889 92888 92887 92886 92885 92884 92883 92882 92881 92880 92879 92878 92877 92876 92875 92874 92873 92872 92871 92870 92869 92868 92867 92866 92865 92864 92863 92862 92861 92860 92859 92858 92857 92856 92855 92854 92853 92852 92851 92850 92849 92848 92847 92846 92845 92844 92843 92842 92841 92840 92839 92838 92837 92836 92835 92834 92833 92832 92831 92830 92829 92828 92827 92826 92825 92824 92823 92822 92821 92820 92819 92818 92817 92816 92815 92814 92813 92812 92811 92810 92809 92808 92807 92806 92805 92804 92803 92802 92801 92800 92799 92798 92797 92796 92795 92794 92793 92792 92791 92790 92789 92788 92787 92786 92785 92784 92783 92782 92781 92780 92779 92778 92777 92776 92775 92774 92773 92772 92771 92770 92769 92768 92767 92766 92765 92764 92763 92762 92761 92760 92759 92758 92757 92756 92755 92754 92753 92752 92751 92750 92749 92748 92747 92746 92745 92744 92743 92742 92741 92740 92739 92738 92737 92736 92735 92734 92733 92732 92731 92730 92729 92728 92727 92726 92725 92724 92723 92722 92721 92720 92719 92718 92717 92716 92715 92714 92713 92712 92711 92710 92709 92708 92707 92706 92705 92704 92703 92702 92701 92700 92699 92698 92697 92696 92695 92694 92693 92692 92691 92690 92689 92688 92687 92686 92685 92684 92683 92682 92681 92680 92679 92678 92677 92676 92675 92674 92673 92672 92671 92670 92669 92668 92667 92666 92665 92664 92663 92662 92661 92660 92659 92658 92657 92656 92655 92654 92653 92652 92651 92650 92649 92648 92647 92646 92645 92644 92643 92642 92641 92640 92639 92638 92637 92636 92635 92634 92633 92632 92631 92630 92629 92628 92627 92626 92625 92624 92623 92622 92621 92620 92619 92618 92617 92616 92615 92614 92613 92612 92611 92610 92609 92608 92607 92606 92605 92604 92603 92602 92601 92600 92599 92598 92597 92596 92595 92594 92593 92592 92591 92590 92589 92588 92587 92586 92585 92584 92583 92582 92581 92580 92579 92578 92577 92576 92575 92574 92573 92572 92571 92570 92569 92568 92567 92566 92565 92564 92563 92562 92561 92560 92559 92558 92557 92556 92555 92554 92553 92552 92551 92550 92549 92548 92547 92546 92545 92544 92543 92542 92541 92540 92539 92538 92537 92536 92535 92534 92533 92532 92531 92530 92529 92528 92527 92526 92525 92524 92523 92522 92521 92520 92519 92518 92517 92516 92515 92514 92513 92512 92511 92510 92509 92508 92507 92506 92505 92504 92503 92502 92501 92500 92499 92498 92497 92496 92495 92494 92493 92492 92491 92490 92489 92488 92487 92486 92485 92484 92483 92482 92481 92480 92479 92478 92477 92476 92475 92474 92473 92472 92471 92470 92469 92468 92467 92466 92465 92464 92463 92462 92461 92460 92459 92458 92457 92456 92455 92454 92453 92452 92451 92450 92449 92448 92447 92446 92445 92444 92443 92442 92441 92440 92439 92438 92437 92436 92435 92434 92433 92432 92431 92430 92429 92428 92427 92426 92425 92424 92423 92422 92421 92420 92419 92418 92417 92416 92415 92414 92413 92412 92411 92410 92409 92408 92407 92406 92405 92404 92403 92402 92401 92400 92399 92398 92397 92396 92395 92394 92393 92392 92391 92390 92389 92388 92387 92386 92385 92384 92383 92382 92381 92380 92379 92378 92377 92376 92375 92374 92373 92372 92371 92370 92369 92368 92367 92366 92365 92364 92363 92362 92361 92360 92359 92358 92357 92356 92355 92354 92353 92352 92351 92350 92349 92348 92347 92346 92345 92344 92343 92342 92341 92340 92339 92338 92337 92336 92335 92334 92333 92332 92331 92330 92329 92328 92327 92326 92325 92324 92323 92322 92321 92320 92319 92318 92317 92316 92315 92314 92313 92312 92311 92310 92309 92308 92307 92306 92305 92304 92303 92302 92301 92300 92299 92298 92297 92296 92295 92294 92293 92292 92291 92290 92289 92288 92287 92286 92285 92284 92283 92282 92281 92280 92279 92278 92277 92276 92275 92274 92273 92272 92271 92270 92269 92268 92267 92266 92265 92264 92263 92262 92261 92260 92259 92258 92257 92256 92255 92254 92253 92252 92251 92250 92249 92248 92247 92246 92245 92244 92243 92242 92241 92240 92239 92238 92237 92236 92235 92234 92233 92232 92231 92230 92229 92228 92227 92226 92225 92224 92223 92222 92221 92220 92219 92218 92217 92216 92215 92214 92213 92212 92211 92210 92209 92208 92207 92206 92205 92204 92203 92202 92201 92200 92199 92198 92197 92196 92195 92194 92193 92192 92191 92190 92189 92188 92187 92186 92185 92184 92183 92182 92181 92180 92179 92178 92177 92176 92175 92174 92173 92172 92171 92170 92169 92168 92167 92166 92165 92164 92163 92162 92161 92160 92159 92158 92157 92156 92155 92154 92153 92152 92151 92150 92149 92148 92147 92146 92145 92144 92143 92142 92141 92140 92139 92138 92137 92136 92135 92134 92133 92132 92131 92130 92129 92128 92127 92126 92125 92124 92123 92122 92121 92120 92119 92118 92117 92116 92115 92114 92113 92112 92111 92110 92109 92108 92107 92106 92105 92104 92103 92102 92101 92100 92099 92098 92097 92096 92095 92094 92093 92092 92091 92090 92089 92088 92087 92086 92085 92084 92083 92082 92081 92080 92079 92078 92077 92076 92075 92074 92073 92072 92071 92070 92069 92068 92067 92066 92065 92064 92063 92062 92061 92060 92059 92058 92057 92056 92055 92054 92053 92052 92051 92050 92049 92048 92047 92046 92045 92044 92043 92042 92041 92040 92039 92038 92037 92036 92035 92034 92033 92032 92031 92030 92029 92028 92027 92026 92025 92024 92023 92022 92021 92020 92019 92018 92017 92016 92015 92014 92013 92012 92011 92010 92009 92008 92007 92006 92005 92004 92003 92002 92001 92000 91999 91998 91997 91996 91995 91994 91993 91992 91991 91990 91989 91988 91987 91986 91985 91984 91983 91982 91981 91980 91979 91978 91977 91976 91975 91974 91973 91972 91971 91970 91969 91968 91967 91966 91965 91964 91963 91962 91961 91960 91959 91958 91957 91956 91955 91954 91953 91952 91951 91950 91949 91948 91947 91946 91945 91944 91943 91942 91941 91940 91939 91938 91937 91936 91935 91934 91933 91932 91931 91930 91929 91928 91927 91926 91925 91924 91923 91922 91921 91920 91919 91918 91917 91916 91915 91914 91913 91912 91911 91910 91909 91908 91907 91906 91905 91904 91903 91902 91901 91900 91899 91898 91897 91896 91895 91894 91893 91892 91891 91890 91889 91888 91887 91886 91885 91884 91883 91882 91881 91880 91879 91878 91877 91876 91875 91874 91873 91872 91871 91870 91869 91868 91867 91866 91865 91864 91863 91862 91861 91860 91859 91858 91857 91856 91855 91854 91853 91852 91851 91850 91849 91848 91847 91846 91845 91844 91843 91842 91841 91840 91839 91838 91837 91836 91835 91834 91833 91832 91831 91830 91829 91828 91827 91826 91825 91824 91823 91822 91821 91820 91819 91818 91817 91816 91815 91814 91813 91812 91811 91810 91809 91808 91807 91806 91805 91804 91803 91802 91801 91800 91799 91798 91797 91796 91795 91794 91793 91792 91791 91790 91789 91788 91787 91786 91785 91784 91783 91782 91781 91780 91779 91778 91777 91776 91775 91774 91773 91772 91771 91770 91769 91768 91767 91766 91765 91764 91763 91762 91761 91760 91759 91758 91757 91756 91755 91754 91753 91752 91751 91750 91749 91748 91747 91746 91745 91744 91743 91742 91741 91740 91739 91738 91737 91736 91735 91734 91733 91732 91731 91730 91729 91728 91727 91726 91725 91724 91723 91722 91721 91720 91719 91718 91717 91716 91715 91714 91713 91712 91711 91710 91709 91708 91707 91706 91705 91704 91703 91702 91701 91700 91699 91698 91697 91696 91695 91694 91693 91692 91691 91690 91689 91688 91687 91686 91685 91684 91683 91682 91681 91680 91679 91678 91677 91676 91675 91674 91673 91672 91671 91670 91669 91668 91667 91666 91665 91664 91663 91662 91661 91660 91659 91658 91657 91656 91655 91654 91653 91652 91651 91650 91649 91648 91647 91646 91645 91644 91643 91642 91641 91640 91639 91638 91637 91636 91635 91634 91633 91632 91631 91630 91629 91628 91627 91626 91625 91624 91623 91622 91621 91620 91619 91618 91617 91616 91615 91614 91613 91612 91611 91610 91609 91608 91607 91606 91605 91604 91603 91602 91601 91600 91599 91598 91597 91596 91595 91594 91593 91592 91591 91590 91589 91588 91587 91586 91585 91584 91583 91582 91581 91580 91579 91578 91577 91576 91575 91574 91573 91572 91571 91570 91569 91568 91567 91566 91565 91564 91563 91562 91561 91560 91559 91558 91557 91556 91555 91554 91553 91552 91551 91550 91549 91548 91547 91546 91545 91544 91543 91542 91541 91540 91539 91538 91537 91536 91535 91534 91533 91532 91531 91530 91529 91528 91527 91526 91525 91524 91523 91522 91521 91520 91519 91518 91517 91516 91515 91514 91513 91512 91511 91510 91509 91508 91507 91506 91505 91504 91503 91502 91501 91500 91499 91498 91497 91496 91495 91494 91493 91492 91491 91490 91489 91488 91487 91486 91485 91484 91483 91482 91481 91480 91479 91478 91477 91476 91475 91474 91473 91472 91471 91470 91469 91468 91467 91466 91465 91464 91463 91462 91461 91460 91459 91458 91457 91456 91455 91454 91453 91452 91451 91450 91449 91448 91447 91446 91445 91444 91443 91442 91441 91440 91439 91438 91437 91436 91435 91434 91433 91432 91431 91430 91429 91428 91427 91426 91425 91424 91423 91422 91421 91420 91419 91418 91417 91416 91415 91414 91413 91412 91411 91410 91409 91408 91407 91406 91405 91404 91403 91402 91401 91400 91399 91398 91397 91396 91395 91394 91393 91392 91391 91390 91389 91388 91387 91386 91385 91384 91383 91382 91381 91380 91379 91378 91377 91376 91375 91374 91373 91372 91371 91370 91369 91368 91367 91366 91365 91364 91363 91362 91361 91360 91359 91358 91357 91356 91355 91354 91353 91352 91351 91350 91349 91348 91347 91346 91345 91344 91343 91342 91341 91340 91339 91338 91337 91336 91335 91334 91333 91332 91331 91330 91329 91328 91327 91326 91325 91324 91323 91322 91321 91320 91319 91318 91317 91316 91315 91314 91313 91312 91311 91310 91309 91308 91307 91306 91305 91304 91303 91302 91301 91300 91299 91298 91297 91296 91295 91294 91293 91292 91291 91290 91289 91288 91287 91286 91285 91284 91283 91282 91281 91280 91279 91278 91277 91276 91275 91274 91273 91272 91271 91270 91269 91268 91267 91266 91265 91264 91263 91262 91261 91260 91259 91258 91257 91256 91255 91254 91253 91252 91251 91250 91249 91248 91247 91246 91245 91244 91243 91242 91241 91240 91239 91238 91237 91236 91235 91234 91233 91232 91231 91230 91229 91228 91227 91226 91225 91224 91223 91222 91221 91220 91219 91218 91217 91216 91215 91214 91213 91212 91211 91210 91209 91208 91207 91206 91205 91204 91203 91202 91201 91200 91199 91198 91197 91196 91195 91194 91193 91192 91191 91190 91189 91188 91187 91186 91185 91184 91183 91182 91181 91180 91179 91178 91177 91176 91175 91174 91173 91172 91171 91170 91169 91168 91167 91166 91165 91164 91163 91162 91161 91160 91159 91158 91157 91156 91155 91154 91153 91152 91151 91150 91149 91148 91147 91146 91145 91144 91143 91142 91141 91140 91139 91138 91137 91136 91135 91134 91133 91132 91131 91130 91129 91128 91127 91126 91125 91124 91123 91122 91121 91120 91119 91118 91117 91116 91115 91114 91113 91112 91111 91110 91109 91108 91107 91106 91105 91104 91103 91102 91101 91100 91099 91098 91097 91096 91095 91094 91093 91092 91091 91090 91089 91088 91087 91086 91085 91084 91083 91082 91081 91080 91079 91078 91077 91076 91075 91074 91073 91072 91071 91070 91069 91068 91067 91066 91065 91064 91063 91062 91061 91060 91059 91058 91057 91056 91055 91054 91053 91052 91051 91050 91049 91048 91047 91046 91045 91044 91043 91042 91041 91040 91039 91038 91037 91036 91035 91034 91033 91032 91031 91030 91029 91028 91027 91026 91025 91024 91023 91022 91021 91020 91019 91018 91017 91016 91015 91014 91013 91012 91011 91010 91009 91008 91007 91006 91005 91004 91003 91002 91001 91000 90999 90998 90997 90996 90995 90994 90993 90992 90991 90990 90989 90988 90987 90986 90985 90984 90983 90982 90981 90980 90979 90978 90977 90976 90975 90974 90973 90972 90971 90970 90969 90968 90967 90966 90965 90964 90963 90962 90961 90960 90959 90958 90957 90956 90955 90954 90953 90952 90951 90950 90949 90948 90947 90946 90945 90944 90943 90942 90941 90940 90939 90938 90937 90936 90935 90934 90933 90932 90931 90930 90929 90928 90927 90926 90925 90924 90923 90922 90921 90920 90919 90918 90917 90916 90915 90914 90913 90912 90911 90910 90909 90908 90907 90906 90905 90904 90903 90902 90901 90900 90899 90898 90897 90896 90895 90894 90893 90892 90891 90890 90889 90888 90887 90886 90885 90884 90883 90882 90881 90880 90879 90878 90877 90876 90875 90874 90873 90872 90871 90870 90869 90868 90867 90866 90865 90864 90863 90862 90861 90860 90859 90858 90857 90856 90855 90854 90853 90852 90851 90850 90849 90848 90847 90846 90845 90844 90843 90842 90841 90840 90839 90838 90837 90836 90835 90834 90833 90832 90831 90830 90829 90828 90827 90826 90825 90824 90823 90822 90821 90820 90819 90818 90817 90816 90815 90814 90813 90812 90811 90810 90809 90808 90807 90806 90805 90804 90803 90802 90801 90800 90799 90798 90797 90796 90795 90794 90793 90792 90791 90790 90789 90788 90787 90786 90785 90784 90783 90782 90781 90780 90779 90778 90777 90776 90775 90774 90773 90772 90771 90770 90769 90768 90767 90766 90765 90764 90763 90762 90761 90760 90759 90758 90757 90756 90755 90754 90753 90752 90751 90750 90749 90748 90747 90746 90745 90744 90743 90742 90741 90740 90739 90738 90737 90736 90735 90734 90733 90732 90731 90730 90729 90728 90727 90726 90725 90724 90723 90722 90721 90720 90719 90718 90717 90716 90715 90714 90713 90712 90711 90710 90709 90708 90707 90706 90705 90704 90703 90702 90701 90700 90699 90698 90697 90696 90695 90694 90693 90692 90691 90690 90689 90688 90687 90686 90685 90684 90683 90682 90681 90680 90679 90678 90677 90676 90675 90674 90673 90672 90671 90670 90669 90668 90667 90666 90665 90664 90663 90662 90661 90660 90659 90658 90657 90656 90655 90654 90653 90652 90651 90650 90649 90648 90647 90646 90645 90644 90643 90642 90641 90640 90639 90638 90637 90636 90635 90634 90633 90632 90631 90630 90629 90628 90627 90626 90625 90624 90623 90622 90621 90620 90619 90618 90617 90616 90615 90614 90613 90612 90611 90610 90609 90608 90607 90606 90605 90604 90603 90602 90601 90600 90599 90598 90597 90596 90595 90594 90593 90592 90591 90590 90589 90588 90587 90586 90585 90584 90583 90582 90581 90580 90579 90578 90577 90576 90575 90574 90573 90572 90571 90570 90569 90568 90567 90566 90565 90564 90563 90562 90561 90560 90559 90558 90557 90556 90555 90554 90553 90552 90551 90550 90549 90548 90547 90546 90545 90544 90543 90542 90541 90540 90539 90538 90537 90536 90535 90534 90533 90532 90531 90530 90529 90528 90527 90526 90525 90524 90523 90522 90521 90520 90519 90518 90517 90516 90515 90514 90513 90512 90511 90510 90509 90508 90507 90506 90505 90504 90503 90502 90501 90500 90499 90498 90497 90496 90495 90494 90493 90492 90491 90490 90489 90488 90487 90486 90485 90484 90483 90482 90481 90480 90479 90478 90477 90476 90475 90474 90473 90472 90471 90470 90469 90468 90467 90466 90465 90464 90463 90462 90461 90460 90459 90458 90457 90456 90455 90454 90453 90452 90451 90450 90449 90448 90447 90446 90445 90444 90443 90442 90441 90440 90439 90438 90437 90436 90435 90434 90433 90432 90431 90430 90429 90428 90427 90426 90425 90424 90423 90422 90421 90420 90419 90418 90417 90416 90415 90414 90413 90412 90411 90410 90409 90408 90407 90406 90405 90404 90403 90402 90401 90400 90399 90398 90397 90396 90395 90394 90393 90392 90391 90390 90389 90388 90387 90386 90385 90384 90383 90382 90381 90380 90379 90378 90377 90376 90375 90374 90373 90372 90371 90370 90369 90368 90367 90366 90365 90364 90363 90362 90361 90360 90359 90358 90357 90356 90355 90354 90353 90352 90351 90350 90349 90348 90347 90346 90345 90344 90343 90342 90341 90340 90339 90338 90337 90336 90335 90334 90333 90332 90331 90330 90329 90328 90327 90326 90325 90324 90323 90322 90321 90320 90319 90318 90317 90316 90315 90314 90313 90312 90311 90310 90309 90308 90307 90306 90305 90304 90303 90302 90301 90300 90299 90298 90297 90296 90295 90294 90293 90292 90291 90290 90289 90288 90287 90286 90285 90284 90283 90282 90281 90280 90279 90278 90277 90276 90275 90274 90273 90272 90271 90270 90269 90268 90267 90266 90265 90264 90263 90262 90261 90260 90259 90258 90257 90256 90255 90254 90253 90252 90251 90250 90249 90248 90247 90246 90245 90244 90243 90242 90241 90240 90239 90238 90237 90236 90235 90234 90233 90232 90231 90230 90229 90228 90227 90226 90225 90224 90223 90222 90221 90220 90219 90218 90217 90216 90215 90214 90213 90212 90211 90210 90209 90208 90207 90206 90205 90204 90203 90202 90201 90200 90199 90198 90197 90196 90195 90194 90193 90192 90191 90190 90189 90188 90187 90186 90185 90184 90183 90182 90181 90180 90179 90178 90177 90176 90175 90174 90173 90172 90171 90170 90169 90168 90167 90166 90165 90164 90163 90162 90161 90160 90159 90158 90157 90156 90155 90154 90153 90152 90151 90150 90149 90148 90147 90146 90145 90144 90143 90142 90141 90140 90139 90138 90137 90136 90135 90134 90133 90132 90131 90130 90129 90128 90127 90126 90125 90124 90123 90122 90121 90120 90119 90118 90117 90116 90115 90114 90113 90112 90111 90110 90109 90108 90107 90106 90105 90104 90103 90102 90101 90100 90099 90098 90097 90096 90095 90094 90093 90092 90091 90090 90089 90088 90087 90086 90085 90084 90083 90082 90081 90080 90079 90078 90077 90076 90075 90074 90073 90072 90071 90070 90069 90068 90067 90066 90065 90064 90063 90062 90061 90060 90059 90058 90057 90056 90055 90054 90053 90052 90051 90050 90049 90048 90047 90046 90045 90044 90043 90042 90041 90040 90039 90038 90037 90036 90035 90034 90033 90032 90031 90030 90029 90028 90027 90026 90025 90024 90023 90022 90021 90020 90019 90018 90017 90016 90015 90014 90013 90012 90011 90010 90009 90008 90007 90006 90005 90004 90003 90002 90001 90000 89999 89998 89997 89996 89995 89994 89993 89992 89991 89990 89989 89988 89987 89986 89985 89984 89983 89982 89981 89980 89979 89978 89977 89976 89975 89974 89973 89972 89971 89970 89969 89968 89967 89966 89965 89964 89963 89962 89961 89960 89959 89958 89957 89956 89955 89954 89953 89952 89951 89950 89949 89948 89947 89946 89945 89944 89943 89942 89941 89940 89939 89938 89937 89936 89935 89934 89933 89932 89931 89930 89929 89928 89927 89926 89925 89924 89923 89922 89921 89920 89919 89918 89917 89916 89915 89914 89913 89912 89911 89910 89909 89908 89907 89906 89905 89904 89903 89902 89901 89900 89899 89898 89897 89896 89895 89894 89893 89892 89891 89890 89889 89888 89887 89886 89885 89884 89883 89882 89881 89880 89879 89878 89877 89876 89875 89874 89873 89872 89871 89870 89869 89868 89867 89866 89865 89864 89863 89862 89861 89860 89859 89858 89857 89856 89855 89854 89853 89852 89851 89850 89849 89848 89847 89846 89845 89844 89843 89842 89841 89840 89839 89838 89837 89836 89835 89834 89833 89832 89831 89830 89829 89828 89827 89826 89825 89824 89823 89822 89821 89820 89819 89818 89817 89816 89815 89814 89813 89812 89811 89810 89809 89808 89807 89806 89805 89804 89803 89802 89801 89800 89799 89798 89797 89796 89795 89794 89793 89792 89791 89790 89789 89788 89787 89786 89785 89784 89783 89782 89781 89780 89779 89778 89777 89776 89775 89774 89773 89772 89771 89770 89769 89768 89767 89766 89765 89764 89763 89762 89761 89760 89759 89758 89757 89756 89755 89754 89753 89752 89751 89750 89749 89748 89747 89746 89745 89744 89743 89742 89741 89740 89739 89738 89737 89736 89735 89734 89733 89732 89731 89730 89729 89728 89727 89726 89725 89724 89723 89722 89721 89720 89719 89718 89717 89716 89715 89714 89713 89712 89711 89710 89709 89708 89707 89706 89705 89704 89703 89702 89701 89700 89699 89698 89697 89696 89695 89694 89693 89692 89691 89690 89689 89688 89687 89686 89685 89684 89683 89682 89681 89680 89679 89678 89677 89676 89675 89674 89673 89672 89671 89670 89669 89668 89667 89666 89665 89664 89663 89662 89661 89660 89659 89658 89657 89656 89655 89654 89653 89652 89651 89650 89649 89648 89647 89646 89645 89644 89643 89642 89641 89640 89639 89638 89637 89636 89635 89634 89633 89632 89631 89630 89629 89628 89627 89626 89625 89624 89623 89622 89621 89620 89619 89618 89617 89616 89615 89614 89613 89612 89611 89610 89609 89608 89607 89606 89605 89604 89603 89602 89601 89600 89599 89598 89597 89596 89595 89594 89593 89592 89591 89590 89589 89588 89587 89586 89585 89584 89583 89582 89581 89580 89579 89578 89577 89576 89575 89574 89573 89572 89571 89570 89569 89568 89567 89566 89565 89564 89563 89562 89561 89560 89559 89558 89557 89556 89555 89554 89553 89552 89551 89550 89549 89548 89547 89546 89545 89544 89543 89542 89541 89540 89539 89538 89537 89536 89535 89534 89533 89532 89531 89530 89529 89528 89527 89526 89525 89524 89523 89522 89521 89520 89519 89518 89517 89516 89515 89514 89513 89512 89511 89510 89509 89508 89507 89506 89505 89504 89503 89502 89501 89500 89499 89498 89497 89496 89495 89494 89493 89492 89491 89490 89489 89488 89487 89486 89485 89484 89483 89482 89481 89480 89479 89478 89477 89476 89475 89474 89473 89472 89471 89470 89469 89468 89467 89466 89465 89464 89463 89462 89461 89460 89459 89458 89457 89456 89455 89454 89453 89452 89451 89450 89449 89448 89447 89446 89445 89444 89443 89442 89441 89440 89439 89438 89437 89436 89435 89434 89433 89432 89431 89430 89429 89428 89427 89426 89425 89424 89423 89422 89421 89420 89419 89418 89417 89416 89415 89414 89413 89412 89411 89410 89409 89408 89407 89406 89405 89404 89403 89402 89401 89400 89399 89398 89397 89396 89395 89394 89393 89392 89391 89390 89389 89388 89387 89386 89385 89384 89383 89382 89381 89380 89379 89378 89377 89376 89375 89374 89373 89372 89371 89370 89369 89368 89367 89366 89365 89364 89363 89362 89361 89360 89359 89358 89357 89356 89355 89354 89353 89352 89351 89350 89349 89348 89347 89346 89345 89344 89343 89342 89341 89340 89339 89338 89337 89336 89335 89334 89333 89332 89331 89330 89329 89328 89327 89326 89325 89324 89323 89322 89321 89320 89319 89318 89317 89316 89315 89314 89313 89312 89311 89310 89309 89308 89307 89306 89305 89304 89303 89302 89301 89300 89299 89298 89297 89296 89295 89294 89293 89292 89291 89290 89289 89288 89287 89286 89285 89284 89283 89282 89281 89280 89279 89278 89277 89276 89275 89274 89273 89272 89271 89270 89269 89268 89267 89266 89265 89264 89263 89262 89261 89260 89259 89258 89257 89256 89255 89254 89253 89252 89251 89250 89249 89248 89247 89246 89245 89244 89243 89242 89241 89240 89239 89238 89237 89236 89235 89234 89233 89232 89231 89230 89229 89228 89227 89226 89225 89224 89223 89222 89221 89220 89219 89218 89217 89216 89215 89214 89213 89212 89211 89210 89209 89208 89207 89206 89205 89204 89203 89202 89201 89200 89199 89198 89197 89196 89195 89194 89193 89192 89191 89190 89189 89188 89187 89186 89185 89184 89183 89182 89181 89180 89179 89178 89177 89176 89175 89174 89173 89172 89171 89170 89169 89168 89167 89166 89165 89164 89163 89162 89161 89160 89159 89158 89157 89156 89155 89154 89153 89152 89151 89150 89149 89148 89147 89146 89145 89144 89143 89142 89141 89140 89139 89138 89137 89136 89135 89134 89133 89132 89131 89130 89129 89128 89127 89126 89125 89124 89123 89122 89121 89120 89119 89118 89117 89116 89115 89114 89113 89112 89111 89110 89109 89108 89107 89106 89105 89104 89103 89102 89101 89100 89099 89098 89097 89096 89095 89094 89093 89092 89091 89090 89089 89088 89087 89086 89085 89084 89083 89082 89081 89080 89079 89078 89077 89076 89075 89074 89073 89072 89071 89070 89069 89068 89067 89066 89065 89064 89063 89062 89061 89060 89059 89058 89057 89056 89055 89054 89053 89052 89051 89050 89049 89048 89047 89046 89045 89044 89043 89042 89041 89040 89039 89038 89037 89036 89035 89034 89033 89032 89031 89030 89029 89028 89027 89026 89025 89024 89023 89022 89021 89020 89019 89018 89017 89016 89015 89014 89013 89012 89011 89010 89009 89008 89007 89006 89005 89004 89003 89002 89001 89000 88999 88998 88997 88996 88995 88994 88993 88992 88991 88990 88989 88988 88987 88986 88985 88984 88983 88982 88981 88980 88979 88978 88977 88976 88975 88974 88973 88972 88971 88970 88969 88968 88967 88966 88965 88964 88963 88962 88961 88960 88959 88958 88957 88956 88955 88954 88953 88952 88951 88950 88949 88948 88947 88946 88945 88944 88943 88942 88941 88940 88939 88938 88937 88936 88935 88934 88933 88932 88931 88930 88929 88928 88927 88926 88925 88924 88923 88922 88921 88920 88919 88918 88917 88916 88915 88914 88913 88912 88911 88910 88909 88908 88907 88906 88905 88904 88903 88902 88901 88900 88899 88898 88897 88896 88895 88894 88893 88892 88891 88890 88889 88888 88887 88886 88885 88884 88883 88882 88881 88880 88879 88878 88877 88876 88875 88874 88873 88872 88871 88870 88869 88868 88867 88866 88865 88864 88863 88862 88861 88860 88859 88858 88857 88856 88855 88854 88853 88852 88851 88850 88849 88848 88847 88846 88845 88844 88843 88842 88841 88840 88839 88838 88837 88836 88835 88834 88833 88832 88831 88830 88829 88828 88827 88826 88825 88824 88823 88822 88821 88820 88819 88818 88817 88816 88815 88814 88813 88812 88811 88810 88809 88808 88807 88806 88805 88804 88803 88802 88801 88800 88799 88798 88797 88796 88795 88794 88793 88792 88791 88790 88789 88788 88787 88786 88785 88784 88783 88782 88781 88780 88779 88778 88777 88776 88775 88774 88773 88772 88771 88770 88769 88768 88767 88766 88765 88764 88763 88762 88761 88760 88759 88758 88757 88756 88755 88754 88753 88752 88751 88750 88749 88748 88747 88746 88745 88744 88743 88742 88741 88740 88739 88738 88737 88736 88735 88734 88733 88732 88731 88730 88729 88728 88727 88726 88725 88724 88723 88722 88721 88720 88719 88718 88717 88716 88715 88714 88713 88712 88711 88710 88709 88708 88707 88706 88705 88704 88703 88702 88701 88700 88699 88698 88697 88696 88695 88694 88693 88692 88691 88690 88689 88688 88687 88686 88685 88684 88683 88682 88681 88680 88679 88678 88677 88676 88675 88674 88673 88672 88671 88670 88669 88668 88667 88666 88665 88664 88663 88662 88661 88660 88659 88658 88657 88656 88655 88654 88653 88652 88651 88650 88649 88648 88647 88646 88645 88644 88643 88642 88641 88640 88639 88638 88637 88636 88635 88634 88633 88632 88631 88630 88629 88628 88627 88626 88625 88624 88623 88622 88621 88620 88619 88618 88617 88616 88615 88614 88613 88612 88611 88610 88609 88608 88607 88606 88605 88604 88603 88602 88601 88600 88599 88598 88597 88596 88595 88594 88593 88592 88591 88590 88589 88588 88587 88586 88585 88584 88583 88582 88581 88580 88579 88578 88577 88576 88575 88574 88573 88572 88571 88570 88569 88568 88567 88566 88565 88564 88563 88562 88561 88560 88559 88558 88557 88556 88555 88554 88553 88552 88551 88550 88549 88548 88547 88546 88545 88544 88543 88542 88541 88540 88539 88538 88537 88536 88535 88534 88533 88532 88531 88530 88529 88528 88527 88526 88525 88524 88523 88522 88521 88520 88519 88518 88517 88516 88515 88514 88513 88512 88511 88510 88509 88508 88507 88506 88505 88504 88503 88502 88501 88500 88499 88498 88497 88496 88495 88494 88493 88492 88491 88490 88489 88488 88487 88486 88485 88484 88483 88482 88481 88480 88479 88478 88477 88476 88475 88474 88473 88472 88471 88470 88469 88468 88467 88466 88465 88464 88463 88462 88461 88460 88459 88458 88457 88456 88455 88454 88453 88452 88451 88450 88449 88448 88447 88446 88445 88444 88443 88442 88441 88440 88439 88438 88437 88436 88435 88434 88433 88432 88431 88430 88429 88428 88427 88426 88425 88424 88423 88422 88421 88420 88419 88418 88417 88416 88415 88414 88413 88412 88411 88410 88409 88408 88407 88406 88405 88404 88403 88402 88401 88400 88399 88398 88397 88396 88395 88394 88393 88392 88391 88390 88389 88388 88387 88386 88385 88384 88383 88382 88381 88380 88379 88378 88377 88376 88375 88374 88373 88372 88371 88370 88369 88368 88367 88366 88365 88364 88363 88362 88361 88360 88359 88358 88357 88356 88355 88354 88353 88352 88351 88350 88349 88348 88347 88346 88345 88344 88343 88342 88341 88340 88339 88338 88337 88336 88335 88334 88333 88332 88331 88330 88329 88328 88327 88326 88325 88324 88323 88322 88321 88320 88319 88318 88317 88316 88315 88314 88313 88312 88311 88310 88309 88308 88307 88306 88305 88304 88303 88302 88301 88300 88299 88298 88297 88296 88295 88294 88293 88292 88291 88290 88289 88288 88287 88286 88285 88284 88283 88282 88281 88280 88279 88278 88277 88276 88275 88274 88273 88272 88271 88270 88269 88268 88267 88266 88265 88264 88263 88262 88261 88260 88259 88258 88257 88256 88255 88254 88253 88252 88251 88250 88249 88248 88247 88246 88245 88244 88243 88242 88241 88240 88239 88238 88237 88236 88235 88234 88233 88232 88231 88230 88229 88228 88227 88226 88225 88224 88223 88222 88221 88220 88219 88218 88217 88216 88215 88214 88213 88212 88211 88210 88209 88208 88207 88206 88205 88204 88203 88202 88201 88200 88199 88198 88197 88196 88195 88194 88193 88192 88191 88190 88189 88188 88187 88186 88185 88184 88183 88182 88181 88180 88179 88178 88177 88176 88175 88174 88173 88172 88171 88170 88169 88168 88167 88166 88165 88164 88163 88162 88161 88160 88159 88158 88157 88156 88155 88154 88153 88152 88151 88150 88149 88148 88147 88146 88145 88144 88143 88142 88141 88140 88139 88138 88137 88136 88135 88134 88133 88132 88131 88130 88129 88128 88127 88126 88125 88124 88123 88122 88121 88120 88119 88118 88117 88116 88115 88114 88113 88112 88111 88110 88109 88108 88107 88106 88105 88104 88103 88102 88101 88100 88099 88098 88097 88096 88095 88094 88093 88092 88091 88090 88089 88088 88087 88086 88085 88084 88083 88082 88081 88080 88079 88078 88077 88076 88075 88074 88073 88072 88071 88070 88069 88068 88067 88066 88065 88064 88063 88062 88061 88060 88059 88058 88057 88056 88055 88054 88053 88052 88051 88050 88049 88048 88047 88046 88045 88044 88043 88042 88041 88040 88039 88038 88037 88036 88035 88034 88033 88032 88031 88030 88029 88028 88027 88026 88025 88024 88023 88022 88021 88020 88019 88018 88017 88016 88015 88014 88013 88012 88011 88010 88009 88008 88007 88006 88005 88004 88003 88002 88001 88000 87999 87998 87997 87996 87995 87994 87993 87992 87991 87990 87989 87988 87987 87986 87985 87984 87983 87982 87981 87980 87979 87978 87977 87976 87975 87974 87973 87972 87971 87970 87969 87968 87967 87966 87965 87964 87963 87962 87961 87960 87959 87958 87957 87956 87955 87954 87953 87952 87951 87950 87949 87948 87947 87946 87945 87944 87943 87942 87941 87940 87939 87938 87937 87936 87935 87934 87933 87932 87931 87930 87929 87928 87927 87926 87925 87924 87923 87922 87921 87920 87919 87918 87917 87916 87915 87914 87913 87912 87911 87910 87909 87908 87907 87906 87905 87904 87903 87902 87901 87900 87899 87898 87897 87896 87895 87894 87893 87892 87891 87890 87889 87888 87887 87886 87885 87884 87883 87882 87881 87880 87879 87878 87877 87876 87875 87874 87873 87872 87871 87870 87869 87868 87867 87866 87865 87864 87863 87862 87861 87860 87859 87858 87857 87856 87855 87854 87853 87852 87851 87850 87849 87848 87847 87846 87845 87844 87843 87842 87841 87840 87839 87838 87837 87836 87835 87834 87833 87832 87831 87830 87829 87828 87827 87826 87825 87824 87823 87822 87821 87820 87819 87818 87817 87816 87815 87814 87813 87812 87811 87810 87809 87808 87807 87806 87805 87804 87803 87802 87801 87800 87799 87798 87797 87796 87795 87794 87793 87792 87791 87790 87789 87788 87787 87786 87785 87784 87783 87782 87781 87780 87779 87778 87777 87776 87775 87774 87773 87772 87771 87770 87769 87768 87767 87766 87765 87764 87763 87762 87761 87760 87759 87758 87757 87756 87755 87754 87753 87752 87751 87750 87749 87748 87747 87746 87745 87744 87743 87742 87741 87740 87739 87738 87737 87736 87735 87734 87733 87732 87731 87730 87729 87728 87727 87726 87725 87724 87723 87722 87721 87720 87719 87718 87717 87716 87715 87714 87713 87712 87711 87710 87709 87708 87707 87706 87705 87704 87703 87702 87701 87700 87699 87698 87697 87696 87695 87694 87693 87692 87691 87690 87689 87688 87687 87686 87685 87684 87683 87682 87681 87680 87679 87678 87677 87676 87675 87674 87673 87672 87671 87670 87669 87668 87667 87666 87665 87664 87663 87662 87661 87660 87659 87658 87657 87656 87655 87654 87653 87652 87651 87650 87649 87648 87647 87646 87645 87644 87643 87642 87641 87640 87639 87638 87637 87636 87635 87634 87633 87632 87631 87630 87629 87628 87627 87626 87625 87624 87623 87622 87621 87620 87619 87618 87617 87616 87615 87614 87613 87612 87611 87610 87609 87608 87607 87606 87605 87604 87603 87602 87601 87600 87599 87598 87597 87596 87595 87594 87593 87592 87591 87590 87589 87588 87587 87586 87585 87584 87583 87582 87581 87580 87579 87578 87577 87576 87575 87574 87573 87572 87571 87570 87569 87568 87567 87566 87565 87564 87563 87562 87561 87560 87559 87558 87557 87556 87555 87554 87553 87552 87551 87550 87549 87548 87547 87546 87545 87544 87543 87542 87541 87540 87539 87538 87537 87536 87535 87534 87533 87532 87531 87530 87529 87528 87527 87526 87525 87524 87523 87522 87521 87520 87519 87518 87517 87516 87515 87514 87513 87512 87511 87510 87509 87508 87507 87506 87505 87504 87503 87502 87501 87500 87499 87498 87497 87496 87495 87494 87493 87492 87491 87490 87489 87488 87487 87486 87485 87484 87483 87482 87481 87480 87479 87478 87477 87476 87475 87474 87473 87472 87471 87470 87469 87468 87467 87466 87465 87464 87463 87462 87461 87460 87459 87458 87457 87456 87455 87454 87453 87452 87451 87450 87449 87448 87447 87446 87445 87444 87443 87442 87441 87440 87439 87438 87437 87436 87435 87434 87433 87432 87431 87430 87429 87428 87427 87426 87425 87424 87423 87422 87421 87420 87419 87418 87417 87416 87415 87414 87413 87412 87411 87410 87409 87408 87407 87406 87405 87404 87403 87402 87401 87400 87399 87398 87397 87396 87395 87394 87393 87392 87391 87390 87389 87388 87387 87386 87385 87384 87383 87382 87381 87380 87379 87378 87377 87376 87375 87374 87373 87372 87371 87370 87369 87368 87367 87366 87365 87364 87363 87362 87361 87360 87359 87358 87357 87356 87355 87354 87353 87352 87351 87350 87349 87348 87347 87346 87345 87344 87343 87342 87341 87340 87339 87338 87337 87336 87335 87334 87333 87332 87331 87330 87329 87328 87327 87326 87325 87324 87323 87322 87321 87320 87319 87318 87317 87316 87315 87314 87313 87312 87311 87310 87309 87308 87307 87306 87305 87304 87303 87302 87301 87300 87299 87298 87297 87296 87295 87294 87293 87292 87291 87290 87289 87288 87287 87286 87285 87284 87283 87282 87281 87280 87279 87278 87277 87276 87275 87274 87273 87272 87271 87270 87269 87268 87267 87266 87265 87264 87263 87262 87261 87260 87259 87258 87257 87256 87255 87254 87253 87252 87251 87250 87249 87248 87247 87246 87245 87244 87243 87242 87241 87240 87239 87238 87237 87236 87235 87234 87233 87232 87231 87230 87229 87228 87227 87226 87225 87224 87223 87222 87221 87220 87219 87218 87217 87216 87215 87214 87213 87212 87211 87210 87209 87208 87207 87206 87205 87204 87203 87202 87201 87200 87199 87198 87197 87196 87195 87194 87193 87192 87191 87190 87189 87188 87187 87186 87185 87184 87183 87182 87181 87180 87179 87178 87177 87176 87175 87174 87173 87172 87171 87170 87169 87168 87167 87166 87165 87164 87163 87162 87161 87160 87159 87158 87157 87156 87155 87154 87153 87152 87151 87150 87149 87148 87147 87146 87145 87144 87143 87142 87141 87140 87139 87138 87137 87136 87135 87134 87133 87132 87131 87130 87129 87128 87127 87126 87125 87124 87123 87122 87121 87120 87119 87118 87117 87116 87115 87114 87113 87112 87111 87110 87109 87108 87107 87106 87105 87104 87103 87102 87101 87100 87099 87098 87097 87096 87095 87094 87093 87092 87091 87090 87089 87088 87087 87086 87085 87084 87083 87082 87081 87080 87079 87078 87077 87076 87075 87074 87073 87072 87071 87070 87069 87068 87067 87066 87065 87064 87063 87062 87061 87060 87059 87058 87057 87056 87055 87054 87053 87052 87051 87050 87049 87048 87047 87046 87045 87044 87043 87042 87041 87040 87039 87038 87037 87036 87035 87034 87033 87032 87031 87030 87029 87028 87027 87026 87025 87024 87023 87022 87021 87020 87019 87018 87017 87016 87015 87014 87013 87012 87011 87010 87009 87008 87007 87006 87005 87004 87003 87002 87001 87000 86999 86998 86997 86996 86995 86994 86993 86992 86991 86990 86989 86988 86987 86986 86985 86984 86983 86982 86981 86980 86979 86978 86977 86976 86975 86974 86973 86972 86971 86970 86969 86968 86967 86966 86965 86964 86963 86962 86961 86960 86959 86958 86957 86956 86955 86954 86953 86952 86951 86950 86949 86948 86947 86946 86945 86944 86943 86942 86941 86940 86939 86938 86937 86936 86935 86934 86933 86932 86931 86930 86929 86928 86927 86926 86925 86924 86923 86922 86921 86920 86919 86918 86917 86916 86915 86914 86913 86912 86911 86910 86909 86908 86907 86906 86905 86904 86903 86902 86901 86900 86899 86898 86897 86896 86895 86894 86893 86892 86891 86890 86889 86888 86887 86886 86885 86884 86883 86882 86881 86880 86879 86878 86877 86876 86875 86874 86873 86872 86871 86870 86869 86868 86867 86866 86865 86864 86863 86862 86861 86860 86859 86858 86857 86856 86855 86854 86853 86852 86851 86850 86849 86848 86847 86846 86845 86844 86843 86842 86841 86840 86839 86838 86837 86836 86835 86834 86833 86832 86831 86830 86829 86828 86827 86826 86825 86824 86823 86822 86821 86820 86819 86818 86817 86816 86815 86814 86813 86812 86811 86810 86809 86808 86807 86806 86805 86804 86803 86802 86801 86800 86799 86798 86797 86796 86795 86794 86793 86792 86791 86790 86789 86788 86787 86786 86785 86784 86783 86782 86781 86780 86779 86778 86777 86776 86775 86774 86773 86772 86771 86770 86769 86768 86767 86766 86765 86764 86763 86762 86761 86760 86759 86758 86757 86756 86755 86754 86753 86752 86751 86750 86749 86748 86747 86746 86745 86744 86743 86742 86741 86740 86739 86738 86737 86736 86735 86734 86733 86732 86731 86730 86729 86728 86727 86726 86725 86724 86723 86722 86721 86720 86719 86718 86717 86716 86715 86714 86713 86712 86711 86710 86709 86708 86707 86706 86705 86704 86703 86702 86701 86700 86699 86698 86697 86696 86695 86694 86693 86692 86691 86690 86689 86688 86687 86686 86685 86684 86683 86682 86681 86680 86679 86678 86677 86676 86675 86674 86673 86672 86671 86670 86669 86668 86667 86666 86665 86664 86663 86662 86661 86660 86659 86658 86657 86656 86655 86654 86653 86652 86651 86650 86649 86648 86647 86646 86645 86644 86643 86642 86641 86640 86639 86638 86637 86636 86635 86634 86633 86632 86631 86630 86629 86628 86627 86626 86625 86624 86623 86622 86621 86620 86619 86618 86617 86616 86615 86614 86613 86612 86611 86610 86609 86608 86607 86606 86605 86604 86603 86602 86601 86600 86599 86598 86597 86596 86595 86594 86593 86592 86591 86590 86589 86588 86587 86586 86585 86584 86583 86582 86581 86580 86579 86578 86577 86576 86575 86574 86573 86572 86571 86570 86569 86568 86567 86566 86565 86564 86563 86562 86561 86560 86559 86558 86557 86556 86555 86554 86553 86552 86551 86550 86549 86548 86547 86546 86545 86544 86543 86542 86541 86540 86539 86538 86537 86536 86535 86534 86533 86532 86531 86530 86529 86528 86527 86526 86525 86524 86523 86522 86521 86520 86519 86518 86517 86516 86515 86514 86513 86512 86511 86510 86509 86508 86507 86506 86505 86504 86503 86502 86501 86500 86499 86498 86497 86496 86495 86494 86493 86492 86491 86490 86489 86488 86487 86486 86485 86484 86483 86482 86481 86480 86479 86478 86477 86476 86475 86474 86473 86472 86471 86470 86469 86468 86467 86466 86465 86464 86463 86462 86461 86460 86459 86458 86457 86456 86455 86454 86453 86452 86451 86450 86449 86448 86447 86446 86445 86444 86443 86442 86441 86440 86439 86438 86437 86436 86435 86434 86433 86432 86431 86430 86429 86428 86427 86426 86425 86424 86423 86422 86421 86420 86419 86418 86417 86416 86415 86414 86413 86412 86411 86410 86409 86408 86407 86406 86405 86404 86403 86402 86401 86400 86399 86398 86397 86396 86395 86394 86393 86392 86391 86390 86389 86388 86387 86386 86385 86384 86383 86382 86381 86380 86379 86378 86377 86376 86375 86374 86373 86372 86371 86370 86369 86368 86367 86366 86365 86364 86363 86362 86361 86360 86359 86358 86357 86356 86355 86354 86353 86352 86351 86350 86349 86348 86347 86346 86345 86344 86343 86342 86341 86340 86339 86338 86337 86336 86335 86334 86333 86332 86331 86330 86329 86328 86327 86326 86325 86324 86323 86322 86321 86320 86319 86318 86317 86316 86315 86314 86313 86312 86311 86310 86309 86308 86307 86306 86305 86304 86303 86302 86301 86300 86299 86298 86297 86296 86295 86294 86293 86292 86291 86290 86289 86288 86287 86286 86285 86284 86283 86282 86281 86280 86279 86278 86277 86276 86275 86274 86273 86272 86271 86270 86269 86268 86267 86266 86265 86264 86263 86262 86261 86260 86259 86258 86257 86256 86255 86254 86253 86252 86251 86250 86249 86248 86247 86246 86245 86244 86243 86242 86241 86240 86239 86238 86237 86236 86235 86234 86233 86232 86231 86230 86229 86228 86227 86226 86225 86224 86223 86222 86221 86220 86219 86218 86217 86216 86215 86214 86213 86212 86211 86210 86209 86208 86207 86206 86205 86204 86203 86202 86201 86200 86199 86198 86197 86196 86195 86194 86193 86192 86191 86190 86189 86188 86187 86186 86185 86184 86183 86182 86181 86180 86179 86178 86177 86176 86175 86174 86173 86172 86171 86170 86169 86168 86167 86166 86165 86164 86163 86162 86161 86160 86159 86158 86157 86156 86155 86154 86153 86152 86151 86150 86149 86148 86147 86146 86145 86144 86143 86142 86141 86140 86139 86138 86137 86136 86135 86134 86133 86132 86131 86130 86129 86128 86127 86126 86125 86124 86123 86122 86121 86120 86119 86118 86117 86116 86115 86114 86113 86112 86111 86110 86109 86108 86107 86106 86105 86104 86103 86102 86101 86100 86099 86098 86097 86096 86095 86094 86093 86092 86091 86090 86089 86088 86087 86086 86085 86084 86083 86082 86081 86080 86079 86078 86077 86076 86075 86074 86073 86072 86071 86070 86069 86068 86067 86066 86065 86064 86063 86062 86061 86060 86059 86058 86057 86056 86055 86054 86053 86052 86051 86050 86049 86048 86047 86046 86045 86044 86043 86042 86041 86040 86039 86038 86037 86036 86035 86034 86033 86032 86031 86030 86029 86028 86027 86026 86025 86024 86023 86022 86021 86020 86019 86018 86017 86016 86015 86014 86013 86012 86011 86010 86009 86008 86007 86006 86005 86004 86003 86002 86001 86000 85999 85998 85997 85996 85995 85994 85993 85992 85991 85990 85989 85988 85987 85986 85985 85984 85983 85982 85981 85980 85979 85978 85977 85976 85975 85974 85973 85972 85971 85970 85969 85968 85967 85966 85965 85964 85963 85962 85961 85960 85959 85958 85957 85956 85955 85954 85953 85952 85951 85950 85949 85948 85947 85946 85945 85944 85943 85942 85941 85940 85939 85938 85937 85936 85935 85934 85933 85932 85931 85930 85929 85928 85927 85926 85925 85924 85923 85922 85921 85920 85919 85918 85917 85916 85915 85914 85913 85912 85911 85910 85909 85908 85907 85906 85905 85904 85903 85902 85901 85900 85899 85898 85897 85896 85895 85894 85893 85892 85891 85890 85889 85888 85887 85886 85885 85884 85883 85882 85881 85880 85879 85878 85877 85876 85875 85874 85873 85872 85871 85870 85869 85868 85867 85866 85865 85864 85863 85862 85861 85860 85859 85858 85857 85856 85855 85854 85853 85852 85851 85850 85849 85848 85847 85846 85845 85844 85843 85842 85841 85840 85839 85838 85837 85836 85835 85834 85833 85832 85831 85830 85829 85828 85827 85826 85825 85824 85823 85822 85821 85820 85819 85818 85817 85816 85815 85814 85813 85812 85811 85810 85809 85808 85807 85806 85805 85804 85803 85802 85801 85800 85799 85798 85797 85796 85795 85794 85793 85792 85791 85790 85789 85788 85787 85786 85785 85784 85783 85782 85781 85780 85779 85778 85777 85776 85775 85774 85773 85772 85771 85770 85769 85768 85767 85766 85765 85764 85763 85762 85761 85760 85759 85758 85757 85756 85755 85754 85753 85752 85751 85750 85749 85748 85747 85746 85745 85744 85743 85742 85741 85740 85739 85738 85737 85736 85735 85734 85733 85732 85731 85730 85729 85728 85727 85726 85725 85724 85723 85722 85721 85720 85719 85718 85717 85716 85715 85714 85713 85712 85711 85710 85709 85708 85707 85706 85705 85704 85703 85702 85701 85700 85699 85698 85697 85696 85695 85694 85693 85692 85691 85690 85689 85688 85687 85686 85685 85684 85683 85682 85681 85680 85679 85678 85677 85676 85675 85674 85673 85672 85671 85670 85669 85668 85667 85666 85665 85664 85663 85662 85661 85660 85659 85658 85657 85656 85655 85654 85653 85652 85651 85650 85649 85648 85647 85646 85645 85644 85643 85642 85641 85640 85639 85638 85637 85636 85635 85634 85633 85632 85631 85630 85629 85628 85627 85626 85625 85624 85623 85622 85621 85620 85619 85618 85617 85616 85615 85614 85613 85612 85611 85610 85609 85608 85607 85606 85605 85604 85603 85602 85601 85600 85599 85598 85597 85596 85595 85594 85593 85592 85591 85590 85589 85588 85587 85586 85585 85584 85583 85582 85581 85580 85579 85578 85577 85576 85575 85574 85573 85572 85571 85570 85569 85568 85567 85566 85565 85564 85563 85562 85561 85560 85559 85558 85557 85556 85555 85554 85553 85552 85551 85550 85549 85548 85547 85546 85545 85544 85543 85542 85541 85540 85539 85538 85537 85536 85535 85534 85533 85532 85531 85530 85529 85528 85527 85526 85525 85524 85523 85522 85521 85520 85519 85518 85517 85516 85515 85514 85513 85512 85511 85510 85509 85508 85507 85506 85505 85504 85503 85502 85501 85500 85499 85498 85497 85496 85495 85494 85493 85492 85491 85490 85489 85488 85487 85486 85485 85484 85483 85482 85481 85480 85479 85478 85477 85476 85475 85474 85473 85472 85471 85470 85469 85468 85467 85466 85465 85464 85463 85462 85461 85460 85459 85458 85457 85456 85455 85454 85453 85452 85451 85450 85449 85448 85447 85446 85445 85444 85443 85442 85441 85440 85439 85438 85437 85436 85435 85434 85433 85432 85431 85430 85429 85428 85427 85426 85425 85424 85423 85422 85421 85420 85419 85418 85417 85416 85415 85414 85413 85412 85411 85410 85409 85408 85407 85406 85405 85404 85403 85402 85401 85400 85399 85398 85397 85396 85395 85394 85393 85392 85391 85390 85389 85388 85387 85386 85385 85384 85383 85382 85381 85380 85379 85378 85377 85376 85375 85374 85373 85372 85371 85370 85369 85368 85367 85366 85365 85364 85363 85362 85361 85360 85359 85358 85357 85356 85355 85354 85353 85352 85351 85350 85349 85348 85347 85346 85345 85344 85343 85342 85341 85340 85339 85338 85337 85336 85335 85334 85333 85332 85331 85330 85329 85328 85327 85326 85325 85324 85323 85322 85321 85320 85319 85318 85317 85316 85315 85314 85313 85312 85311 85310 85309 85308 85307 85306 85305 85304 85303 85302 85301 85300 85299 85298 85297 85296 85295 85294 85293 85292 85291 85290 85289 85288 85287 85286 85285 85284 85283 85282 85281 85280 85279 85278 85277 85276 85275 85274 85273 85272 85271 85270 85269 85268 85267 85266 85265 85264 85263 85262 85261 85260 85259 85258 85257 85256 85255 85254 85253 85252 85251 85250 85249 85248 85247 85246 85245 85244 85243 85242 85241 85240 85239 85238 85237 85236 85235 85234 85233 85232 85231 85230 85229 85228 85227 85226 85225 85224 85223 85222 85221 85220 85219 85218 85217 85216 85215 85214 85213 85212 85211 85210 85209 85208 85207 85206 85205 85204 85203 85202 85201 85200 85199 85198 85197 85196 85195 85194 85193 85192 85191 85190 85189 85188 85187 85186 85185 85184 85183 85182 85181 85180 85179 85178 85177 85176 85175 85174 85173 85172 85171 85170 85169 85168 85167 85166 85165 85164 85163 85162 85161 85160 85159 85158 85157 85156 85155 85154 85153 85152 85151 85150 85149 85148 85147 85146 85145 85144 85143 85142 85141 85140 85139 85138 85137 85136 85135 85134 85133 85132 85131 85130 85129 85128 85127 85126 85125 85124 85123 85122 85121 85120 85119 85118 85117 85116 85115 85114 85113 85112 85111 85110 85109 85108 85107 85106 85105 85104 85103 85102 85101 85100 85099 85098 85097 85096 85095 85094 85093 85092 85091 85090 85089 85088 85087 85086 85085 85084 85083 85082 85081 85080 85079 85078 85077 85076 85075 85074 85073 85072 85071 85070 85069 85068 85067 85066 85065 85064 85063 85062 85061 85060 85059 85058 85057 85056 85055 85054 85053 85052 85051 85050 85049 85048 85047 85046 85045 85044 85043 85042 85041 85040 85039 85038 85037 85036 85035 85034 85033 85032 85031 85030 85029 85028 85027 85026 85025 85024 85023 85022 85021 85020 85019 85018 85017 85016 85015 85014 85013 85012 85011 85010 85009 85008 85007 85006 85005 85004 85003 85002 85001 85000 84999 84998 84997 84996 84995 84994 84993 84992 84991 84990 84989 84988 84987 84986 84985 84984 84983 84982 84981 84980 84979 84978 84977 84976 84975 84974 84973 84972 84971 84970 84969 84968 84967 84966 84965 84964 84963 84962 84961 84960 84959 84958 84957 84956 84955 84954 84953 84952 84951 84950 84949 84948 84947 84946 84945 84944 84943 84942 84941 84940 84939 84938 84937 84936 84935 84934 84933 84932 84931 84930 84929 84928 84927 84926 84925 84924 84923 84922 84921 84920 84919 84918 84917 84916 84915 84914 84913 84912 84911 84910 84909 84908 84907 84906 84905 84904 84903 84902 84901 84900 84899 84898 84897 84896 84895 84894 84893 84892 84891 84890 84889 84888 84887 84886 84885 84884 84883 84882 84881 84880 84879 84878 84877 84876 84875 84874 84873 84872 84871 84870 84869 84868 84867 84866 84865 84864 84863 84862 84861 84860 84859 84858 84857 84856 84855 84854 84853 84852 84851 84850 84849 84848 84847 84846 84845 84844 84843 84842 84841 84840 84839 84838 84837 84836 84835 84834 84833 84832 84831 84830 84829 84828 84827 84826 84825 84824 84823 84822 84821 84820 84819 84818 84817 84816 84815 84814 84813 84812 84811 84810 84809 84808 84807 84806 84805 84804 84803 84802 84801 84800 84799 84798 84797 84796 84795 84794 84793 84792 84791 84790 84789 84788 84787 84786 84785 84784 84783 84782 84781 84780 84779 84778 84777 84776 84775 84774 84773 84772 84771 84770 84769 84768 84767 84766 84765 84764 84763 84762 84761 84760 84759 84758 84757 84756 84755 84754 84753 84752 84751 84750 84749 84748 84747 84746 84745 84744 84743 84742 84741 84740 84739 84738 84737 84736 84735 84734 84733 84732 84731 84730 84729 84728 84727 84726 84725 84724 84723 84722 84721 84720 84719 84718 84717 84716 84715 84714 84713 84712 84711 84710 84709 84708 84707 84706 84705 84704 84703 84702 84701 84700 84699 84698 84697 84696 84695 84694 84693 84692 84691 84690 84689 84688 84687 84686 84685 84684 84683 84682 84681 84680 84679 84678 84677 84676 84675 84674 84673 84672 84671 84670 84669 84668 84667 84666 84665 84664 84663 84662 84661 84660 84659 84658 84657 84656 84655 84654 84653 84652 84651 84650 84649 84648 84647 84646 84645 84644 84643 84642 84641 84640 84639 84638 84637 84636 84635 84634 84633 84632 84631 84630 84629 84628 84627 84626 84625 84624 84623 84622 84621 84620 84619 84618 84617 84616 84615 84614 84613 84612 84611 84610 84609 84608 84607 84606 84605 84604 84603 84602 84601 84600 84599 84598 84597 84596 84595 84594 84593 84592 84591 84590 84589 84588 84587 84586 84585 84584 84583 84582 84581 84580 84579 84578 84577 84576 84575 84574 84573 84572 84571 84570 84569 84568 84567 84566 84565 84564 84563 84562 84561 84560 84559 84558 84557 84556 84555 84554 84553 84552 84551 84550 84549 84548 84547 84546 84545 84544 84543 84542 84541 84540 84539 84538 84537 84536 84535 84534 84533 84532 84531 84530 84529 84528 84527 84526 84525 84524 84523 84522 84521 84520 84519 84518 84517 84516 84515 84514 84513 84512 84511 84510 84509 84508 84507 84506 84505 84504 84503 84502 84501 84500 84499 84498 84497 84496 84495 84494 84493 84492 84491 84490 84489 84488 84487 84486 84485 84484 84483 84482 84481 84480 84479 84478 84477 84476 84475 84474 84473 84472 84471 84470 84469 84468 84467 84466 84465 84464 84463 84462 84461 84460 84459 84458 84457 84456 84455 84454 84453 84452 84451 84450 84449 84448 84447 84446 84445 84444 84443 84442 84441 84440 84439 84438 84437 84436 84435 84434 84433 84432 84431 84430 84429 84428 84427 84426 84425 84424 84423 84422 84421 84420 84419 84418 84417 84416 84415 84414 84413 84412 84411 84410 84409 84408 84407 84406 84405 84404 84403 84402 84401 84400 84399 84398 84397 84396 84395 84394 84393 84392 84391 84390 84389 84388 84387 84386 84385 84384 84383 84382 84381 84380 84379 84378 84377 84376 84375 84374 84373 84372 84371 84370 84369 84368 84367 84366 84365 84364 84363 84362 84361 84360 84359 84358 84357 84356 84355 84354 84353 84352 84351 84350 84349 84348 84347 84346 84345 84344 84343 84342 84341 84340 84339 84338 84337 84336 84335 84334 84333 84332 84331 84330 84329 84328 84327 84326 84325 84324 84323 84322 84321 84320 84319 84318 84317 84316 84315 84314 84313 84312 84311 84310 84309 84308 84307 84306 84305 84304 84303 84302 84301 84300 84299 84298 84297 84296 84295 84294 84293 84292 84291 84290 84289 84288 84287 84286 84285 84284 84283 84282 84281 84280 84279 84278 84277 84276 84275 84274 84273 84272 84271 84270 84269 84268 84267 84266 84265 84264 84263 84262 84261 84260 84259 84258 84257 84256 84255 84254 84253 84252 84251 84250 84249 84248 84247 84246 84245 84244 84243 84242 84241 84240 84239 84238 84237 84236 84235 84234 84233 84232 84231 84230 84229 84228 84227 84226 84225 84224 84223 84222 84221 84220 84219 84218 84217 84216 84215 84214 84213 84212 84211 84210 84209 84208 84207 84206 84205 84204 84203 84202 84201 84200 84199 84198 84197 84196 84195 84194 84193 84192 84191 84190 84189 84188 84187 84186 84185 84184 84183 84182 84181 84180 84179 84178 84177 84176 84175 84174 84173 84172 84171 84170 84169 84168 84167 84166 84165 84164 84163 84162 84161 84160 84159 84158 84157 84156 84155 84154 84153 84152 84151 84150 84149 84148 84147 84146 84145 84144 84143 84142 84141 84140 84139 84138 84137 84136 84135 84134 84133 84132 84131 84130 84129 84128 84127 84126 84125 84124 84123 84122 84121 84120 84119 84118 84117 84116 84115 84114 84113 84112 84111 84110 84109 84108 84107 84106 84105 84104 84103 84102 84101 84100 84099 84098 84097 84096 84095 84094 84093 84092 84091 84090 84089 84088 84087 84086 84085 84084 84083 84082 84081 84080 84079 84078 84077 84076 84075 84074 84073 84072 84071 84070 84069 84068 84067 84066 84065 84064 84063 84062 84061 84060 84059 84058 84057 84056 84055 84054 84053 84052 84051 84050 84049 84048 84047 84046 84045 84044 84043 84042 84041 84040 84039 84038 84037 84036 84035 84034 84033 84032 84031 84030 84029 84028 84027 84026 84025 84024 84023 84022 84021 84020 84019 84018 84017 84016 84015 84014 84013 84012 84011 84010 84009 84008 84007 84006 84005 84004 84003 84002 84001 84000 83999 83998 83997 83996 83995 83994 83993 83992 83991 83990 83989 83988 83987 83986 83985 83984 83983 83982 83981 83980 83979 83978 83977 83976 83975 83974 83973 83972 83971 83970 83969 83968 83967 83966 83965 83964 83963 83962 83961 83960 83959 83958 83957 83956 83955 83954 83953 83952 83951 83950 83949 83948 83947 83946 83945 83944 83943 83942 83941 83940 83939 83938 83937 83936 83935 83934 83933 83932 83931 83930 83929 83928 83927 83926 83925 83924 83923 83922 83921 83920 83919 83918 83917 83916 83915 83914 83913 83912 83911 83910 83909 83908 83907 83906 83905 83904 83903 83902 83901 83900 83899 83898 83897 83896 83895 83894 83893 83892 83891 83890 83889 83888 83887 83886 83885 83884 83883 83882 83881 83880 83879 83878 83877 83876 83875 83874 83873 83872 83871 83870 83869 83868 83867 83866 83865 83864 83863 83862 83861 83860 83859 83858 83857 83856 83855 83854 83853 83852 83851 83850 83849 83848 83847 83846 83845 83844 83843 83842 83841 83840 83839 83838 83837 83836 83835 83834 83833 83832 83831 83830 83829 83828 83827 83826 83825 83824 83823 83822 83821 83820 83819 83818 83817 83816 83815 83814 83813 83812 83811 83810 83809 83808 83807 83806 83805 83804 83803 83802 83801 83800 83799 83798 83797 83796 83795 83794 83793 83792 83791 83790 83789 83788 83787 83786 83785 83784 83783 83782 83781 83780 83779 83778 83777 83776 83775 83774 83773 83772 83771 83770 83769 83768 83767 83766 83765 83764 83763 83762 83761 83760 83759 83758 83757 83756 83755 83754 83753 83752 83751 83750 83749 83748 83747 83746 83745 83744 83743 83742 83741 83740 83739 83738 83737 83736 83735 83734 83733 83732 83731 83730 83729 83728 83727 83726 83725 83724 83723 83722 83721 83720 83719 83718 83717 83716 83715 83714 83713 83712 83711 83710 83709 83708 83707 83706 83705 83704 83703 83702 83701 83700 83699 83698 83697 83696 83695 83694 83693 83692 83691 83690 83689 83688 83687 83686 83685 83684 83683 83682 83681 83680 83679 83678 83677 83676 83675 83674 83673 83672 83671 83670 83669 83668 83667 83666 83665 83664 83663 83662 83661 83660 83659 83658 83657 83656 83655 83654 83653 83652 83651 83650 83649 83648 83647 83646 83645 83644 83643 83642 83641 83640 83639 83638 83637 83636 83635 83634 83633 83632 83631 83630 83629 83628 83627 83626 83625 83624 83623 83622 83621 83620 83619 83618 83617 83616 83615 83614 83613 83612 83611 83610 83609 83608 83607 83606 83605 83604 83603 83602 83601 83600 83599 83598 83597 83596 83595 83594 83593 83592 83591 83590 83589 83588 83587 83586 83585 83584 83583 83582 83581 83580 83579 83578 83577 83576 83575 83574 83573 83572 83571 83570 83569 83568 83567 83566 83565 83564 83563 83562 83561 83560 83559 83558 83557 83556 83555 83554 83553 83552 83551 83550 83549 83548 83547 83546 83545 83544 83543 83542 83541 83540 83539 83538 83537 83536 83535 83534 83533 83532 83531 83530 83529 83528 83527 83526 83525 83524 83523 83522 83521 83520 83519 83518 83517 83516 83515 83514 83513 83512 83511 83510 83509 83508 83507 83506 83505 83504 83503 83502 83501 83500 83499 83498 83497 83496 83495 83494 83493 83492 83491 83490 83489 83488 83487 83486 83485 83484 83483 83482 83481 83480 83479 83478 83477 83476 83475 83474 83473 83472 83471 83470 83469 83468 83467 83466 83465 83464 83463 83462 83461 83460 83459 83458 83457 83456 83455 83454 83453 83452 83451 83450 83449 83448 83447 83446 83445 83444 83443 83442 83441 83440 83439 83438 83437 83436 83435 83434 83433 83432 83431 83430 83429 83428 83427 83426 83425 83424 83423 83422 83421 83420 83419 83418 83417 83416 83415 83414 83413 83412 83411 83410 83409 83408 83407 83406 83405 83404 83403 83402 83401 83400 83399 83398 83397 83396 83395 83394 83393 83392 83391 83390 83389 83388 83387 83386 83385 83384 83383 83382 83381 83380 83379 83378 83377 83376 83375 83374 83373 83372 83371 83370 83369 83368 83367 83366 83365 83364 83363 83362 83361 83360 83359 83358 83357 83356 83355 83354 83353 83352 83351 83350 83349 83348 83347 83346 83345 83344 83343 83342 83341 83340 83339 83338 83337 83336 83335 83334 83333 83332 83331 83330 83329 83328 83327 83326 83325 83324 83323 83322 83321 83320 83319 83318 83317 83316 83315 83314 83313 83312 83311 83310 83309 83308 83307 83306 83305 83304 83303 83302 83301 83300 83299 83298 83297 83296 83295 83294 83293 83292 83291 83290 83289 83288 83287 83286 83285 83284 83283 83282 83281 83280 83279 83278 83277 83276 83275 83274 83273 83272 83271 83270 83269 83268 83267 83266 83265 83264 83263 83262 83261 83260 83259 83258 83257 83256 83255 83254 83253 83252 83251 83250 83249 83248 83247 83246 83245 83244 83243 83242 83241 83240 83239 83238 83237 83236 83235 83234 83233 83232 83231 83230 83229 83228 83227 83226 83225 83224 83223 83222 83221 83220 83219 83218 83217 83216 83215 83214 83213 83212 83211 83210 83209 83208 83207 83206 83205 83204 83203 83202 83201 83200 83199 83198 83197 83196 83195 83194 83193 83192 83191 83190 83189 83188 83187 83186 83185 83184 83183 83182 83181 83180 83179 83178 83177 83176 83175 83174 83173 83172 83171 83170 83169 83168 83167 83166 83165 83164 83163 83162 83161 83160 83159 83158 83157 83156 83155 83154 83153 83152 83151 83150 83149 83148 83147 83146 83145 83144 83143 83142 83141 83140 83139 83138 83137 83136 83135 83134 83133 83132 83131 83130 83129 83128 83127 83126 83125 83124 83123 83122 83121 83120 83119 83118 83117 83116 83115 83114 83113 83112 83111 83110 83109 83108 83107 83106 83105 83104 83103 83102 83101 83100 83099 83098 83097 83096 83095 83094 83093 83092 83091 83090 83089 83088 83087 83086 83085 83084 83083 83082 83081 83080 83079 83078 83077 83076 83075 83074 83073 83072 83071 83070 83069 83068 83067 83066 83065 83064 83063 83062 83061 83060 83059 83058 83057 83056 83055 83054 83053 83052 83051 83050 83049 83048 83047 83046 83045 83044 83043 83042 83041 83040 83039 83038 83037 83036 83035 83034 83033 83032 83031 83030 83029 83028 83027 83026 83025 83024 83023 83022 83021 83020 83019 83018 83017 83016 83015 83014 83013 83012 83011 83010 83009 83008 83007 83006 83005 83004 83003 83002 83001 83000 82999 82998 82997 82996 82995 82994 82993 82992 82991 82990 82989 82988 82987 82986 82985 82984 82983 82982 82981 82980 82979 82978 82977 82976 82975 82974 82973 82972 82971 82970 82969 82968 82967 82966 82965 82964 82963 82962 82961 82960 82959 82958 82957 82956 82955 82954 82953 82952 82951 82950 82949 82948 82947 82946 82945 82944 82943 82942 82941 82940 82939 82938 82937 82936 82935 82934 82933 82932 82931 82930 82929 82928 82927 82926 82925 82924 82923 82922 82921 82920 82919 82918 82917 82916 82915 82914 82913 82912 82911 82910 82909 82908 82907 82906 82905 82904 82903 82902 82901 82900 82899 82898 82897 82896 82895 82894 82893 82892 82891 82890 82889 82888 82887 82886 82885 82884 82883 82882 82881 82880 82879 82878 82877 82876 82875 82874 82873 82872 82871 82870 82869 82868 82867 82866 82865 82864 82863 82862 82861 82860 82859 82858 82857 82856 82855 82854 82853 82852 82851 82850 82849 82848 82847 82846 82845 82844 82843 82842 82841 82840 82839 82838 82837 82836 82835 82834 82833 82832 82831 82830 82829 82828 82827 82826 82825 82824 82823 82822 82821 82820 82819 82818 82817 82816 82815 82814 82813 82812 82811 82810 82809 82808 82807 82806 82805 82804 82803 82802 82801 82800 82799 82798 82797 82796 82795 82794 82793 82792 82791 82790 82789 82788 82787 82786 82785 82784 82783 82782 82781 82780 82779 82778 82777 82776 82775 82774 82773 82772 82771 82770 82769 82768 82767 82766 82765 82764 82763 82762 82761 82760 82759 82758 82757 82756 82755 82754 82753 82752 82751 82750 82749 82748 82747 82746 82745 82744 82743 82742 82741 82740 82739 82738 82737 82736 82735 82734 82733 82732 82731 82730 82729 82728 82727 82726 82725 82724 82723 82722 82721 82720 82719 82718 82717 82716 82715 82714 82713 82712 82711 82710 82709 82708 82707 82706 82705 82704 82703 82702 82701 82700 82699 82698 82697 82696 82695 82694 82693 82692 82691 82690 82689 82688 82687 82686 82685 82684 82683 82682 82681 82680 82679 82678 82677 82676 82675 82674 82673 82672 82671 82670 82669 82668 82667 82666 82665 82664 82663 82662 82661 82660 82659 82658 82657 82656 82655 82654 82653 82652 82651 82650 82649 82648 82647 82646 82645 82644 82643 82642 82641 82640 82639 82638 82637 82636 82635 82634 82633 82632 82631 82630 82629 82628 82627 82626 82625 82624 82623 82622 82621 82620 82619 82618 82617 82616 82615 82614 82613 82612 82611 82610 82609 82608 82607 82606 82605 82604 82603 82602 82601 82600 82599 82598 82597 82596 82595 82594 82593 82592 82591 82590 82589 82588 82587 82586 82585 82584 82583 82582 82581 82580 82579 82578 82577 82576 82575 82574 82573 82572 82571 82570 82569 82568 82567 82566 82565 82564 82563 82562 82561 82560 82559 82558 82557 82556 82555 82554 82553 82552 82551 82550 82549 82548 82547 82546 82545 82544 82543 82542 82541 82540 82539 82538 82537 82536 82535 82534 82533 82532 82531 82530 82529 82528 82527 82526 82525 82524 82523 82522 82521 82520 82519 82518 82517 82516 82515 82514 82513 82512 82511 82510 82509 82508 82507 82506 82505 82504 82503 82502 82501 82500 82499 82498 82497 82496 82495 82494 82493 82492 82491 82490 82489 82488 82487 82486 82485 82484 82483 82482 82481 82480 82479 82478 82477 82476 82475 82474 82473 82472 82471 82470 82469 82468 82467 82466 82465 82464 82463 82462 82461 82460 82459 82458 82457 82456 82455 82454 82453 82452 82451 82450 82449 82448 82447 82446 82445 82444 82443 82442 82441 82440 82439 82438 82437 82436 82435 82434 82433 82432 82431 82430 82429 82428 82427 82426 82425 82424 82423 82422 82421 82420 82419 82418 82417 82416 82415 82414 82413 82412 82411 82410 82409 82408 82407 82406 82405 82404 82403 82402 82401 82400 82399 82398 82397 82396 82395 82394 82393 82392 82391 82390 82389 82388 82387 82386 82385 82384 82383 82382 82381 82380 82379 82378 82377 82376 82375 82374 82373 82372 82371 82370 82369 82368 82367 82366 82365 82364 82363 82362 82361 82360 82359 82358 82357 82356 82355 82354 82353 82352 82351 82350 82349 82348 82347 82346 82345 82344 82343 82342 82341 82340 82339 82338 82337 82336 82335 82334 82333 82332 82331 82330 82329 82328 82327 82326 82325 82324 82323 82322 82321 82320 82319 82318 82317 82316 82315 82314 82313 82312 82311 82310 82309 82308 82307 82306 82305 82304 82303 82302 82301 82300 82299 82298 82297 82296 82295 82294 82293 82292 82291 82290 82289 82288 82287 82286 82285 82284 82283 82282 82281 82280 82279 82278 82277 82276 82275 82274 82273 82272 82271 82270 82269 82268 82267 82266 82265 82264 82263 82262 82261 82260 82259 82258 82257 82256 82255 82254 82253 82252 82251 82250 82249 82248 82247 82246 82245 82244 82243 82242 82241 82240 82239 82238 82237 82236 82235 82234 82233 82232 82231 82230 82229 82228 82227 82226 82225 82224 82223 82222 82221 82220 82219 82218 82217 82216 82215 82214 82213 82212 82211 82210 82209 82208 82207 82206 82205 82204 82203 82202 82201 82200 82199 82198 82197 82196 82195 82194 82193 82192 82191 82190 82189 82188 82187 82186 82185 82184 82183 82182 82181 82180 82179 82178 82177 82176 82175 82174 82173 82172 82171 82170 82169 82168 82167 82166 82165 82164 82163 82162 82161 82160 82159 82158 82157 82156 82155 82154 82153 82152 82151 82150 82149 82148 82147 82146 82145 82144 82143 82142 82141 82140 82139 82138 82137 82136 82135 82134 82133 82132 82131 82130 82129 82128 82127 82126 82125 82124 82123 82122 82121 82120 82119 82118 82117 82116 82115 82114 82113 82112 82111 82110 82109 82108 82107 82106 82105 82104 82103 82102 82101 82100 82099 82098 82097 82096 82095 82094 82093 82092 82091 82090 82089 82088 82087 82086 82085 82084 82083 82082 82081 82080 82079 82078 82077 82076 82075 82074 82073 82072 82071 82070 82069 82068 82067 82066 82065 82064 82063 82062 82061 82060 82059 82058 82057 82056 82055 82054 82053 82052 82051 82050 82049 82048 82047 82046 82045 82044 82043 82042 82041 82040 82039 82038 82037 82036 82035 82034 82033 82032 82031 82030 82029 82028 82027 82026 82025 82024 82023 82022 82021 82020 82019 82018 82017 82016 82015 82014 82013 82012 82011 82010 82009 82008 82007 82006 82005 82004 82003 82002 82001 82000 81999 81998 81997 81996 81995 81994 81993 81992 81991 81990 81989 81988 81987 81986 81985 81984 81983 81982 81981 81980 81979 81978 81977 81976 81975 81974 81973 81972 81971 81970 81969 81968 81967 81966 81965 81964 81963 81962 81961 81960 81959 81958 81957 81956 81955 81954 81953 81952 81951 81950 81949 81948 81947 81946 81945 81944 81943 81942 81941 81940 81939 81938 81937 81936 81935 81934 81933 81932 81931 81930 81929 81928 81927 81926 81925 81924 81923 81922 81921 81920 81919 81918 81917 81916 81915 81914 81913 81912 81911 81910 81909 81908 81907 81906 81905 81904 81903 81902 81901 81900 81899 81898 81897 81896 81895 81894 81893 81892 81891 81890 81889 81888 81887 81886 81885 81884 81883 81882 81881 81880 81879 81878 81877 81876 81875 81874 81873 81872 81871 81870 81869 81868 81867 81866 81865 81864 81863 81862 81861 81860 81859 81858 81857 81856 81855 81854 81853 81852 81851 81850 81849 81848 81847 81846 81845 81844 81843 81842 81841 81840 81839 81838 81837 81836 81835 81834 81833 81832 81831 81830 81829 81828 81827 81826 81825 81824 81823 81822 81821 81820 81819 81818 81817 81816 81815 81814 81813 81812 81811 81810 81809 81808 81807 81806 81805 81804 81803 81802 81801 81800 81799 81798 81797 81796 81795 81794 81793 81792 81791 81790 81789 81788 81787 81786 81785 81784 81783 81782 81781 81780 81779 81778 81777 81776 81775 81774 81773 81772 81771 81770 81769 81768 81767 81766 81765 81764 81763 81762 81761 81760 81759 81758 81757 81756 81755 81754 81753 81752 81751 81750 81749 81748 81747 81746 81745 81744 81743 81742 81741 81740 81739 81738 81737 81736 81735 81734 81733 81732 81731 81730 81729 81728 81727 81726 81725 81724 81723 81722 81721 81720 81719 81718 81717 81716 81715 81714 81713 81712 81711 81710 81709 81708 81707 81706 81705 81704 81703 81702 81701 81700 81699 81698 81697 81696 81695 81694 81693 81692 81691 81690 81689 81688 81687 81686 81685 81684 81683 81682 81681 81680 81679 81678 81677 81676 81675 81674 81673 81672 81671 81670 81669 81668 81667 81666 81665 81664 81663 81662 81661 81660 81659 81658 81657 81656 81655 81654 81653 81652 81651 81650 81649 81648 81647 81646 81645 81644 81643 81642 81641 81640 81639 81638 81637 81636 81635 81634 81633 81632 81631 81630 81629 81628 81627 81626 81625 81624 81623 81622 81621 81620 81619 81618 81617 81616 81615 81614 81613 81612 81611 81610 81609 81608 81607 81606 81605 81604 81603 81602 81601 81600 81599 81598 81597 81596 81595 81594 81593 81592 81591 81590 81589 81588 81587 81586 81585 81584 81583 81582 81581 81580 81579 81578 81577 81576 81575 81574 81573 81572 81571 81570 81569 81568 81567 81566 81565 81564 81563 81562 81561 81560 81559 81558 81557 81556 81555 81554 81553 81552 81551 81550 81549 81548 81547 81546 81545 81544 81543 81542 81541 81540 81539 81538 81537 81536 81535 81534 81533 81532 81531 81530 81529 81528 81527 81526 81525 81524 81523 81522 81521 81520 81519 81518 81517 81516 81515 81514 81513 81512 81511 81510 81509 81508 81507 81506 81505 81504 81503 81502 81501 81500 81499 81498 81497 81496 81495 81494 81493 81492 81491 81490 81489 81488 81487 81486 81485 81484 81483 81482 81481 81480 81479 81478 81477 81476 81475 81474 81473 81472 81471 81470 81469 81468 81467 81466 81465 81464 81463 81462 81461 81460 81459 81458 81457 81456 81455 81454 81453 81452 81451 81450 81449 81448 81447 81446 81445 81444 81443 81442 81441 81440 81439 81438 81437 81436 81435 81434 81433 81432 81431 81430 81429 81428 81427 81426 81425 81424 81423 81422 81421 81420 81419 81418 81417 81416 81415 81414 81413 81412 81411 81410 81409 81408 81407 81406 81405 81404 81403 81402 81401 81400 81399 81398 81397 81396 81395 81394 81393 81392 81391 81390 81389 81388 81387 81386 81385 81384 81383 81382 81381 81380 81379 81378 81377 81376 81375 81374 81373 81372 81371 81370 81369 81368 81367 81366 81365 81364 81363 81362 81361 81360 81359 81358 81357 81356 81355 81354 81353 81352 81351 81350 81349 81348 81347 81346 81345 81344 81343 81342 81341 81340 81339 81338 81337 81336 81335 81334 81333 81332 81331 81330 81329 81328 81327 81326 81325 81324 81323 81322 81321 81320 81319 81318 81317 81316 81315 81314 81313 81312 81311 81310 81309 81308 81307 81306 81305 81304 81303 81302 81301 81300 81299 81298 81297 81296 81295 81294 81293 81292 81291 81290 81289 81288 81287 81286 81285 81284 81283 81282 81281 81280 81279 81278 81277 81276 81275 81274 81273 81272 81271 81270 81269 81268 81267 81266 81265 81264 81263 81262 81261 81260 81259 81258 81257 81256 81255 81254 81253 81252 81251 81250 81249 81248 81247 81246 81245 81244 81243 81242 81241 81240 81239 81238 81237 81236 81235 81234 81233 81232 81231 81230 81229 81228 81227 81226 81225 81224 81223 81222 81221 81220 81219 81218 81217 81216 81215 81214 81213 81212 81211 81210 81209 81208 81207 81206 81205 81204 81203 81202 81201 81200 81199 81198 81197 81196 81195 81194 81193 81192 81191 81190 81189 81188 81187 81186 81185 81184 81183 81182 81181 81180 81179 81178 81177 81176 81175 81174 81173 81172 81171 81170 81169 81168 81167 81166 81165 81164 81163 81162 81161 81160 81159 81158 81157 81156 81155 81154 81153 81152 81151 81150 81149 81148 81147 81146 81145 81144 81143 81142 81141 81140 81139 81138 81137 81136 81135 81134 81133 81132 81131 81130 81129 81128 81127 81126 81125 81124 81123 81122 81121 81120 81119 81118 81117 81116 81115 81114 81113 81112 81111 81110 81109 81108 81107 81106 81105 81104 81103 81102 81101 81100 81099 81098 81097 81096 81095 81094 81093 81092 81091 81090 81089 81088 81087 81086 81085 81084 81083 81082 81081 81080 81079 81078 81077 81076 81075 81074 81073 81072 81071 81070 81069 81068 81067 81066 81065 81064 81063 81062 81061 81060 81059 81058 81057 81056 81055 81054 81053 81052 81051 81050 81049 81048 81047 81046 81045 81044 81043 81042 81041 81040 81039 81038 81037 81036 81035 81034 81033 81032 81031 81030 81029 81028 81027 81026 81025 81024 81023 81022 81021 81020 81019 81018 81017 81016 81015 81014 81013 81012 81011 81010 81009 81008 81007 81006 81005 81004 81003 81002 81001 81000 80999 80998 80997 80996 80995 80994 80993 80992 80991 80990 80989 80988 80987 80986 80985 80984 80983 80982 80981 80980 80979 80978 80977 80976 80975 80974 80973 80972 80971 80970 80969 80968 80967 80966 80965 80964 80963 80962 80961 80960 80959 80958 80957 80956 80955 80954 80953 80952 80951 80950 80949 80948 80947 80946 80945 80944 80943 80942 80941 80940 80939 80938 80937 80936 80935 80934 80933 80932 80931 80930 80929 80928 80927 80926 80925 80924 80923 80922 80921 80920 80919 80918 80917 80916 80915 80914 80913 80912 80911 80910 80909 80908 80907 80906 80905 80904 80903 80902 80901 80900 80899 80898 80897 80896 80895 80894 80893 80892 80891 80890 80889 80888 80887 80886 80885 80884 80883 80882 80881 80880 80879 80878 80877 80876 80875 80874 80873 80872 80871 80870 80869 80868 80867 80866 80865 80864 80863 80862 80861 80860 80859 80858 80857 80856 80855 80854 80853 80852 80851 80850 80849 80848 80847 80846 80845 80844 80843 80842 80841 80840 80839 80838 80837 80836 80835 80834 80833 80832 80831 80830 80829 80828 80827 80826 80825 80824 80823 80822 80821 80820 80819 80818 80817 80816 80815 80814 80813 80812 80811 80810 80809 80808 80807 80806 80805 80804 80803 80802 80801 80800 80799 80798 80797 80796 80795 80794 80793 80792 80791 80790 80789 80788 80787 80786 80785 80784 80783 80782 80781 80780 80779 80778 80777 80776 80775 80774 80773 80772 80771 80770 80769 80768 80767 80766 80765 80764 80763 80762 80761 80760 80759 80758 80757 80756 80755 80754 80753 80752 80751 80750 80749 80748 80747 80746 80745 80744 80743 80742 80741 80740 80739 80738 80737 80736 80735 80734 80733 80732 80731 80730 80729 80728 80727 80726 80725 80724 80723 80722 80721 80720 80719 80718 80717 80716 80715 80714 80713 80712 80711 80710 80709 80708 80707 80706 80705 80704 80703 80702 80701 80700 80699 80698 80697 80696 80695 80694 80693 80692 80691 80690 80689 80688 80687 80686 80685 80684 80683 80682 80681 80680 80679 80678 80677 80676 80675 80674 80673 80672 80671 80670 80669 80668 80667 80666 80665 80664 80663 80662 80661 80660 80659 80658 80657 80656 80655 80654 80653 80652 80651 80650 80649 80648 80647 80646 80645 80644 80643 80642 80641 80640 80639 80638 80637 80636 80635 80634 80633 80632 80631 80630 80629 80628 80627 80626 80625 80624 80623 80622 80621 80620 80619 80618 80617 80616 80615 80614 80613 80612 80611 80610 80609 80608 80607 80606 80605 80604 80603 80602 80601 80600 80599 80598 80597 80596 80595 80594 80593 80592 80591 80590 80589 80588 80587 80586 80585 80584 80583 80582 80581 80580 80579 80578 80577 80576 80575 80574 80573 80572 80571 80570 80569 80568 80567 80566 80565 80564 80563 80562 80561 80560 80559 80558 80557 80556 80555 80554 80553 80552 80551 80550 80549 80548 80547 80546 80545 80544 80543 80542 80541 80540 80539 80538 80537 80536 80535 80534 80533 80532 80531 80530 80529 80528 80527 80526 80525 80524 80523 80522 80521 80520 80519 80518 80517 80516 80515 80514 80513 80512 80511 80510 80509 80508 80507 80506 80505 80504 80503 80502 80501 80500 80499 80498 80497 80496 80495 80494 80493 80492 80491 80490 80489 80488 80487 80486 80485 80484 80483 80482 80481 80480 80479 80478 80477 80476 80475 80474 80473 80472 80471 80470 80469 80468 80467 80466 80465 80464 80463 80462 80461 80460 80459 80458 80457 80456 80455 80454 80453 80452 80451 80450 80449 80448 80447 80446 80445 80444 80443 80442 80441 80440 80439 80438 80437 80436 80435 80434 80433 80432 80431 80430 80429 80428 80427 80426 80425 80424 80423 80422 80421 80420 80419 80418 80417 80416 80415 80414 80413 80412 80411 80410 80409 80408 80407 80406 80405 80404 80403 80402 80401 80400 80399 80398 80397 80396 80395 80394 80393 80392 80391 80390 80389 80388 80387 80386 80385 80384 80383 80382 80381 80380 80379 80378 80377 80376 80375 80374 80373 80372 80371 80370 80369 80368 80367 80366 80365 80364 80363 80362 80361 80360 80359 80358 80357 80356 80355 80354 80353 80352 80351 80350 80349 80348 80347 80346 80345 80344 80343 80342 80341 80340 80339 80338 80337 80336 80335 80334 80333 80332 80331 80330 80329 80328 80327 80326 80325 80324 80323 80322 80321 80320 80319 80318 80317 80316 80315 80314 80313 80312 80311 80310 80309 80308 80307 80306 80305 80304 80303 80302 80301 80300 80299 80298 80297 80296 80295 80294 80293 80292 80291 80290 80289 80288 80287 80286 80285 80284 80283 80282 80281 80280 80279 80278 80277 80276 80275 80274 80273 80272 80271 80270 80269 80268 80267 80266 80265 80264 80263 80262 80261 80260 80259 80258 80257 80256 80255 80254 80253 80252 80251 80250 80249 80248 80247 80246 80245 80244 80243 80242 80241 80240 80239 80238 80237 80236 80235 80234 80233 80232 80231 80230 80229 80228 80227 80226 80225 80224 80223 80222 80221 80220 80219 80218 80217 80216 80215 80214 80213 80212 80211 80210 80209 80208 80207 80206 80205 80204 80203 80202 80201 80200 80199 80198 80197 80196 80195 80194 80193 80192 80191 80190 80189 80188 80187 80186 80185 80184 80183 80182 80181 80180 80179 80178 80177 80176 80175 80174 80173 80172 80171 80170 80169 80168 80167 80166 80165 80164 80163 80162 80161 80160 80159 80158 80157 80156 80155 80154 80153 80152 80151 80150 80149 80148 80147 80146 80145 80144 80143 80142 80141 80140 80139 80138 80137 80136 80135 80134 80133 80132 80131 80130 80129 80128 80127 80126 80125 80124 80123 80122 80121 80120 80119 80118 80117 80116 80115 80114 80113 80112 80111 80110 80109 80108 80107 80106 80105 80104 80103 80102 80101 80100 80099 80098 80097 80096 80095 80094 80093 80092 80091 80090 80089 80088 80087 80086 80085 80084 80083 80082 80081 80080 80079 80078 80077 80076 80075 80074 80073 80072 80071 80070 80069 80068 80067 80066 80065 80064 80063 80062 80061 80060 80059 80058 80057 80056 80055 80054 80053 80052 80051 80050 80049 80048 80047 80046 80045 80044 80043 80042 80041 80040 80039 80038 80037 80036 80035 80034 80033 80032 80031 80030 80029 80028 80027 80026 80025 80024 80023 80022 80021 80020 80019 80018 80017 80016 80015 80014 80013 80012 80011 80010 80009 80008 80007 80006 80005 80004 80003 80002 80001 80000 79999 79998 79997 79996 79995 79994 79993 79992 79991 79990 79989 79988 79987 79986 79985 79984 79983 79982 79981 79980 79979 79978 79977 79976 79975 79974 79973 79972 79971 79970 79969 79968 79967 79966 79965 79964 79963 79962 79961 79960 79959 79958 79957 79956 79955 79954 79953 79952 79951 79950 79949 79948 79947 79946 79945 79944 79943 79942 79941 79940 79939 79938 79937 79936 79935 79934 79933 79932 79931 79930 79929 79928 79927 79926 79925 79924 79923 79922 79921 79920 79919 79918 79917 79916 79915 79914 79913 79912 79911 79910 79909 79908 79907 79906 79905 79904 79903 79902 79901 79900 79899 79898 79897 79896 79895 79894 79893 79892 79891 79890 79889 79888 79887 79886 79885 79884 79883 79882 79881 79880 79879 79878 79877 79876 79875 79874 79873 79872 79871 79870 79869 79868 79867 79866 79865 79864 79863 79862 79861 79860 79859 79858 79857 79856 79855 79854 79853 79852 79851 79850 79849 79848 79847 79846 79845 79844 79843 79842 79841 79840 79839 79838 79837 79836 79835 79834 79833 79832 79831 79830 79829 79828 79827 79826 79825 79824 79823 79822 79821 79820 79819 79818 79817 79816 79815 79814 79813 79812 79811 79810 79809 79808 79807 79806 79805 79804 79803 79802 79801 79800 79799 79798 79797 79796 79795 79794 79793 79792 79791 79790 79789 79788 79787 79786 79785 79784 79783 79782 79781 79780 79779 79778 79777 79776 79775 79774 79773 79772 79771 79770 79769 79768 79767 79766 79765 79764 79763 79762 79761 79760 79759 79758 79757 79756 79755 79754 79753 79752 79751 79750 79749 79748 79747 79746 79745 79744 79743 79742 79741 79740 79739 79738 79737 79736 79735 79734 79733 79732 79731 79730 79729 79728 79727 79726 79725 79724 79723 79722 79721 79720 79719 79718 79717 79716 79715 79714 79713 79712 79711 79710 79709 79708 79707 79706 79705 79704 79703 79702 79701 79700 79699 79698 79697 79696 79695 79694 79693 79692 79691 79690 79689 79688 79687 79686 79685 79684 79683 79682 79681 79680 79679 79678 79677 79676 79675 79674 79673 79672 79671 79670 79669 79668 79667 79666 79665 79664 79663 79662 79661 79660 79659 79658 79657 79656 79655 79654 79653 79652 79651 79650 79649 79648 79647 79646 79645 79644 79643 79642 79641 79640 79639 79638 79637 79636 79635 79634 79633 79632 79631 79630 79629 79628 79627 79626 79625 79624 79623 79622 79621 79620 79619 79618 79617 79616 79615 79614 79613 79612 79611 79610 79609 79608 79607 79606 79605 79604 79603 79602 79601 79600 79599 79598 79597 79596 79595 79594 79593 79592 79591 79590 79589 79588 79587 79586 79585 79584 79583 79582 79581 79580 79579 79578 79577 79576 79575 79574 79573 79572 79571 79570 79569 79568 79567 79566 79565 79564 79563 79562 79561 79560 79559 79558 79557 79556 79555 79554 79553 79552 79551 79550 79549 79548 79547 79546 79545 79544 79543 79542 79541 79540 79539 79538 79537 79536 79535 79534 79533 79532 79531 79530 79529 79528 79527 79526 79525 79524 79523 79522 79521 79520 79519 79518 79517 79516 79515 79514 79513 79512 79511 79510 79509 79508 79507 79506 79505 79504 79503 79502 79501 79500 79499 79498 79497 79496 79495 79494 79493 79492 79491 79490 79489 79488 79487 79486 79485 79484 79483 79482 79481 79480 79479 79478 79477 79476 79475 79474 79473 79472 79471 79470 79469 79468 79467 79466 79465 79464 79463 79462 79461 79460 79459 79458 79457 79456 79455 79454 79453 79452 79451 79450 79449 79448 79447 79446 79445 79444 79443 79442 79441 79440 79439 79438 79437 79436 79435 79434 79433 79432 79431 79430 79429 79428 79427 79426 79425 79424 79423 79422 79421 79420 79419 79418 79417 79416 79415 79414 79413 79412 79411 79410 79409 79408 79407 79406 79405 79404 79403 79402 79401 79400 79399 79398 79397 79396 79395 79394 79393 79392 79391 79390 79389 79388 79387 79386 79385 79384 79383 79382 79381 79380 79379 79378 79377 79376 79375 79374 79373 79372 79371 79370 79369 79368 79367 79366 79365 79364 79363 79362 79361 79360 79359 79358 79357 79356 79355 79354 79353 79352 79351 79350 79349 79348 79347 79346 79345 79344 79343 79342 79341 79340 79339 79338 79337 79336 79335 79334 79333 79332 79331 79330 79329 79328 79327 79326 79325 79324 79323 79322 79321 79320 79319 79318 79317 79316 79315 79314 79313 79312 79311 79310 79309 79308 79307 79306 79305 79304 79303 79302 79301 79300 79299 79298 79297 79296 79295 79294 79293 79292 79291 79290 79289 79288 79287 79286 79285 79284 79283 79282 79281 79280 79279 79278 79277 79276 79275 79274 79273 79272 79271 79270 79269 79268 79267 79266 79265 79264 79263 79262 79261 79260 79259 79258 79257 79256 79255 79254 79253 79252 79251 79250 79249 79248 79247 79246 79245 79244 79243 79242 79241 79240 79239 79238 79237 79236 79235 79234 79233 79232 79231 79230 79229 79228 79227 79226 79225 79224 79223 79222 79221 79220 79219 79218 79217 79216 79215 79214 79213 79212 79211 79210 79209 79208 79207 79206 79205 79204 79203 79202 79201 79200 79199 79198 79197 79196 79195 79194 79193 79192 79191 79190 79189 79188 79187 79186 79185 79184 79183 79182 79181 79180 79179 79178 79177 79176 79175 79174 79173 79172 79171 79170 79169 79168 79167 79166 79165 79164 79163 79162 79161 79160 79159 79158 79157 79156 79155 79154 79153 79152 79151 79150 79149 79148 79147 79146 79145 79144 79143 79142 79141 79140 79139 79138 79137 79136 79135 79134 79133 79132 79131 79130 79129 79128 79127 79126 79125 79124 79123 79122 79121 79120 79119 79118 79117 79116 79115 79114 79113 79112 79111 79110 79109 79108 79107 79106 79105 79104 79103 79102 79101 79100 79099 79098 79097 79096 79095 79094 79093 79092 79091 79090 79089 79088 79087 79086 79085 79084 79083 79082 79081 79080 79079 79078 79077 79076 79075 79074 79073 79072 79071 79070 79069 79068 79067 79066 79065 79064 79063 79062 79061 79060 79059 79058 79057 79056 79055 79054 79053 79052 79051 79050 79049 79048 79047 79046 79045 79044 79043 79042 79041 79040 79039 79038 79037 79036 79035 79034 79033 79032 79031 79030 79029 79028 79027 79026 79025 79024 79023 79022 79021 79020 79019 79018 79017 79016 79015 79014 79013 79012 79011 79010 79009 79008 79007 79006 79005 79004 79003 79002 79001 79000 78999 78998 78997 78996 78995 78994 78993 78992 78991 78990 78989 78988 78987 78986 78985 78984 78983 78982 78981 78980 78979 78978 78977 78976 78975 78974 78973 78972 78971 78970 78969 78968 78967 78966 78965 78964 78963 78962 78961 78960 78959 78958 78957 78956 78955 78954 78953 78952 78951 78950 78949 78948 78947 78946 78945 78944 78943 78942 78941 78940 78939 78938 78937 78936 78935 78934 78933 78932 78931 78930 78929 78928 78927 78926 78925 78924 78923 78922 78921 78920 78919 78918 78917 78916 78915 78914 78913 78912 78911 78910 78909 78908 78907 78906 78905 78904 78903 78902 78901 78900 78899 78898 78897 78896 78895 78894 78893 78892 78891 78890 78889 78888 78887 78886 78885 78884 78883 78882 78881 78880 78879 78878 78877 78876 78875 78874 78873 78872 78871 78870 78869 78868 78867 78866 78865 78864 78863 78862 78861 78860 78859 78858 78857 78856 78855 78854 78853 78852 78851 78850 78849 78848 78847 78846 78845 78844 78843 78842 78841 78840 78839 78838 78837 78836 78835 78834 78833 78832 78831 78830 78829 78828 78827 78826 78825 78824 78823 78822 78821 78820 78819 78818 78817 78816 78815 78814 78813 78812 78811 78810 78809 78808 78807 78806 78805 78804 78803 78802 78801 78800 78799 78798 78797 78796 78795 78794 78793 78792 78791 78790 78789 78788 78787 78786 78785 78784 78783 78782 78781 78780 78779 78778 78777 78776 78775 78774 78773 78772 78771 78770 78769 78768 78767 78766 78765 78764 78763 78762 78761 78760 78759 78758 78757 78756 78755 78754 78753 78752 78751 78750 78749 78748 78747 78746 78745 78744 78743 78742 78741 78740 78739 78738 78737 78736 78735 78734 78733 78732 78731 78730 78729 78728 78727 78726 78725 78724 78723 78722 78721 78720 78719 78718 78717 78716 78715 78714 78713 78712 78711 78710 78709 78708 78707 78706 78705 78704 78703 78702 78701 78700 78699 78698 78697 78696 78695 78694 78693 78692 78691 78690 78689 78688 78687 78686 78685 78684 78683 78682 78681 78680 78679 78678 78677 78676 78675 78674 78673 78672 78671 78670 78669 78668 78667 78666 78665 78664 78663 78662 78661 78660 78659 78658 78657 78656 78655 78654 78653 78652 78651 78650 78649 78648 78647 78646 78645 78644 78643 78642 78641 78640 78639 78638 78637 78636 78635 78634 78633 78632 78631 78630 78629 78628 78627 78626 78625 78624 78623 78622 78621 78620 78619 78618 78617 78616 78615 78614 78613 78612 78611 78610 78609 78608 78607 78606 78605 78604 78603 78602 78601 78600 78599 78598 78597 78596 78595 78594 78593 78592 78591 78590 78589 78588 78587 78586 78585 78584 78583 78582 78581 78580 78579 78578 78577 78576 78575 78574 78573 78572 78571 78570 78569 78568 78567 78566 78565 78564 78563 78562 78561 78560 78559 78558 78557 78556 78555 78554 78553 78552 78551 78550 78549 78548 78547 78546 78545 78544 78543 78542 78541 78540 78539 78538 78537 78536 78535 78534 78533 78532 78531 78530 78529 78528 78527 78526 78525 78524 78523 78522 78521 78520 78519 78518 78517 78516 78515 78514 78513 78512 78511 78510 78509 78508 78507 78506 78505 78504 78503 78502 78501 78500 78499 78498 78497 78496 78495 78494 78493 78492 78491 78490 78489 78488 78487 78486 78485 78484 78483 78482 78481 78480 78479 78478 78477 78476 78475 78474 78473 78472 78471 78470 78469 78468 78467 78466 78465 78464 78463 78462 78461 78460 78459 78458 78457 78456 78455 78454 78453 78452 78451 78450 78449 78448 78447 78446 78445 78444 78443 78442 78441 78440 78439 78438 78437 78436 78435 78434 78433 78432 78431 78430 78429 78428 78427 78426 78425 78424 78423 78422 78421 78420 78419 78418 78417 78416 78415 78414 78413 78412 78411 78410 78409 78408 78407 78406 78405 78404 78403 78402 78401 78400 78399 78398 78397 78396 78395 78394 78393 78392 78391 78390 78389 78388 78387 78386 78385 78384 78383 78382 78381 78380 78379 78378 78377 78376 78375 78374 78373 78372 78371 78370 78369 78368 78367 78366 78365 78364 78363 78362 78361 78360 78359 78358 78357 78356 78355 78354 78353 78352 78351 78350 78349 78348 78347 78346 78345 78344 78343 78342 78341 78340 78339 78338 78337 78336 78335 78334 78333 78332 78331 78330 78329 78328 78327 78326 78325 78324 78323 78322 78321 78320 78319 78318 78317 78316 78315 78314 78313 78312 78311 78310 78309 78308 78307 78306 78305 78304 78303 78302 78301 78300 78299 78298 78297 78296 78295 78294 78293 78292 78291 78290 78289 78288 78287 78286 78285 78284 78283 78282 78281 78280 78279 78278 78277 78276 78275 78274 78273 78272 78271 78270 78269 78268 78267 78266 78265 78264 78263 78262 78261 78260 78259 78258 78257 78256 78255 78254 78253 78252 78251 78250 78249 78248 78247 78246 78245 78244 78243 78242 78241 78240 78239 78238 78237 78236 78235 78234 78233 78232 78231 78230 78229 78228 78227 78226 78225 78224 78223 78222 78221 78220 78219 78218 78217 78216 78215 78214 78213 78212 78211 78210 78209 78208 78207 78206 78205 78204 78203 78202 78201 78200 78199 78198 78197 78196 78195 78194 78193 78192 78191 78190 78189 78188 78187 78186 78185 78184 78183 78182 78181 78180 78179 78178 78177 78176 78175 78174 78173 78172 78171 78170 78169 78168 78167 78166 78165 78164 78163 78162 78161 78160 78159 78158 78157 78156 78155 78154 78153 78152 78151 78150 78149 78148 78147 78146 78145 78144 78143 78142 78141 78140 78139 78138 78137 78136 78135 78134 78133 78132 78131 78130 78129 78128 78127 78126 78125 78124 78123 78122 78121 78120 78119 78118 78117 78116 78115 78114 78113 78112 78111 78110 78109 78108 78107 78106 78105 78104 78103 78102 78101 78100 78099 78098 78097 78096 78095 78094 78093 78092 78091 78090 78089 78088 78087 78086 78085 78084 78083 78082 78081 78080 78079 78078 78077 78076 78075 78074 78073 78072 78071 78070 78069 78068 78067 78066 78065 78064 78063 78062 78061 78060 78059 78058 78057 78056 78055 78054 78053 78052 78051 78050 78049 78048 78047 78046 78045 78044 78043 78042 78041 78040 78039 78038 78037 78036 78035 78034 78033 78032 78031 78030 78029 78028 78027 78026 78025 78024 78023 78022 78021 78020 78019 78018 78017 78016 78015 78014 78013 78012 78011 78010 78009 78008 78007 78006 78005 78004 78003 78002 78001 78000 77999 77998 77997 77996 77995 77994 77993 77992 77991 77990 77989 77988 77987 77986 77985 77984 77983 77982 77981 77980 77979 77978 77977 77976 77975 77974 77973 77972 77971 77970 77969 77968 77967 77966 77965 77964 77963 77962 77961 77960 77959 77958 77957 77956 77955 77954 77953 77952 77951 77950 77949 77948 77947 77946 77945 77944 77943 77942 77941 77940 77939 77938 77937 77936 77935 77934 77933 77932 77931 77930 77929 77928 77927 77926 77925 77924 77923 77922 77921 77920 77919 77918 77917 77916 77915 77914 77913 77912 77911 77910 77909 77908 77907 77906 77905 77904 77903 77902 77901 77900 77899 77898 77897 77896 77895 77894 77893 77892 77891 77890 77889 77888 77887 77886 77885 77884 77883 77882 77881 77880 77879 77878 77877 77876 77875 77874 77873 77872 77871 77870 77869 77868 77867 77866 77865 77864 77863 77862 77861 77860 77859 77858 77857 77856 77855 77854 77853 77852 77851 77850 77849 77848 77847 77846 77845 77844 77843 77842 77841 77840 77839 77838 77837 77836 77835 77834 77833 77832 77831 77830 77829 77828 77827 77826 77825 77824 77823 77822 77821 77820 77819 77818 77817 77816 77815 77814 77813 77812 77811 77810 77809 77808 77807 77806 77805 77804 77803 77802 77801 77800 77799 77798 77797 77796 77795 77794 77793 77792 77791 77790 77789 77788 77787 77786 77785 77784 77783 77782 77781 77780 77779 77778 77777 77776 77775 77774 77773 77772 77771 77770 77769 77768 77767 77766 77765 77764 77763 77762 77761 77760 77759 77758 77757 77756 77755 77754 77753 77752 77751 77750 77749 77748 77747 77746 77745 77744 77743 77742 77741 77740 77739 77738 77737 77736 77735 77734 77733 77732 77731 77730 77729 77728 77727 77726 77725 77724 77723 77722 77721 77720 77719 77718 77717 77716 77715 77714 77713 77712 77711 77710 77709 77708 77707 77706 77705 77704 77703 77702 77701 77700 77699 77698 77697 77696 77695 77694 77693 77692 77691 77690 77689 77688 77687 77686 77685 77684 77683 77682 77681 77680 77679 77678 77677 77676 77675 77674 77673 77672 77671 77670 77669 77668 77667 77666 77665 77664 77663 77662 77661 77660 77659 77658 77657 77656 77655 77654 77653 77652 77651 77650 77649 77648 77647 77646 77645 77644 77643 77642 77641 77640 77639 77638 77637 77636 77635 77634 77633 77632 77631 77630 77629 77628 77627 77626 77625 77624 77623 77622 77621 77620 77619 77618 77617 77616 77615 77614 77613 77612 77611 77610 77609 77608 77607 77606 77605 77604 77603 77602 77601 77600 77599 77598 77597 77596 77595 77594 77593 77592 77591 77590 77589 77588 77587 77586 77585 77584 77583 77582 77581 77580 77579 77578 77577 77576 77575 77574 77573 77572 77571 77570 77569 77568 77567 77566 77565 77564 77563 77562 77561 77560 77559 77558 77557 77556 77555 77554 77553 77552 77551 77550 77549 77548 77547 77546 77545 77544 77543 77542 77541 77540 77539 77538 77537 77536 77535 77534 77533 77532 77531 77530 77529 77528 77527 77526 77525 77524 77523 77522 77521 77520 77519 77518 77517 77516 77515 77514 77513 77512 77511 77510 77509 77508 77507 77506 77505 77504 77503 77502 77501 77500 77499 77498 77497 77496 77495 77494 77493 77492 77491 77490 77489 77488 77487 77486 77485 77484 77483 77482 77481 77480 77479 77478 77477 77476 77475 77474 77473 77472 77471 77470 77469 77468 77467 77466 77465 77464 77463 77462 77461 77460 77459 77458 77457 77456 77455 77454 77453 77452 77451 77450 77449 77448 77447 77446 77445 77444 77443 77442 77441 77440 77439 77438 77437 77436 77435 77434 77433 77432 77431 77430 77429 77428 77427 77426 77425 77424 77423 77422 77421 77420 77419 77418 77417 77416 77415 77414 77413 77412 77411 77410 77409 77408 77407 77406 77405 77404 77403 77402 77401 77400 77399 77398 77397 77396 77395 77394 77393 77392 77391 77390 77389 77388 77387 77386 77385 77384 77383 77382 77381 77380 77379 77378 77377 77376 77375 77374 77373 77372 77371 77370 77369 77368 77367 77366 77365 77364 77363 77362 77361 77360 77359 77358 77357 77356 77355 77354 77353 77352 77351 77350 77349 77348 77347 77346 77345 77344 77343 77342 77341 77340 77339 77338 77337 77336 77335 77334 77333 77332 77331 77330 77329 77328 77327 77326 77325 77324 77323 77322 77321 77320 77319 77318 77317 77316 77315 77314 77313 77312 77311 77310 77309 77308 77307 77306 77305 77304 77303 77302 77301 77300 77299 77298 77297 77296 77295 77294 77293 77292 77291 77290 77289 77288 77287 77286 77285 77284 77283 77282 77281 77280 77279 77278 77277 77276 77275 77274 77273 77272 77271 77270 77269 77268 77267 77266 77265 77264 77263 77262 77261 77260 77259 77258 77257 77256 77255 77254 77253 77252 77251 77250 77249 77248 77247 77246 77245 77244 77243 77242 77241 77240 77239 77238 77237 77236 77235 77234 77233 77232 77231 77230 77229 77228 77227 77226 77225 77224 77223 77222 77221 77220 77219 77218 77217 77216 77215 77214 77213 77212 77211 77210 77209 77208 77207 77206 77205 77204 77203 77202 77201 77200 77199 77198 77197 77196 77195 77194 77193 77192 77191 77190 77189 77188 77187 77186 77185 77184 77183 77182 77181 77180 77179 77178 77177 77176 77175 77174 77173 77172 77171 77170 77169 77168 77167 77166 77165 77164 77163 77162 77161 77160 77159 77158 77157 77156 77155 77154 77153 77152 77151 77150 77149 77148 77147 77146 77145 77144 77143 77142 77141 77140 77139 77138 77137 77136 77135 77134 77133 77132 77131 77130 77129 77128 77127 77126 77125 77124 77123 77122 77121 77120 77119 77118 77117 77116 77115 77114 77113 77112 77111 77110 77109 77108 77107 77106 77105 77104 77103 77102 77101 77100 77099 77098 77097 77096 77095 77094 77093 77092 77091 77090 77089 77088 77087 77086 77085 77084 77083 77082 77081 77080 77079 77078 77077 77076 77075 77074 77073 77072 77071 77070 77069 77068 77067 77066 77065 77064 77063 77062 77061 77060 77059 77058 77057 77056 77055 77054 77053 77052 77051 77050 77049 77048 77047 77046 77045 77044 77043 77042 77041 77040 77039 77038 77037 77036 77035 77034 77033 77032 77031 77030 77029 77028 77027 77026 77025 77024 77023 77022 77021 77020 77019 77018 77017 77016 77015 77014 77013 77012 77011 77010 77009 77008 77007 77006 77005 77004 77003 77002 77001 77000 76999 76998 76997 76996 76995 76994 76993 76992 76991 76990 76989 76988 76987 76986 76985 76984 76983 76982 76981 76980 76979 76978 76977 76976 76975 76974 76973 76972 76971 76970 76969 76968 76967 76966 76965 76964 76963 76962 76961 76960 76959 76958 76957 76956 76955 76954 76953 76952 76951 76950 76949 76948 76947 76946 76945 76944 76943 76942 76941 76940 76939 76938 76937 76936 76935 76934 76933 76932 76931 76930 76929 76928 76927 76926 76925 76924 76923 76922 76921 76920 76919 76918 76917 76916 76915 76914 76913 76912 76911 76910 76909 76908 76907 76906 76905 76904 76903 76902 76901 76900 76899 76898 76897 76896 76895 76894 76893 76892 76891 76890 76889 76888 76887 76886 76885 76884 76883 76882 76881 76880 76879 76878 76877 76876 76875 76874 76873 76872 76871 76870 76869 76868 76867 76866 76865 76864 76863 76862 76861 76860 76859 76858 76857 76856 76855 76854 76853 76852 76851 76850 76849 76848 76847 76846 76845 76844 76843 76842 76841 76840 76839 76838 76837 76836 76835 76834 76833 76832 76831 76830 76829 76828 76827 76826 76825 76824 76823 76822 76821 76820 76819 76818 76817 76816 76815 76814 76813 76812 76811 76810 76809 76808 76807 76806 76805 76804 76803 76802 76801 76800 76799 76798 76797 76796 76795 76794 76793 76792 76791 76790 76789 76788 76787 76786 76785 76784 76783 76782 76781 76780 76779 76778 76777 76776 76775 76774 76773 76772 76771 76770 76769 76768 76767 76766 76765 76764 76763 76762 76761 76760 76759 76758 76757 76756 76755 76754 76753 76752 76751 76750 76749 76748 76747 76746 76745 76744 76743 76742 76741 76740 76739 76738 76737 76736 76735 76734 76733 76732 76731 76730 76729 76728 76727 76726 76725 76724 76723 76722 76721 76720 76719 76718 76717 76716 76715 76714 76713 76712 76711 76710 76709 76708 76707 76706 76705 76704 76703 76702 76701 76700 76699 76698 76697 76696 76695 76694 76693 76692 76691 76690 76689 76688 76687 76686 76685 76684 76683 76682 76681 76680 76679 76678 76677 76676 76675 76674 76673 76672 76671 76670 76669 76668 76667 76666 76665 76664 76663 76662 76661 76660 76659 76658 76657 76656 76655 76654 76653 76652 76651 76650 76649 76648 76647 76646 76645 76644 76643 76642 76641 76640 76639 76638 76637 76636 76635 76634 76633 76632 76631 76630 76629 76628 76627 76626 76625 76624 76623 76622 76621 76620 76619 76618 76617 76616 76615 76614 76613 76612 76611 76610 76609 76608 76607 76606 76605 76604 76603 76602 76601 76600 76599 76598 76597 76596 76595 76594 76593 76592 76591 76590 76589 76588 76587 76586 76585 76584 76583 76582 76581 76580 76579 76578 76577 76576 76575 76574 76573 76572 76571 76570 76569 76568 76567 76566 76565 76564 76563 76562 76561 76560 76559 76558 76557 76556 76555 76554 76553 76552 76551 76550 76549 76548 76547 76546 76545 76544 76543 76542 76541 76540 76539 76538 76537 76536 76535 76534 76533 76532 76531 76530 76529 76528 76527 76526 76525 76524 76523 76522 76521 76520 76519 76518 76517 76516 76515 76514 76513 76512 76511 76510 76509 76508 76507 76506 76505 76504 76503 76502 76501 76500 76499 76498 76497 76496 76495 76494 76493 76492 76491 76490 76489 76488 76487 76486 76485 76484 76483 76482 76481 76480 76479 76478 76477 76476 76475 76474 76473 76472 76471 76470 76469 76468 76467 76466 76465 76464 76463 76462 76461 76460 76459 76458 76457 76456 76455 76454 76453 76452 76451 76450 76449 76448 76447 76446 76445 76444 76443 76442 76441 76440 76439 76438 76437 76436 76435 76434 76433 76432 76431 76430 76429 76428 76427 76426 76425 76424 76423 76422 76421 76420 76419 76418 76417 76416 76415 76414 76413 76412 76411 76410 76409 76408 76407 76406 76405 76404 76403 76402 76401 76400 76399 76398 76397 76396 76395 76394 76393 76392 76391 76390 76389 76388 76387 76386 76385 76384 76383 76382 76381 76380 76379 76378 76377 76376 76375 76374 76373 76372 76371 76370 76369 76368 76367 76366 76365 76364 76363 76362 76361 76360 76359 76358 76357 76356 76355 76354 76353 76352 76351 76350 76349 76348 76347 76346 76345 76344 76343 76342 76341 76340 76339 76338 76337 76336 76335 76334 76333 76332 76331 76330 76329 76328 76327 76326 76325 76324 76323 76322 76321 76320 76319 76318 76317 76316 76315 76314 76313 76312 76311 76310 76309 76308 76307 76306 76305 76304 76303 76302 76301 76300 76299 76298 76297 76296 76295 76294 76293 76292 76291 76290 76289 76288 76287 76286 76285 76284 76283 76282 76281 76280 76279 76278 76277 76276 76275 76274 76273 76272 76271 76270 76269 76268 76267 76266 76265 76264 76263 76262 76261 76260 76259 76258 76257 76256 76255 76254 76253 76252 76251 76250 76249 76248 76247 76246 76245 76244 76243 76242 76241 76240 76239 76238 76237 76236 76235 76234 76233 76232 76231 76230 76229 76228 76227 76226 76225 76224 76223 76222 76221 76220 76219 76218 76217 76216 76215 76214 76213 76212 76211 76210 76209 76208 76207 76206 76205 76204 76203 76202 76201 76200 76199 76198 76197 76196 76195 76194 76193 76192 76191 76190 76189 76188 76187 76186 76185 76184 76183 76182 76181 76180 76179 76178 76177 76176 76175 76174 76173 76172 76171 76170 76169 76168 76167 76166 76165 76164 76163 76162 76161 76160 76159 76158 76157 76156 76155 76154 76153 76152 76151 76150 76149 76148 76147 76146 76145 76144 76143 76142 76141 76140 76139 76138 76137 76136 76135 76134 76133 76132 76131 76130 76129 76128 76127 76126 76125 76124 76123 76122 76121 76120 76119 76118 76117 76116 76115 76114 76113 76112 76111 76110 76109 76108 76107 76106 76105 76104 76103 76102 76101 76100 76099 76098 76097 76096 76095 76094 76093 76092 76091 76090 76089 76088 76087 76086 76085 76084 76083 76082 76081 76080 76079 76078 76077 76076 76075 76074 76073 76072 76071 76070 76069 76068 76067 76066 76065 76064 76063 76062 76061 76060 76059 76058 76057 76056 76055 76054 76053 76052 76051 76050 76049 76048 76047 76046 76045 76044 76043 76042 76041 76040 76039 76038 76037 76036 76035 76034 76033 76032 76031 76030 76029 76028 76027 76026 76025 76024 76023 76022 76021 76020 76019 76018 76017 76016 76015 76014 76013 76012 76011 76010 76009 76008 76007 76006 76005 76004 76003 76002 76001 76000 75999 75998 75997 75996 75995 75994 75993 75992 75991 75990 75989 75988 75987 75986 75985 75984 75983 75982 75981 75980 75979 75978 75977 75976 75975 75974 75973 75972 75971 75970 75969 75968 75967 75966 75965 75964 75963 75962 75961 75960 75959 75958 75957 75956 75955 75954 75953 75952 75951 75950 75949 75948 75947 75946 75945 75944 75943 75942 75941 75940 75939 75938 75937 75936 75935 75934 75933 75932 75931 75930 75929 75928 75927 75926 75925 75924 75923 75922 75921 75920 75919 75918 75917 75916 75915 75914 75913 75912 75911 75910 75909 75908 75907 75906 75905 75904 75903 75902 75901 75900 75899 75898 75897 75896 75895 75894 75893 75892 75891 75890 75889 75888 75887 75886 75885 75884 75883 75882 75881 75880 75879 75878 75877 75876 75875 75874 75873 75872 75871 75870 75869 75868 75867 75866 75865 75864 75863 75862 75861 75860 75859 75858 75857 75856 75855 75854 75853 75852 75851 75850 75849 75848 75847 75846 75845 75844 75843 75842 75841 75840 75839 75838 75837 75836 75835 75834 75833 75832 75831 75830 75829 75828 75827 75826 75825 75824 75823 75822 75821 75820 75819 75818 75817 75816 75815 75814 75813 75812 75811 75810 75809 75808 75807 75806 75805 75804 75803 75802 75801 75800 75799 75798 75797 75796 75795 75794 75793 75792 75791 75790 75789 75788 75787 75786 75785 75784 75783 75782 75781 75780 75779 75778 75777 75776 75775 75774 75773 75772 75771 75770 75769 75768 75767 75766 75765 75764 75763 75762 75761 75760 75759 75758 75757 75756 75755 75754 75753 75752 75751 75750 75749 75748 75747 75746 75745 75744 75743 75742 75741 75740 75739 75738 75737 75736 75735 75734 75733 75732 75731 75730 75729 75728 75727 75726 75725 75724 75723 75722 75721 75720 75719 75718 75717 75716 75715 75714 75713 75712 75711 75710 75709 75708 75707 75706 75705 75704 75703 75702 75701 75700 75699 75698 75697 75696 75695 75694 75693 75692 75691 75690 75689 75688 75687 75686 75685 75684 75683 75682 75681 75680 75679 75678 75677 75676 75675 75674 75673 75672 75671 75670 75669 75668 75667 75666 75665 75664 75663 75662 75661 75660 75659 75658 75657 75656 75655 75654 75653 75652 75651 75650 75649 75648 75647 75646 75645 75644 75643 75642 75641 75640 75639 75638 75637 75636 75635 75634 75633 75632 75631 75630 75629 75628 75627 75626 75625 75624 75623 75622 75621 75620 75619 75618 75617 75616 75615 75614 75613 75612 75611 75610 75609 75608 75607 75606 75605 75604 75603 75602 75601 75600 75599 75598 75597 75596 75595 75594 75593 75592 75591 75590 75589 75588 75587 75586 75585 75584 75583 75582 75581 75580 75579 75578 75577 75576 75575 75574 75573 75572 75571 75570 75569 75568 75567 75566 75565 75564 75563 75562 75561 75560 75559 75558 75557 75556 75555 75554 75553 75552 75551 75550 75549 75548 75547 75546 75545 75544 75543 75542 75541 75540 75539 75538 75537 75536 75535 75534 75533 75532 75531 75530 75529 75528 75527 75526 75525 75524 75523 75522 75521 75520 75519 75518 75517 75516 75515 75514 75513 75512 75511 75510 75509 75508 75507 75506 75505 75504 75503 75502 75501 75500 75499 75498 75497 75496 75495 75494 75493 75492 75491 75490 75489 75488 75487 75486 75485 75484 75483 75482 75481 75480 75479 75478 75477 75476 75475 75474 75473 75472 75471 75470 75469 75468 75467 75466 75465 75464 75463 75462 75461 75460 75459 75458 75457 75456 75455 75454 75453 75452 75451 75450 75449 75448 75447 75446 75445 75444 75443 75442 75441 75440 75439 75438 75437 75436 75435 75434 75433 75432 75431 75430 75429 75428 75427 75426 75425 75424 75423 75422 75421 75420 75419 75418 75417 75416 75415 75414 75413 75412 75411 75410 75409 75408 75407 75406 75405 75404 75403 75402 75401 75400 75399 75398 75397 75396 75395 75394 75393 75392 75391 75390 75389 75388 75387 75386 75385 75384 75383 75382 75381 75380 75379 75378 75377 75376 75375 75374 75373 75372 75371 75370 75369 75368 75367 75366 75365 75364 75363 75362 75361 75360 75359 75358 75357 75356 75355 75354 75353 75352 75351 75350 75349 75348 75347 75346 75345 75344 75343 75342 75341 75340 75339 75338 75337 75336 75335 75334 75333 75332 75331 75330 75329 75328 75327 75326 75325 75324 75323 75322 75321 75320 75319 75318 75317 75316 75315 75314 75313 75312 75311 75310 75309 75308 75307 75306 75305 75304 75303 75302 75301 75300 75299 75298 75297 75296 75295 75294 75293 75292 75291 75290 75289 75288 75287 75286 75285 75284 75283 75282 75281 75280 75279 75278 75277 75276 75275 75274 75273 75272 75271 75270 75269 75268 75267 75266 75265 75264 75263 75262 75261 75260 75259 75258 75257 75256 75255 75254 75253 75252 75251 75250 75249 75248 75247 75246 75245 75244 75243 75242 75241 75240 75239 75238 75237 75236 75235 75234 75233 75232 75231 75230 75229 75228 75227 75226 75225 75224 75223 75222 75221 75220 75219 75218 75217 75216 75215 75214 75213 75212 75211 75210 75209 75208 75207 75206 75205 75204 75203 75202 75201 75200 75199 75198 75197 75196 75195 75194 75193 75192 75191 75190 75189 75188 75187 75186 75185 75184 75183 75182 75181 75180 75179 75178 75177 75176 75175 75174 75173 75172 75171 75170 75169 75168 75167 75166 75165 75164 75163 75162 75161 75160 75159 75158 75157 75156 75155 75154 75153 75152 75151 75150 75149 75148 75147 75146 75145 75144 75143 75142 75141 75140 75139 75138 75137 75136 75135 75134 75133 75132 75131 75130 75129 75128 75127 75126 75125 75124 75123 75122 75121 75120 75119 75118 75117 75116 75115 75114 75113 75112 75111 75110 75109 75108 75107 75106 75105 75104 75103 75102 75101 75100 75099 75098 75097 75096 75095 75094 75093 75092 75091 75090 75089 75088 75087 75086 75085 75084 75083 75082 75081 75080 75079 75078 75077 75076 75075 75074 75073 75072 75071 75070 75069 75068 75067 75066 75065 75064 75063 75062 75061 75060 75059 75058 75057 75056 75055 75054 75053 75052 75051 75050 75049 75048 75047 75046 75045 75044 75043 75042 75041 75040 75039 75038 75037 75036 75035 75034 75033 75032 75031 75030 75029 75028 75027 75026 75025 75024 75023 75022 75021 75020 75019 75018 75017 75016 75015 75014 75013 75012 75011 75010 75009 75008 75007 75006 75005 75004 75003 75002 75001 75000 74999 74998 74997 74996 74995 74994 74993 74992 74991 74990 74989 74988 74987 74986 74985 74984 74983 74982 74981 74980 74979 74978 74977 74976 74975 74974 74973 74972 74971 74970 74969 74968 74967 74966 74965 74964 74963 74962 74961 74960 74959 74958 74957 74956 74955 74954 74953 74952 74951 74950 74949 74948 74947 74946 74945 74944 74943 74942 74941 74940 74939 74938 74937 74936 74935 74934 74933 74932 74931 74930 74929 74928 74927 74926 74925 74924 74923 74922 74921 74920 74919 74918 74917 74916 74915 74914 74913 74912 74911 74910 74909 74908 74907 74906 74905 74904 74903 74902 74901 74900 74899 74898 74897 74896 74895 74894 74893 74892 74891 74890 74889 74888 74887 74886 74885 74884 74883 74882 74881 74880 74879 74878 74877 74876 74875 74874 74873 74872 74871 74870 74869 74868 74867 74866 74865 74864 74863 74862 74861 74860 74859 74858 74857 74856 74855 74854 74853 74852 74851 74850 74849 74848 74847 74846 74845 74844 74843 74842 74841 74840 74839 74838 74837 74836 74835 74834 74833 74832 74831 74830 74829 74828 74827 74826 74825 74824 74823 74822 74821 74820 74819 74818 74817 74816 74815 74814 74813 74812 74811 74810 74809 74808 74807 74806 74805 74804 74803 74802 74801 74800 74799 74798 74797 74796 74795 74794 74793 74792 74791 74790 74789 74788 74787 74786 74785 74784 74783 74782 74781 74780 74779 74778 74777 74776 74775 74774 74773 74772 74771 74770 74769 74768 74767 74766 74765 74764 74763 74762 74761 74760 74759 74758 74757 74756 74755 74754 74753 74752 74751 74750 74749 74748 74747 74746 74745 74744 74743 74742 74741 74740 74739 74738 74737 74736 74735 74734 74733 74732 74731 74730 74729 74728 74727 74726 74725 74724 74723 74722 74721 74720 74719 74718 74717 74716 74715 74714 74713 74712 74711 74710 74709 74708 74707 74706 74705 74704 74703 74702 74701 74700 74699 74698 74697 74696 74695 74694 74693 74692 74691 74690 74689 74688 74687 74686 74685 74684 74683 74682 74681 74680 74679 74678 74677 74676 74675 74674 74673 74672 74671 74670 74669 74668 74667 74666 74665 74664 74663 74662 74661 74660 74659 74658 74657 74656 74655 74654 74653 74652 74651 74650 74649 74648 74647 74646 74645 74644 74643 74642 74641 74640 74639 74638 74637 74636 74635 74634 74633 74632 74631 74630 74629 74628 74627 74626 74625 74624 74623 74622 74621 74620 74619 74618 74617 74616 74615 74614 74613 74612 74611 74610 74609 74608 74607 74606 74605 74604 74603 74602 74601 74600 74599 74598 74597 74596 74595 74594 74593 74592 74591 74590 74589 74588 74587 74586 74585 74584 74583 74582 74581 74580 74579 74578 74577 74576 74575 74574 74573 74572 74571 74570 74569 74568 74567 74566 74565 74564 74563 74562 74561 74560 74559 74558 74557 74556 74555 74554 74553 74552 74551 74550 74549 74548 74547 74546 74545 74544 74543 74542 74541 74540 74539 74538 74537 74536 74535 74534 74533 74532 74531 74530 74529 74528 74527 74526 74525 74524 74523 74522 74521 74520 74519 74518 74517 74516 74515 74514 74513 74512 74511 74510 74509 74508 74507 74506 74505 74504 74503 74502 74501 74500 74499 74498 74497 74496 74495 74494 74493 74492 74491 74490 74489 74488 74487 74486 74485 74484 74483 74482 74481 74480 74479 74478 74477 74476 74475 74474 74473 74472 74471 74470 74469 74468 74467 74466 74465 74464 74463 74462 74461 74460 74459 74458 74457 74456 74455 74454 74453 74452 74451 74450 74449 74448 74447 74446 74445 74444 74443 74442 74441 74440 74439 74438 74437 74436 74435 74434 74433 74432 74431 74430 74429 74428 74427 74426 74425 74424 74423 74422 74421 74420 74419 74418 74417 74416 74415 74414 74413 74412 74411 74410 74409 74408 74407 74406 74405 74404 74403 74402 74401 74400 74399 74398 74397 74396 74395 74394 74393 74392 74391 74390 74389 74388 74387 74386 74385 74384 74383 74382 74381 74380 74379 74378 74377 74376 74375 74374 74373 74372 74371 74370 74369 74368 74367 74366 74365 74364 74363 74362 74361 74360 74359 74358 74357 74356 74355 74354 74353 74352 74351 74350 74349 74348 74347 74346 74345 74344 74343 74342 74341 74340 74339 74338 74337 74336 74335 74334 74333 74332 74331 74330 74329 74328 74327 74326 74325 74324 74323 74322 74321 74320 74319 74318 74317 74316 74315 74314 74313 74312 74311 74310 74309 74308 74307 74306 74305 74304 74303 74302 74301 74300 74299 74298 74297 74296 74295 74294 74293 74292 74291 74290 74289 74288 74287 74286 74285 74284 74283 74282 74281 74280 74279 74278 74277 74276 74275 74274 74273 74272 74271 74270 74269 74268 74267 74266 74265 74264 74263 74262 74261 74260 74259 74258 74257 74256 74255 74254 74253 74252 74251 74250 74249 74248 74247 74246 74245 74244 74243 74242 74241 74240 74239 74238 74237 74236 74235 74234 74233 74232 74231 74230 74229 74228 74227 74226 74225 74224 74223 74222 74221 74220 74219 74218 74217 74216 74215 74214 74213 74212 74211 74210 74209 74208 74207 74206 74205 74204 74203 74202 74201 74200 74199 74198 74197 74196 74195 74194 74193 74192 74191 74190 74189 74188 74187 74186 74185 74184 74183 74182 74181 74180 74179 74178 74177 74176 74175 74174 74173 74172 74171 74170 74169 74168 74167 74166 74165 74164 74163 74162 74161 74160 74159 74158 74157 74156 74155 74154 74153 74152 74151 74150 74149 74148 74147 74146 74145 74144 74143 74142 74141 74140 74139 74138 74137 74136 74135 74134 74133 74132 74131 74130 74129 74128 74127 74126 74125 74124 74123 74122 74121 74120 74119 74118 74117 74116 74115 74114 74113 74112 74111 74110 74109 74108 74107 74106 74105 74104 74103 74102 74101 74100 74099 74098 74097 74096 74095 74094 74093 74092 74091 74090 74089 74088 74087 74086 74085 74084 74083 74082 74081 74080 74079 74078 74077 74076 74075 74074 74073 74072 74071 74070 74069 74068 74067 74066 74065 74064 74063 74062 74061 74060 74059 74058 74057 74056 74055 74054 74053 74052 74051 74050 74049 74048 74047 74046 74045 74044 74043 74042 74041 74040 74039 74038 74037 74036 74035 74034 74033 74032 74031 74030 74029 74028 74027 74026 74025 74024 74023 74022 74021 74020 74019 74018 74017 74016 74015 74014 74013 74012 74011 74010 74009 74008 74007 74006 74005 74004 74003 74002 74001 74000 73999 73998 73997 73996 73995 73994 73993 73992 73991 73990 73989 73988 73987 73986 73985 73984 73983 73982 73981 73980 73979 73978 73977 73976 73975 73974 73973 73972 73971 73970 73969 73968 73967 73966 73965 73964 73963 73962 73961 73960 73959 73958 73957 73956 73955 73954 73953 73952 73951 73950 73949 73948 73947 73946 73945 73944 73943 73942 73941 73940 73939 73938 73937 73936 73935 73934 73933 73932 73931 73930 73929 73928 73927 73926 73925 73924 73923 73922 73921 73920 73919 73918 73917 73916 73915 73914 73913 73912 73911 73910 73909 73908 73907 73906 73905 73904 73903 73902 73901 73900 73899 73898 73897 73896 73895 73894 73893 73892 73891 73890 73889 73888 73887 73886 73885 73884 73883 73882 73881 73880 73879 73878 73877 73876 73875 73874 73873 73872 73871 73870 73869 73868 73867 73866 73865 73864 73863 73862 73861 73860 73859 73858 73857 73856 73855 73854 73853 73852 73851 73850 73849 73848 73847 73846 73845 73844 73843 73842 73841 73840 73839 73838 73837 73836 73835 73834 73833 73832 73831 73830 73829 73828 73827 73826 73825 73824 73823 73822 73821 73820 73819 73818 73817 73816 73815 73814 73813 73812 73811 73810 73809 73808 73807 73806 73805 73804 73803 73802 73801 73800 73799 73798 73797 73796 73795 73794 73793 73792 73791 73790 73789 73788 73787 73786 73785 73784 73783 73782 73781 73780 73779 73778 73777 73776 73775 73774 73773 73772 73771 73770 73769 73768 73767 73766 73765 73764 73763 73762 73761 73760 73759 73758 73757 73756 73755 73754 73753 73752 73751 73750 73749 73748 73747 73746 73745 73744 73743 73742 73741 73740 73739 73738 73737 73736 73735 73734 73733 73732 73731 73730 73729 73728 73727 73726 73725 73724 73723 73722 73721 73720 73719 73718 73717 73716 73715 73714 73713 73712 73711 73710 73709 73708 73707 73706 73705 73704 73703 73702 73701 73700 73699 73698 73697 73696 73695 73694 73693 73692 73691 73690 73689 73688 73687 73686 73685 73684 73683 73682 73681 73680 73679 73678 73677 73676 73675 73674 73673 73672 73671 73670 73669 73668 73667 73666 73665 73664 73663 73662 73661 73660 73659 73658 73657 73656 73655 73654 73653 73652 73651 73650 73649 73648 73647 73646 73645 73644 73643 73642 73641 73640 73639 73638 73637 73636 73635 73634 73633 73632 73631 73630 73629 73628 73627 73626 73625 73624 73623 73622 73621 73620 73619 73618 73617 73616 73615 73614 73613 73612 73611 73610 73609 73608 73607 73606 73605 73604 73603 73602 73601 73600 73599 73598 73597 73596 73595 73594 73593 73592 73591 73590 73589 73588 73587 73586 73585 73584 73583 73582 73581 73580 73579 73578 73577 73576 73575 73574 73573 73572 73571 73570 73569 73568 73567 73566 73565 73564 73563 73562 73561 73560 73559 73558 73557 73556 73555 73554 73553 73552 73551 73550 73549 73548 73547 73546 73545 73544 73543 73542 73541 73540 73539 73538 73537 73536 73535 73534 73533 73532 73531 73530 73529 73528 73527 73526 73525 73524 73523 73522 73521 73520 73519 73518 73517 73516 73515 73514 73513 73512 73511 73510 73509 73508 73507 73506 73505 73504 73503 73502 73501 73500 73499 73498 73497 73496 73495 73494 73493 73492 73491 73490 73489 73488 73487 73486 73485 73484 73483 73482 73481 73480 73479 73478 73477 73476 73475 73474 73473 73472 73471 73470 73469 73468 73467 73466 73465 73464 73463 73462 73461 73460 73459 73458 73457 73456 73455 73454 73453 73452 73451 73450 73449 73448 73447 73446 73445 73444 73443 73442 73441 73440 73439 73438 73437 73436 73435 73434 73433 73432 73431 73430 73429 73428 73427 73426 73425 73424 73423 73422 73421 73420 73419 73418 73417 73416 73415 73414 73413 73412 73411 73410 73409 73408 73407 73406 73405 73404 73403 73402 73401 73400 73399 73398 73397 73396 73395 73394 73393 73392 73391 73390 73389 73388 73387 73386 73385 73384 73383 73382 73381 73380 73379 73378 73377 73376 73375 73374 73373 73372 73371 73370 73369 73368 73367 73366 73365 73364 73363 73362 73361 73360 73359 73358 73357 73356 73355 73354 73353 73352 73351 73350 73349 73348 73347 73346 73345 73344 73343 73342 73341 73340 73339 73338 73337 73336 73335 73334 73333 73332 73331 73330 73329 73328 73327 73326 73325 73324 73323 73322 73321 73320 73319 73318 73317 73316 73315 73314 73313 73312 73311 73310 73309 73308 73307 73306 73305 73304 73303 73302 73301 73300 73299 73298 73297 73296 73295 73294 73293 73292 73291 73290 73289 73288 73287 73286 73285 73284 73283 73282 73281 73280 73279 73278 73277 73276 73275 73274 73273 73272 73271 73270 73269 73268 73267 73266 73265 73264 73263 73262 73261 73260 73259 73258 73257 73256 73255 73254 73253 73252 73251 73250 73249 73248 73247 73246 73245 73244 73243 73242 73241 73240 73239 73238 73237 73236 73235 73234 73233 73232 73231 73230 73229 73228 73227 73226 73225 73224 73223 73222 73221 73220 73219 73218 73217 73216 73215 73214 73213 73212 73211 73210 73209 73208 73207 73206 73205 73204 73203 73202 73201 73200 73199 73198 73197 73196 73195 73194 73193 73192 73191 73190 73189 73188 73187 73186 73185 73184 73183 73182 73181 73180 73179 73178 73177 73176 73175 73174 73173 73172 73171 73170 73169 73168 73167 73166 73165 73164 73163 73162 73161 73160 73159 73158 73157 73156 73155 73154 73153 73152 73151 73150 73149 73148 73147 73146 73145 73144 73143 73142 73141 73140 73139 73138 73137 73136 73135 73134 73133 73132 73131 73130 73129 73128 73127 73126 73125 73124 73123 73122 73121 73120 73119 73118 73117 73116 73115 73114 73113 73112 73111 73110 73109 73108 73107 73106 73105 73104 73103 73102 73101 73100 73099 73098 73097 73096 73095 73094 73093 73092 73091 73090 73089 73088 73087 73086 73085 73084 73083 73082 73081 73080 73079 73078 73077 73076 73075 73074 73073 73072 73071 73070 73069 73068 73067 73066 73065 73064 73063 73062 73061 73060 73059 73058 73057 73056 73055 73054 73053 73052 73051 73050 73049 73048 73047 73046 73045 73044 73043 73042 73041 73040 73039 73038 73037 73036 73035 73034 73033 73032 73031 73030 73029 73028 73027 73026 73025 73024 73023 73022 73021 73020 73019 73018 73017 73016 73015 73014 73013 73012 73011 73010 73009 73008 73007 73006 73005 73004 73003 73002 73001 73000 72999 72998 72997 72996 72995 72994 72993 72992 72991 72990 72989 72988 72987 72986 72985 72984 72983 72982 72981 72980 72979 72978 72977 72976 72975 72974 72973 72972 72971 72970 72969 72968 72967 72966 72965 72964 72963 72962 72961 72960 72959 72958 72957 72956 72955 72954 72953 72952 72951 72950 72949 72948 72947 72946 72945 72944 72943 72942 72941 72940 72939 72938 72937 72936 72935 72934 72933 72932 72931 72930 72929 72928 72927 72926 72925 72924 72923 72922 72921 72920 72919 72918 72917 72916 72915 72914 72913 72912 72911 72910 72909 72908 72907 72906 72905 72904 72903 72902 72901 72900 72899 72898 72897 72896 72895 72894 72893 72892 72891 72890 72889 72888 72887 72886 72885 72884 72883 72882 72881 72880 72879 72878 72877 72876 72875 72874 72873 72872 72871 72870 72869 72868 72867 72866 72865 72864 72863 72862 72861 72860 72859 72858 72857 72856 72855 72854 72853 72852 72851 72850 72849 72848 72847 72846 72845 72844 72843 72842 72841 72840 72839 72838 72837 72836 72835 72834 72833 72832 72831 72830 72829 72828 72827 72826 72825 72824 72823 72822 72821 72820 72819 72818 72817 72816 72815 72814 72813 72812 72811 72810 72809 72808 72807 72806 72805 72804 72803 72802 72801 72800 72799 72798 72797 72796 72795 72794 72793 72792 72791 72790 72789 72788 72787 72786 72785 72784 72783 72782 72781 72780 72779 72778 72777 72776 72775 72774 72773 72772 72771 72770 72769 72768 72767 72766 72765 72764 72763 72762 72761 72760 72759 72758 72757 72756 72755 72754 72753 72752 72751 72750 72749 72748 72747 72746 72745 72744 72743 72742 72741 72740 72739 72738 72737 72736 72735 72734 72733 72732 72731 72730 72729 72728 72727 72726 72725 72724 72723 72722 72721 72720 72719 72718 72717 72716 72715 72714 72713 72712 72711 72710 72709 72708 72707 72706 72705 72704 72703 72702 72701 72700 72699 72698 72697 72696 72695 72694 72693 72692 72691 72690 72689 72688 72687 72686 72685 72684 72683 72682 72681 72680 72679 72678 72677 72676 72675 72674 72673 72672 72671 72670 72669 72668 72667 72666 72665 72664 72663 72662 72661 72660 72659 72658 72657 72656 72655 72654 72653 72652 72651 72650 72649 72648 72647 72646 72645 72644 72643 72642 72641 72640 72639 72638 72637 72636 72635 72634 72633 72632 72631 72630 72629 72628 72627 72626 72625 72624 72623 72622 72621 72620 72619 72618 72617 72616 72615 72614 72613 72612 72611 72610 72609 72608 72607 72606 72605 72604 72603 72602 72601 72600 72599 72598 72597 72596 72595 72594 72593 72592 72591 72590 72589 72588 72587 72586 72585 72584 72583 72582 72581 72580 72579 72578 72577 72576 72575 72574 72573 72572 72571 72570 72569 72568 72567 72566 72565 72564 72563 72562 72561 72560 72559 72558 72557 72556 72555 72554 72553 72552 72551 72550 72549 72548 72547 72546 72545 72544 72543 72542 72541 72540 72539 72538 72537 72536 72535 72534 72533 72532 72531 72530 72529 72528 72527 72526 72525 72524 72523 72522 72521 72520 72519 72518 72517 72516 72515 72514 72513 72512 72511 72510 72509 72508 72507 72506 72505 72504 72503 72502 72501 72500 72499 72498 72497 72496 72495 72494 72493 72492 72491 72490 72489 72488 72487 72486 72485 72484 72483 72482 72481 72480 72479 72478 72477 72476 72475 72474 72473 72472 72471 72470 72469 72468 72467 72466 72465 72464 72463 72462 72461 72460 72459 72458 72457 72456 72455 72454 72453 72452 72451 72450 72449 72448 72447 72446 72445 72444 72443 72442 72441 72440 72439 72438 72437 72436 72435 72434 72433 72432 72431 72430 72429 72428 72427 72426 72425 72424 72423 72422 72421 72420 72419 72418 72417 72416 72415 72414 72413 72412 72411 72410 72409 72408 72407 72406 72405 72404 72403 72402 72401 72400 72399 72398 72397 72396 72395 72394 72393 72392 72391 72390 72389 72388 72387 72386 72385 72384 72383 72382 72381 72380 72379 72378 72377 72376 72375 72374 72373 72372 72371 72370 72369 72368 72367 72366 72365 72364 72363 72362 72361 72360 72359 72358 72357 72356 72355 72354 72353 72352 72351 72350 72349 72348 72347 72346 72345 72344 72343 72342 72341 72340 72339 72338 72337 72336 72335 72334 72333 72332 72331 72330 72329 72328 72327 72326 72325 72324 72323 72322 72321 72320 72319 72318 72317 72316 72315 72314 72313 72312 72311 72310 72309 72308 72307 72306 72305 72304 72303 72302 72301 72300 72299 72298 72297 72296 72295 72294 72293 72292 72291 72290 72289 72288 72287 72286 72285 72284 72283 72282 72281 72280 72279 72278 72277 72276 72275 72274 72273 72272 72271 72270 72269 72268 72267 72266 72265 72264 72263 72262 72261 72260 72259 72258 72257 72256 72255 72254 72253 72252 72251 72250 72249 72248 72247 72246 72245 72244 72243 72242 72241 72240 72239 72238 72237 72236 72235 72234 72233 72232 72231 72230 72229 72228 72227 72226 72225 72224 72223 72222 72221 72220 72219 72218 72217 72216 72215 72214 72213 72212 72211 72210 72209 72208 72207 72206 72205 72204 72203 72202 72201 72200 72199 72198 72197 72196 72195 72194 72193 72192 72191 72190 72189 72188 72187 72186 72185 72184 72183 72182 72181 72180 72179 72178 72177 72176 72175 72174 72173 72172 72171 72170 72169 72168 72167 72166 72165 72164 72163 72162 72161 72160 72159 72158 72157 72156 72155 72154 72153 72152 72151 72150 72149 72148 72147 72146 72145 72144 72143 72142 72141 72140 72139 72138 72137 72136 72135 72134 72133 72132 72131 72130 72129 72128 72127 72126 72125 72124 72123 72122 72121 72120 72119 72118 72117 72116 72115 72114 72113 72112 72111 72110 72109 72108 72107 72106 72105 72104 72103 72102 72101 72100 72099 72098 72097 72096 72095 72094 72093 72092 72091 72090 72089 72088 72087 72086 72085 72084 72083 72082 72081 72080 72079 72078 72077 72076 72075 72074 72073 72072 72071 72070 72069 72068 72067 72066 72065 72064 72063 72062 72061 72060 72059 72058 72057 72056 72055 72054 72053 72052 72051 72050 72049 72048 72047 72046 72045 72044 72043 72042 72041 72040 72039 72038 72037 72036 72035 72034 72033 72032 72031 72030 72029 72028 72027 72026 72025 72024 72023 72022 72021 72020 72019 72018 72017 72016 72015 72014 72013 72012 72011 72010 72009 72008 72007 72006 72005 72004 72003 72002 72001 72000 71999 71998 71997 71996 71995 71994 71993 71992 71991 71990 71989 71988 71987 71986 71985 71984 71983 71982 71981 71980 71979 71978 71977 71976 71975 71974 71973 71972 71971 71970 71969 71968 71967 71966 71965 71964 71963 71962 71961 71960 71959 71958 71957 71956 71955 71954 71953 71952 71951 71950 71949 71948 71947 71946 71945 71944 71943 71942 71941 71940 71939 71938 71937 71936 71935 71934 71933 71932 71931 71930 71929 71928 71927 71926 71925 71924 71923 71922 71921 71920 71919 71918 71917 71916 71915 71914 71913 71912 71911 71910 71909 71908 71907 71906 71905 71904 71903 71902 71901 71900 71899 71898 71897 71896 71895 71894 71893 71892 71891 71890 71889 71888 71887 71886 71885 71884 71883 71882 71881 71880 71879 71878 71877 71876 71875 71874 71873 71872 71871 71870 71869 71868 71867 71866 71865 71864 71863 71862 71861 71860 71859 71858 71857 71856 71855 71854 71853 71852 71851 71850 71849 71848 71847 71846 71845 71844 71843 71842 71841 71840 71839 71838 71837 71836 71835 71834 71833 71832 71831 71830 71829 71828 71827 71826 71825 71824 71823 71822 71821 71820 71819 71818 71817 71816 71815 71814 71813 71812 71811 71810 71809 71808 71807 71806 71805 71804 71803 71802 71801 71800 71799 71798 71797 71796 71795 71794 71793 71792 71791 71790 71789 71788 71787 71786 71785 71784 71783 71782 71781 71780 71779 71778 71777 71776 71775 71774 71773 71772 71771 71770 71769 71768 71767 71766 71765 71764 71763 71762 71761 71760 71759 71758 71757 71756 71755 71754 71753 71752 71751 71750 71749 71748 71747 71746 71745 71744 71743 71742 71741 71740 71739 71738 71737 71736 71735 71734 71733 71732 71731 71730 71729 71728 71727 71726 71725 71724 71723 71722 71721 71720 71719 71718 71717 71716 71715 71714 71713 71712 71711 71710 71709 71708 71707 71706 71705 71704 71703 71702 71701 71700 71699 71698 71697 71696 71695 71694 71693 71692 71691 71690 71689 71688 71687 71686 71685 71684 71683 71682 71681 71680 71679 71678 71677 71676 71675 71674 71673 71672 71671 71670 71669 71668 71667 71666 71665 71664 71663 71662 71661 71660 71659 71658 71657 71656 71655 71654 71653 71652 71651 71650 71649 71648 71647 71646 71645 71644 71643 71642 71641 71640 71639 71638 71637 71636 71635 71634 71633 71632 71631 71630 71629 71628 71627 71626 71625 71624 71623 71622 71621 71620 71619 71618 71617 71616 71615 71614 71613 71612 71611 71610 71609 71608 71607 71606 71605 71604 71603 71602 71601 71600 71599 71598 71597 71596 71595 71594 71593 71592 71591 71590 71589 71588 71587 71586 71585 71584 71583 71582 71581 71580 71579 71578 71577 71576 71575 71574 71573 71572 71571 71570 71569 71568 71567 71566 71565 71564 71563 71562 71561 71560 71559 71558 71557 71556 71555 71554 71553 71552 71551 71550 71549 71548 71547 71546 71545 71544 71543 71542 71541 71540 71539 71538 71537 71536 71535 71534 71533 71532 71531 71530 71529 71528 71527 71526 71525 71524 71523 71522 71521 71520 71519 71518 71517 71516 71515 71514 71513 71512 71511 71510 71509 71508 71507 71506 71505 71504 71503 71502 71501 71500 71499 71498 71497 71496 71495 71494 71493 71492 71491 71490 71489 71488 71487 71486 71485 71484 71483 71482 71481 71480 71479 71478 71477 71476 71475 71474 71473 71472 71471 71470 71469 71468 71467 71466 71465 71464 71463 71462 71461 71460 71459 71458 71457 71456 71455 71454 71453 71452 71451 71450 71449 71448 71447 71446 71445 71444 71443 71442 71441 71440 71439 71438 71437 71436 71435 71434 71433 71432 71431 71430 71429 71428 71427 71426 71425 71424 71423 71422 71421 71420 71419 71418 71417 71416 71415 71414 71413 71412 71411 71410 71409 71408 71407 71406 71405 71404 71403 71402 71401 71400 71399 71398 71397 71396 71395 71394 71393 71392 71391 71390 71389 71388 71387 71386 71385 71384 71383 71382 71381 71380 71379 71378 71377 71376 71375 71374 71373 71372 71371 71370 71369 71368 71367 71366 71365 71364 71363 71362 71361 71360 71359 71358 71357 71356 71355 71354 71353 71352 71351 71350 71349 71348 71347 71346 71345 71344 71343 71342 71341 71340 71339 71338 71337 71336 71335 71334 71333 71332 71331 71330 71329 71328 71327 71326 71325 71324 71323 71322 71321 71320 71319 71318 71317 71316 71315 71314 71313 71312 71311 71310 71309 71308 71307 71306 71305 71304 71303 71302 71301 71300 71299 71298 71297 71296 71295 71294 71293 71292 71291 71290 71289 71288 71287 71286 71285 71284 71283 71282 71281 71280 71279 71278 71277 71276 71275 71274 71273 71272 71271 71270 71269 71268 71267 71266 71265 71264 71263 71262 71261 71260 71259 71258 71257 71256 71255 71254 71253 71252 71251 71250 71249 71248 71247 71246 71245 71244 71243 71242 71241 71240 71239 71238 71237 71236 71235 71234 71233 71232 71231 71230 71229 71228 71227 71226 71225 71224 71223 71222 71221 71220 71219 71218 71217 71216 71215 71214 71213 71212 71211 71210 71209 71208 71207 71206 71205 71204 71203 71202 71201 71200 71199 71198 71197 71196 71195 71194 71193 71192 71191 71190 71189 71188 71187 71186 71185 71184 71183 71182 71181 71180 71179 71178 71177 71176 71175 71174 71173 71172 71171 71170 71169 71168 71167 71166 71165 71164 71163 71162 71161 71160 71159 71158 71157 71156 71155 71154 71153 71152 71151 71150 71149 71148 71147 71146 71145 71144 71143 71142 71141 71140 71139 71138 71137 71136 71135 71134 71133 71132 71131 71130 71129 71128 71127 71126 71125 71124 71123 71122 71121 71120 71119 71118 71117 71116 71115 71114 71113 71112 71111 71110 71109 71108 71107 71106 71105 71104 71103 71102 71101 71100 71099 71098 71097 71096 71095 71094 71093 71092 71091 71090 71089 71088 71087 71086 71085 71084 71083 71082 71081 71080 71079 71078 71077 71076 71075 71074 71073 71072 71071 71070 71069 71068 71067 71066 71065 71064 71063 71062 71061 71060 71059 71058 71057 71056 71055 71054 71053 71052 71051 71050 71049 71048 71047 71046 71045 71044 71043 71042 71041 71040 71039 71038 71037 71036 71035 71034 71033 71032 71031 71030 71029 71028 71027 71026 71025 71024 71023 71022 71021 71020 71019 71018 71017 71016 71015 71014 71013 71012 71011 71010 71009 71008 71007 71006 71005 71004 71003 71002 71001 71000 70999 70998 70997 70996 70995 70994 70993 70992 70991 70990 70989 70988 70987 70986 70985 70984 70983 70982 70981 70980 70979 70978 70977 70976 70975 70974 70973 70972 70971 70970 70969 70968 70967 70966 70965 70964 70963 70962 70961 70960 70959 70958 70957 70956 70955 70954 70953 70952 70951 70950 70949 70948 70947 70946 70945 70944 70943 70942 70941 70940 70939 70938 70937 70936 70935 70934 70933 70932 70931 70930 70929 70928 70927 70926 70925 70924 70923 70922 70921 70920 70919 70918 70917 70916 70915 70914 70913 70912 70911 70910 70909 70908 70907 70906 70905 70904 70903 70902 70901 70900 70899 70898 70897 70896 70895 70894 70893 70892 70891 70890 70889 70888 70887 70886 70885 70884 70883 70882 70881 70880 70879 70878 70877 70876 70875 70874 70873 70872 70871 70870 70869 70868 70867 70866 70865 70864 70863 70862 70861 70860 70859 70858 70857 70856 70855 70854 70853 70852 70851 70850 70849 70848 70847 70846 70845 70844 70843 70842 70841 70840 70839 70838 70837 70836 70835 70834 70833 70832 70831 70830 70829 70828 70827 70826 70825 70824 70823 70822 70821 70820 70819 70818 70817 70816 70815 70814 70813 70812 70811 70810 70809 70808 70807 70806 70805 70804 70803 70802 70801 70800 70799 70798 70797 70796 70795 70794 70793 70792 70791 70790 70789 70788 70787 70786 70785 70784 70783 70782 70781 70780 70779 70778 70777 70776 70775 70774 70773 70772 70771 70770 70769 70768 70767 70766 70765 70764 70763 70762 70761 70760 70759 70758 70757 70756 70755 70754 70753 70752 70751 70750 70749 70748 70747 70746 70745 70744 70743 70742 70741 70740 70739 70738 70737 70736 70735 70734 70733 70732 70731 70730 70729 70728 70727 70726 70725 70724 70723 70722 70721 70720 70719 70718 70717 70716 70715 70714 70713 70712 70711 70710 70709 70708 70707 70706 70705 70704 70703 70702 70701 70700 70699 70698 70697 70696 70695 70694 70693 70692 70691 70690 70689 70688 70687 70686 70685 70684 70683 70682 70681 70680 70679 70678 70677 70676 70675 70674 70673 70672 70671 70670 70669 70668 70667 70666 70665 70664 70663 70662 70661 70660 70659 70658 70657 70656 70655 70654 70653 70652 70651 70650 70649 70648 70647 70646 70645 70644 70643 70642 70641 70640 70639 70638 70637 70636 70635 70634 70633 70632 70631 70630 70629 70628 70627 70626 70625 70624 70623 70622 70621 70620 70619 70618 70617 70616 70615 70614 70613 70612 70611 70610 70609 70608 70607 70606 70605 70604 70603 70602 70601 70600 70599 70598 70597 70596 70595 70594 70593 70592 70591 70590 70589 70588 70587 70586 70585 70584 70583 70582 70581 70580 70579 70578 70577 70576 70575 70574 70573 70572 70571 70570 70569 70568 70567 70566 70565 70564 70563 70562 70561 70560 70559 70558 70557 70556 70555 70554 70553 70552 70551 70550 70549 70548 70547 70546 70545 70544 70543 70542 70541 70540 70539 70538 70537 70536 70535 70534 70533 70532 70531 70530 70529 70528 70527 70526 70525 70524 70523 70522 70521 70520 70519 70518 70517 70516 70515 70514 70513 70512 70511 70510 70509 70508 70507 70506 70505 70504 70503 70502 70501 70500 70499 70498 70497 70496 70495 70494 70493 70492 70491 70490 70489 70488 70487 70486 70485 70484 70483 70482 70481 70480 70479 70478 70477 70476 70475 70474 70473 70472 70471 70470 70469 70468 70467 70466 70465 70464 70463 70462 70461 70460 70459 70458 70457 70456 70455 70454 70453 70452 70451 70450 70449 70448 70447 70446 70445 70444 70443 70442 70441 70440 70439 70438 70437 70436 70435 70434 70433 70432 70431 70430 70429 70428 70427 70426 70425 70424 70423 70422 70421 70420 70419 70418 70417 70416 70415 70414 70413 70412 70411 70410 70409 70408 70407 70406 70405 70404 70403 70402 70401 70400 70399 70398 70397 70396 70395 70394 70393 70392 70391 70390 70389 70388 70387 70386 70385 70384 70383 70382 70381 70380 70379 70378 70377 70376 70375 70374 70373 70372 70371 70370 70369 70368 70367 70366 70365 70364 70363 70362 70361 70360 70359 70358 70357 70356 70355 70354 70353 70352 70351 70350 70349 70348 70347 70346 70345 70344 70343 70342 70341 70340 70339 70338 70337 70336 70335 70334 70333 70332 70331 70330 70329 70328 70327 70326 70325 70324 70323 70322 70321 70320 70319 70318 70317 70316 70315 70314 70313 70312 70311 70310 70309 70308 70307 70306 70305 70304 70303 70302 70301 70300 70299 70298 70297 70296 70295 70294 70293 70292 70291 70290 70289 70288 70287 70286 70285 70284 70283 70282 70281 70280 70279 70278 70277 70276 70275 70274 70273 70272 70271 70270 70269 70268 70267 70266 70265 70264 70263 70262 70261 70260 70259 70258 70257 70256 70255 70254 70253 70252 70251 70250 70249 70248 70247 70246 70245 70244 70243 70242 70241 70240 70239 70238 70237 70236 70235 70234 70233 70232 70231 70230 70229 70228 70227 70226 70225 70224 70223 70222 70221 70220 70219 70218 70217 70216 70215 70214 70213 70212 70211 70210 70209 70208 70207 70206 70205 70204 70203 70202 70201 70200 70199 70198 70197 70196 70195 70194 70193 70192 70191 70190 70189 70188 70187 70186 70185 70184 70183 70182 70181 70180 70179 70178 70177 70176 70175 70174 70173 70172 70171 70170 70169 70168 70167 70166 70165 70164 70163 70162 70161 70160 70159 70158 70157 70156 70155 70154 70153 70152 70151 70150 70149 70148 70147 70146 70145 70144 70143 70142 70141 70140 70139 70138 70137 70136 70135 70134 70133 70132 70131 70130 70129 70128 70127 70126 70125 70124 70123 70122 70121 70120 70119 70118 70117 70116 70115 70114 70113 70112 70111 70110 70109 70108 70107 70106 70105 70104 70103 70102 70101 70100 70099 70098 70097 70096 70095 70094 70093 70092 70091 70090 70089 70088 70087 70086 70085 70084 70083 70082 70081 70080 70079 70078 70077 70076 70075 70074 70073 70072 70071 70070 70069 70068 70067 70066 70065 70064 70063 70062 70061 70060 70059 70058 70057 70056 70055 70054 70053 70052 70051 70050 70049 70048 70047 70046 70045 70044 70043 70042 70041 70040 70039 70038 70037 70036 70035 70034 70033 70032 70031 70030 70029 70028 70027 70026 70025 70024 70023 70022 70021 70020 70019 70018 70017 70016 70015 70014 70013 70012 70011 70010 70009 70008 70007 70006 70005 70004 70003 70002 70001 70000 69999 69998 69997 69996 69995 69994 69993 69992 69991 69990 69989 69988 69987 69986 69985 69984 69983 69982 69981 69980 69979 69978 69977 69976 69975 69974 69973 69972 69971 69970 69969 69968 69967 69966 69965 69964 69963 69962 69961 69960 69959 69958 69957 69956 69955 69954 69953 69952 69951 69950 69949 69948 69947 69946 69945 69944 69943 69942 69941 69940 69939 69938 69937 69936 69935 69934 69933 69932 69931 69930 69929 69928 69927 69926 69925 69924 69923 69922 69921 69920 69919 69918 69917 69916 69915 69914 69913 69912 69911 69910 69909 69908 69907 69906 69905 69904 69903 69902 69901 69900 69899 69898 69897 69896 69895 69894 69893 69892 69891 69890 69889 69888 69887 69886 69885 69884 69883 69882 69881 69880 69879 69878 69877 69876 69875 69874 69873 69872 69871 69870 69869 69868 69867 69866 69865 69864 69863 69862 69861 69860 69859 69858 69857 69856 69855 69854 69853 69852 69851 69850 69849 69848 69847 69846 69845 69844 69843 69842 69841 69840 69839 69838 69837 69836 69835 69834 69833 69832 69831 69830 69829 69828 69827 69826 69825 69824 69823 69822 69821 69820 69819 69818 69817 69816 69815 69814 69813 69812 69811 69810 69809 69808 69807 69806 69805 69804 69803 69802 69801 69800 69799 69798 69797 69796 69795 69794 69793 69792 69791 69790 69789 69788 69787 69786 69785 69784 69783 69782 69781 69780 69779 69778 69777 69776 69775 69774 69773 69772 69771 69770 69769 69768 69767 69766 69765 69764 69763 69762 69761 69760 69759 69758 69757 69756 69755 69754 69753 69752 69751 69750 69749 69748 69747 69746 69745 69744 69743 69742 69741 69740 69739 69738 69737 69736 69735 69734 69733 69732 69731 69730 69729 69728 69727 69726 69725 69724 69723 69722 69721 69720 69719 69718 69717 69716 69715 69714 69713 69712 69711 69710 69709 69708 69707 69706 69705 69704 69703 69702 69701 69700 69699 69698 69697 69696 69695 69694 69693 69692 69691 69690 69689 69688 69687 69686 69685 69684 69683 69682 69681 69680 69679 69678 69677 69676 69675 69674 69673 69672 69671 69670 69669 69668 69667 69666 69665 69664 69663 69662 69661 69660 69659 69658 69657 69656 69655 69654 69653 69652 69651 69650 69649 69648 69647 69646 69645 69644 69643 69642 69641 69640 69639 69638 69637 69636 69635 69634 69633 69632 69631 69630 69629 69628 69627 69626 69625 69624 69623 69622 69621 69620 69619 69618 69617 69616 69615 69614 69613 69612 69611 69610 69609 69608 69607 69606 69605 69604 69603 69602 69601 69600 69599 69598 69597 69596 69595 69594 69593 69592 69591 69590 69589 69588 69587 69586 69585 69584 69583 69582 69581 69580 69579 69578 69577 69576 69575 69574 69573 69572 69571 69570 69569 69568 69567 69566 69565 69564 69563 69562 69561 69560 69559 69558 69557 69556 69555 69554 69553 69552 69551 69550 69549 69548 69547 69546 69545 69544 69543 69542 69541 69540 69539 69538 69537 69536 69535 69534 69533 69532 69531 69530 69529 69528 69527 69526 69525 69524 69523 69522 69521 69520 69519 69518 69517 69516 69515 69514 69513 69512 69511 69510 69509 69508 69507 69506 69505 69504 69503 69502 69501 69500 69499 69498 69497 69496 69495 69494 69493 69492 69491 69490 69489 69488 69487 69486 69485 69484 69483 69482 69481 69480 69479 69478 69477 69476 69475 69474 69473 69472 69471 69470 69469 69468 69467 69466 69465 69464 69463 69462 69461 69460 69459 69458 69457 69456 69455 69454 69453 69452 69451 69450 69449 69448 69447 69446 69445 69444 69443 69442 69441 69440 69439 69438 69437 69436 69435 69434 69433 69432 69431 69430 69429 69428 69427 69426 69425 69424 69423 69422 69421 69420 69419 69418 69417 69416 69415 69414 69413 69412 69411 69410 69409 69408 69407 69406 69405 69404 69403 69402 69401 69400 69399 69398 69397 69396 69395 69394 69393 69392 69391 69390 69389 69388 69387 69386 69385 69384 69383 69382 69381 69380 69379 69378 69377 69376 69375 69374 69373 69372 69371 69370 69369 69368 69367 69366 69365 69364 69363 69362 69361 69360 69359 69358 69357 69356 69355 69354 69353 69352 69351 69350 69349 69348 69347 69346 69345 69344 69343 69342 69341 69340 69339 69338 69337 69336 69335 69334 69333 69332 69331 69330 69329 69328 69327 69326 69325 69324 69323 69322 69321 69320 69319 69318 69317 69316 69315 69314 69313 69312 69311 69310 69309 69308 69307 69306 69305 69304 69303 69302 69301 69300 69299 69298 69297 69296 69295 69294 69293 69292 69291 69290 69289 69288 69287 69286 69285 69284 69283 69282 69281 69280 69279 69278 69277 69276 69275 69274 69273 69272 69271 69270 69269 69268 69267 69266 69265 69264 69263 69262 69261 69260 69259 69258 69257 69256 69255 69254 69253 69252 69251 69250 69249 69248 69247 69246 69245 69244 69243 69242 69241 69240 69239 69238 69237 69236 69235 69234 69233 69232 69231 69230 69229 69228 69227 69226 69225 69224 69223 69222 69221 69220 69219 69218 69217 69216 69215 69214 69213 69212 69211 69210 69209 69208 69207 69206 69205 69204 69203 69202 69201 69200 69199 69198 69197 69196 69195 69194 69193 69192 69191 69190 69189 69188 69187 69186 69185 69184 69183 69182 69181 69180 69179 69178 69177 69176 69175 69174 69173 69172 69171 69170 69169 69168 69167 69166 69165 69164 69163 69162 69161 69160 69159 69158 69157 69156 69155 69154 69153 69152 69151 69150 69149 69148 69147 69146 69145 69144 69143 69142 69141 69140 69139 69138 69137 69136 69135 69134 69133 69132 69131 69130 69129 69128 69127 69126 69125 69124 69123 69122 69121 69120 69119 69118 69117 69116 69115 69114 69113 69112 69111 69110 69109 69108 69107 69106 69105 69104 69103 69102 69101 69100 69099 69098 69097 69096 69095 69094 69093 69092 69091 69090 69089 69088 69087 69086 69085 69084 69083 69082 69081 69080 69079 69078 69077 69076 69075 69074 69073 69072 69071 69070 69069 69068 69067 69066 69065 69064 69063 69062 69061 69060 69059 69058 69057 69056 69055 69054 69053 69052 69051 69050 69049 69048 69047 69046 69045 69044 69043 69042 69041 69040 69039 69038 69037 69036 69035 69034 69033 69032 69031 69030 69029 69028 69027 69026 69025 69024 69023 69022 69021 69020 69019 69018 69017 69016 69015 69014 69013 69012 69011 69010 69009 69008 69007 69006 69005 69004 69003 69002 69001 69000 68999 68998 68997 68996 68995 68994 68993 68992 68991 68990 68989 68988 68987 68986 68985 68984 68983 68982 68981 68980 68979 68978 68977 68976 68975 68974 68973 68972 68971 68970 68969 68968 68967 68966 68965 68964 68963 68962 68961 68960 68959 68958 68957 68956 68955 68954 68953 68952 68951 68950 68949 68948 68947 68946 68945 68944 68943 68942 68941 68940 68939 68938 68937 68936 68935 68934 68933 68932 68931 68930 68929 68928 68927 68926 68925 68924 68923 68922 68921 68920 68919 68918 68917 68916 68915 68914 68913 68912 68911 68910 68909 68908 68907 68906 68905 68904 68903 68902 68901 68900 68899 68898 68897 68896 68895 68894 68893 68892 68891 68890 68889 68888 68887 68886 68885 68884 68883 68882 68881 68880 68879 68878 68877 68876 68875 68874 68873 68872 68871 68870 68869 68868 68867 68866 68865 68864 68863 68862 68861 68860 68859 68858 68857 68856 68855 68854 68853 68852 68851 68850 68849 68848 68847 68846 68845 68844 68843 68842 68841 68840 68839 68838 68837 68836 68835 68834 68833 68832 68831 68830 68829 68828 68827 68826 68825 68824 68823 68822 68821 68820 68819 68818 68817 68816 68815 68814 68813 68812 68811 68810 68809 68808 68807 68806 68805 68804 68803 68802 68801 68800 68799 68798 68797 68796 68795 68794 68793 68792 68791 68790 68789 68788 68787 68786 68785 68784 68783 68782 68781 68780 68779 68778 68777 68776 68775 68774 68773 68772 68771 68770 68769 68768 68767 68766 68765 68764 68763 68762 68761 68760 68759 68758 68757 68756 68755 68754 68753 68752 68751 68750 68749 68748 68747 68746 68745 68744 68743 68742 68741 68740 68739 68738 68737 68736 68735 68734 68733 68732 68731 68730 68729 68728 68727 68726 68725 68724 68723 68722 68721 68720 68719 68718 68717 68716 68715 68714 68713 68712 68711 68710 68709 68708 68707 68706 68705 68704 68703 68702 68701 68700 68699 68698 68697 68696 68695 68694 68693 68692 68691 68690 68689 68688 68687 68686 68685 68684 68683 68682 68681 68680 68679 68678 68677 68676 68675 68674 68673 68672 68671 68670 68669 68668 68667 68666 68665 68664 68663 68662 68661 68660 68659 68658 68657 68656 68655 68654 68653 68652 68651 68650 68649 68648 68647 68646 68645 68644 68643 68642 68641 68640 68639 68638 68637 68636 68635 68634 68633 68632 68631 68630 68629 68628 68627 68626 68625 68624 68623 68622 68621 68620 68619 68618 68617 68616 68615 68614 68613 68612 68611 68610 68609 68608 68607 68606 68605 68604 68603 68602 68601 68600 68599 68598 68597 68596 68595 68594 68593 68592 68591 68590 68589 68588 68587 68586 68585 68584 68583 68582 68581 68580 68579 68578 68577 68576 68575 68574 68573 68572 68571 68570 68569 68568 68567 68566 68565 68564 68563 68562 68561 68560 68559 68558 68557 68556 68555 68554 68553 68552 68551 68550 68549 68548 68547 68546 68545 68544 68543 68542 68541 68540 68539 68538 68537 68536 68535 68534 68533 68532 68531 68530 68529 68528 68527 68526 68525 68524 68523 68522 68521 68520 68519 68518 68517 68516 68515 68514 68513 68512 68511 68510 68509 68508 68507 68506 68505 68504 68503 68502 68501 68500 68499 68498 68497 68496 68495 68494 68493 68492 68491 68490 68489 68488 68487 68486 68485 68484 68483 68482 68481 68480 68479 68478 68477 68476 68475 68474 68473 68472 68471 68470 68469 68468 68467 68466 68465 68464 68463 68462 68461 68460 68459 68458 68457 68456 68455 68454 68453 68452 68451 68450 68449 68448 68447 68446 68445 68444 68443 68442 68441 68440 68439 68438 68437 68436 68435 68434 68433 68432 68431 68430 68429 68428 68427 68426 68425 68424 68423 68422 68421 68420 68419 68418 68417 68416 68415 68414 68413 68412 68411 68410 68409 68408 68407 68406 68405 68404 68403 68402 68401 68400 68399 68398 68397 68396 68395 68394 68393 68392 68391 68390 68389 68388 68387 68386 68385 68384 68383 68382 68381 68380 68379 68378 68377 68376 68375 68374 68373 68372 68371 68370 68369 68368 68367 68366 68365 68364 68363 68362 68361 68360 68359 68358 68357 68356 68355 68354 68353 68352 68351 68350 68349 68348 68347 68346 68345 68344 68343 68342 68341 68340 68339 68338 68337 68336 68335 68334 68333 68332 68331 68330 68329 68328 68327 68326 68325 68324 68323 68322 68321 68320 68319 68318 68317 68316 68315 68314 68313 68312 68311 68310 68309 68308 68307 68306 68305 68304 68303 68302 68301 68300 68299 68298 68297 68296 68295 68294 68293 68292 68291 68290 68289 68288 68287 68286 68285 68284 68283 68282 68281 68280 68279 68278 68277 68276 68275 68274 68273 68272 68271 68270 68269 68268 68267 68266 68265 68264 68263 68262 68261 68260 68259 68258 68257 68256 68255 68254 68253 68252 68251 68250 68249 68248 68247 68246 68245 68244 68243 68242 68241 68240 68239 68238 68237 68236 68235 68234 68233 68232 68231 68230 68229 68228 68227 68226 68225 68224 68223 68222 68221 68220 68219 68218 68217 68216 68215 68214 68213 68212 68211 68210 68209 68208 68207 68206 68205 68204 68203 68202 68201 68200 68199 68198 68197 68196 68195 68194 68193 68192 68191 68190 68189 68188 68187 68186 68185 68184 68183 68182 68181 68180 68179 68178 68177 68176 68175 68174 68173 68172 68171 68170 68169 68168 68167 68166 68165 68164 68163 68162 68161 68160 68159 68158 68157 68156 68155 68154 68153 68152 68151 68150 68149 68148 68147 68146 68145 68144 68143 68142 68141 68140 68139 68138 68137 68136 68135 68134 68133 68132 68131 68130 68129 68128 68127 68126 68125 68124 68123 68122 68121 68120 68119 68118 68117 68116 68115 68114 68113 68112 68111 68110 68109 68108 68107 68106 68105 68104 68103 68102 68101 68100 68099 68098 68097 68096 68095 68094 68093 68092 68091 68090 68089 68088 68087 68086 68085 68084 68083 68082 68081 68080 68079 68078 68077 68076 68075 68074 68073 68072 68071 68070 68069 68068 68067 68066 68065 68064 68063 68062 68061 68060 68059 68058 68057 68056 68055 68054 68053 68052 68051 68050 68049 68048 68047 68046 68045 68044 68043 68042 68041 68040 68039 68038 68037 68036 68035 68034 68033 68032 68031 68030 68029 68028 68027 68026 68025 68024 68023 68022 68021 68020 68019 68018 68017 68016 68015 68014 68013 68012 68011 68010 68009 68008 68007 68006 68005 68004 68003 68002 68001 68000 67999 67998 67997 67996 67995 67994 67993 67992 67991 67990 67989 67988 67987 67986 67985 67984 67983 67982 67981 67980 67979 67978 67977 67976 67975 67974 67973 67972 67971 67970 67969 67968 67967 67966 67965 67964 67963 67962 67961 67960 67959 67958 67957 67956 67955 67954 67953 67952 67951 67950 67949 67948 67947 67946 67945 67944 67943 67942 67941 67940 67939 67938 67937 67936 67935 67934 67933 67932 67931 67930 67929 67928 67927 67926 67925 67924 67923 67922 67921 67920 67919 67918 67917 67916 67915 67914 67913 67912 67911 67910 67909 67908 67907 67906 67905 67904 67903 67902 67901 67900 67899 67898 67897 67896 67895 67894 67893 67892 67891 67890 67889 67888 67887 67886 67885 67884 67883 67882 67881 67880 67879 67878 67877 67876 67875 67874 67873 67872 67871 67870 67869 67868 67867 67866 67865 67864 67863 67862 67861 67860 67859 67858 67857 67856 67855 67854 67853 67852 67851 67850 67849 67848 67847 67846 67845 67844 67843 67842 67841 67840 67839 67838 67837 67836 67835 67834 67833 67832 67831 67830 67829 67828 67827 67826 67825 67824 67823 67822 67821 67820 67819 67818 67817 67816 67815 67814 67813 67812 67811 67810 67809 67808 67807 67806 67805 67804 67803 67802 67801 67800 67799 67798 67797 67796 67795 67794 67793 67792 67791 67790 67789 67788 67787 67786 67785 67784 67783 67782 67781 67780 67779 67778 67777 67776 67775 67774 67773 67772 67771 67770 67769 67768 67767 67766 67765 67764 67763 67762 67761 67760 67759 67758 67757 67756 67755 67754 67753 67752 67751 67750 67749 67748 67747 67746 67745 67744 67743 67742 67741 67740 67739 67738 67737 67736 67735 67734 67733 67732 67731 67730 67729 67728 67727 67726 67725 67724 67723 67722 67721 67720 67719 67718 67717 67716 67715 67714 67713 67712 67711 67710 67709 67708 67707 67706 67705 67704 67703 67702 67701 67700 67699 67698 67697 67696 67695 67694 67693 67692 67691 67690 67689 67688 67687 67686 67685 67684 67683 67682 67681 67680 67679 67678 67677 67676 67675 67674 67673 67672 67671 67670 67669 67668 67667 67666 67665 67664 67663 67662 67661 67660 67659 67658 67657 67656 67655 67654 67653 67652 67651 67650 67649 67648 67647 67646 67645 67644 67643 67642 67641 67640 67639 67638 67637 67636 67635 67634 67633 67632 67631 67630 67629 67628 67627 67626 67625 67624 67623 67622 67621 67620 67619 67618 67617 67616 67615 67614 67613 67612 67611 67610 67609 67608 67607 67606 67605 67604 67603 67602 67601 67600 67599 67598 67597 67596 67595 67594 67593 67592 67591 67590 67589 67588 67587 67586 67585 67584 67583 67582 67581 67580 67579 67578 67577 67576 67575 67574 67573 67572 67571 67570 67569 67568 67567 67566 67565 67564 67563 67562 67561 67560 67559 67558 67557 67556 67555 67554 67553 67552 67551 67550 67549 67548 67547 67546 67545 67544 67543 67542 67541 67540 67539 67538 67537 67536 67535 67534 67533 67532 67531 67530 67529 67528 67527 67526 67525 67524 67523 67522 67521 67520 67519 67518 67517 67516 67515 67514 67513 67512 67511 67510 67509 67508 67507 67506 67505 67504 67503 67502 67501 67500 67499 67498 67497 67496 67495 67494 67493 67492 67491 67490 67489 67488 67487 67486 67485 67484 67483 67482 67481 67480 67479 67478 67477 67476 67475 67474 67473 67472 67471 67470 67469 67468 67467 67466 67465 67464 67463 67462 67461 67460 67459 67458 67457 67456 67455 67454 67453 67452 67451 67450 67449 67448 67447 67446 67445 67444 67443 67442 67441 67440 67439 67438 67437 67436 67435 67434 67433 67432 67431 67430 67429 67428 67427 67426 67425 67424 67423 67422 67421 67420 67419 67418 67417 67416 67415 67414 67413 67412 67411 67410 67409 67408 67407 67406 67405 67404 67403 67402 67401 67400 67399 67398 67397 67396 67395 67394 67393 67392 67391 67390 67389 67388 67387 67386 67385 67384 67383 67382 67381 67380 67379 67378 67377 67376 67375 67374 67373 67372 67371 67370 67369 67368 67367 67366 67365 67364 67363 67362 67361 67360 67359 67358 67357 67356 67355 67354 67353 67352 67351 67350 67349 67348 67347 67346 67345 67344 67343 67342 67341 67340 67339 67338 67337 67336 67335 67334 67333 67332 67331 67330 67329 67328 67327 67326 67325 67324 67323 67322 67321 67320 67319 67318 67317 67316 67315 67314 67313 67312 67311 67310 67309 67308 67307 67306 67305 67304 67303 67302 67301 67300 67299 67298 67297 67296 67295 67294 67293 67292 67291 67290 67289 67288 67287 67286 67285 67284 67283 67282 67281 67280 67279 67278 67277 67276 67275 67274 67273 67272 67271 67270 67269 67268 67267 67266 67265 67264 67263 67262 67261 67260 67259 67258 67257 67256 67255 67254 67253 67252 67251 67250 67249 67248 67247 67246 67245 67244 67243 67242 67241 67240 67239 67238 67237 67236 67235 67234 67233 67232 67231 67230 67229 67228 67227 67226 67225 67224 67223 67222 67221 67220 67219 67218 67217 67216 67215 67214 67213 67212 67211 67210 67209 67208 67207 67206 67205 67204 67203 67202 67201 67200 67199 67198 67197 67196 67195 67194 67193 67192 67191 67190 67189 67188 67187 67186 67185 67184 67183 67182 67181 67180 67179 67178 67177 67176 67175 67174 67173 67172 67171 67170 67169 67168 67167 67166 67165 67164 67163 67162 67161 67160 67159 67158 67157 67156 67155 67154 67153 67152 67151 67150 67149 67148 67147 67146 67145 67144 67143 67142 67141 67140 67139 67138 67137 67136 67135 67134 67133 67132 67131 67130 67129 67128 67127 67126 67125 67124 67123 67122 67121 67120 67119 67118 67117 67116 67115 67114 67113 67112 67111 67110 67109 67108 67107 67106 67105 67104 67103 67102 67101 67100 67099 67098 67097 67096 67095 67094 67093 67092 67091 67090 67089 67088 67087 67086 67085 67084 67083 67082 67081 67080 67079 67078 67077 67076 67075 67074 67073 67072 67071 67070 67069 67068 67067 67066 67065 67064 67063 67062 67061 67060 67059 67058 67057 67056 67055 67054 67053 67052 67051 67050 67049 67048 67047 67046 67045 67044 67043 67042 67041 67040 67039 67038 67037 67036 67035 67034 67033 67032 67031 67030 67029 67028 67027 67026 67025 67024 67023 67022 67021 67020 67019 67018 67017 67016 67015 67014 67013 67012 67011 67010 67009 67008 67007 67006 67005 67004 67003 67002 67001 67000 66999 66998 66997 66996 66995 66994 66993 66992 66991 66990 66989 66988 66987 66986 66985 66984 66983 66982 66981 66980 66979 66978 66977 66976 66975 66974 66973 66972 66971 66970 66969 66968 66967 66966 66965 66964 66963 66962 66961 66960 66959 66958 66957 66956 66955 66954 66953 66952 66951 66950 66949 66948 66947 66946 66945 66944 66943 66942 66941 66940 66939 66938 66937 66936 66935 66934 66933 66932 66931 66930 66929 66928 66927 66926 66925 66924 66923 66922 66921 66920 66919 66918 66917 66916 66915 66914 66913 66912 66911 66910 66909 66908 66907 66906 66905 66904 66903 66902 66901 66900 66899 66898 66897 66896 66895 66894 66893 66892 66891 66890 66889 66888 66887 66886 66885 66884 66883 66882 66881 66880 66879 66878 66877 66876 66875 66874 66873 66872 66871 66870 66869 66868 66867 66866 66865 66864 66863 66862 66861 66860 66859 66858 66857 66856 66855 66854 66853 66852 66851 66850 66849 66848 66847 66846 66845 66844 66843 66842 66841 66840 66839 66838 66837 66836 66835 66834 66833 66832 66831 66830 66829 66828 66827 66826 66825 66824 66823 66822 66821 66820 66819 66818 66817 66816 66815 66814 66813 66812 66811 66810 66809 66808 66807 66806 66805 66804 66803 66802 66801 66800 66799 66798 66797 66796 66795 66794 66793 66792 66791 66790 66789 66788 66787 66786 66785 66784 66783 66782 66781 66780 66779 66778 66777 66776 66775 66774 66773 66772 66771 66770 66769 66768 66767 66766 66765 66764 66763 66762 66761 66760 66759 66758 66757 66756 66755 66754 66753 66752 66751 66750 66749 66748 66747 66746 66745 66744 66743 66742 66741 66740 66739 66738 66737 66736 66735 66734 66733 66732 66731 66730 66729 66728 66727 66726 66725 66724 66723 66722 66721 66720 66719 66718 66717 66716 66715 66714 66713 66712 66711 66710 66709 66708 66707 66706 66705 66704 66703 66702 66701 66700 66699 66698 66697 66696 66695 66694 66693 66692 66691 66690 66689 66688 66687 66686 66685 66684 66683 66682 66681 66680 66679 66678 66677 66676 66675 66674 66673 66672 66671 66670 66669 66668 66667 66666 66665 66664 66663 66662 66661 66660 66659 66658 66657 66656 66655 66654 66653 66652 66651 66650 66649 66648 66647 66646 66645 66644 66643 66642 66641 66640 66639 66638 66637 66636 66635 66634 66633 66632 66631 66630 66629 66628 66627 66626 66625 66624 66623 66622 66621 66620 66619 66618 66617 66616 66615 66614 66613 66612 66611 66610 66609 66608 66607 66606 66605 66604 66603 66602 66601 66600 66599 66598 66597 66596 66595 66594 66593 66592 66591 66590 66589 66588 66587 66586 66585 66584 66583 66582 66581 66580 66579 66578 66577 66576 66575 66574 66573 66572 66571 66570 66569 66568 66567 66566 66565 66564 66563 66562 66561 66560 66559 66558 66557 66556 66555 66554 66553 66552 66551 66550 66549 66548 66547 66546 66545 66544 66543 66542 66541 66540 66539 66538 66537 66536 66535 66534 66533 66532 66531 66530 66529 66528 66527 66526 66525 66524 66523 66522 66521 66520 66519 66518 66517 66516 66515 66514 66513 66512 66511 66510 66509 66508 66507 66506 66505 66504 66503 66502 66501 66500 66499 66498 66497 66496 66495 66494 66493 66492 66491 66490 66489 66488 66487 66486 66485 66484 66483 66482 66481 66480 66479 66478 66477 66476 66475 66474 66473 66472 66471 66470 66469 66468 66467 66466 66465 66464 66463 66462 66461 66460 66459 66458 66457 66456 66455 66454 66453 66452 66451 66450 66449 66448 66447 66446 66445 66444 66443 66442 66441 66440 66439 66438 66437 66436 66435 66434 66433 66432 66431 66430 66429 66428 66427 66426 66425 66424 66423 66422 66421 66420 66419 66418 66417 66416 66415 66414 66413 66412 66411 66410 66409 66408 66407 66406 66405 66404 66403 66402 66401 66400 66399 66398 66397 66396 66395 66394 66393 66392 66391 66390 66389 66388 66387 66386 66385 66384 66383 66382 66381 66380 66379 66378 66377 66376 66375 66374 66373 66372 66371 66370 66369 66368 66367 66366 66365 66364 66363 66362 66361 66360 66359 66358 66357 66356 66355 66354 66353 66352 66351 66350 66349 66348 66347 66346 66345 66344 66343 66342 66341 66340 66339 66338 66337 66336 66335 66334 66333 66332 66331 66330 66329 66328 66327 66326 66325 66324 66323 66322 66321 66320 66319 66318 66317 66316 66315 66314 66313 66312 66311 66310 66309 66308 66307 66306 66305 66304 66303 66302 66301 66300 66299 66298 66297 66296 66295 66294 66293 66292 66291 66290 66289 66288 66287 66286 66285 66284 66283 66282 66281 66280 66279 66278 66277 66276 66275 66274 66273 66272 66271 66270 66269 66268 66267 66266 66265 66264 66263 66262 66261 66260 66259 66258 66257 66256 66255 66254 66253 66252 66251 66250 66249 66248 66247 66246 66245 66244 66243 66242 66241 66240 66239 66238 66237 66236 66235 66234 66233 66232 66231 66230 66229 66228 66227 66226 66225 66224 66223 66222 66221 66220 66219 66218 66217 66216 66215 66214 66213 66212 66211 66210 66209 66208 66207 66206 66205 66204 66203 66202 66201 66200 66199 66198 66197 66196 66195 66194 66193 66192 66191 66190 66189 66188 66187 66186 66185 66184 66183 66182 66181 66180 66179 66178 66177 66176 66175 66174 66173 66172 66171 66170 66169 66168 66167 66166 66165 66164 66163 66162 66161 66160 66159 66158 66157 66156 66155 66154 66153 66152 66151 66150 66149 66148 66147 66146 66145 66144 66143 66142 66141 66140 66139 66138 66137 66136 66135 66134 66133 66132 66131 66130 66129 66128 66127 66126 66125 66124 66123 66122 66121 66120 66119 66118 66117 66116 66115 66114 66113 66112 66111 66110 66109 66108 66107 66106 66105 66104 66103 66102 66101 66100 66099 66098 66097 66096 66095 66094 66093 66092 66091 66090 66089 66088 66087 66086 66085 66084 66083 66082 66081 66080 66079 66078 66077 66076 66075 66074 66073 66072 66071 66070 66069 66068 66067 66066 66065 66064 66063 66062 66061 66060 66059 66058 66057 66056 66055 66054 66053 66052 66051 66050 66049 66048 66047 66046 66045 66044 66043 66042 66041 66040 66039 66038 66037 66036 66035 66034 66033 66032 66031 66030 66029 66028 66027 66026 66025 66024 66023 66022 66021 66020 66019 66018 66017 66016 66015 66014 66013 66012 66011 66010 66009 66008 66007 66006 66005 66004 66003 66002 66001 66000 65999 65998 65997 65996 65995 65994 65993 65992 65991 65990 65989 65988 65987 65986 65985 65984 65983 65982 65981 65980 65979 65978 65977 65976 65975 65974 65973 65972 65971 65970 65969 65968 65967 65966 65965 65964 65963 65962 65961 65960 65959 65958 65957 65956 65955 65954 65953 65952 65951 65950 65949 65948 65947 65946 65945 65944 65943 65942 65941 65940 65939 65938 65937 65936 65935 65934 65933 65932 65931 65930 65929 65928 65927 65926 65925 65924 65923 65922 65921 65920 65919 65918 65917 65916 65915 65914 65913 65912 65911 65910 65909 65908 65907 65906 65905 65904 65903 65902 65901 65900 65899 65898 65897 65896 65895 65894 65893 65892 65891 65890 65889 65888 65887 65886 65885 65884 65883 65882 65881 65880 65879 65878 65877 65876 65875 65874 65873 65872 65871 65870 65869 65868 65867 65866 65865 65864 65863 65862 65861 65860 65859 65858 65857 65856 65855 65854 65853 65852 65851 65850 65849 65848 65847 65846 65845 65844 65843 65842 65841 65840 65839 65838 65837 65836 65835 65834 65833 65832 65831 65830 65829 65828 65827 65826 65825 65824 65823 65822 65821 65820 65819 65818 65817 65816 65815 65814 65813 65812 65811 65810 65809 65808 65807 65806 65805 65804 65803 65802 65801 65800 65799 65798 65797 65796 65795 65794 65793 65792 65791 65790 65789 65788 65787 65786 65785 65784 65783 65782 65781 65780 65779 65778 65777 65776 65775 65774 65773 65772 65771 65770 65769 65768 65767 65766 65765 65764 65763 65762 65761 65760 65759 65758 65757 65756 65755 65754 65753 65752 65751 65750 65749 65748 65747 65746 65745 65744 65743 65742 65741 65740 65739 65738 65737 65736 65735 65734 65733 65732 65731 65730 65729 65728 65727 65726 65725 65724 65723 65722 65721 65720 65719 65718 65717 65716 65715 65714 65713 65712 65711 65710 65709 65708 65707 65706 65705 65704 65703 65702 65701 65700 65699 65698 65697 65696 65695 65694 65693 65692 65691 65690 65689 65688 65687 65686 65685 65684 65683 65682 65681 65680 65679 65678 65677 65676 65675 65674 65673 65672 65671 65670 65669 65668 65667 65666 65665 65664 65663 65662 65661 65660 65659 65658 65657 65656 65655 65654 65653 65652 65651 65650 65649 65648 65647 65646 65645 65644 65643 65642 65641 65640 65639 65638 65637 65636 65635 65634 65633 65632 65631 65630 65629 65628 65627 65626 65625 65624 65623 65622 65621 65620 65619 65618 65617 65616 65615 65614 65613 65612 65611 65610 65609 65608 65607 65606 65605 65604 65603 65602 65601 65600 65599 65598 65597 65596 65595 65594 65593 65592 65591 65590 65589 65588 65587 65586 65585 65584 65583 65582 65581 65580 65579 65578 65577 65576 65575 65574 65573 65572 65571 65570 65569 65568 65567 65566 65565 65564 65563 65562 65561 65560 65559 65558 65557 65556 65555 65554 65553 65552 65551 65550 65549 65548 65547 65546 65545 65544 65543 65542 65541 65540 65539 65538 65537 65536 65535 65534 65533 65532 65531 65530 65529 65528 65527 65526 65525 65524 65523 65522 65521 65520 65519 65518 65517 65516 65515 65514 65513 65512 65511 65510 65509 65508 65507 65506 65505 65504 65503 65502 65501 65500 65499 65498 65497 65496 65495 65494 65493 65492 65491 65490 65489 65488 65487 65486 65485 65484 65483 65482 65481 65480 65479 65478 65477 65476 65475 65474 65473 65472 65471 65470 65469 65468 65467 65466 65465 65464 65463 65462 65461 65460 65459 65458 65457 65456 65455 65454 65453 65452 65451 65450 65449 65448 65447 65446 65445 65444 65443 65442 65441 65440 65439 65438 65437 65436 65435 65434 65433 65432 65431 65430 65429 65428 65427 65426 65425 65424 65423 65422 65421 65420 65419 65418 65417 65416 65415 65414 65413 65412 65411 65410 65409 65408 65407 65406 65405 65404 65403 65402 65401 65400 65399 65398 65397 65396 65395 65394 65393 65392 65391 65390 65389 65388 65387 65386 65385 65384 65383 65382 65381 65380 65379 65378 65377 65376 65375 65374 65373 65372 65371 65370 65369 65368 65367 65366 65365 65364 65363 65362 65361 65360 65359 65358 65357 65356 65355 65354 65353 65352 65351 65350 65349 65348 65347 65346 65345 65344 65343 65342 65341 65340 65339 65338 65337 65336 65335 65334 65333 65332 65331 65330 65329 65328 65327 65326 65325 65324 65323 65322 65321 65320 65319 65318 65317 65316 65315 65314 65313 65312 65311 65310 65309 65308 65307 65306 65305 65304 65303 65302 65301 65300 65299 65298 65297 65296 65295 65294 65293 65292 65291 65290 65289 65288 65287 65286 65285 65284 65283 65282 65281 65280 65279 65278 65277 65276 65275 65274 65273 65272 65271 65270 65269 65268 65267 65266 65265 65264 65263 65262 65261 65260 65259 65258 65257 65256 65255 65254 65253 65252 65251 65250 65249 65248 65247 65246 65245 65244 65243 65242 65241 65240 65239 65238 65237 65236 65235 65234 65233 65232 65231 65230 65229 65228 65227 65226 65225 65224 65223 65222 65221 65220 65219 65218 65217 65216 65215 65214 65213 65212 65211 65210 65209 65208 65207 65206 65205 65204 65203 65202 65201 65200 65199 65198 65197 65196 65195 65194 65193 65192 65191 65190 65189 65188 65187 65186 65185 65184 65183 65182 65181 65180 65179 65178 65177 65176 65175 65174 65173 65172 65171 65170 65169 65168 65167 65166 65165 65164 65163 65162 65161 65160 65159 65158 65157 65156 65155 65154 65153 65152 65151 65150 65149 65148 65147 65146 65145 65144 65143 65142 65141 65140 65139 65138 65137 65136 65135 65134 65133 65132 65131 65130 65129 65128 65127 65126 65125 65124 65123 65122 65121 65120 65119 65118 65117 65116 65115 65114 65113 65112 65111 65110 65109 65108 65107 65106 65105 65104 65103 65102 65101 65100 65099 65098 65097 65096 65095 65094 65093 65092 65091 65090 65089 65088 65087 65086 65085 65084 65083 65082 65081 65080 65079 65078 65077 65076 65075 65074 65073 65072 65071 65070 65069 65068 65067 65066 65065 65064 65063 65062 65061 65060 65059 65058 65057 65056 65055 65054 65053 65052 65051 65050 65049 65048 65047 65046 65045 65044 65043 65042 65041 65040 65039 65038 65037 65036 65035 65034 65033 65032 65031 65030 65029 65028 65027 65026 65025 65024 65023 65022 65021 65020 65019 65018 65017 65016 65015 65014 65013 65012 65011 65010 65009 65008 65007 65006 65005 65004 65003 65002 65001 65000 64999 64998 64997 64996 64995 64994 64993 64992 64991 64990 64989 64988 64987 64986 64985 64984 64983 64982 64981 64980 64979 64978 64977 64976 64975 64974 64973 64972 64971 64970 64969 64968 64967 64966 64965 64964 64963 64962 64961 64960 64959 64958 64957 64956 64955 64954 64953 64952 64951 64950 64949 64948 64947 64946 64945 64944 64943 64942 64941 64940 64939 64938 64937 64936 64935 64934 64933 64932 64931 64930 64929 64928 64927 64926 64925 64924 64923 64922 64921 64920 64919 64918 64917 64916 64915 64914 64913 64912 64911 64910 64909 64908 64907 64906 64905 64904 64903 64902 64901 64900 64899 64898 64897 64896 64895 64894 64893 64892 64891 64890 64889 64888 64887 64886 64885 64884 64883 64882 64881 64880 64879 64878 64877 64876 64875 64874 64873 64872 64871 64870 64869 64868 64867 64866 64865 64864 64863 64862 64861 64860 64859 64858 64857 64856 64855 64854 64853 64852 64851 64850 64849 64848 64847 64846 64845 64844 64843 64842 64841 64840 64839 64838 64837 64836 64835 64834 64833 64832 64831 64830 64829 64828 64827 64826 64825 64824 64823 64822 64821 64820 64819 64818 64817 64816 64815 64814 64813 64812 64811 64810 64809 64808 64807 64806 64805 64804 64803 64802 64801 64800 64799 64798 64797 64796 64795 64794 64793 64792 64791 64790 64789 64788 64787 64786 64785 64784 64783 64782 64781 64780 64779 64778 64777 64776 64775 64774 64773 64772 64771 64770 64769 64768 64767 64766 64765 64764 64763 64762 64761 64760 64759 64758 64757 64756 64755 64754 64753 64752 64751 64750 64749 64748 64747 64746 64745 64744 64743 64742 64741 64740 64739 64738 64737 64736 64735 64734 64733 64732 64731 64730 64729 64728 64727 64726 64725 64724 64723 64722 64721 64720 64719 64718 64717 64716 64715 64714 64713 64712 64711 64710 64709 64708 64707 64706 64705 64704 64703 64702 64701 64700 64699 64698 64697 64696 64695 64694 64693 64692 64691 64690 64689 64688 64687 64686 64685 64684 64683 64682 64681 64680 64679 64678 64677 64676 64675 64674 64673 64672 64671 64670 64669 64668 64667 64666 64665 64664 64663 64662 64661 64660 64659 64658 64657 64656 64655 64654 64653 64652 64651 64650 64649 64648 64647 64646 64645 64644 64643 64642 64641 64640 64639 64638 64637 64636 64635 64634 64633 64632 64631 64630 64629 64628 64627 64626 64625 64624 64623 64622 64621 64620 64619 64618 64617 64616 64615 64614 64613 64612 64611 64610 64609 64608 64607 64606 64605 64604 64603 64602 64601 64600 64599 64598 64597 64596 64595 64594 64593 64592 64591 64590 64589 64588 64587 64586 64585 64584 64583 64582 64581 64580 64579 64578 64577 64576 64575 64574 64573 64572 64571 64570 64569 64568 64567 64566 64565 64564 64563 64562 64561 64560 64559 64558 64557 64556 64555 64554 64553 64552 64551 64550 64549 64548 64547 64546 64545 64544 64543 64542 64541 64540 64539 64538 64537 64536 64535 64534 64533 64532 64531 64530 64529 64528 64527 64526 64525 64524 64523 64522 64521 64520 64519 64518 64517 64516 64515 64514 64513 64512 64511 64510 64509 64508 64507 64506 64505 64504 64503 64502 64501 64500 64499 64498 64497 64496 64495 64494 64493 64492 64491 64490 64489 64488 64487 64486 64485 64484 64483 64482 64481 64480 64479 64478 64477 64476 64475 64474 64473 64472 64471 64470 64469 64468 64467 64466 64465 64464 64463 64462 64461 64460 64459 64458 64457 64456 64455 64454 64453 64452 64451 64450 64449 64448 64447 64446 64445 64444 64443 64442 64441 64440 64439 64438 64437 64436 64435 64434 64433 64432 64431 64430 64429 64428 64427 64426 64425 64424 64423 64422 64421 64420 64419 64418 64417 64416 64415 64414 64413 64412 64411 64410 64409 64408 64407 64406 64405 64404 64403 64402 64401 64400 64399 64398 64397 64396 64395 64394 64393 64392 64391 64390 64389 64388 64387 64386 64385 64384 64383 64382 64381 64380 64379 64378 64377 64376 64375 64374 64373 64372 64371 64370 64369 64368 64367 64366 64365 64364 64363 64362 64361 64360 64359 64358 64357 64356 64355 64354 64353 64352 64351 64350 64349 64348 64347 64346 64345 64344 64343 64342 64341 64340 64339 64338 64337 64336 64335 64334 64333 64332 64331 64330 64329 64328 64327 64326 64325 64324 64323 64322 64321 64320 64319 64318 64317 64316 64315 64314 64313 64312 64311 64310 64309 64308 64307 64306 64305 64304 64303 64302 64301 64300 64299 64298 64297 64296 64295 64294 64293 64292 64291 64290 64289 64288 64287 64286 64285 64284 64283 64282 64281 64280 64279 64278 64277 64276 64275 64274 64273 64272 64271 64270 64269 64268 64267 64266 64265 64264 64263 64262 64261 64260 64259 64258 64257 64256 64255 64254 64253 64252 64251 64250 64249 64248 64247 64246 64245 64244 64243 64242 64241 64240 64239 64238 64237 64236 64235 64234 64233 64232 64231 64230 64229 64228 64227 64226 64225 64224 64223 64222 64221 64220 64219 64218 64217 64216 64215 64214 64213 64212 64211 64210 64209 64208 64207 64206 64205 64204 64203 64202 64201 64200 64199 64198 64197 64196 64195 64194 64193 64192 64191 64190 64189 64188 64187 64186 64185 64184 64183 64182 64181 64180 64179 64178 64177 64176 64175 64174 64173 64172 64171 64170 64169 64168 64167 64166 64165 64164 64163 64162 64161 64160 64159 64158 64157 64156 64155 64154 64153 64152 64151 64150 64149 64148 64147 64146 64145 64144 64143 64142 64141 64140 64139 64138 64137 64136 64135 64134 64133 64132 64131 64130 64129 64128 64127 64126 64125 64124 64123 64122 64121 64120 64119 64118 64117 64116 64115 64114 64113 64112 64111 64110 64109 64108 64107 64106 64105 64104 64103 64102 64101 64100 64099 64098 64097 64096 64095 64094 64093 64092 64091 64090 64089 64088 64087 64086 64085 64084 64083 64082 64081 64080 64079 64078 64077 64076 64075 64074 64073 64072 64071 64070 64069 64068 64067 64066 64065 64064 64063 64062 64061 64060 64059 64058 64057 64056 64055 64054 64053 64052 64051 64050 64049 64048 64047 64046 64045 64044 64043 64042 64041 64040 64039 64038 64037 64036 64035 64034 64033 64032 64031 64030 64029 64028 64027 64026 64025 64024 64023 64022 64021 64020 64019 64018 64017 64016 64015 64014 64013 64012 64011 64010 64009 64008 64007 64006 64005 64004 64003 64002 64001 64000 63999 63998 63997 63996 63995 63994 63993 63992 63991 63990 63989 63988 63987 63986 63985 63984 63983 63982 63981 63980 63979 63978 63977 63976 63975 63974 63973 63972 63971 63970 63969 63968 63967 63966 63965 63964 63963 63962 63961 63960 63959 63958 63957 63956 63955 63954 63953 63952 63951 63950 63949 63948 63947 63946 63945 63944 63943 63942 63941 63940 63939 63938 63937 63936 63935 63934 63933 63932 63931 63930 63929 63928 63927 63926 63925 63924 63923 63922 63921 63920 63919 63918 63917 63916 63915 63914 63913 63912 63911 63910 63909 63908 63907 63906 63905 63904 63903 63902 63901 63900 63899 63898 63897 63896 63895 63894 63893 63892 63891 63890 63889 63888 63887 63886 63885 63884 63883 63882 63881 63880 63879 63878 63877 63876 63875 63874 63873 63872 63871 63870 63869 63868 63867 63866 63865 63864 63863 63862 63861 63860 63859 63858 63857 63856 63855 63854 63853 63852 63851 63850 63849 63848 63847 63846 63845 63844 63843 63842 63841 63840 63839 63838 63837 63836 63835 63834 63833 63832 63831 63830 63829 63828 63827 63826 63825 63824 63823 63822 63821 63820 63819 63818 63817 63816 63815 63814 63813 63812 63811 63810 63809 63808 63807 63806 63805 63804 63803 63802 63801 63800 63799 63798 63797 63796 63795 63794 63793 63792 63791 63790 63789 63788 63787 63786 63785 63784 63783 63782 63781 63780 63779 63778 63777 63776 63775 63774 63773 63772 63771 63770 63769 63768 63767 63766 63765 63764 63763 63762 63761 63760 63759 63758 63757 63756 63755 63754 63753 63752 63751 63750 63749 63748 63747 63746 63745 63744 63743 63742 63741 63740 63739 63738 63737 63736 63735 63734 63733 63732 63731 63730 63729 63728 63727 63726 63725 63724 63723 63722 63721 63720 63719 63718 63717 63716 63715 63714 63713 63712 63711 63710 63709 63708 63707 63706 63705 63704 63703 63702 63701 63700 63699 63698 63697 63696 63695 63694 63693 63692 63691 63690 63689 63688 63687 63686 63685 63684 63683 63682 63681 63680 63679 63678 63677 63676 63675 63674 63673 63672 63671 63670 63669 63668 63667 63666 63665 63664 63663 63662 63661 63660 63659 63658 63657 63656 63655 63654 63653 63652 63651 63650 63649 63648 63647 63646 63645 63644 63643 63642 63641 63640 63639 63638 63637 63636 63635 63634 63633 63632 63631 63630 63629 63628 63627 63626 63625 63624 63623 63622 63621 63620 63619 63618 63617 63616 63615 63614 63613 63612 63611 63610 63609 63608 63607 63606 63605 63604 63603 63602 63601 63600 63599 63598 63597 63596 63595 63594 63593 63592 63591 63590 63589 63588 63587 63586 63585 63584 63583 63582 63581 63580 63579 63578 63577 63576 63575 63574 63573 63572 63571 63570 63569 63568 63567 63566 63565 63564 63563 63562 63561 63560 63559 63558 63557 63556 63555 63554 63553 63552 63551 63550 63549 63548 63547 63546 63545 63544 63543 63542 63541 63540 63539 63538 63537 63536 63535 63534 63533 63532 63531 63530 63529 63528 63527 63526 63525 63524 63523 63522 63521 63520 63519 63518 63517 63516 63515 63514 63513 63512 63511 63510 63509 63508 63507 63506 63505 63504 63503 63502 63501 63500 63499 63498 63497 63496 63495 63494 63493 63492 63491 63490 63489 63488 63487 63486 63485 63484 63483 63482 63481 63480 63479 63478 63477 63476 63475 63474 63473 63472 63471 63470 63469 63468 63467 63466 63465 63464 63463 63462 63461 63460 63459 63458 63457 63456 63455 63454 63453 63452 63451 63450 63449 63448 63447 63446 63445 63444 63443 63442 63441 63440 63439 63438 63437 63436 63435 63434 63433 63432 63431 63430 63429 63428 63427 63426 63425 63424 63423 63422 63421 63420 63419 63418 63417 63416 63415 63414 63413 63412 63411 63410 63409 63408 63407 63406 63405 63404 63403 63402 63401 63400 63399 63398 63397 63396 63395 63394 63393 63392 63391 63390 63389 63388 63387 63386 63385 63384 63383 63382 63381 63380 63379 63378 63377 63376 63375 63374 63373 63372 63371 63370 63369 63368 63367 63366 63365 63364 63363 63362 63361 63360 63359 63358 63357 63356 63355 63354 63353 63352 63351 63350 63349 63348 63347 63346 63345 63344 63343 63342 63341 63340 63339 63338 63337 63336 63335 63334 63333 63332 63331 63330 63329 63328 63327 63326 63325 63324 63323 63322 63321 63320 63319 63318 63317 63316 63315 63314 63313 63312 63311 63310 63309 63308 63307 63306 63305 63304 63303 63302 63301 63300 63299 63298 63297 63296 63295 63294 63293 63292 63291 63290 63289 63288 63287 63286 63285 63284 63283 63282 63281 63280 63279 63278 63277 63276 63275 63274 63273 63272 63271 63270 63269 63268 63267 63266 63265 63264 63263 63262 63261 63260 63259 63258 63257 63256 63255 63254 63253 63252 63251 63250 63249 63248 63247 63246 63245 63244 63243 63242 63241 63240 63239 63238 63237 63236 63235 63234 63233 63232 63231 63230 63229 63228 63227 63226 63225 63224 63223 63222 63221 63220 63219 63218 63217 63216 63215 63214 63213 63212 63211 63210 63209 63208 63207 63206 63205 63204 63203 63202 63201 63200 63199 63198 63197 63196 63195 63194 63193 63192 63191 63190 63189 63188 63187 63186 63185 63184 63183 63182 63181 63180 63179 63178 63177 63176 63175 63174 63173 63172 63171 63170 63169 63168 63167 63166 63165 63164 63163 63162 63161 63160 63159 63158 63157 63156 63155 63154 63153 63152 63151 63150 63149 63148 63147 63146 63145 63144 63143 63142 63141 63140 63139 63138 63137 63136 63135 63134 63133 63132 63131 63130 63129 63128 63127 63126 63125 63124 63123 63122 63121 63120 63119 63118 63117 63116 63115 63114 63113 63112 63111 63110 63109 63108 63107 63106 63105 63104 63103 63102 63101 63100 63099 63098 63097 63096 63095 63094 63093 63092 63091 63090 63089 63088 63087 63086 63085 63084 63083 63082 63081 63080 63079 63078 63077 63076 63075 63074 63073 63072 63071 63070 63069 63068 63067 63066 63065 63064 63063 63062 63061 63060 63059 63058 63057 63056 63055 63054 63053 63052 63051 63050 63049 63048 63047 63046 63045 63044 63043 63042 63041 63040 63039 63038 63037 63036 63035 63034 63033 63032 63031 63030 63029 63028 63027 63026 63025 63024 63023 63022 63021 63020 63019 63018 63017 63016 63015 63014 63013 63012 63011 63010 63009 63008 63007 63006 63005 63004 63003 63002 63001 63000 62999 62998 62997 62996 62995 62994 62993 62992 62991 62990 62989 62988 62987 62986 62985 62984 62983 62982 62981 62980 62979 62978 62977 62976 62975 62974 62973 62972 62971 62970 62969 62968 62967 62966 62965 62964 62963 62962 62961 62960 62959 62958 62957 62956 62955 62954 62953 62952 62951 62950 62949 62948 62947 62946 62945 62944 62943 62942 62941 62940 62939 62938 62937 62936 62935 62934 62933 62932 62931 62930 62929 62928 62927 62926 62925 62924 62923 62922 62921 62920 62919 62918 62917 62916 62915 62914 62913 62912 62911 62910 62909 62908 62907 62906 62905 62904 62903 62902 62901 62900 62899 62898 62897 62896 62895 62894 62893 62892 62891 62890 62889 62888 62887 62886 62885 62884 62883 62882 62881 62880 62879 62878 62877 62876 62875 62874 62873 62872 62871 62870 62869 62868 62867 62866 62865 62864 62863 62862 62861 62860 62859 62858 62857 62856 62855 62854 62853 62852 62851 62850 62849 62848 62847 62846 62845 62844 62843 62842 62841 62840 62839 62838 62837 62836 62835 62834 62833 62832 62831 62830 62829 62828 62827 62826 62825 62824 62823 62822 62821 62820 62819 62818 62817 62816 62815 62814 62813 62812 62811 62810 62809 62808 62807 62806 62805 62804 62803 62802 62801 62800 62799 62798 62797 62796 62795 62794 62793 62792 62791 62790 62789 62788 62787 62786 62785 62784 62783 62782 62781 62780 62779 62778 62777 62776 62775 62774 62773 62772 62771 62770 62769 62768 62767 62766 62765 62764 62763 62762 62761 62760 62759 62758 62757 62756 62755 62754 62753 62752 62751 62750 62749 62748 62747 62746 62745 62744 62743 62742 62741 62740 62739 62738 62737 62736 62735 62734 62733 62732 62731 62730 62729 62728 62727 62726 62725 62724 62723 62722 62721 62720 62719 62718 62717 62716 62715 62714 62713 62712 62711 62710 62709 62708 62707 62706 62705 62704 62703 62702 62701 62700 62699 62698 62697 62696 62695 62694 62693 62692 62691 62690 62689 62688 62687 62686 62685 62684 62683 62682 62681 62680 62679 62678 62677 62676 62675 62674 62673 62672 62671 62670 62669 62668 62667 62666 62665 62664 62663 62662 62661 62660 62659 62658 62657 62656 62655 62654 62653 62652 62651 62650 62649 62648 62647 62646 62645 62644 62643 62642 62641 62640 62639 62638 62637 62636 62635 62634 62633 62632 62631 62630 62629 62628 62627 62626 62625 62624 62623 62622 62621 62620 62619 62618 62617 62616 62615 62614 62613 62612 62611 62610 62609 62608 62607 62606 62605 62604 62603 62602 62601 62600 62599 62598 62597 62596 62595 62594 62593 62592 62591 62590 62589 62588 62587 62586 62585 62584 62583 62582 62581 62580 62579 62578 62577 62576 62575 62574 62573 62572 62571 62570 62569 62568 62567 62566 62565 62564 62563 62562 62561 62560 62559 62558 62557 62556 62555 62554 62553 62552 62551 62550 62549 62548 62547 62546 62545 62544 62543 62542 62541 62540 62539 62538 62537 62536 62535 62534 62533 62532 62531 62530 62529 62528 62527 62526 62525 62524 62523 62522 62521 62520 62519 62518 62517 62516 62515 62514 62513 62512 62511 62510 62509 62508 62507 62506 62505 62504 62503 62502 62501 62500 62499 62498 62497 62496 62495 62494 62493 62492 62491 62490 62489 62488 62487 62486 62485 62484 62483 62482 62481 62480 62479 62478 62477 62476 62475 62474 62473 62472 62471 62470 62469 62468 62467 62466 62465 62464 62463 62462 62461 62460 62459 62458 62457 62456 62455 62454 62453 62452 62451 62450 62449 62448 62447 62446 62445 62444 62443 62442 62441 62440 62439 62438 62437 62436 62435 62434 62433 62432 62431 62430 62429 62428 62427 62426 62425 62424 62423 62422 62421 62420 62419 62418 62417 62416 62415 62414 62413 62412 62411 62410 62409 62408 62407 62406 62405 62404 62403 62402 62401 62400 62399 62398 62397 62396 62395 62394 62393 62392 62391 62390 62389 62388 62387 62386 62385 62384 62383 62382 62381 62380 62379 62378 62377 62376 62375 62374 62373 62372 62371 62370 62369 62368 62367 62366 62365 62364 62363 62362 62361 62360 62359 62358 62357 62356 62355 62354 62353 62352 62351 62350 62349 62348 62347 62346 62345 62344 62343 62342 62341 62340 62339 62338 62337 62336 62335 62334 62333 62332 62331 62330 62329 62328 62327 62326 62325 62324 62323 62322 62321 62320 62319 62318 62317 62316 62315 62314 62313 62312 62311 62310 62309 62308 62307 62306 62305 62304 62303 62302 62301 62300 62299 62298 62297 62296 62295 62294 62293 62292 62291 62290 62289 62288 62287 62286 62285 62284 62283 62282 62281 62280 62279 62278 62277 62276 62275 62274 62273 62272 62271 62270 62269 62268 62267 62266 62265 62264 62263 62262 62261 62260 62259 62258 62257 62256 62255 62254 62253 62252 62251 62250 62249 62248 62247 62246 62245 62244 62243 62242 62241 62240 62239 62238 62237 62236 62235 62234 62233 62232 62231 62230 62229 62228 62227 62226 62225 62224 62223 62222 62221 62220 62219 62218 62217 62216 62215 62214 62213 62212 62211 62210 62209 62208 62207 62206 62205 62204 62203 62202 62201 62200 62199 62198 62197 62196 62195 62194 62193 62192 62191 62190 62189 62188 62187 62186 62185 62184 62183 62182 62181 62180 62179 62178 62177 62176 62175 62174 62173 62172 62171 62170 62169 62168 62167 62166 62165 62164 62163 62162 62161 62160 62159 62158 62157 62156 62155 62154 62153 62152 62151 62150 62149 62148 62147 62146 62145 62144 62143 62142 62141 62140 62139 62138 62137 62136 62135 62134 62133 62132 62131 62130 62129 62128 62127 62126 62125 62124 62123 62122 62121 62120 62119 62118 62117 62116 62115 62114 62113 62112 62111 62110 62109 62108 62107 62106 62105 62104 62103 62102 62101 62100 62099 62098 62097 62096 62095 62094 62093 62092 62091 62090 62089 62088 62087 62086 62085 62084 62083 62082 62081 62080 62079 62078 62077 62076 62075 62074 62073 62072 62071 62070 62069 62068 62067 62066 62065 62064 62063 62062 62061 62060 62059 62058 62057 62056 62055 62054 62053 62052 62051 62050 62049 62048 62047 62046 62045 62044 62043 62042 62041 62040 62039 62038 62037 62036 62035 62034 62033 62032 62031 62030 62029 62028 62027 62026 62025 62024 62023 62022 62021 62020 62019 62018 62017 62016 62015 62014 62013 62012 62011 62010 62009 62008 62007 62006 62005 62004 62003 62002 62001 62000 61999 61998 61997 61996 61995 61994 61993 61992 61991 61990 61989 61988 61987 61986 61985 61984 61983 61982 61981 61980 61979 61978 61977 61976 61975 61974 61973 61972 61971 61970 61969 61968 61967 61966 61965 61964 61963 61962 61961 61960 61959 61958 61957 61956 61955 61954 61953 61952 61951 61950 61949 61948 61947 61946 61945 61944 61943 61942 61941 61940 61939 61938 61937 61936 61935 61934 61933 61932 61931 61930 61929 61928 61927 61926 61925 61924 61923 61922 61921 61920 61919 61918 61917 61916 61915 61914 61913 61912 61911 61910 61909 61908 61907 61906 61905 61904 61903 61902 61901 61900 61899 61898 61897 61896 61895 61894 61893 61892 61891 61890 61889 61888 61887 61886 61885 61884 61883 61882 61881 61880 61879 61878 61877 61876 61875 61874 61873 61872 61871 61870 61869 61868 61867 61866 61865 61864 61863 61862 61861 61860 61859 61858 61857 61856 61855 61854 61853 61852 61851 61850 61849 61848 61847 61846 61845 61844 61843 61842 61841 61840 61839 61838 61837 61836 61835 61834 61833 61832 61831 61830 61829 61828 61827 61826 61825 61824 61823 61822 61821 61820 61819 61818 61817 61816 61815 61814 61813 61812 61811 61810 61809 61808 61807 61806 61805 61804 61803 61802 61801 61800 61799 61798 61797 61796 61795 61794 61793 61792 61791 61790 61789 61788 61787 61786 61785 61784 61783 61782 61781 61780 61779 61778 61777 61776 61775 61774 61773 61772 61771 61770 61769 61768 61767 61766 61765 61764 61763 61762 61761 61760 61759 61758 61757 61756 61755 61754 61753 61752 61751 61750 61749 61748 61747 61746 61745 61744 61743 61742 61741 61740 61739 61738 61737 61736 61735 61734 61733 61732 61731 61730 61729 61728 61727 61726 61725 61724 61723 61722 61721 61720 61719 61718 61717 61716 61715 61714 61713 61712 61711 61710 61709 61708 61707 61706 61705 61704 61703 61702 61701 61700 61699 61698 61697 61696 61695 61694 61693 61692 61691 61690 61689 61688 61687 61686 61685 61684 61683 61682 61681 61680 61679 61678 61677 61676 61675 61674 61673 61672 61671 61670 61669 61668 61667 61666 61665 61664 61663 61662 61661 61660 61659 61658 61657 61656 61655 61654 61653 61652 61651 61650 61649 61648 61647 61646 61645 61644 61643 61642 61641 61640 61639 61638 61637 61636 61635 61634 61633 61632 61631 61630 61629 61628 61627 61626 61625 61624 61623 61622 61621 61620 61619 61618 61617 61616 61615 61614 61613 61612 61611 61610 61609 61608 61607 61606 61605 61604 61603 61602 61601 61600 61599 61598 61597 61596 61595 61594 61593 61592 61591 61590 61589 61588 61587 61586 61585 61584 61583 61582 61581 61580 61579 61578 61577 61576 61575 61574 61573 61572 61571 61570 61569 61568 61567 61566 61565 61564 61563 61562 61561 61560 61559 61558 61557 61556 61555 61554 61553 61552 61551 61550 61549 61548 61547 61546 61545 61544 61543 61542 61541 61540 61539 61538 61537 61536 61535 61534 61533 61532 61531 61530 61529 61528 61527 61526 61525 61524 61523 61522 61521 61520 61519 61518 61517 61516 61515 61514 61513 61512 61511 61510 61509 61508 61507 61506 61505 61504 61503 61502 61501 61500 61499 61498 61497 61496 61495 61494 61493 61492 61491 61490 61489 61488 61487 61486 61485 61484 61483 61482 61481 61480 61479 61478 61477 61476 61475 61474 61473 61472 61471 61470 61469 61468 61467 61466 61465 61464 61463 61462 61461 61460 61459 61458 61457 61456 61455 61454 61453 61452 61451 61450 61449 61448 61447 61446 61445 61444 61443 61442 61441 61440 61439 61438 61437 61436 61435 61434 61433 61432 61431 61430 61429 61428 61427 61426 61425 61424 61423 61422 61421 61420 61419 61418 61417 61416 61415 61414 61413 61412 61411 61410 61409 61408 61407 61406 61405 61404 61403 61402 61401 61400 61399 61398 61397 61396 61395 61394 61393 61392 61391 61390 61389 61388 61387 61386 61385 61384 61383 61382 61381 61380 61379 61378 61377 61376 61375 61374 61373 61372 61371 61370 61369 61368 61367 61366 61365 61364 61363 61362 61361 61360 61359 61358 61357 61356 61355 61354 61353 61352 61351 61350 61349 61348 61347 61346 61345 61344 61343 61342 61341 61340 61339 61338 61337 61336 61335 61334 61333 61332 61331 61330 61329 61328 61327 61326 61325 61324 61323 61322 61321 61320 61319 61318 61317 61316 61315 61314 61313 61312 61311 61310 61309 61308 61307 61306 61305 61304 61303 61302 61301 61300 61299 61298 61297 61296 61295 61294 61293 61292 61291 61290 61289 61288 61287 61286 61285 61284 61283 61282 61281 61280 61279 61278 61277 61276 61275 61274 61273 61272 61271 61270 61269 61268 61267 61266 61265 61264 61263 61262 61261 61260 61259 61258 61257 61256 61255 61254 61253 61252 61251 61250 61249 61248 61247 61246 61245 61244 61243 61242 61241 61240 61239 61238 61237 61236 61235 61234 61233 61232 61231 61230 61229 61228 61227 61226 61225 61224 61223 61222 61221 61220 61219 61218 61217 61216 61215 61214 61213 61212 61211 61210 61209 61208 61207 61206 61205 61204 61203 61202 61201 61200 61199 61198 61197 61196 61195 61194 61193 61192 61191 61190 61189 61188 61187 61186 61185 61184 61183 61182 61181 61180 61179 61178 61177 61176 61175 61174 61173 61172 61171 61170 61169 61168 61167 61166 61165 61164 61163 61162 61161 61160 61159 61158 61157 61156 61155 61154 61153 61152 61151 61150 61149 61148 61147 61146 61145 61144 61143 61142 61141 61140 61139 61138 61137 61136 61135 61134 61133 61132 61131 61130 61129 61128 61127 61126 61125 61124 61123 61122 61121 61120 61119 61118 61117 61116 61115 61114 61113 61112 61111 61110 61109 61108 61107 61106 61105 61104 61103 61102 61101 61100 61099 61098 61097 61096 61095 61094 61093 61092 61091 61090 61089 61088 61087 61086 61085 61084 61083 61082 61081 61080 61079 61078 61077 61076 61075 61074 61073 61072 61071 61070 61069 61068 61067 61066 61065 61064 61063 61062 61061 61060 61059 61058 61057 61056 61055 61054 61053 61052 61051 61050 61049 61048 61047 61046 61045 61044 61043 61042 61041 61040 61039 61038 61037 61036 61035 61034 61033 61032 61031 61030 61029 61028 61027 61026 61025 61024 61023 61022 61021 61020 61019 61018 61017 61016 61015 61014 61013 61012 61011 61010 61009 61008 61007 61006 61005 61004 61003 61002 61001 61000 60999 60998 60997 60996 60995 60994 60993 60992 60991 60990 60989 60988 60987 60986 60985 60984 60983 60982 60981 60980 60979 60978 60977 60976 60975 60974 60973 60972 60971 60970 60969 60968 60967 60966 60965 60964 60963 60962 60961 60960 60959 60958 60957 60956 60955 60954 60953 60952 60951 60950 60949 60948 60947 60946 60945 60944 60943 60942 60941 60940 60939 60938 60937 60936 60935 60934 60933 60932 60931 60930 60929 60928 60927 60926 60925 60924 60923 60922 60921 60920 60919 60918 60917 60916 60915 60914 60913 60912 60911 60910 60909 60908 60907 60906 60905 60904 60903 60902 60901 60900 60899 60898 60897 60896 60895 60894 60893 60892 60891 60890 60889 60888 60887 60886 60885 60884 60883 60882 60881 60880 60879 60878 60877 60876 60875 60874 60873 60872 60871 60870 60869 60868 60867 60866 60865 60864 60863 60862 60861 60860 60859 60858 60857 60856 60855 60854 60853 60852 60851 60850 60849 60848 60847 60846 60845 60844 60843 60842 60841 60840 60839 60838 60837 60836 60835 60834 60833 60832 60831 60830 60829 60828 60827 60826 60825 60824 60823 60822 60821 60820 60819 60818 60817 60816 60815 60814 60813 60812 60811 60810 60809 60808 60807 60806 60805 60804 60803 60802 60801 60800 60799 60798 60797 60796 60795 60794 60793 60792 60791 60790 60789 60788 60787 60786 60785 60784 60783 60782 60781 60780 60779 60778 60777 60776 60775 60774 60773 60772 60771 60770 60769 60768 60767 60766 60765 60764 60763 60762 60761 60760 60759 60758 60757 60756 60755 60754 60753 60752 60751 60750 60749 60748 60747 60746 60745 60744 60743 60742 60741 60740 60739 60738 60737 60736 60735 60734 60733 60732 60731 60730 60729 60728 60727 60726 60725 60724 60723 60722 60721 60720 60719 60718 60717 60716 60715 60714 60713 60712 60711 60710 60709 60708 60707 60706 60705 60704 60703 60702 60701 60700 60699 60698 60697 60696 60695 60694 60693 60692 60691 60690 60689 60688 60687 60686 60685 60684 60683 60682 60681 60680 60679 60678 60677 60676 60675 60674 60673 60672 60671 60670 60669 60668 60667 60666 60665 60664 60663 60662 60661 60660 60659 60658 60657 60656 60655 60654 60653 60652 60651 60650 60649 60648 60647 60646 60645 60644 60643 60642 60641 60640 60639 60638 60637 60636 60635 60634 60633 60632 60631 60630 60629 60628 60627 60626 60625 60624 60623 60622 60621 60620 60619 60618 60617 60616 60615 60614 60613 60612 60611 60610 60609 60608 60607 60606 60605 60604 60603 60602 60601 60600 60599 60598 60597 60596 60595 60594 60593 60592 60591 60590 60589 60588 60587 60586 60585 60584 60583 60582 60581 60580 60579 60578 60577 60576 60575 60574 60573 60572 60571 60570 60569 60568 60567 60566 60565 60564 60563 60562 60561 60560 60559 60558 60557 60556 60555 60554 60553 60552 60551 60550 60549 60548 60547 60546 60545 60544 60543 60542 60541 60540 60539 60538 60537 60536 60535 60534 60533 60532 60531 60530 60529 60528 60527 60526 60525 60524 60523 60522 60521 60520 60519 60518 60517 60516 60515 60514 60513 60512 60511 60510 60509 60508 60507 60506 60505 60504 60503 60502 60501 60500 60499 60498 60497 60496 60495 60494 60493 60492 60491 60490 60489 60488 60487 60486 60485 60484 60483 60482 60481 60480 60479 60478 60477 60476 60475 60474 60473 60472 60471 60470 60469 60468 60467 60466 60465 60464 60463 60462 60461 60460 60459 60458 60457 60456 60455 60454 60453 60452 60451 60450 60449 60448 60447 60446 60445 60444 60443 60442 60441 60440 60439 60438 60437 60436 60435 60434 60433 60432 60431 60430 60429 60428 60427 60426 60425 60424 60423 60422 60421 60420 60419 60418 60417 60416 60415 60414 60413 60412 60411 60410 60409 60408 60407 60406 60405 60404 60403 60402 60401 60400 60399 60398 60397 60396 60395 60394 60393 60392 60391 60390 60389 60388 60387 60386 60385 60384 60383 60382 60381 60380 60379 60378 60377 60376 60375 60374 60373 60372 60371 60370 60369 60368 60367 60366 60365 60364 60363 60362 60361 60360 60359 60358 60357 60356 60355 60354 60353 60352 60351 60350 60349 60348 60347 60346 60345 60344 60343 60342 60341 60340 60339 60338 60337 60336 60335 60334 60333 60332 60331 60330 60329 60328 60327 60326 60325 60324 60323 60322 60321 60320 60319 60318 60317 60316 60315 60314 60313 60312 60311 60310 60309 60308 60307 60306 60305 60304 60303 60302 60301 60300 60299 60298 60297 60296 60295 60294 60293 60292 60291 60290 60289 60288 60287 60286 60285 60284 60283 60282 60281 60280 60279 60278 60277 60276 60275 60274 60273 60272 60271 60270 60269 60268 60267 60266 60265 60264 60263 60262 60261 60260 60259 60258 60257 60256 60255 60254 60253 60252 60251 60250 60249 60248 60247 60246 60245 60244 60243 60242 60241 60240 60239 60238 60237 60236 60235 60234 60233 60232 60231 60230 60229 60228 60227 60226 60225 60224 60223 60222 60221 60220 60219 60218 60217 60216 60215 60214 60213 60212 60211 60210 60209 60208 60207 60206 60205 60204 60203 60202 60201 60200 60199 60198 60197 60196 60195 60194 60193 60192 60191 60190 60189 60188 60187 60186 60185 60184 60183 60182 60181 60180 60179 60178 60177 60176 60175 60174 60173 60172 60171 60170 60169 60168 60167 60166 60165 60164 60163 60162 60161 60160 60159 60158 60157 60156 60155 60154 60153 60152 60151 60150 60149 60148 60147 60146 60145 60144 60143 60142 60141 60140 60139 60138 60137 60136 60135 60134 60133 60132 60131 60130 60129 60128 60127 60126 60125 60124 60123 60122 60121 60120 60119 60118 60117 60116 60115 60114 60113 60112 60111 60110 60109 60108 60107 60106 60105 60104 60103 60102 60101 60100 60099 60098 60097 60096 60095 60094 60093 60092 60091 60090 60089 60088 60087 60086 60085 60084 60083 60082 60081 60080 60079 60078 60077 60076 60075 60074 60073 60072 60071 60070 60069 60068 60067 60066 60065 60064 60063 60062 60061 60060 60059 60058 60057 60056 60055 60054 60053 60052 60051 60050 60049 60048 60047 60046 60045 60044 60043 60042 60041 60040 60039 60038 60037 60036 60035 60034 60033 60032 60031 60030 60029 60028 60027 60026 60025 60024 60023 60022 60021 60020 60019 60018 60017 60016 60015 60014 60013 60012 60011 60010 60009 60008 60007 60006 60005 60004 60003 60002 60001 60000 59999 59998 59997 59996 59995 59994 59993 59992 59991 59990 59989 59988 59987 59986 59985 59984 59983 59982 59981 59980 59979 59978 59977 59976 59975 59974 59973 59972 59971 59970 59969 59968 59967 59966 59965 59964 59963 59962 59961 59960 59959 59958 59957 59956 59955 59954 59953 59952 59951 59950 59949 59948 59947 59946 59945 59944 59943 59942 59941 59940 59939 59938 59937 59936 59935 59934 59933 59932 59931 59930 59929 59928 59927 59926 59925 59924 59923 59922 59921 59920 59919 59918 59917 59916 59915 59914 59913 59912 59911 59910 59909 59908 59907 59906 59905 59904 59903 59902 59901 59900 59899 59898 59897 59896 59895 59894 59893 59892 59891 59890 59889 59888 59887 59886 59885 59884 59883 59882 59881 59880 59879 59878 59877 59876 59875 59874 59873 59872 59871 59870 59869 59868 59867 59866 59865 59864 59863 59862 59861 59860 59859 59858 59857 59856 59855 59854 59853 59852 59851 59850 59849 59848 59847 59846 59845 59844 59843 59842 59841 59840 59839 59838 59837 59836 59835 59834 59833 59832 59831 59830 59829 59828 59827 59826 59825 59824 59823 59822 59821 59820 59819 59818 59817 59816 59815 59814 59813 59812 59811 59810 59809 59808 59807 59806 59805 59804 59803 59802 59801 59800 59799 59798 59797 59796 59795 59794 59793 59792 59791 59790 59789 59788 59787 59786 59785 59784 59783 59782 59781 59780 59779 59778 59777 59776 59775 59774 59773 59772 59771 59770 59769 59768 59767 59766 59765 59764 59763 59762 59761 59760 59759 59758 59757 59756 59755 59754 59753 59752 59751 59750 59749 59748 59747 59746 59745 59744 59743 59742 59741 59740 59739 59738 59737 59736 59735 59734 59733 59732 59731 59730 59729 59728 59727 59726 59725 59724 59723 59722 59721 59720 59719 59718 59717 59716 59715 59714 59713 59712 59711 59710 59709 59708 59707 59706 59705 59704 59703 59702 59701 59700 59699 59698 59697 59696 59695 59694 59693 59692 59691 59690 59689 59688 59687 59686 59685 59684 59683 59682 59681 59680 59679 59678 59677 59676 59675 59674 59673 59672 59671 59670 59669 59668 59667 59666 59665 59664 59663 59662 59661 59660 59659 59658 59657 59656 59655 59654 59653 59652 59651 59650 59649 59648 59647 59646 59645 59644 59643 59642 59641 59640 59639 59638 59637 59636 59635 59634 59633 59632 59631 59630 59629 59628 59627 59626 59625 59624 59623 59622 59621 59620 59619 59618 59617 59616 59615 59614 59613 59612 59611 59610 59609 59608 59607 59606 59605 59604 59603 59602 59601 59600 59599 59598 59597 59596 59595 59594 59593 59592 59591 59590 59589 59588 59587 59586 59585 59584 59583 59582 59581 59580 59579 59578 59577 59576 59575 59574 59573 59572 59571 59570 59569 59568 59567 59566 59565 59564 59563 59562 59561 59560 59559 59558 59557 59556 59555 59554 59553 59552 59551 59550 59549 59548 59547 59546 59545 59544 59543 59542 59541 59540 59539 59538 59537 59536 59535 59534 59533 59532 59531 59530 59529 59528 59527 59526 59525 59524 59523 59522 59521 59520 59519 59518 59517 59516 59515 59514 59513 59512 59511 59510 59509 59508 59507 59506 59505 59504 59503 59502 59501 59500 59499 59498 59497 59496 59495 59494 59493 59492 59491 59490 59489 59488 59487 59486 59485 59484 59483 59482 59481 59480 59479 59478 59477 59476 59475 59474 59473 59472 59471 59470 59469 59468 59467 59466 59465 59464 59463 59462 59461 59460 59459 59458 59457 59456 59455 59454 59453 59452 59451 59450 59449 59448 59447 59446 59445 59444 59443 59442 59441 59440 59439 59438 59437 59436 59435 59434 59433 59432 59431 59430 59429 59428 59427 59426 59425 59424 59423 59422 59421 59420 59419 59418 59417 59416 59415 59414 59413 59412 59411 59410 59409 59408 59407 59406 59405 59404 59403 59402 59401 59400 59399 59398 59397 59396 59395 59394 59393 59392 59391 59390 59389 59388 59387 59386 59385 59384 59383 59382 59381 59380 59379 59378 59377 59376 59375 59374 59373 59372 59371 59370 59369 59368 59367 59366 59365 59364 59363 59362 59361 59360 59359 59358 59357 59356 59355 59354 59353 59352 59351 59350 59349 59348 59347 59346 59345 59344 59343 59342 59341 59340 59339 59338 59337 59336 59335 59334 59333 59332 59331 59330 59329 59328 59327 59326 59325 59324 59323 59322 59321 59320 59319 59318 59317 59316 59315 59314 59313 59312 59311 59310 59309 59308 59307 59306 59305 59304 59303 59302 59301 59300 59299 59298 59297 59296 59295 59294 59293 59292 59291 59290 59289 59288 59287 59286 59285 59284 59283 59282 59281 59280 59279 59278 59277 59276 59275 59274 59273 59272 59271 59270 59269 59268 59267 59266 59265 59264 59263 59262 59261 59260 59259 59258 59257 59256 59255 59254 59253 59252 59251 59250 59249 59248 59247 59246 59245 59244 59243 59242 59241 59240 59239 59238 59237 59236 59235 59234 59233 59232 59231 59230 59229 59228 59227 59226 59225 59224 59223 59222 59221 59220 59219 59218 59217 59216 59215 59214 59213 59212 59211 59210 59209 59208 59207 59206 59205 59204 59203 59202 59201 59200 59199 59198 59197 59196 59195 59194 59193 59192 59191 59190 59189 59188 59187 59186 59185 59184 59183 59182 59181 59180 59179 59178 59177 59176 59175 59174 59173 59172 59171 59170 59169 59168 59167 59166 59165 59164 59163 59162 59161 59160 59159 59158 59157 59156 59155 59154 59153 59152 59151 59150 59149 59148 59147 59146 59145 59144 59143 59142 59141 59140 59139 59138 59137 59136 59135 59134 59133 59132 59131 59130 59129 59128 59127 59126 59125 59124 59123 59122 59121 59120 59119 59118 59117 59116 59115 59114 59113 59112 59111 59110 59109 59108 59107 59106 59105 59104 59103 59102 59101 59100 59099 59098 59097 59096 59095 59094 59093 59092 59091 59090 59089 59088 59087 59086 59085 59084 59083 59082 59081 59080 59079 59078 59077 59076 59075 59074 59073 59072 59071 59070 59069 59068 59067 59066 59065 59064 59063 59062 59061 59060 59059 59058 59057 59056 59055 59054 59053 59052 59051 59050 59049 59048 59047 59046 59045 59044 59043 59042 59041 59040 59039 59038 59037 59036 59035 59034 59033 59032 59031 59030 59029 59028 59027 59026 59025 59024 59023 59022 59021 59020 59019 59018 59017 59016 59015 59014 59013 59012 59011 59010 59009 59008 59007 59006 59005 59004 59003 59002 59001 59000 58999 58998 58997 58996 58995 58994 58993 58992 58991 58990 58989 58988 58987 58986 58985 58984 58983 58982 58981 58980 58979 58978 58977 58976 58975 58974 58973 58972 58971 58970 58969 58968 58967 58966 58965 58964 58963 58962 58961 58960 58959 58958 58957 58956 58955 58954 58953 58952 58951 58950 58949 58948 58947 58946 58945 58944 58943 58942 58941 58940 58939 58938 58937 58936 58935 58934 58933 58932 58931 58930 58929 58928 58927 58926 58925 58924 58923 58922 58921 58920 58919 58918 58917 58916 58915 58914 58913 58912 58911 58910 58909 58908 58907 58906 58905 58904 58903 58902 58901 58900 58899 58898 58897 58896 58895 58894 58893 58892 58891 58890 58889 58888 58887 58886 58885 58884 58883 58882 58881 58880 58879 58878 58877 58876 58875 58874 58873 58872 58871 58870 58869 58868 58867 58866 58865 58864 58863 58862 58861 58860 58859 58858 58857 58856 58855 58854 58853 58852 58851 58850 58849 58848 58847 58846 58845 58844 58843 58842 58841 58840 58839 58838 58837 58836 58835 58834 58833 58832 58831 58830 58829 58828 58827 58826 58825 58824 58823 58822 58821 58820 58819 58818 58817 58816 58815 58814 58813 58812 58811 58810 58809 58808 58807 58806 58805 58804 58803 58802 58801 58800 58799 58798 58797 58796 58795 58794 58793 58792 58791 58790 58789 58788 58787 58786 58785 58784 58783 58782 58781 58780 58779 58778 58777 58776 58775 58774 58773 58772 58771 58770 58769 58768 58767 58766 58765 58764 58763 58762 58761 58760 58759 58758 58757 58756 58755 58754 58753 58752 58751 58750 58749 58748 58747 58746 58745 58744 58743 58742 58741 58740 58739 58738 58737 58736 58735 58734 58733 58732 58731 58730 58729 58728 58727 58726 58725 58724 58723 58722 58721 58720 58719 58718 58717 58716 58715 58714 58713 58712 58711 58710 58709 58708 58707 58706 58705 58704 58703 58702 58701 58700 58699 58698 58697 58696 58695 58694 58693 58692 58691 58690 58689 58688 58687 58686 58685 58684 58683 58682 58681 58680 58679 58678 58677 58676 58675 58674 58673 58672 58671 58670 58669 58668 58667 58666 58665 58664 58663 58662 58661 58660 58659 58658 58657 58656 58655 58654 58653 58652 58651 58650 58649 58648 58647 58646 58645 58644 58643 58642 58641 58640 58639 58638 58637 58636 58635 58634 58633 58632 58631 58630 58629 58628 58627 58626 58625 58624 58623 58622 58621 58620 58619 58618 58617 58616 58615 58614 58613 58612 58611 58610 58609 58608 58607 58606 58605 58604 58603 58602 58601 58600 58599 58598 58597 58596 58595 58594 58593 58592 58591 58590 58589 58588 58587 58586 58585 58584 58583 58582 58581 58580 58579 58578 58577 58576 58575 58574 58573 58572 58571 58570 58569 58568 58567 58566 58565 58564 58563 58562 58561 58560 58559 58558 58557 58556 58555 58554 58553 58552 58551 58550 58549 58548 58547 58546 58545 58544 58543 58542 58541 58540 58539 58538 58537 58536 58535 58534 58533 58532 58531 58530 58529 58528 58527 58526 58525 58524 58523 58522 58521 58520 58519 58518 58517 58516 58515 58514 58513 58512 58511 58510 58509 58508 58507 58506 58505 58504 58503 58502 58501 58500 58499 58498 58497 58496 58495 58494 58493 58492 58491 58490 58489 58488 58487 58486 58485 58484 58483 58482 58481 58480 58479 58478 58477 58476 58475 58474 58473 58472 58471 58470 58469 58468 58467 58466 58465 58464 58463 58462 58461 58460 58459 58458 58457 58456 58455 58454 58453 58452 58451 58450 58449 58448 58447 58446 58445 58444 58443 58442 58441 58440 58439 58438 58437 58436 58435 58434 58433 58432 58431 58430 58429 58428 58427 58426 58425 58424 58423 58422 58421 58420 58419 58418 58417 58416 58415 58414 58413 58412 58411 58410 58409 58408 58407 58406 58405 58404 58403 58402 58401 58400 58399 58398 58397 58396 58395 58394 58393 58392 58391 58390 58389 58388 58387 58386 58385 58384 58383 58382 58381 58380 58379 58378 58377 58376 58375 58374 58373 58372 58371 58370 58369 58368 58367 58366 58365 58364 58363 58362 58361 58360 58359 58358 58357 58356 58355 58354 58353 58352 58351 58350 58349 58348 58347 58346 58345 58344 58343 58342 58341 58340 58339 58338 58337 58336 58335 58334 58333 58332 58331 58330 58329 58328 58327 58326 58325 58324 58323 58322 58321 58320 58319 58318 58317 58316 58315 58314 58313 58312 58311 58310 58309 58308 58307 58306 58305 58304 58303 58302 58301 58300 58299 58298 58297 58296 58295 58294 58293 58292 58291 58290 58289 58288 58287 58286 58285 58284 58283 58282 58281 58280 58279 58278 58277 58276 58275 58274 58273 58272 58271 58270 58269 58268 58267 58266 58265 58264 58263 58262 58261 58260 58259 58258 58257 58256 58255 58254 58253 58252 58251 58250 58249 58248 58247 58246 58245 58244 58243 58242 58241 58240 58239 58238 58237 58236 58235 58234 58233 58232 58231 58230 58229 58228 58227 58226 58225 58224 58223 58222 58221 58220 58219 58218 58217 58216 58215 58214 58213 58212 58211 58210 58209 58208 58207 58206 58205 58204 58203 58202 58201 58200 58199 58198 58197 58196 58195 58194 58193 58192 58191 58190 58189 58188 58187 58186 58185 58184 58183 58182 58181 58180 58179 58178 58177 58176 58175 58174 58173 58172 58171 58170 58169 58168 58167 58166 58165 58164 58163 58162 58161 58160 58159 58158 58157 58156 58155 58154 58153 58152 58151 58150 58149 58148 58147 58146 58145 58144 58143 58142 58141 58140 58139 58138 58137 58136 58135 58134 58133 58132 58131 58130 58129 58128 58127 58126 58125 58124 58123 58122 58121 58120 58119 58118 58117 58116 58115 58114 58113 58112 58111 58110 58109 58108 58107 58106 58105 58104 58103 58102 58101 58100 58099 58098 58097 58096 58095 58094 58093 58092 58091 58090 58089 58088 58087 58086 58085 58084 58083 58082 58081 58080 58079 58078 58077 58076 58075 58074 58073 58072 58071 58070 58069 58068 58067 58066 58065 58064 58063 58062 58061 58060 58059 58058 58057 58056 58055 58054 58053 58052 58051 58050 58049 58048 58047 58046 58045 58044 58043 58042 58041 58040 58039 58038 58037 58036 58035 58034 58033 58032 58031 58030 58029 58028 58027 58026 58025 58024 58023 58022 58021 58020 58019 58018 58017 58016 58015 58014 58013 58012 58011 58010 58009 58008 58007 58006 58005 58004 58003 58002 58001 58000 57999 57998 57997 57996 57995 57994 57993 57992 57991 57990 57989 57988 57987 57986 57985 57984 57983 57982 57981 57980 57979 57978 57977 57976 57975 57974 57973 57972 57971 57970 57969 57968 57967 57966 57965 57964 57963 57962 57961 57960 57959 57958 57957 57956 57955 57954 57953 57952 57951 57950 57949 57948 57947 57946 57945 57944 57943 57942 57941 57940 57939 57938 57937 57936 57935 57934 57933 57932 57931 57930 57929 57928 57927 57926 57925 57924 57923 57922 57921 57920 57919 57918 57917 57916 57915 57914 57913 57912 57911 57910 57909 57908 57907 57906 57905 57904 57903 57902 57901 57900 57899 57898 57897 57896 57895 57894 57893 57892 57891 57890 57889 57888 57887 57886 57885 57884 57883 57882 57881 57880 57879 57878 57877 57876 57875 57874 57873 57872 57871 57870 57869 57868 57867 57866 57865 57864 57863 57862 57861 57860 57859 57858 57857 57856 57855 57854 57853 57852 57851 57850 57849 57848 57847 57846 57845 57844 57843 57842 57841 57840 57839 57838 57837 57836 57835 57834 57833 57832 57831 57830 57829 57828 57827 57826 57825 57824 57823 57822 57821 57820 57819 57818 57817 57816 57815 57814 57813 57812 57811 57810 57809 57808 57807 57806 57805 57804 57803 57802 57801 57800 57799 57798 57797 57796 57795 57794 57793 57792 57791 57790 57789 57788 57787 57786 57785 57784 57783 57782 57781 57780 57779 57778 57777 57776 57775 57774 57773 57772 57771 57770 57769 57768 57767 57766 57765 57764 57763 57762 57761 57760 57759 57758 57757 57756 57755 57754 57753 57752 57751 57750 57749 57748 57747 57746 57745 57744 57743 57742 57741 57740 57739 57738 57737 57736 57735 57734 57733 57732 57731 57730 57729 57728 57727 57726 57725 57724 57723 57722 57721 57720 57719 57718 57717 57716 57715 57714 57713 57712 57711 57710 57709 57708 57707 57706 57705 57704 57703 57702 57701 57700 57699 57698 57697 57696 57695 57694 57693 57692 57691 57690 57689 57688 57687 57686 57685 57684 57683 57682 57681 57680 57679 57678 57677 57676 57675 57674 57673 57672 57671 57670 57669 57668 57667 57666 57665 57664 57663 57662 57661 57660 57659 57658 57657 57656 57655 57654 57653 57652 57651 57650 57649 57648 57647 57646 57645 57644 57643 57642 57641 57640 57639 57638 57637 57636 57635 57634 57633 57632 57631 57630 57629 57628 57627 57626 57625 57624 57623 57622 57621 57620 57619 57618 57617 57616 57615 57614 57613 57612 57611 57610 57609 57608 57607 57606 57605 57604 57603 57602 57601 57600 57599 57598 57597 57596 57595 57594 57593 57592 57591 57590 57589 57588 57587 57586 57585 57584 57583 57582 57581 57580 57579 57578 57577 57576 57575 57574 57573 57572 57571 57570 57569 57568 57567 57566 57565 57564 57563 57562 57561 57560 57559 57558 57557 57556 57555 57554 57553 57552 57551 57550 57549 57548 57547 57546 57545 57544 57543 57542 57541 57540 57539 57538 57537 57536 57535 57534 57533 57532 57531 57530 57529 57528 57527 57526 57525 57524 57523 57522 57521 57520 57519 57518 57517 57516 57515 57514 57513 57512 57511 57510 57509 57508 57507 57506 57505 57504 57503 57502 57501 57500 57499 57498 57497 57496 57495 57494 57493 57492 57491 57490 57489 57488 57487 57486 57485 57484 57483 57482 57481 57480 57479 57478 57477 57476 57475 57474 57473 57472 57471 57470 57469 57468 57467 57466 57465 57464 57463 57462 57461 57460 57459 57458 57457 57456 57455 57454 57453 57452 57451 57450 57449 57448 57447 57446 57445 57444 57443 57442 57441 57440 57439 57438 57437 57436 57435 57434 57433 57432 57431 57430 57429 57428 57427 57426 57425 57424 57423 57422 57421 57420 57419 57418 57417 57416 57415 57414 57413 57412 57411 57410 57409 57408 57407 57406 57405 57404 57403 57402 57401 57400 57399 57398 57397 57396 57395 57394 57393 57392 57391 57390 57389 57388 57387 57386 57385 57384 57383 57382 57381 57380 57379 57378 57377 57376 57375 57374 57373 57372 57371 57370 57369 57368 57367 57366 57365 57364 57363 57362 57361 57360 57359 57358 57357 57356 57355 57354 57353 57352 57351 57350 57349 57348 57347 57346 57345 57344 57343 57342 57341 57340 57339 57338 57337 57336 57335 57334 57333 57332 57331 57330 57329 57328 57327 57326 57325 57324 57323 57322 57321 57320 57319 57318 57317 57316 57315 57314 57313 57312 57311 57310 57309 57308 57307 57306 57305 57304 57303 57302 57301 57300 57299 57298 57297 57296 57295 57294 57293 57292 57291 57290 57289 57288 57287 57286 57285 57284 57283 57282 57281 57280 57279 57278 57277 57276 57275 57274 57273 57272 57271 57270 57269 57268 57267 57266 57265 57264 57263 57262 57261 57260 57259 57258 57257 57256 57255 57254 57253 57252 57251 57250 57249 57248 57247 57246 57245 57244 57243 57242 57241 57240 57239 57238 57237 57236 57235 57234 57233 57232 57231 57230 57229 57228 57227 57226 57225 57224 57223 57222 57221 57220 57219 57218 57217 57216 57215 57214 57213 57212 57211 57210 57209 57208 57207 57206 57205 57204 57203 57202 57201 57200 57199 57198 57197 57196 57195 57194 57193 57192 57191 57190 57189 57188 57187 57186 57185 57184 57183 57182 57181 57180 57179 57178 57177 57176 57175 57174 57173 57172 57171 57170 57169 57168 57167 57166 57165 57164 57163 57162 57161 57160 57159 57158 57157 57156 57155 57154 57153 57152 57151 57150 57149 57148 57147 57146 57145 57144 57143 57142 57141 57140 57139 57138 57137 57136 57135 57134 57133 57132 57131 57130 57129 57128 57127 57126 57125 57124 57123 57122 57121 57120 57119 57118 57117 57116 57115 57114 57113 57112 57111 57110 57109 57108 57107 57106 57105 57104 57103 57102 57101 57100 57099 57098 57097 57096 57095 57094 57093 57092 57091 57090 57089 57088 57087 57086 57085 57084 57083 57082 57081 57080 57079 57078 57077 57076 57075 57074 57073 57072 57071 57070 57069 57068 57067 57066 57065 57064 57063 57062 57061 57060 57059 57058 57057 57056 57055 57054 57053 57052 57051 57050 57049 57048 57047 57046 57045 57044 57043 57042 57041 57040 57039 57038 57037 57036 57035 57034 57033 57032 57031 57030 57029 57028 57027 57026 57025 57024 57023 57022 57021 57020 57019 57018 57017 57016 57015 57014 57013 57012 57011 57010 57009 57008 57007 57006 57005 57004 57003 57002 57001 57000 56999 56998 56997 56996 56995 56994 56993 56992 56991 56990 56989 56988 56987 56986 56985 56984 56983 56982 56981 56980 56979 56978 56977 56976 56975 56974 56973 56972 56971 56970 56969 56968 56967 56966 56965 56964 56963 56962 56961 56960 56959 56958 56957 56956 56955 56954 56953 56952 56951 56950 56949 56948 56947 56946 56945 56944 56943 56942 56941 56940 56939 56938 56937 56936 56935 56934 56933 56932 56931 56930 56929 56928 56927 56926 56925 56924 56923 56922 56921 56920 56919 56918 56917 56916 56915 56914 56913 56912 56911 56910 56909 56908 56907 56906 56905 56904 56903 56902 56901 56900 56899 56898 56897 56896 56895 56894 56893 56892 56891 56890 56889 56888 56887 56886 56885 56884 56883 56882 56881 56880 56879 56878 56877 56876 56875 56874 56873 56872 56871 56870 56869 56868 56867 56866 56865 56864 56863 56862 56861 56860 56859 56858 56857 56856 56855 56854 56853 56852 56851 56850 56849 56848 56847 56846 56845 56844 56843 56842 56841 56840 56839 56838 56837 56836 56835 56834 56833 56832 56831 56830 56829 56828 56827 56826 56825 56824 56823 56822 56821 56820 56819 56818 56817 56816 56815 56814 56813 56812 56811 56810 56809 56808 56807 56806 56805 56804 56803 56802 56801 56800 56799 56798 56797 56796 56795 56794 56793 56792 56791 56790 56789 56788 56787 56786 56785 56784 56783 56782 56781 56780 56779 56778 56777 56776 56775 56774 56773 56772 56771 56770 56769 56768 56767 56766 56765 56764 56763 56762 56761 56760 56759 56758 56757 56756 56755 56754 56753 56752 56751 56750 56749 56748 56747 56746 56745 56744 56743 56742 56741 56740 56739 56738 56737 56736 56735 56734 56733 56732 56731 56730 56729 56728 56727 56726 56725 56724 56723 56722 56721 56720 56719 56718 56717 56716 56715 56714 56713 56712 56711 56710 56709 56708 56707 56706 56705 56704 56703 56702 56701 56700 56699 56698 56697 56696 56695 56694 56693 56692 56691 56690 56689 56688 56687 56686 56685 56684 56683 56682 56681 56680 56679 56678 56677 56676 56675 56674 56673 56672 56671 56670 56669 56668 56667 56666 56665 56664 56663 56662 56661 56660 56659 56658 56657 56656 56655 56654 56653 56652 56651 56650 56649 56648 56647 56646 56645 56644 56643 56642 56641 56640 56639 56638 56637 56636 56635 56634 56633 56632 56631 56630 56629 56628 56627 56626 56625 56624 56623 56622 56621 56620 56619 56618 56617 56616 56615 56614 56613 56612 56611 56610 56609 56608 56607 56606 56605 56604 56603 56602 56601 56600 56599 56598 56597 56596 56595 56594 56593 56592 56591 56590 56589 56588 56587 56586 56585 56584 56583 56582 56581 56580 56579 56578 56577 56576 56575 56574 56573 56572 56571 56570 56569 56568 56567 56566 56565 56564 56563 56562 56561 56560 56559 56558 56557 56556 56555 56554 56553 56552 56551 56550 56549 56548 56547 56546 56545 56544 56543 56542 56541 56540 56539 56538 56537 56536 56535 56534 56533 56532 56531 56530 56529 56528 56527 56526 56525 56524 56523 56522 56521 56520 56519 56518 56517 56516 56515 56514 56513 56512 56511 56510 56509 56508 56507 56506 56505 56504 56503 56502 56501 56500 56499 56498 56497 56496 56495 56494 56493 56492 56491 56490 56489 56488 56487 56486 56485 56484 56483 56482 56481 56480 56479 56478 56477 56476 56475 56474 56473 56472 56471 56470 56469 56468 56467 56466 56465 56464 56463 56462 56461 56460 56459 56458 56457 56456 56455 56454 56453 56452 56451 56450 56449 56448 56447 56446 56445 56444 56443 56442 56441 56440 56439 56438 56437 56436 56435 56434 56433 56432 56431 56430 56429 56428 56427 56426 56425 56424 56423 56422 56421 56420 56419 56418 56417 56416 56415 56414 56413 56412 56411 56410 56409 56408 56407 56406 56405 56404 56403 56402 56401 56400 56399 56398 56397 56396 56395 56394 56393 56392 56391 56390 56389 56388 56387 56386 56385 56384 56383 56382 56381 56380 56379 56378 56377 56376 56375 56374 56373 56372 56371 56370 56369 56368 56367 56366 56365 56364 56363 56362 56361 56360 56359 56358 56357 56356 56355 56354 56353 56352 56351 56350 56349 56348 56347 56346 56345 56344 56343 56342 56341 56340 56339 56338 56337 56336 56335 56334 56333 56332 56331 56330 56329 56328 56327 56326 56325 56324 56323 56322 56321 56320 56319 56318 56317 56316 56315 56314 56313 56312 56311 56310 56309 56308 56307 56306 56305 56304 56303 56302 56301 56300 56299 56298 56297 56296 56295 56294 56293 56292 56291 56290 56289 56288 56287 56286 56285 56284 56283 56282 56281 56280 56279 56278 56277 56276 56275 56274 56273 56272 56271 56270 56269 56268 56267 56266 56265 56264 56263 56262 56261 56260 56259 56258 56257 56256 56255 56254 56253 56252 56251 56250 56249 56248 56247 56246 56245 56244 56243 56242 56241 56240 56239 56238 56237 56236 56235 56234 56233 56232 56231 56230 56229 56228 56227 56226 56225 56224 56223 56222 56221 56220 56219 56218 56217 56216 56215 56214 56213 56212 56211 56210 56209 56208 56207 56206 56205 56204 56203 56202 56201 56200 56199 56198 56197 56196 56195 56194 56193 56192 56191 56190 56189 56188 56187 56186 56185 56184 56183 56182 56181 56180 56179 56178 56177 56176 56175 56174 56173 56172 56171 56170 56169 56168 56167 56166 56165 56164 56163 56162 56161 56160 56159 56158 56157 56156 56155 56154 56153 56152 56151 56150 56149 56148 56147 56146 56145 56144 56143 56142 56141 56140 56139 56138 56137 56136 56135 56134 56133 56132 56131 56130 56129 56128 56127 56126 56125 56124 56123 56122 56121 56120 56119 56118 56117 56116 56115 56114 56113 56112 56111 56110 56109 56108 56107 56106 56105 56104 56103 56102 56101 56100 56099 56098 56097 56096 56095 56094 56093 56092 56091 56090 56089 56088 56087 56086 56085 56084 56083 56082 56081 56080 56079 56078 56077 56076 56075 56074 56073 56072 56071 56070 56069 56068 56067 56066 56065 56064 56063 56062 56061 56060 56059 56058 56057 56056 56055 56054 56053 56052 56051 56050 56049 56048 56047 56046 56045 56044 56043 56042 56041 56040 56039 56038 56037 56036 56035 56034 56033 56032 56031 56030 56029 56028 56027 56026 56025 56024 56023 56022 56021 56020 56019 56018 56017 56016 56015 56014 56013 56012 56011 56010 56009 56008 56007 56006 56005 56004 56003 56002 56001 56000 55999 55998 55997 55996 55995 55994 55993 55992 55991 55990 55989 55988 55987 55986 55985 55984 55983 55982 55981 55980 55979 55978 55977 55976 55975 55974 55973 55972 55971 55970 55969 55968 55967 55966 55965 55964 55963 55962 55961 55960 55959 55958 55957 55956 55955 55954 55953 55952 55951 55950 55949 55948 55947 55946 55945 55944 55943 55942 55941 55940 55939 55938 55937 55936 55935 55934 55933 55932 55931 55930 55929 55928 55927 55926 55925 55924 55923 55922 55921 55920 55919 55918 55917 55916 55915 55914 55913 55912 55911 55910 55909 55908 55907 55906 55905 55904 55903 55902 55901 55900 55899 55898 55897 55896 55895 55894 55893 55892 55891 55890 55889 55888 55887 55886 55885 55884 55883 55882 55881 55880 55879 55878 55877 55876 55875 55874 55873 55872 55871 55870 55869 55868 55867 55866 55865 55864 55863 55862 55861 55860 55859 55858 55857 55856 55855 55854 55853 55852 55851 55850 55849 55848 55847 55846 55845 55844 55843 55842 55841 55840 55839 55838 55837 55836 55835 55834 55833 55832 55831 55830 55829 55828 55827 55826 55825 55824 55823 55822 55821 55820 55819 55818 55817 55816 55815 55814 55813 55812 55811 55810 55809 55808 55807 55806 55805 55804 55803 55802 55801 55800 55799 55798 55797 55796 55795 55794 55793 55792 55791 55790 55789 55788 55787 55786 55785 55784 55783 55782 55781 55780 55779 55778 55777 55776 55775 55774 55773 55772 55771 55770 55769 55768 55767 55766 55765 55764 55763 55762 55761 55760 55759 55758 55757 55756 55755 55754 55753 55752 55751 55750 55749 55748 55747 55746 55745 55744 55743 55742 55741 55740 55739 55738 55737 55736 55735 55734 55733 55732 55731 55730 55729 55728 55727 55726 55725 55724 55723 55722 55721 55720 55719 55718 55717 55716 55715 55714 55713 55712 55711 55710 55709 55708 55707 55706 55705 55704 55703 55702 55701 55700 55699 55698 55697 55696 55695 55694 55693 55692 55691 55690 55689 55688 55687 55686 55685 55684 55683 55682 55681 55680 55679 55678 55677 55676 55675 55674 55673 55672 55671 55670 55669 55668 55667 55666 55665 55664 55663 55662 55661 55660 55659 55658 55657 55656 55655 55654 55653 55652 55651 55650 55649 55648 55647 55646 55645 55644 55643 55642 55641 55640 55639 55638 55637 55636 55635 55634 55633 55632 55631 55630 55629 55628 55627 55626 55625 55624 55623 55622 55621 55620 55619 55618 55617 55616 55615 55614 55613 55612 55611 55610 55609 55608 55607 55606 55605 55604 55603 55602 55601 55600 55599 55598 55597 55596 55595 55594 55593 55592 55591 55590 55589 55588 55587 55586 55585 55584 55583 55582 55581 55580 55579 55578 55577 55576 55575 55574 55573 55572 55571 55570 55569 55568 55567 55566 55565 55564 55563 55562 55561 55560 55559 55558 55557 55556 55555 55554 55553 55552 55551 55550 55549 55548 55547 55546 55545 55544 55543 55542 55541 55540 55539 55538 55537 55536 55535 55534 55533 55532 55531 55530 55529 55528 55527 55526 55525 55524 55523 55522 55521 55520 55519 55518 55517 55516 55515 55514 55513 55512 55511 55510 55509 55508 55507 55506 55505 55504 55503 55502 55501 55500 55499 55498 55497 55496 55495 55494 55493 55492 55491 55490 55489 55488 55487 55486 55485 55484 55483 55482 55481 55480 55479 55478 55477 55476 55475 55474 55473 55472 55471 55470 55469 55468 55467 55466 55465 55464 55463 55462 55461 55460 55459 55458 55457 55456 55455 55454 55453 55452 55451 55450 55449 55448 55447 55446 55445 55444 55443 55442 55441 55440 55439 55438 55437 55436 55435 55434 55433 55432 55431 55430 55429 55428 55427 55426 55425 55424 55423 55422 55421 55420 55419 55418 55417 55416 55415 55414 55413 55412 55411 55410 55409 55408 55407 55406 55405 55404 55403 55402 55401 55400 55399 55398 55397 55396 55395 55394 55393 55392 55391 55390 55389 55388 55387 55386 55385 55384 55383 55382 55381 55380 55379 55378 55377 55376 55375 55374 55373 55372 55371 55370 55369 55368 55367 55366 55365 55364 55363 55362 55361 55360 55359 55358 55357 55356 55355 55354 55353 55352 55351 55350 55349 55348 55347 55346 55345 55344 55343 55342 55341 55340 55339 55338 55337 55336 55335 55334 55333 55332 55331 55330 55329 55328 55327 55326 55325 55324 55323 55322 55321 55320 55319 55318 55317 55316 55315 55314 55313 55312 55311 55310 55309 55308 55307 55306 55305 55304 55303 55302 55301 55300 55299 55298 55297 55296 55295 55294 55293 55292 55291 55290 55289 55288 55287 55286 55285 55284 55283 55282 55281 55280 55279 55278 55277 55276 55275 55274 55273 55272 55271 55270 55269 55268 55267 55266 55265 55264 55263 55262 55261 55260 55259 55258 55257 55256 55255 55254 55253 55252 55251 55250 55249 55248 55247 55246 55245 55244 55243 55242 55241 55240 55239 55238 55237 55236 55235 55234 55233 55232 55231 55230 55229 55228 55227 55226 55225 55224 55223 55222 55221 55220 55219 55218 55217 55216 55215 55214 55213 55212 55211 55210 55209 55208 55207 55206 55205 55204 55203 55202 55201 55200 55199 55198 55197 55196 55195 55194 55193 55192 55191 55190 55189 55188 55187 55186 55185 55184 55183 55182 55181 55180 55179 55178 55177 55176 55175 55174 55173 55172 55171 55170 55169 55168 55167 55166 55165 55164 55163 55162 55161 55160 55159 55158 55157 55156 55155 55154 55153 55152 55151 55150 55149 55148 55147 55146 55145 55144 55143 55142 55141 55140 55139 55138 55137 55136 55135 55134 55133 55132 55131 55130 55129 55128 55127 55126 55125 55124 55123 55122 55121 55120 55119 55118 55117 55116 55115 55114 55113 55112 55111 55110 55109 55108 55107 55106 55105 55104 55103 55102 55101 55100 55099 55098 55097 55096 55095 55094 55093 55092 55091 55090 55089 55088 55087 55086 55085 55084 55083 55082 55081 55080 55079 55078 55077 55076 55075 55074 55073 55072 55071 55070 55069 55068 55067 55066 55065 55064 55063 55062 55061 55060 55059 55058 55057 55056 55055 55054 55053 55052 55051 55050 55049 55048 55047 55046 55045 55044 55043 55042 55041 55040 55039 55038 55037 55036 55035 55034 55033 55032 55031 55030 55029 55028 55027 55026 55025 55024 55023 55022 55021 55020 55019 55018 55017 55016 55015 55014 55013 55012 55011 55010 55009 55008 55007 55006 55005 55004 55003 55002 55001 55000 54999 54998 54997 54996 54995 54994 54993 54992 54991 54990 54989 54988 54987 54986 54985 54984 54983 54982 54981 54980 54979 54978 54977 54976 54975 54974 54973 54972 54971 54970 54969 54968 54967 54966 54965 54964 54963 54962 54961 54960 54959 54958 54957 54956 54955 54954 54953 54952 54951 54950 54949 54948 54947 54946 54945 54944 54943 54942 54941 54940 54939 54938 54937 54936 54935 54934 54933 54932 54931 54930 54929 54928 54927 54926 54925 54924 54923 54922 54921 54920 54919 54918 54917 54916 54915 54914 54913 54912 54911 54910 54909 54908 54907 54906 54905 54904 54903 54902 54901 54900 54899 54898 54897 54896 54895 54894 54893 54892 54891 54890 54889 54888 54887 54886 54885 54884 54883 54882 54881 54880 54879 54878 54877 54876 54875 54874 54873 54872 54871 54870 54869 54868 54867 54866 54865 54864 54863 54862 54861 54860 54859 54858 54857 54856 54855 54854 54853 54852 54851 54850 54849 54848 54847 54846 54845 54844 54843 54842 54841 54840 54839 54838 54837 54836 54835 54834 54833 54832 54831 54830 54829 54828 54827 54826 54825 54824 54823 54822 54821 54820 54819 54818 54817 54816 54815 54814 54813 54812 54811 54810 54809 54808 54807 54806 54805 54804 54803 54802 54801 54800 54799 54798 54797 54796 54795 54794 54793 54792 54791 54790 54789 54788 54787 54786 54785 54784 54783 54782 54781 54780 54779 54778 54777 54776 54775 54774 54773 54772 54771 54770 54769 54768 54767 54766 54765 54764 54763 54762 54761 54760 54759 54758 54757 54756 54755 54754 54753 54752 54751 54750 54749 54748 54747 54746 54745 54744 54743 54742 54741 54740 54739 54738 54737 54736 54735 54734 54733 54732 54731 54730 54729 54728 54727 54726 54725 54724 54723 54722 54721 54720 54719 54718 54717 54716 54715 54714 54713 54712 54711 54710 54709 54708 54707 54706 54705 54704 54703 54702 54701 54700 54699 54698 54697 54696 54695 54694 54693 54692 54691 54690 54689 54688 54687 54686 54685 54684 54683 54682 54681 54680 54679 54678 54677 54676 54675 54674 54673 54672 54671 54670 54669 54668 54667 54666 54665 54664 54663 54662 54661 54660 54659 54658 54657 54656 54655 54654 54653 54652 54651 54650 54649 54648 54647 54646 54645 54644 54643 54642 54641 54640 54639 54638 54637 54636 54635 54634 54633 54632 54631 54630 54629 54628 54627 54626 54625 54624 54623 54622 54621 54620 54619 54618 54617 54616 54615 54614 54613 54612 54611 54610 54609 54608 54607 54606 54605 54604 54603 54602 54601 54600 54599 54598 54597 54596 54595 54594 54593 54592 54591 54590 54589 54588 54587 54586 54585 54584 54583 54582 54581 54580 54579 54578 54577 54576 54575 54574 54573 54572 54571 54570 54569 54568 54567 54566 54565 54564 54563 54562 54561 54560 54559 54558 54557 54556 54555 54554 54553 54552 54551 54550 54549 54548 54547 54546 54545 54544 54543 54542 54541 54540 54539 54538 54537 54536 54535 54534 54533 54532 54531 54530 54529 54528 54527 54526 54525 54524 54523 54522 54521 54520 54519 54518 54517 54516 54515 54514 54513 54512 54511 54510 54509 54508 54507 54506 54505 54504 54503 54502 54501 54500 54499 54498 54497 54496 54495 54494 54493 54492 54491 54490 54489 54488 54487 54486 54485 54484 54483 54482 54481 54480 54479 54478 54477 54476 54475 54474 54473 54472 54471 54470 54469 54468 54467 54466 54465 54464 54463 54462 54461 54460 54459 54458 54457 54456 54455 54454 54453 54452 54451 54450 54449 54448 54447 54446 54445 54444 54443 54442 54441 54440 54439 54438 54437 54436 54435 54434 54433 54432 54431 54430 54429 54428 54427 54426 54425 54424 54423 54422 54421 54420 54419 54418 54417 54416 54415 54414 54413 54412 54411 54410 54409 54408 54407 54406 54405 54404 54403 54402 54401 54400 54399 54398 54397 54396 54395 54394 54393 54392 54391 54390 54389 54388 54387 54386 54385 54384 54383 54382 54381 54380 54379 54378 54377 54376 54375 54374 54373 54372 54371 54370 54369 54368 54367 54366 54365 54364 54363 54362 54361 54360 54359 54358 54357 54356 54355 54354 54353 54352 54351 54350 54349 54348 54347 54346 54345 54344 54343 54342 54341 54340 54339 54338 54337 54336 54335 54334 54333 54332 54331 54330 54329 54328 54327 54326 54325 54324 54323 54322 54321 54320 54319 54318 54317 54316 54315 54314 54313 54312 54311 54310 54309 54308 54307 54306 54305 54304 54303 54302 54301 54300 54299 54298 54297 54296 54295 54294 54293 54292 54291 54290 54289 54288 54287 54286 54285 54284 54283 54282 54281 54280 54279 54278 54277 54276 54275 54274 54273 54272 54271 54270 54269 54268 54267 54266 54265 54264 54263 54262 54261 54260 54259 54258 54257 54256 54255 54254 54253 54252 54251 54250 54249 54248 54247 54246 54245 54244 54243 54242 54241 54240 54239 54238 54237 54236 54235 54234 54233 54232 54231 54230 54229 54228 54227 54226 54225 54224 54223 54222 54221 54220 54219 54218 54217 54216 54215 54214 54213 54212 54211 54210 54209 54208 54207 54206 54205 54204 54203 54202 54201 54200 54199 54198 54197 54196 54195 54194 54193 54192 54191 54190 54189 54188 54187 54186 54185 54184 54183 54182 54181 54180 54179 54178 54177 54176 54175 54174 54173 54172 54171 54170 54169 54168 54167 54166 54165 54164 54163 54162 54161 54160 54159 54158 54157 54156 54155 54154 54153 54152 54151 54150 54149 54148 54147 54146 54145 54144 54143 54142 54141 54140 54139 54138 54137 54136 54135 54134 54133 54132 54131 54130 54129 54128 54127 54126 54125 54124 54123 54122 54121 54120 54119 54118 54117 54116 54115 54114 54113 54112 54111 54110 54109 54108 54107 54106 54105 54104 54103 54102 54101 54100 54099 54098 54097 54096 54095 54094 54093 54092 54091 54090 54089 54088 54087 54086 54085 54084 54083 54082 54081 54080 54079 54078 54077 54076 54075 54074 54073 54072 54071 54070 54069 54068 54067 54066 54065 54064 54063 54062 54061 54060 54059 54058 54057 54056 54055 54054 54053 54052 54051 54050 54049 54048 54047 54046 54045 54044 54043 54042 54041 54040 54039 54038 54037 54036 54035 54034 54033 54032 54031 54030 54029 54028 54027 54026 54025 54024 54023 54022 54021 54020 54019 54018 54017 54016 54015 54014 54013 54012 54011 54010 54009 54008 54007 54006 54005 54004 54003 54002 54001 54000 53999 53998 53997 53996 53995 53994 53993 53992 53991 53990 53989 53988 53987 53986 53985 53984 53983 53982 53981 53980 53979 53978 53977 53976 53975 53974 53973 53972 53971 53970 53969 53968 53967 53966 53965 53964 53963 53962 53961 53960 53959 53958 53957 53956 53955 53954 53953 53952 53951 53950 53949 53948 53947 53946 53945 53944 53943 53942 53941 53940 53939 53938 53937 53936 53935 53934 53933 53932 53931 53930 53929 53928 53927 53926 53925 53924 53923 53922 53921 53920 53919 53918 53917 53916 53915 53914 53913 53912 53911 53910 53909 53908 53907 53906 53905 53904 53903 53902 53901 53900 53899 53898 53897 53896 53895 53894 53893 53892 53891 53890 53889 53888 53887 53886 53885 53884 53883 53882 53881 53880 53879 53878 53877 53876 53875 53874 53873 53872 53871 53870 53869 53868 53867 53866 53865 53864 53863 53862 53861 53860 53859 53858 53857 53856 53855 53854 53853 53852 53851 53850 53849 53848 53847 53846 53845 53844 53843 53842 53841 53840 53839 53838 53837 53836 53835 53834 53833 53832 53831 53830 53829 53828 53827 53826 53825 53824 53823 53822 53821 53820 53819 53818 53817 53816 53815 53814 53813 53812 53811 53810 53809 53808 53807 53806 53805 53804 53803 53802 53801 53800 53799 53798 53797 53796 53795 53794 53793 53792 53791 53790 53789 53788 53787 53786 53785 53784 53783 53782 53781 53780 53779 53778 53777 53776 53775 53774 53773 53772 53771 53770 53769 53768 53767 53766 53765 53764 53763 53762 53761 53760 53759 53758 53757 53756 53755 53754 53753 53752 53751 53750 53749 53748 53747 53746 53745 53744 53743 53742 53741 53740 53739 53738 53737 53736 53735 53734 53733 53732 53731 53730 53729 53728 53727 53726 53725 53724 53723 53722 53721 53720 53719 53718 53717 53716 53715 53714 53713 53712 53711 53710 53709 53708 53707 53706 53705 53704 53703 53702 53701 53700 53699 53698 53697 53696 53695 53694 53693 53692 53691 53690 53689 53688 53687 53686 53685 53684 53683 53682 53681 53680 53679 53678 53677 53676 53675 53674 53673 53672 53671 53670 53669 53668 53667 53666 53665 53664 53663 53662 53661 53660 53659 53658 53657 53656 53655 53654 53653 53652 53651 53650 53649 53648 53647 53646 53645 53644 53643 53642 53641 53640 53639 53638 53637 53636 53635 53634 53633 53632 53631 53630 53629 53628 53627 53626 53625 53624 53623 53622 53621 53620 53619 53618 53617 53616 53615 53614 53613 53612 53611 53610 53609 53608 53607 53606 53605 53604 53603 53602 53601 53600 53599 53598 53597 53596 53595 53594 53593 53592 53591 53590 53589 53588 53587 53586 53585 53584 53583 53582 53581 53580 53579 53578 53577 53576 53575 53574 53573 53572 53571 53570 53569 53568 53567 53566 53565 53564 53563 53562 53561 53560 53559 53558 53557 53556 53555 53554 53553 53552 53551 53550 53549 53548 53547 53546 53545 53544 53543 53542 53541 53540 53539 53538 53537 53536 53535 53534 53533 53532 53531 53530 53529 53528 53527 53526 53525 53524 53523 53522 53521 53520 53519 53518 53517 53516 53515 53514 53513 53512 53511 53510 53509 53508 53507 53506 53505 53504 53503 53502 53501 53500 53499 53498 53497 53496 53495 53494 53493 53492 53491 53490 53489 53488 53487 53486 53485 53484 53483 53482 53481 53480 53479 53478 53477 53476 53475 53474 53473 53472 53471 53470 53469 53468 53467 53466 53465 53464 53463 53462 53461 53460 53459 53458 53457 53456 53455 53454 53453 53452 53451 53450 53449 53448 53447 53446 53445 53444 53443 53442 53441 53440 53439 53438 53437 53436 53435 53434 53433 53432 53431 53430 53429 53428 53427 53426 53425 53424 53423 53422 53421 53420 53419 53418 53417 53416 53415 53414 53413 53412 53411 53410 53409 53408 53407 53406 53405 53404 53403 53402 53401 53400 53399 53398 53397 53396 53395 53394 53393 53392 53391 53390 53389 53388 53387 53386 53385 53384 53383 53382 53381 53380 53379 53378 53377 53376 53375 53374 53373 53372 53371 53370 53369 53368 53367 53366 53365 53364 53363 53362 53361 53360 53359 53358 53357 53356 53355 53354 53353 53352 53351 53350 53349 53348 53347 53346 53345 53344 53343 53342 53341 53340 53339 53338 53337 53336 53335 53334 53333 53332 53331 53330 53329 53328 53327 53326 53325 53324 53323 53322 53321 53320 53319 53318 53317 53316 53315 53314 53313 53312 53311 53310 53309 53308 53307 53306 53305 53304 53303 53302 53301 53300 53299 53298 53297 53296 53295 53294 53293 53292 53291 53290 53289 53288 53287 53286 53285 53284 53283 53282 53281 53280 53279 53278 53277 53276 53275 53274 53273 53272 53271 53270 53269 53268 53267 53266 53265 53264 53263 53262 53261 53260 53259 53258 53257 53256 53255 53254 53253 53252 53251 53250 53249 53248 53247 53246 53245 53244 53243 53242 53241 53240 53239 53238 53237 53236 53235 53234 53233 53232 53231 53230 53229 53228 53227 53226 53225 53224 53223 53222 53221 53220 53219 53218 53217 53216 53215 53214 53213 53212 53211 53210 53209 53208 53207 53206 53205 53204 53203 53202 53201 53200 53199 53198 53197 53196 53195 53194 53193 53192 53191 53190 53189 53188 53187 53186 53185 53184 53183 53182 53181 53180 53179 53178 53177 53176 53175 53174 53173 53172 53171 53170 53169 53168 53167 53166 53165 53164 53163 53162 53161 53160 53159 53158 53157 53156 53155 53154 53153 53152 53151 53150 53149 53148 53147 53146 53145 53144 53143 53142 53141 53140 53139 53138 53137 53136 53135 53134 53133 53132 53131 53130 53129 53128 53127 53126 53125 53124 53123 53122 53121 53120 53119 53118 53117 53116 53115 53114 53113 53112 53111 53110 53109 53108 53107 53106 53105 53104 53103 53102 53101 53100 53099 53098 53097 53096 53095 53094 53093 53092 53091 53090 53089 53088 53087 53086 53085 53084 53083 53082 53081 53080 53079 53078 53077 53076 53075 53074 53073 53072 53071 53070 53069 53068 53067 53066 53065 53064 53063 53062 53061 53060 53059 53058 53057 53056 53055 53054 53053 53052 53051 53050 53049 53048 53047 53046 53045 53044 53043 53042 53041 53040 53039 53038 53037 53036 53035 53034 53033 53032 53031 53030 53029 53028 53027 53026 53025 53024 53023 53022 53021 53020 53019 53018 53017 53016 53015 53014 53013 53012 53011 53010 53009 53008 53007 53006 53005 53004 53003 53002 53001 53000 52999 52998 52997 52996 52995 52994 52993 52992 52991 52990 52989 52988 52987 52986 52985 52984 52983 52982 52981 52980 52979 52978 52977 52976 52975 52974 52973 52972 52971 52970 52969 52968 52967 52966 52965 52964 52963 52962 52961 52960 52959 52958 52957 52956 52955 52954 52953 52952 52951 52950 52949 52948 52947 52946 52945 52944 52943 52942 52941 52940 52939 52938 52937 52936 52935 52934 52933 52932 52931 52930 52929 52928 52927 52926 52925 52924 52923 52922 52921 52920 52919 52918 52917 52916 52915 52914 52913 52912 52911 52910 52909 52908 52907 52906 52905 52904 52903 52902 52901 52900 52899 52898 52897 52896 52895 52894 52893 52892 52891 52890 52889 52888 52887 52886 52885 52884 52883 52882 52881 52880 52879 52878 52877 52876 52875 52874 52873 52872 52871 52870 52869 52868 52867 52866 52865 52864 52863 52862 52861 52860 52859 52858 52857 52856 52855 52854 52853 52852 52851 52850 52849 52848 52847 52846 52845 52844 52843 52842 52841 52840 52839 52838 52837 52836 52835 52834 52833 52832 52831 52830 52829 52828 52827 52826 52825 52824 52823 52822 52821 52820 52819 52818 52817 52816 52815 52814 52813 52812 52811 52810 52809 52808 52807 52806 52805 52804 52803 52802 52801 52800 52799 52798 52797 52796 52795 52794 52793 52792 52791 52790 52789 52788 52787 52786 52785 52784 52783 52782 52781 52780 52779 52778 52777 52776 52775 52774 52773 52772 52771 52770 52769 52768 52767 52766 52765 52764 52763 52762 52761 52760 52759 52758 52757 52756 52755 52754 52753 52752 52751 52750 52749 52748 52747 52746 52745 52744 52743 52742 52741 52740 52739 52738 52737 52736 52735 52734 52733 52732 52731 52730 52729 52728 52727 52726 52725 52724 52723 52722 52721 52720 52719 52718 52717 52716 52715 52714 52713 52712 52711 52710 52709 52708 52707 52706 52705 52704 52703 52702 52701 52700 52699 52698 52697 52696 52695 52694 52693 52692 52691 52690 52689 52688 52687 52686 52685 52684 52683 52682 52681 52680 52679 52678 52677 52676 52675 52674 52673 52672 52671 52670 52669 52668 52667 52666 52665 52664 52663 52662 52661 52660 52659 52658 52657 52656 52655 52654 52653 52652 52651 52650 52649 52648 52647 52646 52645 52644 52643 52642 52641 52640 52639 52638 52637 52636 52635 52634 52633 52632 52631 52630 52629 52628 52627 52626 52625 52624 52623 52622 52621 52620 52619 52618 52617 52616 52615 52614 52613 52612 52611 52610 52609 52608 52607 52606 52605 52604 52603 52602 52601 52600 52599 52598 52597 52596 52595 52594 52593 52592 52591 52590 52589 52588 52587 52586 52585 52584 52583 52582 52581 52580 52579 52578 52577 52576 52575 52574 52573 52572 52571 52570 52569 52568 52567 52566 52565 52564 52563 52562 52561 52560 52559 52558 52557 52556 52555 52554 52553 52552 52551 52550 52549 52548 52547 52546 52545 52544 52543 52542 52541 52540 52539 52538 52537 52536 52535 52534 52533 52532 52531 52530 52529 52528 52527 52526 52525 52524 52523 52522 52521 52520 52519 52518 52517 52516 52515 52514 52513 52512 52511 52510 52509 52508 52507 52506 52505 52504 52503 52502 52501 52500 52499 52498 52497 52496 52495 52494 52493 52492 52491 52490 52489 52488 52487 52486 52485 52484 52483 52482 52481 52480 52479 52478 52477 52476 52475 52474 52473 52472 52471 52470 52469 52468 52467 52466 52465 52464 52463 52462 52461 52460 52459 52458 52457 52456 52455 52454 52453 52452 52451 52450 52449 52448 52447 52446 52445 52444 52443 52442 52441 52440 52439 52438 52437 52436 52435 52434 52433 52432 52431 52430 52429 52428 52427 52426 52425 52424 52423 52422 52421 52420 52419 52418 52417 52416 52415 52414 52413 52412 52411 52410 52409 52408 52407 52406 52405 52404 52403 52402 52401 52400 52399 52398 52397 52396 52395 52394 52393 52392 52391 52390 52389 52388 52387 52386 52385 52384 52383 52382 52381 52380 52379 52378 52377 52376 52375 52374 52373 52372 52371 52370 52369 52368 52367 52366 52365 52364 52363 52362 52361 52360 52359 52358 52357 52356 52355 52354 52353 52352 52351 52350 52349 52348 52347 52346 52345 52344 52343 52342 52341 52340 52339 52338 52337 52336 52335 52334 52333 52332 52331 52330 52329 52328 52327 52326 52325 52324 52323 52322 52321 52320 52319 52318 52317 52316 52315 52314 52313 52312 52311 52310 52309 52308 52307 52306 52305 52304 52303 52302 52301 52300 52299 52298 52297 52296 52295 52294 52293 52292 52291 52290 52289 52288 52287 52286 52285 52284 52283 52282 52281 52280 52279 52278 52277 52276 52275 52274 52273 52272 52271 52270 52269 52268 52267 52266 52265 52264 52263 52262 52261 52260 52259 52258 52257 52256 52255 52254 52253 52252 52251 52250 52249 52248 52247 52246 52245 52244 52243 52242 52241 52240 52239 52238 52237 52236 52235 52234 52233 52232 52231 52230 52229 52228 52227 52226 52225 52224 52223 52222 52221 52220 52219 52218 52217 52216 52215 52214 52213 52212 52211 52210 52209 52208 52207 52206 52205 52204 52203 52202 52201 52200 52199 52198 52197 52196 52195 52194 52193 52192 52191 52190 52189 52188 52187 52186 52185 52184 52183 52182 52181 52180 52179 52178 52177 52176 52175 52174 52173 52172 52171 52170 52169 52168 52167 52166 52165 52164 52163 52162 52161 52160 52159 52158 52157 52156 52155 52154 52153 52152 52151 52150 52149 52148 52147 52146 52145 52144 52143 52142 52141 52140 52139 52138 52137 52136 52135 52134 52133 52132 52131 52130 52129 52128 52127 52126 52125 52124 52123 52122 52121 52120 52119 52118 52117 52116 52115 52114 52113 52112 52111 52110 52109 52108 52107 52106 52105 52104 52103 52102 52101 52100 52099 52098 52097 52096 52095 52094 52093 52092 52091 52090 52089 52088 52087 52086 52085 52084 52083 52082 52081 52080 52079 52078 52077 52076 52075 52074 52073 52072 52071 52070 52069 52068 52067 52066 52065 52064 52063 52062 52061 52060 52059 52058 52057 52056 52055 52054 52053 52052 52051 52050 52049 52048 52047 52046 52045 52044 52043 52042 52041 52040 52039 52038 52037 52036 52035 52034 52033 52032 52031 52030 52029 52028 52027 52026 52025 52024 52023 52022 52021 52020 52019 52018 52017 52016 52015 52014 52013 52012 52011 52010 52009 52008 52007 52006 52005 52004 52003 52002 52001 52000 51999 51998 51997 51996 51995 51994 51993 51992 51991 51990 51989 51988 51987 51986 51985 51984 51983 51982 51981 51980 51979 51978 51977 51976 51975 51974 51973 51972 51971 51970 51969 51968 51967 51966 51965 51964 51963 51962 51961 51960 51959 51958 51957 51956 51955 51954 51953 51952 51951 51950 51949 51948 51947 51946 51945 51944 51943 51942 51941 51940 51939 51938 51937 51936 51935 51934 51933 51932 51931 51930 51929 51928 51927 51926 51925 51924 51923 51922 51921 51920 51919 51918 51917 51916 51915 51914 51913 51912 51911 51910 51909 51908 51907 51906 51905 51904 51903 51902 51901 51900 51899 51898 51897 51896 51895 51894 51893 51892 51891 51890 51889 51888 51887 51886 51885 51884 51883 51882 51881 51880 51879 51878 51877 51876 51875 51874 51873 51872 51871 51870 51869 51868 51867 51866 51865 51864 51863 51862 51861 51860 51859 51858 51857 51856 51855 51854 51853 51852 51851 51850 51849 51848 51847 51846 51845 51844 51843 51842 51841 51840 51839 51838 51837 51836 51835 51834 51833 51832 51831 51830 51829 51828 51827 51826 51825 51824 51823 51822 51821 51820 51819 51818 51817 51816 51815 51814 51813 51812 51811 51810 51809 51808 51807 51806 51805 51804 51803 51802 51801 51800 51799 51798 51797 51796 51795 51794 51793 51792 51791 51790 51789 51788 51787 51786 51785 51784 51783 51782 51781 51780 51779 51778 51777 51776 51775 51774 51773 51772 51771 51770 51769 51768 51767 51766 51765 51764 51763 51762 51761 51760 51759 51758 51757 51756 51755 51754 51753 51752 51751 51750 51749 51748 51747 51746 51745 51744 51743 51742 51741 51740 51739 51738 51737 51736 51735 51734 51733 51732 51731 51730 51729 51728 51727 51726 51725 51724 51723 51722 51721 51720 51719 51718 51717 51716 51715 51714 51713 51712 51711 51710 51709 51708 51707 51706 51705 51704 51703 51702 51701 51700 51699 51698 51697 51696 51695 51694 51693 51692 51691 51690 51689 51688 51687 51686 51685 51684 51683 51682 51681 51680 51679 51678 51677 51676 51675 51674 51673 51672 51671 51670 51669 51668 51667 51666 51665 51664 51663 51662 51661 51660 51659 51658 51657 51656 51655 51654 51653 51652 51651 51650 51649 51648 51647 51646 51645 51644 51643 51642 51641 51640 51639 51638 51637 51636 51635 51634 51633 51632 51631 51630 51629 51628 51627 51626 51625 51624 51623 51622 51621 51620 51619 51618 51617 51616 51615 51614 51613 51612 51611 51610 51609 51608 51607 51606 51605 51604 51603 51602 51601 51600 51599 51598 51597 51596 51595 51594 51593 51592 51591 51590 51589 51588 51587 51586 51585 51584 51583 51582 51581 51580 51579 51578 51577 51576 51575 51574 51573 51572 51571 51570 51569 51568 51567 51566 51565 51564 51563 51562 51561 51560 51559 51558 51557 51556 51555 51554 51553 51552 51551 51550 51549 51548 51547 51546 51545 51544 51543 51542 51541 51540 51539 51538 51537 51536 51535 51534 51533 51532 51531 51530 51529 51528 51527 51526 51525 51524 51523 51522 51521 51520 51519 51518 51517 51516 51515 51514 51513 51512 51511 51510 51509 51508 51507 51506 51505 51504 51503 51502 51501 51500 51499 51498 51497 51496 51495 51494 51493 51492 51491 51490 51489 51488 51487 51486 51485 51484 51483 51482 51481 51480 51479 51478 51477 51476 51475 51474 51473 51472 51471 51470 51469 51468 51467 51466 51465 51464 51463 51462 51461 51460 51459 51458 51457 51456 51455 51454 51453 51452 51451 51450 51449 51448 51447 51446 51445 51444 51443 51442 51441 51440 51439 51438 51437 51436 51435 51434 51433 51432 51431 51430 51429 51428 51427 51426 51425 51424 51423 51422 51421 51420 51419 51418 51417 51416 51415 51414 51413 51412 51411 51410 51409 51408 51407 51406 51405 51404 51403 51402 51401 51400 51399 51398 51397 51396 51395 51394 51393 51392 51391 51390 51389 51388 51387 51386 51385 51384 51383 51382 51381 51380 51379 51378 51377 51376 51375 51374 51373 51372 51371 51370 51369 51368 51367 51366 51365 51364 51363 51362 51361 51360 51359 51358 51357 51356 51355 51354 51353 51352 51351 51350 51349 51348 51347 51346 51345 51344 51343 51342 51341 51340 51339 51338 51337 51336 51335 51334 51333 51332 51331 51330 51329 51328 51327 51326 51325 51324 51323 51322 51321 51320 51319 51318 51317 51316 51315 51314 51313 51312 51311 51310 51309 51308 51307 51306 51305 51304 51303 51302 51301 51300 51299 51298 51297 51296 51295 51294 51293 51292 51291 51290 51289 51288 51287 51286 51285 51284 51283 51282 51281 51280 51279 51278 51277 51276 51275 51274 51273 51272 51271 51270 51269 51268 51267 51266 51265 51264 51263 51262 51261 51260 51259 51258 51257 51256 51255 51254 51253 51252 51251 51250 51249 51248 51247 51246 51245 51244 51243 51242 51241 51240 51239 51238 51237 51236 51235 51234 51233 51232 51231 51230 51229 51228 51227 51226 51225 51224 51223 51222 51221 51220 51219 51218 51217 51216 51215 51214 51213 51212 51211 51210 51209 51208 51207 51206 51205 51204 51203 51202 51201 51200 51199 51198 51197 51196 51195 51194 51193 51192 51191 51190 51189 51188 51187 51186 51185 51184 51183 51182 51181 51180 51179 51178 51177 51176 51175 51174 51173 51172 51171 51170 51169 51168 51167 51166 51165 51164 51163 51162 51161 51160 51159 51158 51157 51156 51155 51154 51153 51152 51151 51150 51149 51148 51147 51146 51145 51144 51143 51142 51141 51140 51139 51138 51137 51136 51135 51134 51133 51132 51131 51130 51129 51128 51127 51126 51125 51124 51123 51122 51121 51120 51119 51118 51117 51116 51115 51114 51113 51112 51111 51110 51109 51108 51107 51106 51105 51104 51103 51102 51101 51100 51099 51098 51097 51096 51095 51094 51093 51092 51091 51090 51089 51088 51087 51086 51085 51084 51083 51082 51081 51080 51079 51078 51077 51076 51075 51074 51073 51072 51071 51070 51069 51068 51067 51066 51065 51064 51063 51062 51061 51060 51059 51058 51057 51056 51055 51054 51053 51052 51051 51050 51049 51048 51047 51046 51045 51044 51043 51042 51041 51040 51039 51038 51037 51036 51035 51034 51033 51032 51031 51030 51029 51028 51027 51026 51025 51024 51023 51022 51021 51020 51019 51018 51017 51016 51015 51014 51013 51012 51011 51010 51009 51008 51007 51006 51005 51004 51003 51002 51001 51000 50999 50998 50997 50996 50995 50994 50993 50992 50991 50990 50989 50988 50987 50986 50985 50984 50983 50982 50981 50980 50979 50978 50977 50976 50975 50974 50973 50972 50971 50970 50969 50968 50967 50966 50965 50964 50963 50962 50961 50960 50959 50958 50957 50956 50955 50954 50953 50952 50951 50950 50949 50948 50947 50946 50945 50944 50943 50942 50941 50940 50939 50938 50937 50936 50935 50934 50933 50932 50931 50930 50929 50928 50927 50926 50925 50924 50923 50922 50921 50920 50919 50918 50917 50916 50915 50914 50913 50912 50911 50910 50909 50908 50907 50906 50905 50904 50903 50902 50901 50900 50899 50898 50897 50896 50895 50894 50893 50892 50891 50890 50889 50888 50887 50886 50885 50884 50883 50882 50881 50880 50879 50878 50877 50876 50875 50874 50873 50872 50871 50870 50869 50868 50867 50866 50865 50864 50863 50862 50861 50860 50859 50858 50857 50856 50855 50854 50853 50852 50851 50850 50849 50848 50847 50846 50845 50844 50843 50842 50841 50840 50839 50838 50837 50836 50835 50834 50833 50832 50831 50830 50829 50828 50827 50826 50825 50824 50823 50822 50821 50820 50819 50818 50817 50816 50815 50814 50813 50812 50811 50810 50809 50808 50807 50806 50805 50804 50803 50802 50801 50800 50799 50798 50797 50796 50795 50794 50793 50792 50791 50790 50789 50788 50787 50786 50785 50784 50783 50782 50781 50780 50779 50778 50777 50776 50775 50774 50773 50772 50771 50770 50769 50768 50767 50766 50765 50764 50763 50762 50761 50760 50759 50758 50757 50756 50755 50754 50753 50752 50751 50750 50749 50748 50747 50746 50745 50744 50743 50742 50741 50740 50739 50738 50737 50736 50735 50734 50733 50732 50731 50730 50729 50728 50727 50726 50725 50724 50723 50722 50721 50720 50719 50718 50717 50716 50715 50714 50713 50712 50711 50710 50709 50708 50707 50706 50705 50704 50703 50702 50701 50700 50699 50698 50697 50696 50695 50694 50693 50692 50691 50690 50689 50688 50687 50686 50685 50684 50683 50682 50681 50680 50679 50678 50677 50676 50675 50674 50673 50672 50671 50670 50669 50668 50667 50666 50665 50664 50663 50662 50661 50660 50659 50658 50657 50656 50655 50654 50653 50652 50651 50650 50649 50648 50647 50646 50645 50644 50643 50642 50641 50640 50639 50638 50637 50636 50635 50634 50633 50632 50631 50630 50629 50628 50627 50626 50625 50624 50623 50622 50621 50620 50619 50618 50617 50616 50615 50614 50613 50612 50611 50610 50609 50608 50607 50606 50605 50604 50603 50602 50601 50600 50599 50598 50597 50596 50595 50594 50593 50592 50591 50590 50589 50588 50587 50586 50585 50584 50583 50582 50581 50580 50579 50578 50577 50576 50575 50574 50573 50572 50571 50570 50569 50568 50567 50566 50565 50564 50563 50562 50561 50560 50559 50558 50557 50556 50555 50554 50553 50552 50551 50550 50549 50548 50547 50546 50545 50544 50543 50542 50541 50540 50539 50538 50537 50536 50535 50534 50533 50532 50531 50530 50529 50528 50527 50526 50525 50524 50523 50522 50521 50520 50519 50518 50517 50516 50515 50514 50513 50512 50511 50510 50509 50508 50507 50506 50505 50504 50503 50502 50501 50500 50499 50498 50497 50496 50495 50494 50493 50492 50491 50490 50489 50488 50487 50486 50485 50484 50483 50482 50481 50480 50479 50478 50477 50476 50475 50474 50473 50472 50471 50470 50469 50468 50467 50466 50465 50464 50463 50462 50461 50460 50459 50458 50457 50456 50455 50454 50453 50452 50451 50450 50449 50448 50447 50446 50445 50444 50443 50442 50441 50440 50439 50438 50437 50436 50435 50434 50433 50432 50431 50430 50429 50428 50427 50426 50425 50424 50423 50422 50421 50420 50419 50418 50417 50416 50415 50414 50413 50412 50411 50410 50409 50408 50407 50406 50405 50404 50403 50402 50401 50400 50399 50398 50397 50396 50395 50394 50393 50392 50391 50390 50389 50388 50387 50386 50385 50384 50383 50382 50381 50380 50379 50378 50377 50376 50375 50374 50373 50372 50371 50370 50369 50368 50367 50366 50365 50364 50363 50362 50361 50360 50359 50358 50357 50356 50355 50354 50353 50352 50351 50350 50349 50348 50347 50346 50345 50344 50343 50342 50341 50340 50339 50338 50337 50336 50335 50334 50333 50332 50331 50330 50329 50328 50327 50326 50325 50324 50323 50322 50321 50320 50319 50318 50317 50316 50315 50314 50313 50312 50311 50310 50309 50308 50307 50306 50305 50304 50303 50302 50301 50300 50299 50298 50297 50296 50295 50294 50293 50292 50291 50290 50289 50288 50287 50286 50285 50284 50283 50282 50281 50280 50279 50278 50277 50276 50275 50274 50273 50272 50271 50270 50269 50268 50267 50266 50265 50264 50263 50262 50261 50260 50259 50258 50257 50256 50255 50254 50253 50252 50251 50250 50249 50248 50247 50246 50245 50244 50243 50242 50241 50240 50239 50238 50237 50236 50235 50234 50233 50232 50231 50230 50229 50228 50227 50226 50225 50224 50223 50222 50221 50220 50219 50218 50217 50216 50215 50214 50213 50212 50211 50210 50209 50208 50207 50206 50205 50204 50203 50202 50201 50200 50199 50198 50197 50196 50195 50194 50193 50192 50191 50190 50189 50188 50187 50186 50185 50184 50183 50182 50181 50180 50179 50178 50177 50176 50175 50174 50173 50172 50171 50170 50169 50168 50167 50166 50165 50164 50163 50162 50161 50160 50159 50158 50157 50156 50155 50154 50153 50152 50151 50150 50149 50148 50147 50146 50145 50144 50143 50142 50141 50140 50139 50138 50137 50136 50135 50134 50133 50132 50131 50130 50129 50128 50127 50126 50125 50124 50123 50122 50121 50120 50119 50118 50117 50116 50115 50114 50113 50112 50111 50110 50109 50108 50107 50106 50105 50104 50103 50102 50101 50100 50099 50098 50097 50096 50095 50094 50093 50092 50091 50090 50089 50088 50087 50086 50085 50084 50083 50082 50081 50080 50079 50078 50077 50076 50075 50074 50073 50072 50071 50070 50069 50068 50067 50066 50065 50064 50063 50062 50061 50060 50059 50058 50057 50056 50055 50054 50053 50052 50051 50050 50049 50048 50047 50046 50045 50044 50043 50042 50041 50040 50039 50038 50037 50036 50035 50034 50033 50032 50031 50030 50029 50028 50027 50026 50025 50024 50023 50022 50021 50020 50019 50018 50017 50016 50015 50014 50013 50012 50011 50010 50009 50008 50007 50006 50005 50004 50003 50002 50001 50000 49999 49998 49997 49996 49995 49994 49993 49992 49991 49990 49989 49988 49987 49986 49985 49984 49983 49982 49981 49980 49979 49978 49977 49976 49975 49974 49973 49972 49971 49970 49969 49968 49967 49966 49965 49964 49963 49962 49961 49960 49959 49958 49957 49956 49955 49954 49953 49952 49951 49950 49949 49948 49947 49946 49945 49944 49943 49942 49941 49940 49939 49938 49937 49936 49935 49934 49933 49932 49931 49930 49929 49928 49927 49926 49925 49924 49923 49922 49921 49920 49919 49918 49917 49916 49915 49914 49913 49912 49911 49910 49909 49908 49907 49906 49905 49904 49903 49902 49901 49900 49899 49898 49897 49896 49895 49894 49893 49892 49891 49890 49889 49888 49887 49886 49885 49884 49883 49882 49881 49880 49879 49878 49877 49876 49875 49874 49873 49872 49871 49870 49869 49868 49867 49866 49865 49864 49863 49862 49861 49860 49859 49858 49857 49856 49855 49854 49853 49852 49851 49850 49849 49848 49847 49846 49845 49844 49843 49842 49841 49840 49839 49838 49837 49836 49835 49834 49833 49832 49831 49830 49829 49828 49827 49826 49825 49824 49823 49822 49821 49820 49819 49818 49817 49816 49815 49814 49813 49812 49811 49810 49809 49808 49807 49806 49805 49804 49803 49802 49801 49800 49799 49798 49797 49796 49795 49794 49793 49792 49791 49790 49789 49788 49787 49786 49785 49784 49783 49782 49781 49780 49779 49778 49777 49776 49775 49774 49773 49772 49771 49770 49769 49768 49767 49766 49765 49764 49763 49762 49761 49760 49759 49758 49757 49756 49755 49754 49753 49752 49751 49750 49749 49748 49747 49746 49745 49744 49743 49742 49741 49740 49739 49738 49737 49736 49735 49734 49733 49732 49731 49730 49729 49728 49727 49726 49725 49724 49723 49722 49721 49720 49719 49718 49717 49716 49715 49714 49713 49712 49711 49710 49709 49708 49707 49706 49705 49704 49703 49702 49701 49700 49699 49698 49697 49696 49695 49694 49693 49692 49691 49690 49689 49688 49687 49686 49685 49684 49683 49682 49681 49680 49679 49678 49677 49676 49675 49674 49673 49672 49671 49670 49669 49668 49667 49666 49665 49664 49663 49662 49661 49660 49659 49658 49657 49656 49655 49654 49653 49652 49651 49650 49649 49648 49647 49646 49645 49644 49643 49642 49641 49640 49639 49638 49637 49636 49635 49634 49633 49632 49631 49630 49629 49628 49627 49626 49625 49624 49623 49622 49621 49620 49619 49618 49617 49616 49615 49614 49613 49612 49611 49610 49609 49608 49607 49606 49605 49604 49603 49602 49601 49600 49599 49598 49597 49596 49595 49594 49593 49592 49591 49590 49589 49588 49587 49586 49585 49584 49583 49582 49581 49580 49579 49578 49577 49576 49575 49574 49573 49572 49571 49570 49569 49568 49567 49566 49565 49564 49563 49562 49561 49560 49559 49558 49557 49556 49555 49554 49553 49552 49551 49550 49549 49548 49547 49546 49545 49544 49543 49542 49541 49540 49539 49538 49537 49536 49535 49534 49533 49532 49531 49530 49529 49528 49527 49526 49525 49524 49523 49522 49521 49520 49519 49518 49517 49516 49515 49514 49513 49512 49511 49510 49509 49508 49507 49506 49505 49504 49503 49502 49501 49500 49499 49498 49497 49496 49495 49494 49493 49492 49491 49490 49489 49488 49487 49486 49485 49484 49483 49482 49481 49480 49479 49478 49477 49476 49475 49474 49473 49472 49471 49470 49469 49468 49467 49466 49465 49464 49463 49462 49461 49460 49459 49458 49457 49456 49455 49454 49453 49452 49451 49450 49449 49448 49447 49446 49445 49444 49443 49442 49441 49440 49439 49438 49437 49436 49435 49434 49433 49432 49431 49430 49429 49428 49427 49426 49425 49424 49423 49422 49421 49420 49419 49418 49417 49416 49415 49414 49413 49412 49411 49410 49409 49408 49407 49406 49405 49404 49403 49402 49401 49400 49399 49398 49397 49396 49395 49394 49393 49392 49391 49390 49389 49388 49387 49386 49385 49384 49383 49382 49381 49380 49379 49378 49377 49376 49375 49374 49373 49372 49371 49370 49369 49368 49367 49366 49365 49364 49363 49362 49361 49360 49359 49358 49357 49356 49355 49354 49353 49352 49351 49350 49349 49348 49347 49346 49345 49344 49343 49342 49341 49340 49339 49338 49337 49336 49335 49334 49333 49332 49331 49330 49329 49328 49327 49326 49325 49324 49323 49322 49321 49320 49319 49318 49317 49316 49315 49314 49313 49312 49311 49310 49309 49308 49307 49306 49305 49304 49303 49302 49301 49300 49299 49298 49297 49296 49295 49294 49293 49292 49291 49290 49289 49288 49287 49286 49285 49284 49283 49282 49281 49280 49279 49278 49277 49276 49275 49274 49273 49272 49271 49270 49269 49268 49267 49266 49265 49264 49263 49262 49261 49260 49259 49258 49257 49256 49255 49254 49253 49252 49251 49250 49249 49248 49247 49246 49245 49244 49243 49242 49241 49240 49239 49238 49237 49236 49235 49234 49233 49232 49231 49230 49229 49228 49227 49226 49225 49224 49223 49222 49221 49220 49219 49218 49217 49216 49215 49214 49213 49212 49211 49210 49209 49208 49207 49206 49205 49204 49203 49202 49201 49200 49199 49198 49197 49196 49195 49194 49193 49192 49191 49190 49189 49188 49187 49186 49185 49184 49183 49182 49181 49180 49179 49178 49177 49176 49175 49174 49173 49172 49171 49170 49169 49168 49167 49166 49165 49164 49163 49162 49161 49160 49159 49158 49157 49156 49155 49154 49153 49152 49151 49150 49149 49148 49147 49146 49145 49144 49143 49142 49141 49140 49139 49138 49137 49136 49135 49134 49133 49132 49131 49130 49129 49128 49127 49126 49125 49124 49123 49122 49121 49120 49119 49118 49117 49116 49115 49114 49113 49112 49111 49110 49109 49108 49107 49106 49105 49104 49103 49102 49101 49100 49099 49098 49097 49096 49095 49094 49093 49092 49091 49090 49089 49088 49087 49086 49085 49084 49083 49082 49081 49080 49079 49078 49077 49076 49075 49074 49073 49072 49071 49070 49069 49068 49067 49066 49065 49064 49063 49062 49061 49060 49059 49058 49057 49056 49055 49054 49053 49052 49051 49050 49049 49048 49047 49046 49045 49044 49043 49042 49041 49040 49039 49038 49037 49036 49035 49034 49033 49032 49031 49030 49029 49028 49027 49026 49025 49024 49023 49022 49021 49020 49019 49018 49017 49016 49015 49014 49013 49012 49011 49010 49009 49008 49007 49006 49005 49004 49003 49002 49001 49000 48999 48998 48997 48996 48995 48994 48993 48992 48991 48990 48989 48988 48987 48986 48985 48984 48983 48982 48981 48980 48979 48978 48977 48976 48975 48974 48973 48972 48971 48970 48969 48968 48967 48966 48965 48964 48963 48962 48961 48960 48959 48958 48957 48956 48955 48954 48953 48952 48951 48950 48949 48948 48947 48946 48945 48944 48943 48942 48941 48940 48939 48938 48937 48936 48935 48934 48933 48932 48931 48930 48929 48928 48927 48926 48925 48924 48923 48922 48921 48920 48919 48918 48917 48916 48915 48914 48913 48912 48911 48910 48909 48908 48907 48906 48905 48904 48903 48902 48901 48900 48899 48898 48897 48896 48895 48894 48893 48892 48891 48890 48889 48888 48887 48886 48885 48884 48883 48882 48881 48880 48879 48878 48877 48876 48875 48874 48873 48872 48871 48870 48869 48868 48867 48866 48865 48864 48863 48862 48861 48860 48859 48858 48857 48856 48855 48854 48853 48852 48851 48850 48849 48848 48847 48846 48845 48844 48843 48842 48841 48840 48839 48838 48837 48836 48835 48834 48833 48832 48831 48830 48829 48828 48827 48826 48825 48824 48823 48822 48821 48820 48819 48818 48817 48816 48815 48814 48813 48812 48811 48810 48809 48808 48807 48806 48805 48804 48803 48802 48801 48800 48799 48798 48797 48796 48795 48794 48793 48792 48791 48790 48789 48788 48787 48786 48785 48784 48783 48782 48781 48780 48779 48778 48777 48776 48775 48774 48773 48772 48771 48770 48769 48768 48767 48766 48765 48764 48763 48762 48761 48760 48759 48758 48757 48756 48755 48754 48753 48752 48751 48750 48749 48748 48747 48746 48745 48744 48743 48742 48741 48740 48739 48738 48737 48736 48735 48734 48733 48732 48731 48730 48729 48728 48727 48726 48725 48724 48723 48722 48721 48720 48719 48718 48717 48716 48715 48714 48713 48712 48711 48710 48709 48708 48707 48706 48705 48704 48703 48702 48701 48700 48699 48698 48697 48696 48695 48694 48693 48692 48691 48690 48689 48688 48687 48686 48685 48684 48683 48682 48681 48680 48679 48678 48677 48676 48675 48674 48673 48672 48671 48670 48669 48668 48667 48666 48665 48664 48663 48662 48661 48660 48659 48658 48657 48656 48655 48654 48653 48652 48651 48650 48649 48648 48647 48646 48645 48644 48643 48642 48641 48640 48639 48638 48637 48636 48635 48634 48633 48632 48631 48630 48629 48628 48627 48626 48625 48624 48623 48622 48621 48620 48619 48618 48617 48616 48615 48614 48613 48612 48611 48610 48609 48608 48607 48606 48605 48604 48603 48602 48601 48600 48599 48598 48597 48596 48595 48594 48593 48592 48591 48590 48589 48588 48587 48586 48585 48584 48583 48582 48581 48580 48579 48578 48577 48576 48575 48574 48573 48572 48571 48570 48569 48568 48567 48566 48565 48564 48563 48562 48561 48560 48559 48558 48557 48556 48555 48554 48553 48552 48551 48550 48549 48548 48547 48546 48545 48544 48543 48542 48541 48540 48539 48538 48537 48536 48535 48534 48533 48532 48531 48530 48529 48528 48527 48526 48525 48524 48523 48522 48521 48520 48519 48518 48517 48516 48515 48514 48513 48512 48511 48510 48509 48508 48507 48506 48505 48504 48503 48502 48501 48500 48499 48498 48497 48496 48495 48494 48493 48492 48491 48490 48489 48488 48487 48486 48485 48484 48483 48482 48481 48480 48479 48478 48477 48476 48475 48474 48473 48472 48471 48470 48469 48468 48467 48466 48465 48464 48463 48462 48461 48460 48459 48458 48457 48456 48455 48454 48453 48452 48451 48450 48449 48448 48447 48446 48445 48444 48443 48442 48441 48440 48439 48438 48437 48436 48435 48434 48433 48432 48431 48430 48429 48428 48427 48426 48425 48424 48423 48422 48421 48420 48419 48418 48417 48416 48415 48414 48413 48412 48411 48410 48409 48408 48407 48406 48405 48404 48403 48402 48401 48400 48399 48398 48397 48396 48395 48394 48393 48392 48391 48390 48389 48388 48387 48386 48385 48384 48383 48382 48381 48380 48379 48378 48377 48376 48375 48374 48373 48372 48371 48370 48369 48368 48367 48366 48365 48364 48363 48362 48361 48360 48359 48358 48357 48356 48355 48354 48353 48352 48351 48350 48349 48348 48347 48346 48345 48344 48343 48342 48341 48340 48339 48338 48337 48336 48335 48334 48333 48332 48331 48330 48329 48328 48327 48326 48325 48324 48323 48322 48321 48320 48319 48318 48317 48316 48315 48314 48313 48312 48311 48310 48309 48308 48307 48306 48305 48304 48303 48302 48301 48300 48299 48298 48297 48296 48295 48294 48293 48292 48291 48290 48289 48288 48287 48286 48285 48284 48283 48282 48281 48280 48279 48278 48277 48276 48275 48274 48273 48272 48271 48270 48269 48268 48267 48266 48265 48264 48263 48262 48261 48260 48259 48258 48257 48256 48255 48254 48253 48252 48251 48250 48249 48248 48247 48246 48245 48244 48243 48242 48241 48240 48239 48238 48237 48236 48235 48234 48233 48232 48231 48230 48229 48228 48227 48226 48225 48224 48223 48222 48221 48220 48219 48218 48217 48216 48215 48214 48213 48212 48211 48210 48209 48208 48207 48206 48205 48204 48203 48202 48201 48200 48199 48198 48197 48196 48195 48194 48193 48192 48191 48190 48189 48188 48187 48186 48185 48184 48183 48182 48181 48180 48179 48178 48177 48176 48175 48174 48173 48172 48171 48170 48169 48168 48167 48166 48165 48164 48163 48162 48161 48160 48159 48158 48157 48156 48155 48154 48153 48152 48151 48150 48149 48148 48147 48146 48145 48144 48143 48142 48141 48140 48139 48138 48137 48136 48135 48134 48133 48132 48131 48130 48129 48128 48127 48126 48125 48124 48123 48122 48121 48120 48119 48118 48117 48116 48115 48114 48113 48112 48111 48110 48109 48108 48107 48106 48105 48104 48103 48102 48101 48100 48099 48098 48097 48096 48095 48094 48093 48092 48091 48090 48089 48088 48087 48086 48085 48084 48083 48082 48081 48080 48079 48078 48077 48076 48075 48074 48073 48072 48071 48070 48069 48068 48067 48066 48065 48064 48063 48062 48061 48060 48059 48058 48057 48056 48055 48054 48053 48052 48051 48050 48049 48048 48047 48046 48045 48044 48043 48042 48041 48040 48039 48038 48037 48036 48035 48034 48033 48032 48031 48030 48029 48028 48027 48026 48025 48024 48023 48022 48021 48020 48019 48018 48017 48016 48015 48014 48013 48012 48011 48010 48009 48008 48007 48006 48005 48004 48003 48002 48001 48000 47999 47998 47997 47996 47995 47994 47993 47992 47991 47990 47989 47988 47987 47986 47985 47984 47983 47982 47981 47980 47979 47978 47977 47976 47975 47974 47973 47972 47971 47970 47969 47968 47967 47966 47965 47964 47963 47962 47961 47960 47959 47958 47957 47956 47955 47954 47953 47952 47951 47950 47949 47948 47947 47946 47945 47944 47943 47942 47941 47940 47939 47938 47937 47936 47935 47934 47933 47932 47931 47930 47929 47928 47927 47926 47925 47924 47923 47922 47921 47920 47919 47918 47917 47916 47915 47914 47913 47912 47911 47910 47909 47908 47907 47906 47905 47904 47903 47902 47901 47900 47899 47898 47897 47896 47895 47894 47893 47892 47891 47890 47889 47888 47887 47886 47885 47884 47883 47882 47881 47880 47879 47878 47877 47876 47875 47874 47873 47872 47871 47870 47869 47868 47867 47866 47865 47864 47863 47862 47861 47860 47859 47858 47857 47856 47855 47854 47853 47852 47851 47850 47849 47848 47847 47846 47845 47844 47843 47842 47841 47840 47839 47838 47837 47836 47835 47834 47833 47832 47831 47830 47829 47828 47827 47826 47825 47824 47823 47822 47821 47820 47819 47818 47817 47816 47815 47814 47813 47812 47811 47810 47809 47808 47807 47806 47805 47804 47803 47802 47801 47800 47799 47798 47797 47796 47795 47794 47793 47792 47791 47790 47789 47788 47787 47786 47785 47784 47783 47782 47781 47780 47779 47778 47777 47776 47775 47774 47773 47772 47771 47770 47769 47768 47767 47766 47765 47764 47763 47762 47761 47760 47759 47758 47757 47756 47755 47754 47753 47752 47751 47750 47749 47748 47747 47746 47745 47744 47743 47742 47741 47740 47739 47738 47737 47736 47735 47734 47733 47732 47731 47730 47729 47728 47727 47726 47725 47724 47723 47722 47721 47720 47719 47718 47717 47716 47715 47714 47713 47712 47711 47710 47709 47708 47707 47706 47705 47704 47703 47702 47701 47700 47699 47698 47697 47696 47695 47694 47693 47692 47691 47690 47689 47688 47687 47686 47685 47684 47683 47682 47681 47680 47679 47678 47677 47676 47675 47674 47673 47672 47671 47670 47669 47668 47667 47666 47665 47664 47663 47662 47661 47660 47659 47658 47657 47656 47655 47654 47653 47652 47651 47650 47649 47648 47647 47646 47645 47644 47643 47642 47641 47640 47639 47638 47637 47636 47635 47634 47633 47632 47631 47630 47629 47628 47627 47626 47625 47624 47623 47622 47621 47620 47619 47618 47617 47616 47615 47614 47613 47612 47611 47610 47609 47608 47607 47606 47605 47604 47603 47602 47601 47600 47599 47598 47597 47596 47595 47594 47593 47592 47591 47590 47589 47588 47587 47586 47585 47584 47583 47582 47581 47580 47579 47578 47577 47576 47575 47574 47573 47572 47571 47570 47569 47568 47567 47566 47565 47564 47563 47562 47561 47560 47559 47558 47557 47556 47555 47554 47553 47552 47551 47550 47549 47548 47547 47546 47545 47544 47543 47542 47541 47540 47539 47538 47537 47536 47535 47534 47533 47532 47531 47530 47529 47528 47527 47526 47525 47524 47523 47522 47521 47520 47519 47518 47517 47516 47515 47514 47513 47512 47511 47510 47509 47508 47507 47506 47505 47504 47503 47502 47501 47500 47499 47498 47497 47496 47495 47494 47493 47492 47491 47490 47489 47488 47487 47486 47485 47484 47483 47482 47481 47480 47479 47478 47477 47476 47475 47474 47473 47472 47471 47470 47469 47468 47467 47466 47465 47464 47463 47462 47461 47460 47459 47458 47457 47456 47455 47454 47453 47452 47451 47450 47449 47448 47447 47446 47445 47444 47443 47442 47441 47440 47439 47438 47437 47436 47435 47434 47433 47432 47431 47430 47429 47428 47427 47426 47425 47424 47423 47422 47421 47420 47419 47418 47417 47416 47415 47414 47413 47412 47411 47410 47409 47408 47407 47406 47405 47404 47403 47402 47401 47400 47399 47398 47397 47396 47395 47394 47393 47392 47391 47390 47389 47388 47387 47386 47385 47384 47383 47382 47381 47380 47379 47378 47377 47376 47375 47374 47373 47372 47371 47370 47369 47368 47367 47366 47365 47364 47363 47362 47361 47360 47359 47358 47357 47356 47355 47354 47353 47352 47351 47350 47349 47348 47347 47346 47345 47344 47343 47342 47341 47340 47339 47338 47337 47336 47335 47334 47333 47332 47331 47330 47329 47328 47327 47326 47325 47324 47323 47322 47321 47320 47319 47318 47317 47316 47315 47314 47313 47312 47311 47310 47309 47308 47307 47306 47305 47304 47303 47302 47301 47300 47299 47298 47297 47296 47295 47294 47293 47292 47291 47290 47289 47288 47287 47286 47285 47284 47283 47282 47281 47280 47279 47278 47277 47276 47275 47274 47273 47272 47271 47270 47269 47268 47267 47266 47265 47264 47263 47262 47261 47260 47259 47258 47257 47256 47255 47254 47253 47252 47251 47250 47249 47248 47247 47246 47245 47244 47243 47242 47241 47240 47239 47238 47237 47236 47235 47234 47233 47232 47231 47230 47229 47228 47227 47226 47225 47224 47223 47222 47221 47220 47219 47218 47217 47216 47215 47214 47213 47212 47211 47210 47209 47208 47207 47206 47205 47204 47203 47202 47201 47200 47199 47198 47197 47196 47195 47194 47193 47192 47191 47190 47189 47188 47187 47186 47185 47184 47183 47182 47181 47180 47179 47178 47177 47176 47175 47174 47173 47172 47171 47170 47169 47168 47167 47166 47165 47164 47163 47162 47161 47160 47159 47158 47157 47156 47155 47154 47153 47152 47151 47150 47149 47148 47147 47146 47145 47144 47143 47142 47141 47140 47139 47138 47137 47136 47135 47134 47133 47132 47131 47130 47129 47128 47127 47126 47125 47124 47123 47122 47121 47120 47119 47118 47117 47116 47115 47114 47113 47112 47111 47110 47109 47108 47107 47106 47105 47104 47103 47102 47101 47100 47099 47098 47097 47096 47095 47094 47093 47092 47091 47090 47089 47088 47087 47086 47085 47084 47083 47082 47081 47080 47079 47078 47077 47076 47075 47074 47073 47072 47071 47070 47069 47068 47067 47066 47065 47064 47063 47062 47061 47060 47059 47058 47057 47056 47055 47054 47053 47052 47051 47050 47049 47048 47047 47046 47045 47044 47043 47042 47041 47040 47039 47038 47037 47036 47035 47034 47033 47032 47031 47030 47029 47028 47027 47026 47025 47024 47023 47022 47021 47020 47019 47018 47017 47016 47015 47014 47013 47012 47011 47010 47009 47008 47007 47006 47005 47004 47003 47002 47001 47000 46999 46998 46997 46996 46995 46994 46993 46992 46991 46990 46989 46988 46987 46986 46985 46984 46983 46982 46981 46980 46979 46978 46977 46976 46975 46974 46973 46972 46971 46970 46969 46968 46967 46966 46965 46964 46963 46962 46961 46960 46959 46958 46957 46956 46955 46954 46953 46952 46951 46950 46949 46948 46947 46946 46945 46944 46943 46942 46941 46940 46939 46938 46937 46936 46935 46934 46933 46932 46931 46930 46929 46928 46927 46926 46925 46924 46923 46922 46921 46920 46919 46918 46917 46916 46915 46914 46913 46912 46911 46910 46909 46908 46907 46906 46905 46904 46903 46902 46901 46900 46899 46898 46897 46896 46895 46894 46893 46892 46891 46890 46889 46888 46887 46886 46885 46884 46883 46882 46881 46880 46879 46878 46877 46876 46875 46874 46873 46872 46871 46870 46869 46868 46867 46866 46865 46864 46863 46862 46861 46860 46859 46858 46857 46856 46855 46854 46853 46852 46851 46850 46849 46848 46847 46846 46845 46844 46843 46842 46841 46840 46839 46838 46837 46836 46835 46834 46833 46832 46831 46830 46829 46828 46827 46826 46825 46824 46823 46822 46821 46820 46819 46818 46817 46816 46815 46814 46813 46812 46811 46810 46809 46808 46807 46806 46805 46804 46803 46802 46801 46800 46799 46798 46797 46796 46795 46794 46793 46792 46791 46790 46789 46788 46787 46786 46785 46784 46783 46782 46781 46780 46779 46778 46777 46776 46775 46774 46773 46772 46771 46770 46769 46768 46767 46766 46765 46764 46763 46762 46761 46760 46759 46758 46757 46756 46755 46754 46753 46752 46751 46750 46749 46748 46747 46746 46745 46744 46743 46742 46741 46740 46739 46738 46737 46736 46735 46734 46733 46732 46731 46730 46729 46728 46727 46726 46725 46724 46723 46722 46721 46720 46719 46718 46717 46716 46715 46714 46713 46712 46711 46710 46709 46708 46707 46706 46705 46704 46703 46702 46701 46700 46699 46698 46697 46696 46695 46694 46693 46692 46691 46690 46689 46688 46687 46686 46685 46684 46683 46682 46681 46680 46679 46678 46677 46676 46675 46674 46673 46672 46671 46670 46669 46668 46667 46666 46665 46664 46663 46662 46661 46660 46659 46658 46657 46656 46655 46654 46653 46652 46651 46650 46649 46648 46647 46646 46645 46644 46643 46642 46641 46640 46639 46638 46637 46636 46635 46634 46633 46632 46631 46630 46629 46628 46627 46626 46625 46624 46623 46622 46621 46620 46619 46618 46617 46616 46615 46614 46613 46612 46611 46610 46609 46608 46607 46606 46605 46604 46603 46602 46601 46600 46599 46598 46597 46596 46595 46594 46593 46592 46591 46590 46589 46588 46587 46586 46585 46584 46583 46582 46581 46580 46579 46578 46577 46576 46575 46574 46573 46572 46571 46570 46569 46568 46567 46566 46565 46564 46563 46562 46561 46560 46559 46558 46557 46556 46555 46554 46553 46552 46551 46550 46549 46548 46547 46546 46545 46544 46543 46542 46541 46540 46539 46538 46537 46536 46535 46534 46533 46532 46531 46530 46529 46528 46527 46526 46525 46524 46523 46522 46521 46520 46519 46518 46517 46516 46515 46514 46513 46512 46511 46510 46509 46508 46507 46506 46505 46504 46503 46502 46501 46500 46499 46498 46497 46496 46495 46494 46493 46492 46491 46490 46489 46488 46487 46486 46485 46484 46483 46482 46481 46480 46479 46478 46477 46476 46475 46474 46473 46472 46471 46470 46469 46468 46467 46466 46465 46464 46463 46462 46461 46460 46459 46458 46457 46456 46455 46454 46453 46452 46451 46450 46449 46448 46447 46446 46445 46444 46443 46442 46441 46440 46439 46438 46437 46436 46435 46434 46433 46432 46431 46430 46429 46428 46427 46426 46425 46424 46423 46422 46421 46420 46419 46418 46417 46416 46415 46414 46413 46412 46411 46410 46409 46408 46407 46406 46405 46404 46403 46402 46401 46400 46399 46398 46397 46396 46395 46394 46393 46392 46391 46390 46389 46388 46387 46386 46385 46384 46383 46382 46381 46380 46379 46378 46377 46376 46375 46374 46373 46372 46371 46370 46369 46368 46367 46366 46365 46364 46363 46362 46361 46360 46359 46358 46357 46356 46355 46354 46353 46352 46351 46350 46349 46348 46347 46346 46345 46344 46343 46342 46341 46340 46339 46338 46337 46336 46335 46334 46333 46332 46331 46330 46329 46328 46327 46326 46325 46324 46323 46322 46321 46320 46319 46318 46317 46316 46315 46314 46313 46312 46311 46310 46309 46308 46307 46306 46305 46304 46303 46302 46301 46300 46299 46298 46297 46296 46295 46294 46293 46292 46291 46290 46289 46288 46287 46286 46285 46284 46283 46282 46281 46280 46279 46278 46277 46276 46275 46274 46273 46272 46271 46270 46269 46268 46267 46266 46265 46264 46263 46262 46261 46260 46259 46258 46257 46256 46255 46254 46253 46252 46251 46250 46249 46248 46247 46246 46245 46244 46243 46242 46241 46240 46239 46238 46237 46236 46235 46234 46233 46232 46231 46230 46229 46228 46227 46226 46225 46224 46223 46222 46221 46220 46219 46218 46217 46216 46215 46214 46213 46212 46211 46210 46209 46208 46207 46206 46205 46204 46203 46202 46201 46200 46199 46198 46197 46196 46195 46194 46193 46192 46191 46190 46189 46188 46187 46186 46185 46184 46183 46182 46181 46180 46179 46178 46177 46176 46175 46174 46173 46172 46171 46170 46169 46168 46167 46166 46165 46164 46163 46162 46161 46160 46159 46158 46157 46156 46155 46154 46153 46152 46151 46150 46149 46148 46147 46146 46145 46144 46143 46142 46141 46140 46139 46138 46137 46136 46135 46134 46133 46132 46131 46130 46129 46128 46127 46126 46125 46124 46123 46122 46121 46120 46119 46118 46117 46116 46115 46114 46113 46112 46111 46110 46109 46108 46107 46106 46105 46104 46103 46102 46101 46100 46099 46098 46097 46096 46095 46094 46093 46092 46091 46090 46089 46088 46087 46086 46085 46084 46083 46082 46081 46080 46079 46078 46077 46076 46075 46074 46073 46072 46071 46070 46069 46068 46067 46066 46065 46064 46063 46062 46061 46060 46059 46058 46057 46056 46055 46054 46053 46052 46051 46050 46049 46048 46047 46046 46045 46044 46043 46042 46041 46040 46039 46038 46037 46036 46035 46034 46033 46032 46031 46030 46029 46028 46027 46026 46025 46024 46023 46022 46021 46020 46019 46018 46017 46016 46015 46014 46013 46012 46011 46010 46009 46008 46007 46006 46005 46004 46003 46002 46001 46000 45999 45998 45997 45996 45995 45994 45993 45992 45991 45990 45989 45988 45987 45986 45985 45984 45983 45982 45981 45980 45979 45978 45977 45976 45975 45974 45973 45972 45971 45970 45969 45968 45967 45966 45965 45964 45963 45962 45961 45960 45959 45958 45957 45956 45955 45954 45953 45952 45951 45950 45949 45948 45947 45946 45945 45944 45943 45942 45941 45940 45939 45938 45937 45936 45935 45934 45933 45932 45931 45930 45929 45928 45927 45926 45925 45924 45923 45922 45921 45920 45919 45918 45917 45916 45915 45914 45913 45912 45911 45910 45909 45908 45907 45906 45905 45904 45903 45902 45901 45900 45899 45898 45897 45896 45895 45894 45893 45892 45891 45890 45889 45888 45887 45886 45885 45884 45883 45882 45881 45880 45879 45878 45877 45876 45875 45874 45873 45872 45871 45870 45869 45868 45867 45866 45865 45864 45863 45862 45861 45860 45859 45858 45857 45856 45855 45854 45853 45852 45851 45850 45849 45848 45847 45846 45845 45844 45843 45842 45841 45840 45839 45838 45837 45836 45835 45834 45833 45832 45831 45830 45829 45828 45827 45826 45825 45824 45823 45822 45821 45820 45819 45818 45817 45816 45815 45814 45813 45812 45811 45810 45809 45808 45807 45806 45805 45804 45803 45802 45801 45800 45799 45798 45797 45796 45795 45794 45793 45792 45791 45790 45789 45788 45787 45786 45785 45784 45783 45782 45781 45780 45779 45778 45777 45776 45775 45774 45773 45772 45771 45770 45769 45768 45767 45766 45765 45764 45763 45762 45761 45760 45759 45758 45757 45756 45755 45754 45753 45752 45751 45750 45749 45748 45747 45746 45745 45744 45743 45742 45741 45740 45739 45738 45737 45736 45735 45734 45733 45732 45731 45730 45729 45728 45727 45726 45725 45724 45723 45722 45721 45720 45719 45718 45717 45716 45715 45714 45713 45712 45711 45710 45709 45708 45707 45706 45705 45704 45703 45702 45701 45700 45699 45698 45697 45696 45695 45694 45693 45692 45691 45690 45689 45688 45687 45686 45685 45684 45683 45682 45681 45680 45679 45678 45677 45676 45675 45674 45673 45672 45671 45670 45669 45668 45667 45666 45665 45664 45663 45662 45661 45660 45659 45658 45657 45656 45655 45654 45653 45652 45651 45650 45649 45648 45647 45646 45645 45644 45643 45642 45641 45640 45639 45638 45637 45636 45635 45634 45633 45632 45631 45630 45629 45628 45627 45626 45625 45624 45623 45622 45621 45620 45619 45618 45617 45616 45615 45614 45613 45612 45611 45610 45609 45608 45607 45606 45605 45604 45603 45602 45601 45600 45599 45598 45597 45596 45595 45594 45593 45592 45591 45590 45589 45588 45587 45586 45585 45584 45583 45582 45581 45580 45579 45578 45577 45576 45575 45574 45573 45572 45571 45570 45569 45568 45567 45566 45565 45564 45563 45562 45561 45560 45559 45558 45557 45556 45555 45554 45553 45552 45551 45550 45549 45548 45547 45546 45545 45544 45543 45542 45541 45540 45539 45538 45537 45536 45535 45534 45533 45532 45531 45530 45529 45528 45527 45526 45525 45524 45523 45522 45521 45520 45519 45518 45517 45516 45515 45514 45513 45512 45511 45510 45509 45508 45507 45506 45505 45504 45503 45502 45501 45500 45499 45498 45497 45496 45495 45494 45493 45492 45491 45490 45489 45488 45487 45486 45485 45484 45483 45482 45481 45480 45479 45478 45477 45476 45475 45474 45473 45472 45471 45470 45469 45468 45467 45466 45465 45464 45463 45462 45461 45460 45459 45458 45457 45456 45455 45454 45453 45452 45451 45450 45449 45448 45447 45446 45445 45444 45443 45442 45441 45440 45439 45438 45437 45436 45435 45434 45433 45432 45431 45430 45429 45428 45427 45426 45425 45424 45423 45422 45421 45420 45419 45418 45417 45416 45415 45414 45413 45412 45411 45410 45409 45408 45407 45406 45405 45404 45403 45402 45401 45400 45399 45398 45397 45396 45395 45394 45393 45392 45391 45390 45389 45388 45387 45386 45385 45384 45383 45382 45381 45380 45379 45378 45377 45376 45375 45374 45373 45372 45371 45370 45369 45368 45367 45366 45365 45364 45363 45362 45361 45360 45359 45358 45357 45356 45355 45354 45353 45352 45351 45350 45349 45348 45347 45346 45345 45344 45343 45342 45341 45340 45339 45338 45337 45336 45335 45334 45333 45332 45331 45330 45329 45328 45327 45326 45325 45324 45323 45322 45321 45320 45319 45318 45317 45316 45315 45314 45313 45312 45311 45310 45309 45308 45307 45306 45305 45304 45303 45302 45301 45300 45299 45298 45297 45296 45295 45294 45293 45292 45291 45290 45289 45288 45287 45286 45285 45284 45283 45282 45281 45280 45279 45278 45277 45276 45275 45274 45273 45272 45271 45270 45269 45268 45267 45266 45265 45264 45263 45262 45261 45260 45259 45258 45257 45256 45255 45254 45253 45252 45251 45250 45249 45248 45247 45246 45245 45244 45243 45242 45241 45240 45239 45238 45237 45236 45235 45234 45233 45232 45231 45230 45229 45228 45227 45226 45225 45224 45223 45222 45221 45220 45219 45218 45217 45216 45215 45214 45213 45212 45211 45210 45209 45208 45207 45206 45205 45204 45203 45202 45201 45200 45199 45198 45197 45196 45195 45194 45193 45192 45191 45190 45189 45188 45187 45186 45185 45184 45183 45182 45181 45180 45179 45178 45177 45176 45175 45174 45173 45172 45171 45170 45169 45168 45167 45166 45165 45164 45163 45162 45161 45160 45159 45158 45157 45156 45155 45154 45153 45152 45151 45150 45149 45148 45147 45146 45145 45144 45143 45142 45141 45140 45139 45138 45137 45136 45135 45134 45133 45132 45131 45130 45129 45128 45127 45126 45125 45124 45123 45122 45121 45120 45119 45118 45117 45116 45115 45114 45113 45112 45111 45110 45109 45108 45107 45106 45105 45104 45103 45102 45101 45100 45099 45098 45097 45096 45095 45094 45093 45092 45091 45090 45089 45088 45087 45086 45085 45084 45083 45082 45081 45080 45079 45078 45077 45076 45075 45074 45073 45072 45071 45070 45069 45068 45067 45066 45065 45064 45063 45062 45061 45060 45059 45058 45057 45056 45055 45054 45053 45052 45051 45050 45049 45048 45047 45046 45045 45044 45043 45042 45041 45040 45039 45038 45037 45036 45035 45034 45033 45032 45031 45030 45029 45028 45027 45026 45025 45024 45023 45022 45021 45020 45019 45018 45017 45016 45015 45014 45013 45012 45011 45010 45009 45008 45007 45006 45005 45004 45003 45002 45001 45000 44999 44998 44997 44996 44995 44994 44993 44992 44991 44990 44989 44988 44987 44986 44985 44984 44983 44982 44981 44980 44979 44978 44977 44976 44975 44974 44973 44972 44971 44970 44969 44968 44967 44966 44965 44964 44963 44962 44961 44960 44959 44958 44957 44956 44955 44954 44953 44952 44951 44950 44949 44948 44947 44946 44945 44944 44943 44942 44941 44940 44939 44938 44937 44936 44935 44934 44933 44932 44931 44930 44929 44928 44927 44926 44925 44924 44923 44922 44921 44920 44919 44918 44917 44916 44915 44914 44913 44912 44911 44910 44909 44908 44907 44906 44905 44904 44903 44902 44901 44900 44899 44898 44897 44896 44895 44894 44893 44892 44891 44890 44889 44888 44887 44886 44885 44884 44883 44882 44881 44880 44879 44878 44877 44876 44875 44874 44873 44872 44871 44870 44869 44868 44867 44866 44865 44864 44863 44862 44861 44860 44859 44858 44857 44856 44855 44854 44853 44852 44851 44850 44849 44848 44847 44846 44845 44844 44843 44842 44841 44840 44839 44838 44837 44836 44835 44834 44833 44832 44831 44830 44829 44828 44827 44826 44825 44824 44823 44822 44821 44820 44819 44818 44817 44816 44815 44814 44813 44812 44811 44810 44809 44808 44807 44806 44805 44804 44803 44802 44801 44800 44799 44798 44797 44796 44795 44794 44793 44792 44791 44790 44789 44788 44787 44786 44785 44784 44783 44782 44781 44780 44779 44778 44777 44776 44775 44774 44773 44772 44771 44770 44769 44768 44767 44766 44765 44764 44763 44762 44761 44760 44759 44758 44757 44756 44755 44754 44753 44752 44751 44750 44749 44748 44747 44746 44745 44744 44743 44742 44741 44740 44739 44738 44737 44736 44735 44734 44733 44732 44731 44730 44729 44728 44727 44726 44725 44724 44723 44722 44721 44720 44719 44718 44717 44716 44715 44714 44713 44712 44711 44710 44709 44708 44707 44706 44705 44704 44703 44702 44701 44700 44699 44698 44697 44696 44695 44694 44693 44692 44691 44690 44689 44688 44687 44686 44685 44684 44683 44682 44681 44680 44679 44678 44677 44676 44675 44674 44673 44672 44671 44670 44669 44668 44667 44666 44665 44664 44663 44662 44661 44660 44659 44658 44657 44656 44655 44654 44653 44652 44651 44650 44649 44648 44647 44646 44645 44644 44643 44642 44641 44640 44639 44638 44637 44636 44635 44634 44633 44632 44631 44630 44629 44628 44627 44626 44625 44624 44623 44622 44621 44620 44619 44618 44617 44616 44615 44614 44613 44612 44611 44610 44609 44608 44607 44606 44605 44604 44603 44602 44601 44600 44599 44598 44597 44596 44595 44594 44593 44592 44591 44590 44589 44588 44587 44586 44585 44584 44583 44582 44581 44580 44579 44578 44577 44576 44575 44574 44573 44572 44571 44570 44569 44568 44567 44566 44565 44564 44563 44562 44561 44560 44559 44558 44557 44556 44555 44554 44553 44552 44551 44550 44549 44548 44547 44546 44545 44544 44543 44542 44541 44540 44539 44538 44537 44536 44535 44534 44533 44532 44531 44530 44529 44528 44527 44526 44525 44524 44523 44522 44521 44520 44519 44518 44517 44516 44515 44514 44513 44512 44511 44510 44509 44508 44507 44506 44505 44504 44503 44502 44501 44500 44499 44498 44497 44496 44495 44494 44493 44492 44491 44490 44489 44488 44487 44486 44485 44484 44483 44482 44481 44480 44479 44478 44477 44476 44475 44474 44473 44472 44471 44470 44469 44468 44467 44466 44465 44464 44463 44462 44461 44460 44459 44458 44457 44456 44455 44454 44453 44452 44451 44450 44449 44448 44447 44446 44445 44444 44443 44442 44441 44440 44439 44438 44437 44436 44435 44434 44433 44432 44431 44430 44429 44428 44427 44426 44425 44424 44423 44422 44421 44420 44419 44418 44417 44416 44415 44414 44413 44412 44411 44410 44409 44408 44407 44406 44405 44404 44403 44402 44401 44400 44399 44398 44397 44396 44395 44394 44393 44392 44391 44390 44389 44388 44387 44386 44385 44384 44383 44382 44381 44380 44379 44378 44377 44376 44375 44374 44373 44372 44371 44370 44369 44368 44367 44366 44365 44364 44363 44362 44361 44360 44359 44358 44357 44356 44355 44354 44353 44352 44351 44350 44349 44348 44347 44346 44345 44344 44343 44342 44341 44340 44339 44338 44337 44336 44335 44334 44333 44332 44331 44330 44329 44328 44327 44326 44325 44324 44323 44322 44321 44320 44319 44318 44317 44316 44315 44314 44313 44312 44311 44310 44309 44308 44307 44306 44305 44304 44303 44302 44301 44300 44299 44298 44297 44296 44295 44294 44293 44292 44291 44290 44289 44288 44287 44286 44285 44284 44283 44282 44281 44280 44279 44278 44277 44276 44275 44274 44273 44272 44271 44270 44269 44268 44267 44266 44265 44264 44263 44262 44261 44260 44259 44258 44257 44256 44255 44254 44253 44252 44251 44250 44249 44248 44247 44246 44245 44244 44243 44242 44241 44240 44239 44238 44237 44236 44235 44234 44233 44232 44231 44230 44229 44228 44227 44226 44225 44224 44223 44222 44221 44220 44219 44218 44217 44216 44215 44214 44213 44212 44211 44210 44209 44208 44207 44206 44205 44204 44203 44202 44201 44200 44199 44198 44197 44196 44195 44194 44193 44192 44191 44190 44189 44188 44187 44186 44185 44184 44183 44182 44181 44180 44179 44178 44177 44176 44175 44174 44173 44172 44171 44170 44169 44168 44167 44166 44165 44164 44163 44162 44161 44160 44159 44158 44157 44156 44155 44154 44153 44152 44151 44150 44149 44148 44147 44146 44145 44144 44143 44142 44141 44140 44139 44138 44137 44136 44135 44134 44133 44132 44131 44130 44129 44128 44127 44126 44125 44124 44123 44122 44121 44120 44119 44118 44117 44116 44115 44114 44113 44112 44111 44110 44109 44108 44107 44106 44105 44104 44103 44102 44101 44100 44099 44098 44097 44096 44095 44094 44093 44092 44091 44090 44089 44088 44087 44086 44085 44084 44083 44082 44081 44080 44079 44078 44077 44076 44075 44074 44073 44072 44071 44070 44069 44068 44067 44066 44065 44064 44063 44062 44061 44060 44059 44058 44057 44056 44055 44054 44053 44052 44051 44050 44049 44048 44047 44046 44045 44044 44043 44042 44041 44040 44039 44038 44037 44036 44035 44034 44033 44032 44031 44030 44029 44028 44027 44026 44025 44024 44023 44022 44021 44020 44019 44018 44017 44016 44015 44014 44013 44012 44011 44010 44009 44008 44007 44006 44005 44004 44003 44002 44001 44000 43999 43998 43997 43996 43995 43994 43993 43992 43991 43990 43989 43988 43987 43986 43985 43984 43983 43982 43981 43980 43979 43978 43977 43976 43975 43974 43973 43972 43971 43970 43969 43968 43967 43966 43965 43964 43963 43962 43961 43960 43959 43958 43957 43956 43955 43954 43953 43952 43951 43950 43949 43948 43947 43946 43945 43944 43943 43942 43941 43940 43939 43938 43937 43936 43935 43934 43933 43932 43931 43930 43929 43928 43927 43926 43925 43924 43923 43922 43921 43920 43919 43918 43917 43916 43915 43914 43913 43912 43911 43910 43909 43908 43907 43906 43905 43904 43903 43902 43901 43900 43899 43898 43897 43896 43895 43894 43893 43892 43891 43890 43889 43888 43887 43886 43885 43884 43883 43882 43881 43880 43879 43878 43877 43876 43875 43874 43873 43872 43871 43870 43869 43868 43867 43866 43865 43864 43863 43862 43861 43860 43859 43858 43857 43856 43855 43854 43853 43852 43851 43850 43849 43848 43847 43846 43845 43844 43843 43842 43841 43840 43839 43838 43837 43836 43835 43834 43833 43832 43831 43830 43829 43828 43827 43826 43825 43824 43823 43822 43821 43820 43819 43818 43817 43816 43815 43814 43813 43812 43811 43810 43809 43808 43807 43806 43805 43804 43803 43802 43801 43800 43799 43798 43797 43796 43795 43794 43793 43792 43791 43790 43789 43788 43787 43786 43785 43784 43783 43782 43781 43780 43779 43778 43777 43776 43775 43774 43773 43772 43771 43770 43769 43768 43767 43766 43765 43764 43763 43762 43761 43760 43759 43758 43757 43756 43755 43754 43753 43752 43751 43750 43749 43748 43747 43746 43745 43744 43743 43742 43741 43740 43739 43738 43737 43736 43735 43734 43733 43732 43731 43730 43729 43728 43727 43726 43725 43724 43723 43722 43721 43720 43719 43718 43717 43716 43715 43714 43713 43712 43711 43710 43709 43708 43707 43706 43705 43704 43703 43702 43701 43700 43699 43698 43697 43696 43695 43694 43693 43692 43691 43690 43689 43688 43687 43686 43685 43684 43683 43682 43681 43680 43679 43678 43677 43676 43675 43674 43673 43672 43671 43670 43669 43668 43667 43666 43665 43664 43663 43662 43661 43660 43659 43658 43657 43656 43655 43654 43653 43652 43651 43650 43649 43648 43647 43646 43645 43644 43643 43642 43641 43640 43639 43638 43637 43636 43635 43634 43633 43632 43631 43630 43629 43628 43627 43626 43625 43624 43623 43622 43621 43620 43619 43618 43617 43616 43615 43614 43613 43612 43611 43610 43609 43608 43607 43606 43605 43604 43603 43602 43601 43600 43599 43598 43597 43596 43595 43594 43593 43592 43591 43590 43589 43588 43587 43586 43585 43584 43583 43582 43581 43580 43579 43578 43577 43576 43575 43574 43573 43572 43571 43570 43569 43568 43567 43566 43565 43564 43563 43562 43561 43560 43559 43558 43557 43556 43555 43554 43553 43552 43551 43550 43549 43548 43547 43546 43545 43544 43543 43542 43541 43540 43539 43538 43537 43536 43535 43534 43533 43532 43531 43530 43529 43528 43527 43526 43525 43524 43523 43522 43521 43520 43519 43518 43517 43516 43515 43514 43513 43512 43511 43510 43509 43508 43507 43506 43505 43504 43503 43502 43501 43500 43499 43498 43497 43496 43495 43494 43493 43492 43491 43490 43489 43488 43487 43486 43485 43484 43483 43482 43481 43480 43479 43478 43477 43476 43475 43474 43473 43472 43471 43470 43469 43468 43467 43466 43465 43464 43463 43462 43461 43460 43459 43458 43457 43456 43455 43454 43453 43452 43451 43450 43449 43448 43447 43446 43445 43444 43443 43442 43441 43440 43439 43438 43437 43436 43435 43434 43433 43432 43431 43430 43429 43428 43427 43426 43425 43424 43423 43422 43421 43420 43419 43418 43417 43416 43415 43414 43413 43412 43411 43410 43409 43408 43407 43406 43405 43404 43403 43402 43401 43400 43399 43398 43397 43396 43395 43394 43393 43392 43391 43390 43389 43388 43387 43386 43385 43384 43383 43382 43381 43380 43379 43378 43377 43376 43375 43374 43373 43372 43371 43370 43369 43368 43367 43366 43365 43364 43363 43362 43361 43360 43359 43358 43357 43356 43355 43354 43353 43352 43351 43350 43349 43348 43347 43346 43345 43344 43343 43342 43341 43340 43339 43338 43337 43336 43335 43334 43333 43332 43331 43330 43329 43328 43327 43326 43325 43324 43323 43322 43321 43320 43319 43318 43317 43316 43315 43314 43313 43312 43311 43310 43309 43308 43307 43306 43305 43304 43303 43302 43301 43300 43299 43298 43297 43296 43295 43294 43293 43292 43291 43290 43289 43288 43287 43286 43285 43284 43283 43282 43281 43280 43279 43278 43277 43276 43275 43274 43273 43272 43271 43270 43269 43268 43267 43266 43265 43264 43263 43262 43261 43260 43259 43258 43257 43256 43255 43254 43253 43252 43251 43250 43249 43248 43247 43246 43245 43244 43243 43242 43241 43240 43239 43238 43237 43236 43235 43234 43233 43232 43231 43230 43229 43228 43227 43226 43225 43224 43223 43222 43221 43220 43219 43218 43217 43216 43215 43214 43213 43212 43211 43210 43209 43208 43207 43206 43205 43204 43203 43202 43201 43200 43199 43198 43197 43196 43195 43194 43193 43192 43191 43190 43189 43188 43187 43186 43185 43184 43183 43182 43181 43180 43179 43178 43177 43176 43175 43174 43173 43172 43171 43170 43169 43168 43167 43166 43165 43164 43163 43162 43161 43160 43159 43158 43157 43156 43155 43154 43153 43152 43151 43150 43149 43148 43147 43146 43145 43144 43143 43142 43141 43140 43139 43138 43137 43136 43135 43134 43133 43132 43131 43130 43129 43128 43127 43126 43125 43124 43123 43122 43121 43120 43119 43118 43117 43116 43115 43114 43113 43112 43111 43110 43109 43108 43107 43106 43105 43104 43103 43102 43101 43100 43099 43098 43097 43096 43095 43094 43093 43092 43091 43090 43089 43088 43087 43086 43085 43084 43083 43082 43081 43080 43079 43078 43077 43076 43075 43074 43073 43072 43071 43070 43069 43068 43067 43066 43065 43064 43063 43062 43061 43060 43059 43058 43057 43056 43055 43054 43053 43052 43051 43050 43049 43048 43047 43046 43045 43044 43043 43042 43041 43040 43039 43038 43037 43036 43035 43034 43033 43032 43031 43030 43029 43028 43027 43026 43025 43024 43023 43022 43021 43020 43019 43018 43017 43016 43015 43014 43013 43012 43011 43010 43009 43008 43007 43006 43005 43004 43003 43002 43001 43000 42999 42998 42997 42996 42995 42994 42993 42992 42991 42990 42989 42988 42987 42986 42985 42984 42983 42982 42981 42980 42979 42978 42977 42976 42975 42974 42973 42972 42971 42970 42969 42968 42967 42966 42965 42964 42963 42962 42961 42960 42959 42958 42957 42956 42955 42954 42953 42952 42951 42950 42949 42948 42947 42946 42945 42944 42943 42942 42941 42940 42939 42938 42937 42936 42935 42934 42933 42932 42931 42930 42929 42928 42927 42926 42925 42924 42923 42922 42921 42920 42919 42918 42917 42916 42915 42914 42913 42912 42911 42910 42909 42908 42907 42906 42905 42904 42903 42902 42901 42900 42899 42898 42897 42896 42895 42894 42893 42892 42891 42890 42889 42888 42887 42886 42885 42884 42883 42882 42881 42880 42879 42878 42877 42876 42875 42874 42873 42872 42871 42870 42869 42868 42867 42866 42865 42864 42863 42862 42861 42860 42859 42858 42857 42856 42855 42854 42853 42852 42851 42850 42849 42848 42847 42846 42845 42844 42843 42842 42841 42840 42839 42838 42837 42836 42835 42834 42833 42832 42831 42830 42829 42828 42827 42826 42825 42824 42823 42822 42821 42820 42819 42818 42817 42816 42815 42814 42813 42812 42811 42810 42809 42808 42807 42806 42805 42804 42803 42802 42801 42800 42799 42798 42797 42796 42795 42794 42793 42792 42791 42790 42789 42788 42787 42786 42785 42784 42783 42782 42781 42780 42779 42778 42777 42776 42775 42774 42773 42772 42771 42770 42769 42768 42767 42766 42765 42764 42763 42762 42761 42760 42759 42758 42757 42756 42755 42754 42753 42752 42751 42750 42749 42748 42747 42746 42745 42744 42743 42742 42741 42740 42739 42738 42737 42736 42735 42734 42733 42732 42731 42730 42729 42728 42727 42726 42725 42724 42723 42722 42721 42720 42719 42718 42717 42716 42715 42714 42713 42712 42711 42710 42709 42708 42707 42706 42705 42704 42703 42702 42701 42700 42699 42698 42697 42696 42695 42694 42693 42692 42691 42690 42689 42688 42687 42686 42685 42684 42683 42682 42681 42680 42679 42678 42677 42676 42675 42674 42673 42672 42671 42670 42669 42668 42667 42666 42665 42664 42663 42662 42661 42660 42659 42658 42657 42656 42655 42654 42653 42652 42651 42650 42649 42648 42647 42646 42645 42644 42643 42642 42641 42640 42639 42638 42637 42636 42635 42634 42633 42632 42631 42630 42629 42628 42627 42626 42625 42624 42623 42622 42621 42620 42619 42618 42617 42616 42615 42614 42613 42612 42611 42610 42609 42608 42607 42606 42605 42604 42603 42602 42601 42600 42599 42598 42597 42596 42595 42594 42593 42592 42591 42590 42589 42588 42587 42586 42585 42584 42583 42582 42581 42580 42579 42578 42577 42576 42575 42574 42573 42572 42571 42570 42569 42568 42567 42566 42565 42564 42563 42562 42561 42560 42559 42558 42557 42556 42555 42554 42553 42552 42551 42550 42549 42548 42547 42546 42545 42544 42543 42542 42541 42540 42539 42538 42537 42536 42535 42534 42533 42532 42531 42530 42529 42528 42527 42526 42525 42524 42523 42522 42521 42520 42519 42518 42517 42516 42515 42514 42513 42512 42511 42510 42509 42508 42507 42506 42505 42504 42503 42502 42501 42500 42499 42498 42497 42496 42495 42494 42493 42492 42491 42490 42489 42488 42487 42486 42485 42484 42483 42482 42481 42480 42479 42478 42477 42476 42475 42474 42473 42472 42471 42470 42469 42468 42467 42466 42465 42464 42463 42462 42461 42460 42459 42458 42457 42456 42455 42454 42453 42452 42451 42450 42449 42448 42447 42446 42445 42444 42443 42442 42441 42440 42439 42438 42437 42436 42435 42434 42433 42432 42431 42430 42429 42428 42427 42426 42425 42424 42423 42422 42421 42420 42419 42418 42417 42416 42415 42414 42413 42412 42411 42410 42409 42408 42407 42406 42405 42404 42403 42402 42401 42400 42399 42398 42397 42396 42395 42394 42393 42392 42391 42390 42389 42388 42387 42386 42385 42384 42383 42382 42381 42380 42379 42378 42377 42376 42375 42374 42373 42372 42371 42370 42369 42368 42367 42366 42365 42364 42363 42362 42361 42360 42359 42358 42357 42356 42355 42354 42353 42352 42351 42350 42349 42348 42347 42346 42345 42344 42343 42342 42341 42340 42339 42338 42337 42336 42335 42334 42333 42332 42331 42330 42329 42328 42327 42326 42325 42324 42323 42322 42321 42320 42319 42318 42317 42316 42315 42314 42313 42312 42311 42310 42309 42308 42307 42306 42305 42304 42303 42302 42301 42300 42299 42298 42297 42296 42295 42294 42293 42292 42291 42290 42289 42288 42287 42286 42285 42284 42283 42282 42281 42280 42279 42278 42277 42276 42275 42274 42273 42272 42271 42270 42269 42268 42267 42266 42265 42264 42263 42262 42261 42260 42259 42258 42257 42256 42255 42254 42253 42252 42251 42250 42249 42248 42247 42246 42245 42244 42243 42242 42241 42240 42239 42238 42237 42236 42235 42234 42233 42232 42231 42230 42229 42228 42227 42226 42225 42224 42223 42222 42221 42220 42219 42218 42217 42216 42215 42214 42213 42212 42211 42210 42209 42208 42207 42206 42205 42204 42203 42202 42201 42200 42199 42198 42197 42196 42195 42194 42193 42192 42191 42190 42189 42188 42187 42186 42185 42184 42183 42182 42181 42180 42179 42178 42177 42176 42175 42174 42173 42172 42171 42170 42169 42168 42167 42166 42165 42164 42163 42162 42161 42160 42159 42158 42157 42156 42155 42154 42153 42152 42151 42150 42149 42148 42147 42146 42145 42144 42143 42142 42141 42140 42139 42138 42137 42136 42135 42134 42133 42132 42131 42130 42129 42128 42127 42126 42125 42124 42123 42122 42121 42120 42119 42118 42117 42116 42115 42114 42113 42112 42111 42110 42109 42108 42107 42106 42105 42104 42103 42102 42101 42100 42099 42098 42097 42096 42095 42094 42093 42092 42091 42090 42089 42088 42087 42086 42085 42084 42083 42082 42081 42080 42079 42078 42077 42076 42075 42074 42073 42072 42071 42070 42069 42068 42067 42066 42065 42064 42063 42062 42061 42060 42059 42058 42057 42056 42055 42054 42053 42052 42051 42050 42049 42048 42047 42046 42045 42044 42043 42042 42041 42040 42039 42038 42037 42036 42035 42034 42033 42032 42031 42030 42029 42028 42027 42026 42025 42024 42023 42022 42021 42020 42019 42018 42017 42016 42015 42014 42013 42012 42011 42010 42009 42008 42007 42006 42005 42004 42003 42002 42001 42000 41999 41998 41997 41996 41995 41994 41993 41992 41991 41990 41989 41988 41987 41986 41985 41984 41983 41982 41981 41980 41979 41978 41977 41976 41975 41974 41973 41972 41971 41970 41969 41968 41967 41966 41965 41964 41963 41962 41961 41960 41959 41958 41957 41956 41955 41954 41953 41952 41951 41950 41949 41948 41947 41946 41945 41944 41943 41942 41941 41940 41939 41938 41937 41936 41935 41934 41933 41932 41931 41930 41929 41928 41927 41926 41925 41924 41923 41922 41921 41920 41919 41918 41917 41916 41915 41914 41913 41912 41911 41910 41909 41908 41907 41906 41905 41904 41903 41902 41901 41900 41899 41898 41897 41896 41895 41894 41893 41892 41891 41890 41889 41888 41887 41886 41885 41884 41883 41882 41881 41880 41879 41878 41877 41876 41875 41874 41873 41872 41871 41870 41869 41868 41867 41866 41865 41864 41863 41862 41861 41860 41859 41858 41857 41856 41855 41854 41853 41852 41851 41850 41849 41848 41847 41846 41845 41844 41843 41842 41841 41840 41839 41838 41837 41836 41835 41834 41833 41832 41831 41830 41829 41828 41827 41826 41825 41824 41823 41822 41821 41820 41819 41818 41817 41816 41815 41814 41813 41812 41811 41810 41809 41808 41807 41806 41805 41804 41803 41802 41801 41800 41799 41798 41797 41796 41795 41794 41793 41792 41791 41790 41789 41788 41787 41786 41785 41784 41783 41782 41781 41780 41779 41778 41777 41776 41775 41774 41773 41772 41771 41770 41769 41768 41767 41766 41765 41764 41763 41762 41761 41760 41759 41758 41757 41756 41755 41754 41753 41752 41751 41750 41749 41748 41747 41746 41745 41744 41743 41742 41741 41740 41739 41738 41737 41736 41735 41734 41733 41732 41731 41730 41729 41728 41727 41726 41725 41724 41723 41722 41721 41720 41719 41718 41717 41716 41715 41714 41713 41712 41711 41710 41709 41708 41707 41706 41705 41704 41703 41702 41701 41700 41699 41698 41697 41696 41695 41694 41693 41692 41691 41690 41689 41688 41687 41686 41685 41684 41683 41682 41681 41680 41679 41678 41677 41676 41675 41674 41673 41672 41671 41670 41669 41668 41667 41666 41665 41664 41663 41662 41661 41660 41659 41658 41657 41656 41655 41654 41653 41652 41651 41650 41649 41648 41647 41646 41645 41644 41643 41642 41641 41640 41639 41638 41637 41636 41635 41634 41633 41632 41631 41630 41629 41628 41627 41626 41625 41624 41623 41622 41621 41620 41619 41618 41617 41616 41615 41614 41613 41612 41611 41610 41609 41608 41607 41606 41605 41604 41603 41602 41601 41600 41599 41598 41597 41596 41595 41594 41593 41592 41591 41590 41589 41588 41587 41586 41585 41584 41583 41582 41581 41580 41579 41578 41577 41576 41575 41574 41573 41572 41571 41570 41569 41568 41567 41566 41565 41564 41563 41562 41561 41560 41559 41558 41557 41556 41555 41554 41553 41552 41551 41550 41549 41548 41547 41546 41545 41544 41543 41542 41541 41540 41539 41538 41537 41536 41535 41534 41533 41532 41531 41530 41529 41528 41527 41526 41525 41524 41523 41522 41521 41520 41519 41518 41517 41516 41515 41514 41513 41512 41511 41510 41509 41508 41507 41506 41505 41504 41503 41502 41501 41500 41499 41498 41497 41496 41495 41494 41493 41492 41491 41490 41489 41488 41487 41486 41485 41484 41483 41482 41481 41480 41479 41478 41477 41476 41475 41474 41473 41472 41471 41470 41469 41468 41467 41466 41465 41464 41463 41462 41461 41460 41459 41458 41457 41456 41455 41454 41453 41452 41451 41450 41449 41448 41447 41446 41445 41444 41443 41442 41441 41440 41439 41438 41437 41436 41435 41434 41433 41432 41431 41430 41429 41428 41427 41426 41425 41424 41423 41422 41421 41420 41419 41418 41417 41416 41415 41414 41413 41412 41411 41410 41409 41408 41407 41406 41405 41404 41403 41402 41401 41400 41399 41398 41397 41396 41395 41394 41393 41392 41391 41390 41389 41388 41387 41386 41385 41384 41383 41382 41381 41380 41379 41378 41377 41376 41375 41374 41373 41372 41371 41370 41369 41368 41367 41366 41365 41364 41363 41362 41361 41360 41359 41358 41357 41356 41355 41354 41353 41352 41351 41350 41349 41348 41347 41346 41345 41344 41343 41342 41341 41340 41339 41338 41337 41336 41335 41334 41333 41332 41331 41330 41329 41328 41327 41326 41325 41324 41323 41322 41321 41320 41319 41318 41317 41316 41315 41314 41313 41312 41311 41310 41309 41308 41307 41306 41305 41304 41303 41302 41301 41300 41299 41298 41297 41296 41295 41294 41293 41292 41291 41290 41289 41288 41287 41286 41285 41284 41283 41282 41281 41280 41279 41278 41277 41276 41275 41274 41273 41272 41271 41270 41269 41268 41267 41266 41265 41264 41263 41262 41261 41260 41259 41258 41257 41256 41255 41254 41253 41252 41251 41250 41249 41248 41247 41246 41245 41244 41243 41242 41241 41240 41239 41238 41237 41236 41235 41234 41233 41232 41231 41230 41229 41228 41227 41226 41225 41224 41223 41222 41221 41220 41219 41218 41217 41216 41215 41214 41213 41212 41211 41210 41209 41208 41207 41206 41205 41204 41203 41202 41201 41200 41199 41198 41197 41196 41195 41194 41193 41192 41191 41190 41189 41188 41187 41186 41185 41184 41183 41182 41181 41180 41179 41178 41177 41176 41175 41174 41173 41172 41171 41170 41169 41168 41167 41166 41165 41164 41163 41162 41161 41160 41159 41158 41157 41156 41155 41154 41153 41152 41151 41150 41149 41148 41147 41146 41145 41144 41143 41142 41141 41140 41139 41138 41137 41136 41135 41134 41133 41132 41131 41130 41129 41128 41127 41126 41125 41124 41123 41122 41121 41120 41119 41118 41117 41116 41115 41114 41113 41112 41111 41110 41109 41108 41107 41106 41105 41104 41103 41102 41101 41100 41099 41098 41097 41096 41095 41094 41093 41092 41091 41090 41089 41088 41087 41086 41085 41084 41083 41082 41081 41080 41079 41078 41077 41076 41075 41074 41073 41072 41071 41070 41069 41068 41067 41066 41065 41064 41063 41062 41061 41060 41059 41058 41057 41056 41055 41054 41053 41052 41051 41050 41049 41048 41047 41046 41045 41044 41043 41042 41041 41040 41039 41038 41037 41036 41035 41034 41033 41032 41031 41030 41029 41028 41027 41026 41025 41024 41023 41022 41021 41020 41019 41018 41017 41016 41015 41014 41013 41012 41011 41010 41009 41008 41007 41006 41005 41004 41003 41002 41001 41000 40999 40998 40997 40996 40995 40994 40993 40992 40991 40990 40989 40988 40987 40986 40985 40984 40983 40982 40981 40980 40979 40978 40977 40976 40975 40974 40973 40972 40971 40970 40969 40968 40967 40966 40965 40964 40963 40962 40961 40960 40959 40958 40957 40956 40955 40954 40953 40952 40951 40950 40949 40948 40947 40946 40945 40944 40943 40942 40941 40940 40939 40938 40937 40936 40935 40934 40933 40932 40931 40930 40929 40928 40927 40926 40925 40924 40923 40922 40921 40920 40919 40918 40917 40916 40915 40914 40913 40912 40911 40910 40909 40908 40907 40906 40905 40904 40903 40902 40901 40900 40899 40898 40897 40896 40895 40894 40893 40892 40891 40890 40889 40888 40887 40886 40885 40884 40883 40882 40881 40880 40879 40878 40877 40876 40875 40874 40873 40872 40871 40870 40869 40868 40867 40866 40865 40864 40863 40862 40861 40860 40859 40858 40857 40856 40855 40854 40853 40852 40851 40850 40849 40848 40847 40846 40845 40844 40843 40842 40841 40840 40839 40838 40837 40836 40835 40834 40833 40832 40831 40830 40829 40828 40827 40826 40825 40824 40823 40822 40821 40820 40819 40818 40817 40816 40815 40814 40813 40812 40811 40810 40809 40808 40807 40806 40805 40804 40803 40802 40801 40800 40799 40798 40797 40796 40795 40794 40793 40792 40791 40790 40789 40788 40787 40786 40785 40784 40783 40782 40781 40780 40779 40778 40777 40776 40775 40774 40773 40772 40771 40770 40769 40768 40767 40766 40765 40764 40763 40762 40761 40760 40759 40758 40757 40756 40755 40754 40753 40752 40751 40750 40749 40748 40747 40746 40745 40744 40743 40742 40741 40740 40739 40738 40737 40736 40735 40734 40733 40732 40731 40730 40729 40728 40727 40726 40725 40724 40723 40722 40721 40720 40719 40718 40717 40716 40715 40714 40713 40712 40711 40710 40709 40708 40707 40706 40705 40704 40703 40702 40701 40700 40699 40698 40697 40696 40695 40694 40693 40692 40691 40690 40689 40688 40687 40686 40685 40684 40683 40682 40681 40680 40679 40678 40677 40676 40675 40674 40673 40672 40671 40670 40669 40668 40667 40666 40665 40664 40663 40662 40661 40660 40659 40658 40657 40656 40655 40654 40653 40652 40651 40650 40649 40648 40647 40646 40645 40644 40643 40642 40641 40640 40639 40638 40637 40636 40635 40634 40633 40632 40631 40630 40629 40628 40627 40626 40625 40624 40623 40622 40621 40620 40619 40618 40617 40616 40615 40614 40613 40612 40611 40610 40609 40608 40607 40606 40605 40604 40603 40602 40601 40600 40599 40598 40597 40596 40595 40594 40593 40592 40591 40590 40589 40588 40587 40586 40585 40584 40583 40582 40581 40580 40579 40578 40577 40576 40575 40574 40573 40572 40571 40570 40569 40568 40567 40566 40565 40564 40563 40562 40561 40560 40559 40558 40557 40556 40555 40554 40553 40552 40551 40550 40549 40548 40547 40546 40545 40544 40543 40542 40541 40540 40539 40538 40537 40536 40535 40534 40533 40532 40531 40530 40529 40528 40527 40526 40525 40524 40523 40522 40521 40520 40519 40518 40517 40516 40515 40514 40513 40512 40511 40510 40509 40508 40507 40506 40505 40504 40503 40502 40501 40500 40499 40498 40497 40496 40495 40494 40493 40492 40491 40490 40489 40488 40487 40486 40485 40484 40483 40482 40481 40480 40479 40478 40477 40476 40475 40474 40473 40472 40471 40470 40469 40468 40467 40466 40465 40464 40463 40462 40461 40460 40459 40458 40457 40456 40455 40454 40453 40452 40451 40450 40449 40448 40447 40446 40445 40444 40443 40442 40441 40440 40439 40438 40437 40436 40435 40434 40433 40432 40431 40430 40429 40428 40427 40426 40425 40424 40423 40422 40421 40420 40419 40418 40417 40416 40415 40414 40413 40412 40411 40410 40409 40408 40407 40406 40405 40404 40403 40402 40401 40400 40399 40398 40397 40396 40395 40394 40393 40392 40391 40390 40389 40388 40387 40386 40385 40384 40383 40382 40381 40380 40379 40378 40377 40376 40375 40374 40373 40372 40371 40370 40369 40368 40367 40366 40365 40364 40363 40362 40361 40360 40359 40358 40357 40356 40355 40354 40353 40352 40351 40350 40349 40348 40347 40346 40345 40344 40343 40342 40341 40340 40339 40338 40337 40336 40335 40334 40333 40332 40331 40330 40329 40328 40327 40326 40325 40324 40323 40322 40321 40320 40319 40318 40317 40316 40315 40314 40313 40312 40311 40310 40309 40308 40307 40306 40305 40304 40303 40302 40301 40300 40299 40298 40297 40296 40295 40294 40293 40292 40291 40290 40289 40288 40287 40286 40285 40284 40283 40282 40281 40280 40279 40278 40277 40276 40275 40274 40273 40272 40271 40270 40269 40268 40267 40266 40265 40264 40263 40262 40261 40260 40259 40258 40257 40256 40255 40254 40253 40252 40251 40250 40249 40248 40247 40246 40245 40244 40243 40242 40241 40240 40239 40238 40237 40236 40235 40234 40233 40232 40231 40230 40229 40228 40227 40226 40225 40224 40223 40222 40221 40220 40219 40218 40217 40216 40215 40214 40213 40212 40211 40210 40209 40208 40207 40206 40205 40204 40203 40202 40201 40200 40199 40198 40197 40196 40195 40194 40193 40192 40191 40190 40189 40188 40187 40186 40185 40184 40183 40182 40181 40180 40179 40178 40177 40176 40175 40174 40173 40172 40171 40170 40169 40168 40167 40166 40165 40164 40163 40162 40161 40160 40159 40158 40157 40156 40155 40154 40153 40152 40151 40150 40149 40148 40147 40146 40145 40144 40143 40142 40141 40140 40139 40138 40137 40136 40135 40134 40133 40132 40131 40130 40129 40128 40127 40126 40125 40124 40123 40122 40121 40120 40119 40118 40117 40116 40115 40114 40113 40112 40111 40110 40109 40108 40107 40106 40105 40104 40103 40102 40101 40100 40099 40098 40097 40096 40095 40094 40093 40092 40091 40090 40089 40088 40087 40086 40085 40084 40083 40082 40081 40080 40079 40078 40077 40076 40075 40074 40073 40072 40071 40070 40069 40068 40067 40066 40065 40064 40063 40062 40061 40060 40059 40058 40057 40056 40055 40054 40053 40052 40051 40050 40049 40048 40047 40046 40045 40044 40043 40042 40041 40040 40039 40038 40037 40036 40035 40034 40033 40032 40031 40030 40029 40028 40027 40026 40025 40024 40023 40022 40021 40020 40019 40018 40017 40016 40015 40014 40013 40012 40011 40010 40009 40008 40007 40006 40005 40004 40003 40002 40001 40000 39999 39998 39997 39996 39995 39994 39993 39992 39991 39990 39989 39988 39987 39986 39985 39984 39983 39982 39981 39980 39979 39978 39977 39976 39975 39974 39973 39972 39971 39970 39969 39968 39967 39966 39965 39964 39963 39962 39961 39960 39959 39958 39957 39956 39955 39954 39953 39952 39951 39950 39949 39948 39947 39946 39945 39944 39943 39942 39941 39940 39939 39938 39937 39936 39935 39934 39933 39932 39931 39930 39929 39928 39927 39926 39925 39924 39923 39922 39921 39920 39919 39918 39917 39916 39915 39914 39913 39912 39911 39910 39909 39908 39907 39906 39905 39904 39903 39902 39901 39900 39899 39898 39897 39896 39895 39894 39893 39892 39891 39890 39889 39888 39887 39886 39885 39884 39883 39882 39881 39880 39879 39878 39877 39876 39875 39874 39873 39872 39871 39870 39869 39868 39867 39866 39865 39864 39863 39862 39861 39860 39859 39858 39857 39856 39855 39854 39853 39852 39851 39850 39849 39848 39847 39846 39845 39844 39843 39842 39841 39840 39839 39838 39837 39836 39835 39834 39833 39832 39831 39830 39829 39828 39827 39826 39825 39824 39823 39822 39821 39820 39819 39818 39817 39816 39815 39814 39813 39812 39811 39810 39809 39808 39807 39806 39805 39804 39803 39802 39801 39800 39799 39798 39797 39796 39795 39794 39793 39792 39791 39790 39789 39788 39787 39786 39785 39784 39783 39782 39781 39780 39779 39778 39777 39776 39775 39774 39773 39772 39771 39770 39769 39768 39767 39766 39765 39764 39763 39762 39761 39760 39759 39758 39757 39756 39755 39754 39753 39752 39751 39750 39749 39748 39747 39746 39745 39744 39743 39742 39741 39740 39739 39738 39737 39736 39735 39734 39733 39732 39731 39730 39729 39728 39727 39726 39725 39724 39723 39722 39721 39720 39719 39718 39717 39716 39715 39714 39713 39712 39711 39710 39709 39708 39707 39706 39705 39704 39703 39702 39701 39700 39699 39698 39697 39696 39695 39694 39693 39692 39691 39690 39689 39688 39687 39686 39685 39684 39683 39682 39681 39680 39679 39678 39677 39676 39675 39674 39673 39672 39671 39670 39669 39668 39667 39666 39665 39664 39663 39662 39661 39660 39659 39658 39657 39656 39655 39654 39653 39652 39651 39650 39649 39648 39647 39646 39645 39644 39643 39642 39641 39640 39639 39638 39637 39636 39635 39634 39633 39632 39631 39630 39629 39628 39627 39626 39625 39624 39623 39622 39621 39620 39619 39618 39617 39616 39615 39614 39613 39612 39611 39610 39609 39608 39607 39606 39605 39604 39603 39602 39601 39600 39599 39598 39597 39596 39595 39594 39593 39592 39591 39590 39589 39588 39587 39586 39585 39584 39583 39582 39581 39580 39579 39578 39577 39576 39575 39574 39573 39572 39571 39570 39569 39568 39567 39566 39565 39564 39563 39562 39561 39560 39559 39558 39557 39556 39555 39554 39553 39552 39551 39550 39549 39548 39547 39546 39545 39544 39543 39542 39541 39540 39539 39538 39537 39536 39535 39534 39533 39532 39531 39530 39529 39528 39527 39526 39525 39524 39523 39522 39521 39520 39519 39518 39517 39516 39515 39514 39513 39512 39511 39510 39509 39508 39507 39506 39505 39504 39503 39502 39501 39500 39499 39498 39497 39496 39495 39494 39493 39492 39491 39490 39489 39488 39487 39486 39485 39484 39483 39482 39481 39480 39479 39478 39477 39476 39475 39474 39473 39472 39471 39470 39469 39468 39467 39466 39465 39464 39463 39462 39461 39460 39459 39458 39457 39456 39455 39454 39453 39452 39451 39450 39449 39448 39447 39446 39445 39444 39443 39442 39441 39440 39439 39438 39437 39436 39435 39434 39433 39432 39431 39430 39429 39428 39427 39426 39425 39424 39423 39422 39421 39420 39419 39418 39417 39416 39415 39414 39413 39412 39411 39410 39409 39408 39407 39406 39405 39404 39403 39402 39401 39400 39399 39398 39397 39396 39395 39394 39393 39392 39391 39390 39389 39388 39387 39386 39385 39384 39383 39382 39381 39380 39379 39378 39377 39376 39375 39374 39373 39372 39371 39370 39369 39368 39367 39366 39365 39364 39363 39362 39361 39360 39359 39358 39357 39356 39355 39354 39353 39352 39351 39350 39349 39348 39347 39346 39345 39344 39343 39342 39341 39340 39339 39338 39337 39336 39335 39334 39333 39332 39331 39330 39329 39328 39327 39326 39325 39324 39323 39322 39321 39320 39319 39318 39317 39316 39315 39314 39313 39312 39311 39310 39309 39308 39307 39306 39305 39304 39303 39302 39301 39300 39299 39298 39297 39296 39295 39294 39293 39292 39291 39290 39289 39288 39287 39286 39285 39284 39283 39282 39281 39280 39279 39278 39277 39276 39275 39274 39273 39272 39271 39270 39269 39268 39267 39266 39265 39264 39263 39262 39261 39260 39259 39258 39257 39256 39255 39254 39253 39252 39251 39250 39249 39248 39247 39246 39245 39244 39243 39242 39241 39240 39239 39238 39237 39236 39235 39234 39233 39232 39231 39230 39229 39228 39227 39226 39225 39224 39223 39222 39221 39220 39219 39218 39217 39216 39215 39214 39213 39212 39211 39210 39209 39208 39207 39206 39205 39204 39203 39202 39201 39200 39199 39198 39197 39196 39195 39194 39193 39192 39191 39190 39189 39188 39187 39186 39185 39184 39183 39182 39181 39180 39179 39178 39177 39176 39175 39174 39173 39172 39171 39170 39169 39168 39167 39166 39165 39164 39163 39162 39161 39160 39159 39158 39157 39156 39155 39154 39153 39152 39151 39150 39149 39148 39147 39146 39145 39144 39143 39142 39141 39140 39139 39138 39137 39136 39135 39134 39133 39132 39131 39130 39129 39128 39127 39126 39125 39124 39123 39122 39121 39120 39119 39118 39117 39116 39115 39114 39113 39112 39111 39110 39109 39108 39107 39106 39105 39104 39103 39102 39101 39100 39099 39098 39097 39096 39095 39094 39093 39092 39091 39090 39089 39088 39087 39086 39085 39084 39083 39082 39081 39080 39079 39078 39077 39076 39075 39074 39073 39072 39071 39070 39069 39068 39067 39066 39065 39064 39063 39062 39061 39060 39059 39058 39057 39056 39055 39054 39053 39052 39051 39050 39049 39048 39047 39046 39045 39044 39043 39042 39041 39040 39039 39038 39037 39036 39035 39034 39033 39032 39031 39030 39029 39028 39027 39026 39025 39024 39023 39022 39021 39020 39019 39018 39017 39016 39015 39014 39013 39012 39011 39010 39009 39008 39007 39006 39005 39004 39003 39002 39001 39000 38999 38998 38997 38996 38995 38994 38993 38992 38991 38990 38989 38988 38987 38986 38985 38984 38983 38982 38981 38980 38979 38978 38977 38976 38975 38974 38973 38972 38971 38970 38969 38968 38967 38966 38965 38964 38963 38962 38961 38960 38959 38958 38957 38956 38955 38954 38953 38952 38951 38950 38949 38948 38947 38946 38945 38944 38943 38942 38941 38940 38939 38938 38937 38936 38935 38934 38933 38932 38931 38930 38929 38928 38927 38926 38925 38924 38923 38922 38921 38920 38919 38918 38917 38916 38915 38914 38913 38912 38911 38910 38909 38908 38907 38906 38905 38904 38903 38902 38901 38900 38899 38898 38897 38896 38895 38894 38893 38892 38891 38890 38889 38888 38887 38886 38885 38884 38883 38882 38881 38880 38879 38878 38877 38876 38875 38874 38873 38872 38871 38870 38869 38868 38867 38866 38865 38864 38863 38862 38861 38860 38859 38858 38857 38856 38855 38854 38853 38852 38851 38850 38849 38848 38847 38846 38845 38844 38843 38842 38841 38840 38839 38838 38837 38836 38835 38834 38833 38832 38831 38830 38829 38828 38827 38826 38825 38824 38823 38822 38821 38820 38819 38818 38817 38816 38815 38814 38813 38812 38811 38810 38809 38808 38807 38806 38805 38804 38803 38802 38801 38800 38799 38798 38797 38796 38795 38794 38793 38792 38791 38790 38789 38788 38787 38786 38785 38784 38783 38782 38781 38780 38779 38778 38777 38776 38775 38774 38773 38772 38771 38770 38769 38768 38767 38766 38765 38764 38763 38762 38761 38760 38759 38758 38757 38756 38755 38754 38753 38752 38751 38750 38749 38748 38747 38746 38745 38744 38743 38742 38741 38740 38739 38738 38737 38736 38735 38734 38733 38732 38731 38730 38729 38728 38727 38726 38725 38724 38723 38722 38721 38720 38719 38718 38717 38716 38715 38714 38713 38712 38711 38710 38709 38708 38707 38706 38705 38704 38703 38702 38701 38700 38699 38698 38697 38696 38695 38694 38693 38692 38691 38690 38689 38688 38687 38686 38685 38684 38683 38682 38681 38680 38679 38678 38677 38676 38675 38674 38673 38672 38671 38670 38669 38668 38667 38666 38665 38664 38663 38662 38661 38660 38659 38658 38657 38656 38655 38654 38653 38652 38651 38650 38649 38648 38647 38646 38645 38644 38643 38642 38641 38640 38639 38638 38637 38636 38635 38634 38633 38632 38631 38630 38629 38628 38627 38626 38625 38624 38623 38622 38621 38620 38619 38618 38617 38616 38615 38614 38613 38612 38611 38610 38609 38608 38607 38606 38605 38604 38603 38602 38601 38600 38599 38598 38597 38596 38595 38594 38593 38592 38591 38590 38589 38588 38587 38586 38585 38584 38583 38582 38581 38580 38579 38578 38577 38576 38575 38574 38573 38572 38571 38570 38569 38568 38567 38566 38565 38564 38563 38562 38561 38560 38559 38558 38557 38556 38555 38554 38553 38552 38551 38550 38549 38548 38547 38546 38545 38544 38543 38542 38541 38540 38539 38538 38537 38536 38535 38534 38533 38532 38531 38530 38529 38528 38527 38526 38525 38524 38523 38522 38521 38520 38519 38518 38517 38516 38515 38514 38513 38512 38511 38510 38509 38508 38507 38506 38505 38504 38503 38502 38501 38500 38499 38498 38497 38496 38495 38494 38493 38492 38491 38490 38489 38488 38487 38486 38485 38484 38483 38482 38481 38480 38479 38478 38477 38476 38475 38474 38473 38472 38471 38470 38469 38468 38467 38466 38465 38464 38463 38462 38461 38460 38459 38458 38457 38456 38455 38454 38453 38452 38451 38450 38449 38448 38447 38446 38445 38444 38443 38442 38441 38440 38439 38438 38437 38436 38435 38434 38433 38432 38431 38430 38429 38428 38427 38426 38425 38424 38423 38422 38421 38420 38419 38418 38417 38416 38415 38414 38413 38412 38411 38410 38409 38408 38407 38406 38405 38404 38403 38402 38401 38400 38399 38398 38397 38396 38395 38394 38393 38392 38391 38390 38389 38388 38387 38386 38385 38384 38383 38382 38381 38380 38379 38378 38377 38376 38375 38374 38373 38372 38371 38370 38369 38368 38367 38366 38365 38364 38363 38362 38361 38360 38359 38358 38357 38356 38355 38354 38353 38352 38351 38350 38349 38348 38347 38346 38345 38344 38343 38342 38341 38340 38339 38338 38337 38336 38335 38334 38333 38332 38331 38330 38329 38328 38327 38326 38325 38324 38323 38322 38321 38320 38319 38318 38317 38316 38315 38314 38313 38312 38311 38310 38309 38308 38307 38306 38305 38304 38303 38302 38301 38300 38299 38298 38297 38296 38295 38294 38293 38292 38291 38290 38289 38288 38287 38286 38285 38284 38283 38282 38281 38280 38279 38278 38277 38276 38275 38274 38273 38272 38271 38270 38269 38268 38267 38266 38265 38264 38263 38262 38261 38260 38259 38258 38257 38256 38255 38254 38253 38252 38251 38250 38249 38248 38247 38246 38245 38244 38243 38242 38241 38240 38239 38238 38237 38236 38235 38234 38233 38232 38231 38230 38229 38228 38227 38226 38225 38224 38223 38222 38221 38220 38219 38218 38217 38216 38215 38214 38213 38212 38211 38210 38209 38208 38207 38206 38205 38204 38203 38202 38201 38200 38199 38198 38197 38196 38195 38194 38193 38192 38191 38190 38189 38188 38187 38186 38185 38184 38183 38182 38181 38180 38179 38178 38177 38176 38175 38174 38173 38172 38171 38170 38169 38168 38167 38166 38165 38164 38163 38162 38161 38160 38159 38158 38157 38156 38155 38154 38153 38152 38151 38150 38149 38148 38147 38146 38145 38144 38143 38142 38141 38140 38139 38138 38137 38136 38135 38134 38133 38132 38131 38130 38129 38128 38127 38126 38125 38124 38123 38122 38121 38120 38119 38118 38117 38116 38115 38114 38113 38112 38111 38110 38109 38108 38107 38106 38105 38104 38103 38102 38101 38100 38099 38098 38097 38096 38095 38094 38093 38092 38091 38090 38089 38088 38087 38086 38085 38084 38083 38082 38081 38080 38079 38078 38077 38076 38075 38074 38073 38072 38071 38070 38069 38068 38067 38066 38065 38064 38063 38062 38061 38060 38059 38058 38057 38056 38055 38054 38053 38052 38051 38050 38049 38048 38047 38046 38045 38044 38043 38042 38041 38040 38039 38038 38037 38036 38035 38034 38033 38032 38031 38030 38029 38028 38027 38026 38025 38024 38023 38022 38021 38020 38019 38018 38017 38016 38015 38014 38013 38012 38011 38010 38009 38008 38007 38006 38005 38004 38003 38002 38001 38000 37999 37998 37997 37996 37995 37994 37993 37992 37991 37990 37989 37988 37987 37986 37985 37984 37983 37982 37981 37980 37979 37978 37977 37976 37975 37974 37973 37972 37971 37970 37969 37968 37967 37966 37965 37964 37963 37962 37961 37960 37959 37958 37957 37956 37955 37954 37953 37952 37951 37950 37949 37948 37947 37946 37945 37944 37943 37942 37941 37940 37939 37938 37937 37936 37935 37934 37933 37932 37931 37930 37929 37928 37927 37926 37925 37924 37923 37922 37921 37920 37919 37918 37917 37916 37915 37914 37913 37912 37911 37910 37909 37908 37907 37906 37905 37904 37903 37902 37901 37900 37899 37898 37897 37896 37895 37894 37893 37892 37891 37890 37889 37888 37887 37886 37885 37884 37883 37882 37881 37880 37879 37878 37877 37876 37875 37874 37873 37872 37871 37870 37869 37868 37867 37866 37865 37864 37863 37862 37861 37860 37859 37858 37857 37856 37855 37854 37853 37852 37851 37850 37849 37848 37847 37846 37845 37844 37843 37842 37841 37840 37839 37838 37837 37836 37835 37834 37833 37832 37831 37830 37829 37828 37827 37826 37825 37824 37823 37822 37821 37820 37819 37818 37817 37816 37815 37814 37813 37812 37811 37810 37809 37808 37807 37806 37805 37804 37803 37802 37801 37800 37799 37798 37797 37796 37795 37794 37793 37792 37791 37790 37789 37788 37787 37786 37785 37784 37783 37782 37781 37780 37779 37778 37777 37776 37775 37774 37773 37772 37771 37770 37769 37768 37767 37766 37765 37764 37763 37762 37761 37760 37759 37758 37757 37756 37755 37754 37753 37752 37751 37750 37749 37748 37747 37746 37745 37744 37743 37742 37741 37740 37739 37738 37737 37736 37735 37734 37733 37732 37731 37730 37729 37728 37727 37726 37725 37724 37723 37722 37721 37720 37719 37718 37717 37716 37715 37714 37713 37712 37711 37710 37709 37708 37707 37706 37705 37704 37703 37702 37701 37700 37699 37698 37697 37696 37695 37694 37693 37692 37691 37690 37689 37688 37687 37686 37685 37684 37683 37682 37681 37680 37679 37678 37677 37676 37675 37674 37673 37672 37671 37670 37669 37668 37667 37666 37665 37664 37663 37662 37661 37660 37659 37658 37657 37656 37655 37654 37653 37652 37651 37650 37649 37648 37647 37646 37645 37644 37643 37642 37641 37640 37639 37638 37637 37636 37635 37634 37633 37632 37631 37630 37629 37628 37627 37626 37625 37624 37623 37622 37621 37620 37619 37618 37617 37616 37615 37614 37613 37612 37611 37610 37609 37608 37607 37606 37605 37604 37603 37602 37601 37600 37599 37598 37597 37596 37595 37594 37593 37592 37591 37590 37589 37588 37587 37586 37585 37584 37583 37582 37581 37580 37579 37578 37577 37576 37575 37574 37573 37572 37571 37570 37569 37568 37567 37566 37565 37564 37563 37562 37561 37560 37559 37558 37557 37556 37555 37554 37553 37552 37551 37550 37549 37548 37547 37546 37545 37544 37543 37542 37541 37540 37539 37538 37537 37536 37535 37534 37533 37532 37531 37530 37529 37528 37527 37526 37525 37524 37523 37522 37521 37520 37519 37518 37517 37516 37515 37514 37513 37512 37511 37510 37509 37508 37507 37506 37505 37504 37503 37502 37501 37500 37499 37498 37497 37496 37495 37494 37493 37492 37491 37490 37489 37488 37487 37486 37485 37484 37483 37482 37481 37480 37479 37478 37477 37476 37475 37474 37473 37472 37471 37470 37469 37468 37467 37466 37465 37464 37463 37462 37461 37460 37459 37458 37457 37456 37455 37454 37453 37452 37451 37450 37449 37448 37447 37446 37445 37444 37443 37442 37441 37440 37439 37438 37437 37436 37435 37434 37433 37432 37431 37430 37429 37428 37427 37426 37425 37424 37423 37422 37421 37420 37419 37418 37417 37416 37415 37414 37413 37412 37411 37410 37409 37408 37407 37406 37405 37404 37403 37402 37401 37400 37399 37398 37397 37396 37395 37394 37393 37392 37391 37390 37389 37388 37387 37386 37385 37384 37383 37382 37381 37380 37379 37378 37377 37376 37375 37374 37373 37372 37371 37370 37369 37368 37367 37366 37365 37364 37363 37362 37361 37360 37359 37358 37357 37356 37355 37354 37353 37352 37351 37350 37349 37348 37347 37346 37345 37344 37343 37342 37341 37340 37339 37338 37337 37336 37335 37334 37333 37332 37331 37330 37329 37328 37327 37326 37325 37324 37323 37322 37321 37320 37319 37318 37317 37316 37315 37314 37313 37312 37311 37310 37309 37308 37307 37306 37305 37304 37303 37302 37301 37300 37299 37298 37297 37296 37295 37294 37293 37292 37291 37290 37289 37288 37287 37286 37285 37284 37283 37282 37281 37280 37279 37278 37277 37276 37275 37274 37273 37272 37271 37270 37269 37268 37267 37266 37265 37264 37263 37262 37261 37260 37259 37258 37257 37256 37255 37254 37253 37252 37251 37250 37249 37248 37247 37246 37245 37244 37243 37242 37241 37240 37239 37238 37237 37236 37235 37234 37233 37232 37231 37230 37229 37228 37227 37226 37225 37224 37223 37222 37221 37220 37219 37218 37217 37216 37215 37214 37213 37212 37211 37210 37209 37208 37207 37206 37205 37204 37203 37202 37201 37200 37199 37198 37197 37196 37195 37194 37193 37192 37191 37190 37189 37188 37187 37186 37185 37184 37183 37182 37181 37180 37179 37178 37177 37176 37175 37174 37173 37172 37171 37170 37169 37168 37167 37166 37165 37164 37163 37162 37161 37160 37159 37158 37157 37156 37155 37154 37153 37152 37151 37150 37149 37148 37147 37146 37145 37144 37143 37142 37141 37140 37139 37138 37137 37136 37135 37134 37133 37132 37131 37130 37129 37128 37127 37126 37125 37124 37123 37122 37121 37120 37119 37118 37117 37116 37115 37114 37113 37112 37111 37110 37109 37108 37107 37106 37105 37104 37103 37102 37101 37100 37099 37098 37097 37096 37095 37094 37093 37092 37091 37090 37089 37088 37087 37086 37085 37084 37083 37082 37081 37080 37079 37078 37077 37076 37075 37074 37073 37072 37071 37070 37069 37068 37067 37066 37065 37064 37063 37062 37061 37060 37059 37058 37057 37056 37055 37054 37053 37052 37051 37050 37049 37048 37047 37046 37045 37044 37043 37042 37041 37040 37039 37038 37037 37036 37035 37034 37033 37032 37031 37030 37029 37028 37027 37026 37025 37024 37023 37022 37021 37020 37019 37018 37017 37016 37015 37014 37013 37012 37011 37010 37009 37008 37007 37006 37005 37004 37003 37002 37001 37000 36999 36998 36997 36996 36995 36994 36993 36992 36991 36990 36989 36988 36987 36986 36985 36984 36983 36982 36981 36980 36979 36978 36977 36976 36975 36974 36973 36972 36971 36970 36969 36968 36967 36966 36965 36964 36963 36962 36961 36960 36959 36958 36957 36956 36955 36954 36953 36952 36951 36950 36949 36948 36947 36946 36945 36944 36943 36942 36941 36940 36939 36938 36937 36936 36935 36934 36933 36932 36931 36930 36929 36928 36927 36926 36925 36924 36923 36922 36921 36920 36919 36918 36917 36916 36915 36914 36913 36912 36911 36910 36909 36908 36907 36906 36905 36904 36903 36902 36901 36900 36899 36898 36897 36896 36895 36894 36893 36892 36891 36890 36889 36888 36887 36886 36885 36884 36883 36882 36881 36880 36879 36878 36877 36876 36875 36874 36873 36872 36871 36870 36869 36868 36867 36866 36865 36864 36863 36862 36861 36860 36859 36858 36857 36856 36855 36854 36853 36852 36851 36850 36849 36848 36847 36846 36845 36844 36843 36842 36841 36840 36839 36838 36837 36836 36835 36834 36833 36832 36831 36830 36829 36828 36827 36826 36825 36824 36823 36822 36821 36820 36819 36818 36817 36816 36815 36814 36813 36812 36811 36810 36809 36808 36807 36806 36805 36804 36803 36802 36801 36800 36799 36798 36797 36796 36795 36794 36793 36792 36791 36790 36789 36788 36787 36786 36785 36784 36783 36782 36781 36780 36779 36778 36777 36776 36775 36774 36773 36772 36771 36770 36769 36768 36767 36766 36765 36764 36763 36762 36761 36760 36759 36758 36757 36756 36755 36754 36753 36752 36751 36750 36749 36748 36747 36746 36745 36744 36743 36742 36741 36740 36739 36738 36737 36736 36735 36734 36733 36732 36731 36730 36729 36728 36727 36726 36725 36724 36723 36722 36721 36720 36719 36718 36717 36716 36715 36714 36713 36712 36711 36710 36709 36708 36707 36706 36705 36704 36703 36702 36701 36700 36699 36698 36697 36696 36695 36694 36693 36692 36691 36690 36689 36688 36687 36686 36685 36684 36683 36682 36681 36680 36679 36678 36677 36676 36675 36674 36673 36672 36671 36670 36669 36668 36667 36666 36665 36664 36663 36662 36661 36660 36659 36658 36657 36656 36655 36654 36653 36652 36651 36650 36649 36648 36647 36646 36645 36644 36643 36642 36641 36640 36639 36638 36637 36636 36635 36634 36633 36632 36631 36630 36629 36628 36627 36626 36625 36624 36623 36622 36621 36620 36619 36618 36617 36616 36615 36614 36613 36612 36611 36610 36609 36608 36607 36606 36605 36604 36603 36602 36601 36600 36599 36598 36597 36596 36595 36594 36593 36592 36591 36590 36589 36588 36587 36586 36585 36584 36583 36582 36581 36580 36579 36578 36577 36576 36575 36574 36573 36572 36571 36570 36569 36568 36567 36566 36565 36564 36563 36562 36561 36560 36559 36558 36557 36556 36555 36554 36553 36552 36551 36550 36549 36548 36547 36546 36545 36544 36543 36542 36541 36540 36539 36538 36537 36536 36535 36534 36533 36532 36531 36530 36529 36528 36527 36526 36525 36524 36523 36522 36521 36520 36519 36518 36517 36516 36515 36514 36513 36512 36511 36510 36509 36508 36507 36506 36505 36504 36503 36502 36501 36500 36499 36498 36497 36496 36495 36494 36493 36492 36491 36490 36489 36488 36487 36486 36485 36484 36483 36482 36481 36480 36479 36478 36477 36476 36475 36474 36473 36472 36471 36470 36469 36468 36467 36466 36465 36464 36463 36462 36461 36460 36459 36458 36457 36456 36455 36454 36453 36452 36451 36450 36449 36448 36447 36446 36445 36444 36443 36442 36441 36440 36439 36438 36437 36436 36435 36434 36433 36432 36431 36430 36429 36428 36427 36426 36425 36424 36423 36422 36421 36420 36419 36418 36417 36416 36415 36414 36413 36412 36411 36410 36409 36408 36407 36406 36405 36404 36403 36402 36401 36400 36399 36398 36397 36396 36395 36394 36393 36392 36391 36390 36389 36388 36387 36386 36385 36384 36383 36382 36381 36380 36379 36378 36377 36376 36375 36374 36373 36372 36371 36370 36369 36368 36367 36366 36365 36364 36363 36362 36361 36360 36359 36358 36357 36356 36355 36354 36353 36352 36351 36350 36349 36348 36347 36346 36345 36344 36343 36342 36341 36340 36339 36338 36337 36336 36335 36334 36333 36332 36331 36330 36329 36328 36327 36326 36325 36324 36323 36322 36321 36320 36319 36318 36317 36316 36315 36314 36313 36312 36311 36310 36309 36308 36307 36306 36305 36304 36303 36302 36301 36300 36299 36298 36297 36296 36295 36294 36293 36292 36291 36290 36289 36288 36287 36286 36285 36284 36283 36282 36281 36280 36279 36278 36277 36276 36275 36274 36273 36272 36271 36270 36269 36268 36267 36266 36265 36264 36263 36262 36261 36260 36259 36258 36257 36256 36255 36254 36253 36252 36251 36250 36249 36248 36247 36246 36245 36244 36243 36242 36241 36240 36239 36238 36237 36236 36235 36234 36233 36232 36231 36230 36229 36228 36227 36226 36225 36224 36223 36222 36221 36220 36219 36218 36217 36216 36215 36214 36213 36212 36211 36210 36209 36208 36207 36206 36205 36204 36203 36202 36201 36200 36199 36198 36197 36196 36195 36194 36193 36192 36191 36190 36189 36188 36187 36186 36185 36184 36183 36182 36181 36180 36179 36178 36177 36176 36175 36174 36173 36172 36171 36170 36169 36168 36167 36166 36165 36164 36163 36162 36161 36160 36159 36158 36157 36156 36155 36154 36153 36152 36151 36150 36149 36148 36147 36146 36145 36144 36143 36142 36141 36140 36139 36138 36137 36136 36135 36134 36133 36132 36131 36130 36129 36128 36127 36126 36125 36124 36123 36122 36121 36120 36119 36118 36117 36116 36115 36114 36113 36112 36111 36110 36109 36108 36107 36106 36105 36104 36103 36102 36101 36100 36099 36098 36097 36096 36095 36094 36093 36092 36091 36090 36089 36088 36087 36086 36085 36084 36083 36082 36081 36080 36079 36078 36077 36076 36075 36074 36073 36072 36071 36070 36069 36068 36067 36066 36065 36064 36063 36062 36061 36060 36059 36058 36057 36056 36055 36054 36053 36052 36051 36050 36049 36048 36047 36046 36045 36044 36043 36042 36041 36040 36039 36038 36037 36036 36035 36034 36033 36032 36031 36030 36029 36028 36027 36026 36025 36024 36023 36022 36021 36020 36019 36018 36017 36016 36015 36014 36013 36012 36011 36010 36009 36008 36007 36006 36005 36004 36003 36002 36001 36000 35999 35998 35997 35996 35995 35994 35993 35992 35991 35990 35989 35988 35987 35986 35985 35984 35983 35982 35981 35980 35979 35978 35977 35976 35975 35974 35973 35972 35971 35970 35969 35968 35967 35966 35965 35964 35963 35962 35961 35960 35959 35958 35957 35956 35955 35954 35953 35952 35951 35950 35949 35948 35947 35946 35945 35944 35943 35942 35941 35940 35939 35938 35937 35936 35935 35934 35933 35932 35931 35930 35929 35928 35927 35926 35925 35924 35923 35922 35921 35920 35919 35918 35917 35916 35915 35914 35913 35912 35911 35910 35909 35908 35907 35906 35905 35904 35903 35902 35901 35900 35899 35898 35897 35896 35895 35894 35893 35892 35891 35890 35889 35888 35887 35886 35885 35884 35883 35882 35881 35880 35879 35878 35877 35876 35875 35874 35873 35872 35871 35870 35869 35868 35867 35866 35865 35864 35863 35862 35861 35860 35859 35858 35857 35856 35855 35854 35853 35852 35851 35850 35849 35848 35847 35846 35845 35844 35843 35842 35841 35840 35839 35838 35837 35836 35835 35834 35833 35832 35831 35830 35829 35828 35827 35826 35825 35824 35823 35822 35821 35820 35819 35818 35817 35816 35815 35814 35813 35812 35811 35810 35809 35808 35807 35806 35805 35804 35803 35802 35801 35800 35799 35798 35797 35796 35795 35794 35793 35792 35791 35790 35789 35788 35787 35786 35785 35784 35783 35782 35781 35780 35779 35778 35777 35776 35775 35774 35773 35772 35771 35770 35769 35768 35767 35766 35765 35764 35763 35762 35761 35760 35759 35758 35757 35756 35755 35754 35753 35752 35751 35750 35749 35748 35747 35746 35745 35744 35743 35742 35741 35740 35739 35738 35737 35736 35735 35734 35733 35732 35731 35730 35729 35728 35727 35726 35725 35724 35723 35722 35721 35720 35719 35718 35717 35716 35715 35714 35713 35712 35711 35710 35709 35708 35707 35706 35705 35704 35703 35702 35701 35700 35699 35698 35697 35696 35695 35694 35693 35692 35691 35690 35689 35688 35687 35686 35685 35684 35683 35682 35681 35680 35679 35678 35677 35676 35675 35674 35673 35672 35671 35670 35669 35668 35667 35666 35665 35664 35663 35662 35661 35660 35659 35658 35657 35656 35655 35654 35653 35652 35651 35650 35649 35648 35647 35646 35645 35644 35643 35642 35641 35640 35639 35638 35637 35636 35635 35634 35633 35632 35631 35630 35629 35628 35627 35626 35625 35624 35623 35622 35621 35620 35619 35618 35617 35616 35615 35614 35613 35612 35611 35610 35609 35608 35607 35606 35605 35604 35603 35602 35601 35600 35599 35598 35597 35596 35595 35594 35593 35592 35591 35590 35589 35588 35587 35586 35585 35584 35583 35582 35581 35580 35579 35578 35577 35576 35575 35574 35573 35572 35571 35570 35569 35568 35567 35566 35565 35564 35563 35562 35561 35560 35559 35558 35557 35556 35555 35554 35553 35552 35551 35550 35549 35548 35547 35546 35545 35544 35543 35542 35541 35540 35539 35538 35537 35536 35535 35534 35533 35532 35531 35530 35529 35528 35527 35526 35525 35524 35523 35522 35521 35520 35519 35518 35517 35516 35515 35514 35513 35512 35511 35510 35509 35508 35507 35506 35505 35504 35503 35502 35501 35500 35499 35498 35497 35496 35495 35494 35493 35492 35491 35490 35489 35488 35487 35486 35485 35484 35483 35482 35481 35480 35479 35478 35477 35476 35475 35474 35473 35472 35471 35470 35469 35468 35467 35466 35465 35464 35463 35462 35461 35460 35459 35458 35457 35456 35455 35454 35453 35452 35451 35450 35449 35448 35447 35446 35445 35444 35443 35442 35441 35440 35439 35438 35437 35436 35435 35434 35433 35432 35431 35430 35429 35428 35427 35426 35425 35424 35423 35422 35421 35420 35419 35418 35417 35416 35415 35414 35413 35412 35411 35410 35409 35408 35407 35406 35405 35404 35403 35402 35401 35400 35399 35398 35397 35396 35395 35394 35393 35392 35391 35390 35389 35388 35387 35386 35385 35384 35383 35382 35381 35380 35379 35378 35377 35376 35375 35374 35373 35372 35371 35370 35369 35368 35367 35366 35365 35364 35363 35362 35361 35360 35359 35358 35357 35356 35355 35354 35353 35352 35351 35350 35349 35348 35347 35346 35345 35344 35343 35342 35341 35340 35339 35338 35337 35336 35335 35334 35333 35332 35331 35330 35329 35328 35327 35326 35325 35324 35323 35322 35321 35320 35319 35318 35317 35316 35315 35314 35313 35312 35311 35310 35309 35308 35307 35306 35305 35304 35303 35302 35301 35300 35299 35298 35297 35296 35295 35294 35293 35292 35291 35290 35289 35288 35287 35286 35285 35284 35283 35282 35281 35280 35279 35278 35277 35276 35275 35274 35273 35272 35271 35270 35269 35268 35267 35266 35265 35264 35263 35262 35261 35260 35259 35258 35257 35256 35255 35254 35253 35252 35251 35250 35249 35248 35247 35246 35245 35244 35243 35242 35241 35240 35239 35238 35237 35236 35235 35234 35233 35232 35231 35230 35229 35228 35227 35226 35225 35224 35223 35222 35221 35220 35219 35218 35217 35216 35215 35214 35213 35212 35211 35210 35209 35208 35207 35206 35205 35204 35203 35202 35201 35200 35199 35198 35197 35196 35195 35194 35193 35192 35191 35190 35189 35188 35187 35186 35185 35184 35183 35182 35181 35180 35179 35178 35177 35176 35175 35174 35173 35172 35171 35170 35169 35168 35167 35166 35165 35164 35163 35162 35161 35160 35159 35158 35157 35156 35155 35154 35153 35152 35151 35150 35149 35148 35147 35146 35145 35144 35143 35142 35141 35140 35139 35138 35137 35136 35135 35134 35133 35132 35131 35130 35129 35128 35127 35126 35125 35124 35123 35122 35121 35120 35119 35118 35117 35116 35115 35114 35113 35112 35111 35110 35109 35108 35107 35106 35105 35104 35103 35102 35101 35100 35099 35098 35097 35096 35095 35094 35093 35092 35091 35090 35089 35088 35087 35086 35085 35084 35083 35082 35081 35080 35079 35078 35077 35076 35075 35074 35073 35072 35071 35070 35069 35068 35067 35066 35065 35064 35063 35062 35061 35060 35059 35058 35057 35056 35055 35054 35053 35052 35051 35050 35049 35048 35047 35046 35045 35044 35043 35042 35041 35040 35039 35038 35037 35036 35035 35034 35033 35032 35031 35030 35029 35028 35027 35026 35025 35024 35023 35022 35021 35020 35019 35018 35017 35016 35015 35014 35013 35012 35011 35010 35009 35008 35007 35006 35005 35004 35003 35002 35001 35000 34999 34998 34997 34996 34995 34994 34993 34992 34991 34990 34989 34988 34987 34986 34985 34984 34983 34982 34981 34980 34979 34978 34977 34976 34975 34974 34973 34972 34971 34970 34969 34968 34967 34966 34965 34964 34963 34962 34961 34960 34959 34958 34957 34956 34955 34954 34953 34952 34951 34950 34949 34948 34947 34946 34945 34944 34943 34942 34941 34940 34939 34938 34937 34936 34935 34934 34933 34932 34931 34930 34929 34928 34927 34926 34925 34924 34923 34922 34921 34920 34919 34918 34917 34916 34915 34914 34913 34912 34911 34910 34909 34908 34907 34906 34905 34904 34903 34902 34901 34900 34899 34898 34897 34896 34895 34894 34893 34892 34891 34890 34889 34888 34887 34886 34885 34884 34883 34882 34881 34880 34879 34878 34877 34876 34875 34874 34873 34872 34871 34870 34869 34868 34867 34866 34865 34864 34863 34862 34861 34860 34859 34858 34857 34856 34855 34854 34853 34852 34851 34850 34849 34848 34847 34846 34845 34844 34843 34842 34841 34840 34839 34838 34837 34836 34835 34834 34833 34832 34831 34830 34829 34828 34827 34826 34825 34824 34823 34822 34821 34820 34819 34818 34817 34816 34815 34814 34813 34812 34811 34810 34809 34808 34807 34806 34805 34804 34803 34802 34801 34800 34799 34798 34797 34796 34795 34794 34793 34792 34791 34790 34789 34788 34787 34786 34785 34784 34783 34782 34781 34780 34779 34778 34777 34776 34775 34774 34773 34772 34771 34770 34769 34768 34767 34766 34765 34764 34763 34762 34761 34760 34759 34758 34757 34756 34755 34754 34753 34752 34751 34750 34749 34748 34747 34746 34745 34744 34743 34742 34741 34740 34739 34738 34737 34736 34735 34734 34733 34732 34731 34730 34729 34728 34727 34726 34725 34724 34723 34722 34721 34720 34719 34718 34717 34716 34715 34714 34713 34712 34711 34710 34709 34708 34707 34706 34705 34704 34703 34702 34701 34700 34699 34698 34697 34696 34695 34694 34693 34692 34691 34690 34689 34688 34687 34686 34685 34684 34683 34682 34681 34680 34679 34678 34677 34676 34675 34674 34673 34672 34671 34670 34669 34668 34667 34666 34665 34664 34663 34662 34661 34660 34659 34658 34657 34656 34655 34654 34653 34652 34651 34650 34649 34648 34647 34646 34645 34644 34643 34642 34641 34640 34639 34638 34637 34636 34635 34634 34633 34632 34631 34630 34629 34628 34627 34626 34625 34624 34623 34622 34621 34620 34619 34618 34617 34616 34615 34614 34613 34612 34611 34610 34609 34608 34607 34606 34605 34604 34603 34602 34601 34600 34599 34598 34597 34596 34595 34594 34593 34592 34591 34590 34589 34588 34587 34586 34585 34584 34583 34582 34581 34580 34579 34578 34577 34576 34575 34574 34573 34572 34571 34570 34569 34568 34567 34566 34565 34564 34563 34562 34561 34560 34559 34558 34557 34556 34555 34554 34553 34552 34551 34550 34549 34548 34547 34546 34545 34544 34543 34542 34541 34540 34539 34538 34537 34536 34535 34534 34533 34532 34531 34530 34529 34528 34527 34526 34525 34524 34523 34522 34521 34520 34519 34518 34517 34516 34515 34514 34513 34512 34511 34510 34509 34508 34507 34506 34505 34504 34503 34502 34501 34500 34499 34498 34497 34496 34495 34494 34493 34492 34491 34490 34489 34488 34487 34486 34485 34484 34483 34482 34481 34480 34479 34478 34477 34476 34475 34474 34473 34472 34471 34470 34469 34468 34467 34466 34465 34464 34463 34462 34461 34460 34459 34458 34457 34456 34455 34454 34453 34452 34451 34450 34449 34448 34447 34446 34445 34444 34443 34442 34441 34440 34439 34438 34437 34436 34435 34434 34433 34432 34431 34430 34429 34428 34427 34426 34425 34424 34423 34422 34421 34420 34419 34418 34417 34416 34415 34414 34413 34412 34411 34410 34409 34408 34407 34406 34405 34404 34403 34402 34401 34400 34399 34398 34397 34396 34395 34394 34393 34392 34391 34390 34389 34388 34387 34386 34385 34384 34383 34382 34381 34380 34379 34378 34377 34376 34375 34374 34373 34372 34371 34370 34369 34368 34367 34366 34365 34364 34363 34362 34361 34360 34359 34358 34357 34356 34355 34354 34353 34352 34351 34350 34349 34348 34347 34346 34345 34344 34343 34342 34341 34340 34339 34338 34337 34336 34335 34334 34333 34332 34331 34330 34329 34328 34327 34326 34325 34324 34323 34322 34321 34320 34319 34318 34317 34316 34315 34314 34313 34312 34311 34310 34309 34308 34307 34306 34305 34304 34303 34302 34301 34300 34299 34298 34297 34296 34295 34294 34293 34292 34291 34290 34289 34288 34287 34286 34285 34284 34283 34282 34281 34280 34279 34278 34277 34276 34275 34274 34273 34272 34271 34270 34269 34268 34267 34266 34265 34264 34263 34262 34261 34260 34259 34258 34257 34256 34255 34254 34253 34252 34251 34250 34249 34248 34247 34246 34245 34244 34243 34242 34241 34240 34239 34238 34237 34236 34235 34234 34233 34232 34231 34230 34229 34228 34227 34226 34225 34224 34223 34222 34221 34220 34219 34218 34217 34216 34215 34214 34213 34212 34211 34210 34209 34208 34207 34206 34205 34204 34203 34202 34201 34200 34199 34198 34197 34196 34195 34194 34193 34192 34191 34190 34189 34188 34187 34186 34185 34184 34183 34182 34181 34180 34179 34178 34177 34176 34175 34174 34173 34172 34171 34170 34169 34168 34167 34166 34165 34164 34163 34162 34161 34160 34159 34158 34157 34156 34155 34154 34153 34152 34151 34150 34149 34148 34147 34146 34145 34144 34143 34142 34141 34140 34139 34138 34137 34136 34135 34134 34133 34132 34131 34130 34129 34128 34127 34126 34125 34124 34123 34122 34121 34120 34119 34118 34117 34116 34115 34114 34113 34112 34111 34110 34109 34108 34107 34106 34105 34104 34103 34102 34101 34100 34099 34098 34097 34096 34095 34094 34093 34092 34091 34090 34089 34088 34087 34086 34085 34084 34083 34082 34081 34080 34079 34078 34077 34076 34075 34074 34073 34072 34071 34070 34069 34068 34067 34066 34065 34064 34063 34062 34061 34060 34059 34058 34057 34056 34055 34054 34053 34052 34051 34050 34049 34048 34047 34046 34045 34044 34043 34042 34041 34040 34039 34038 34037 34036 34035 34034 34033 34032 34031 34030 34029 34028 34027 34026 34025 34024 34023 34022 34021 34020 34019 34018 34017 34016 34015 34014 34013 34012 34011 34010 34009 34008 34007 34006 34005 34004 34003 34002 34001 34000 33999 33998 33997 33996 33995 33994 33993 33992 33991 33990 33989 33988 33987 33986 33985 33984 33983 33982 33981 33980 33979 33978 33977 33976 33975 33974 33973 33972 33971 33970 33969 33968 33967 33966 33965 33964 33963 33962 33961 33960 33959 33958 33957 33956 33955 33954 33953 33952 33951 33950 33949 33948 33947 33946 33945 33944 33943 33942 33941 33940 33939 33938 33937 33936 33935 33934 33933 33932 33931 33930 33929 33928 33927 33926 33925 33924 33923 33922 33921 33920 33919 33918 33917 33916 33915 33914 33913 33912 33911 33910 33909 33908 33907 33906 33905 33904 33903 33902 33901 33900 33899 33898 33897 33896 33895 33894 33893 33892 33891 33890 33889 33888 33887 33886 33885 33884 33883 33882 33881 33880 33879 33878 33877 33876 33875 33874 33873 33872 33871 33870 33869 33868 33867 33866 33865 33864 33863 33862 33861 33860 33859 33858 33857 33856 33855 33854 33853 33852 33851 33850 33849 33848 33847 33846 33845 33844 33843 33842 33841 33840 33839 33838 33837 33836 33835 33834 33833 33832 33831 33830 33829 33828 33827 33826 33825 33824 33823 33822 33821 33820 33819 33818 33817 33816 33815 33814 33813 33812 33811 33810 33809 33808 33807 33806 33805 33804 33803 33802 33801 33800 33799 33798 33797 33796 33795 33794 33793 33792 33791 33790 33789 33788 33787 33786 33785 33784 33783 33782 33781 33780 33779 33778 33777 33776 33775 33774 33773 33772 33771 33770 33769 33768 33767 33766 33765 33764 33763 33762 33761 33760 33759 33758 33757 33756 33755 33754 33753 33752 33751 33750 33749 33748 33747 33746 33745 33744 33743 33742 33741 33740 33739 33738 33737 33736 33735 33734 33733 33732 33731 33730 33729 33728 33727 33726 33725 33724 33723 33722 33721 33720 33719 33718 33717 33716 33715 33714 33713 33712 33711 33710 33709 33708 33707 33706 33705 33704 33703 33702 33701 33700 33699 33698 33697 33696 33695 33694 33693 33692 33691 33690 33689 33688 33687 33686 33685 33684 33683 33682 33681 33680 33679 33678 33677 33676 33675 33674 33673 33672 33671 33670 33669 33668 33667 33666 33665 33664 33663 33662 33661 33660 33659 33658 33657 33656 33655 33654 33653 33652 33651 33650 33649 33648 33647 33646 33645 33644 33643 33642 33641 33640 33639 33638 33637 33636 33635 33634 33633 33632 33631 33630 33629 33628 33627 33626 33625 33624 33623 33622 33621 33620 33619 33618 33617 33616 33615 33614 33613 33612 33611 33610 33609 33608 33607 33606 33605 33604 33603 33602 33601 33600 33599 33598 33597 33596 33595 33594 33593 33592 33591 33590 33589 33588 33587 33586 33585 33584 33583 33582 33581 33580 33579 33578 33577 33576 33575 33574 33573 33572 33571 33570 33569 33568 33567 33566 33565 33564 33563 33562 33561 33560 33559 33558 33557 33556 33555 33554 33553 33552 33551 33550 33549 33548 33547 33546 33545 33544 33543 33542 33541 33540 33539 33538 33537 33536 33535 33534 33533 33532 33531 33530 33529 33528 33527 33526 33525 33524 33523 33522 33521 33520 33519 33518 33517 33516 33515 33514 33513 33512 33511 33510 33509 33508 33507 33506 33505 33504 33503 33502 33501 33500 33499 33498 33497 33496 33495 33494 33493 33492 33491 33490 33489 33488 33487 33486 33485 33484 33483 33482 33481 33480 33479 33478 33477 33476 33475 33474 33473 33472 33471 33470 33469 33468 33467 33466 33465 33464 33463 33462 33461 33460 33459 33458 33457 33456 33455 33454 33453 33452 33451 33450 33449 33448 33447 33446 33445 33444 33443 33442 33441 33440 33439 33438 33437 33436 33435 33434 33433 33432 33431 33430 33429 33428 33427 33426 33425 33424 33423 33422 33421 33420 33419 33418 33417 33416 33415 33414 33413 33412 33411 33410 33409 33408 33407 33406 33405 33404 33403 33402 33401 33400 33399 33398 33397 33396 33395 33394 33393 33392 33391 33390 33389 33388 33387 33386 33385 33384 33383 33382 33381 33380 33379 33378 33377 33376 33375 33374 33373 33372 33371 33370 33369 33368 33367 33366 33365 33364 33363 33362 33361 33360 33359 33358 33357 33356 33355 33354 33353 33352 33351 33350 33349 33348 33347 33346 33345 33344 33343 33342 33341 33340 33339 33338 33337 33336 33335 33334 33333 33332 33331 33330 33329 33328 33327 33326 33325 33324 33323 33322 33321 33320 33319 33318 33317 33316 33315 33314 33313 33312 33311 33310 33309 33308 33307 33306 33305 33304 33303 33302 33301 33300 33299 33298 33297 33296 33295 33294 33293 33292 33291 33290 33289 33288 33287 33286 33285 33284 33283 33282 33281 33280 33279 33278 33277 33276 33275 33274 33273 33272 33271 33270 33269 33268 33267 33266 33265 33264 33263 33262 33261 33260 33259 33258 33257 33256 33255 33254 33253 33252 33251 33250 33249 33248 33247 33246 33245 33244 33243 33242 33241 33240 33239 33238 33237 33236 33235 33234 33233 33232 33231 33230 33229 33228 33227 33226 33225 33224 33223 33222 33221 33220 33219 33218 33217 33216 33215 33214 33213 33212 33211 33210 33209 33208 33207 33206 33205 33204 33203 33202 33201 33200 33199 33198 33197 33196 33195 33194 33193 33192 33191 33190 33189 33188 33187 33186 33185 33184 33183 33182 33181 33180 33179 33178 33177 33176 33175 33174 33173 33172 33171 33170 33169 33168 33167 33166 33165 33164 33163 33162 33161 33160 33159 33158 33157 33156 33155 33154 33153 33152 33151 33150 33149 33148 33147 33146 33145 33144 33143 33142 33141 33140 33139 33138 33137 33136 33135 33134 33133 33132 33131 33130 33129 33128 33127 33126 33125 33124 33123 33122 33121 33120 33119 33118 33117 33116 33115 33114 33113 33112 33111 33110 33109 33108 33107 33106 33105 33104 33103 33102 33101 33100 33099 33098 33097 33096 33095 33094 33093 33092 33091 33090 33089 33088 33087 33086 33085 33084 33083 33082 33081 33080 33079 33078 33077 33076 33075 33074 33073 33072 33071 33070 33069 33068 33067 33066 33065 33064 33063 33062 33061 33060 33059 33058 33057 33056 33055 33054 33053 33052 33051 33050 33049 33048 33047 33046 33045 33044 33043 33042 33041 33040 33039 33038 33037 33036 33035 33034 33033 33032 33031 33030 33029 33028 33027 33026 33025 33024 33023 33022 33021 33020 33019 33018 33017 33016 33015 33014 33013 33012 33011 33010 33009 33008 33007 33006 33005 33004 33003 33002 33001 33000 32999 32998 32997 32996 32995 32994 32993 32992 32991 32990 32989 32988 32987 32986 32985 32984 32983 32982 32981 32980 32979 32978 32977 32976 32975 32974 32973 32972 32971 32970 32969 32968 32967 32966 32965 32964 32963 32962 32961 32960 32959 32958 32957 32956 32955 32954 32953 32952 32951 32950 32949 32948 32947 32946 32945 32944 32943 32942 32941 32940 32939 32938 32937 32936 32935 32934 32933 32932 32931 32930 32929 32928 32927 32926 32925 32924 32923 32922 32921 32920 32919 32918 32917 32916 32915 32914 32913 32912 32911 32910 32909 32908 32907 32906 32905 32904 32903 32902 32901 32900 32899 32898 32897 32896 32895 32894 32893 32892 32891 32890 32889 32888 32887 32886 32885 32884 32883 32882 32881 32880 32879 32878 32877 32876 32875 32874 32873 32872 32871 32870 32869 32868 32867 32866 32865 32864 32863 32862 32861 32860 32859 32858 32857 32856 32855 32854 32853 32852 32851 32850 32849 32848 32847 32846 32845 32844 32843 32842 32841 32840 32839 32838 32837 32836 32835 32834 32833 32832 32831 32830 32829 32828 32827 32826 32825 32824 32823 32822 32821 32820 32819 32818 32817 32816 32815 32814 32813 32812 32811 32810 32809 32808 32807 32806 32805 32804 32803 32802 32801 32800 32799 32798 32797 32796 32795 32794 32793 32792 32791 32790 32789 32788 32787 32786 32785 32784 32783 32782 32781 32780 32779 32778 32777 32776 32775 32774 32773 32772 32771 32770 32769 32768 32767 32766 32765 32764 32763 32762 32761 32760 32759 32758 32757 32756 32755 32754 32753 32752 32751 32750 32749 32748 32747 32746 32745 32744 32743 32742 32741 32740 32739 32738 32737 32736 32735 32734 32733 32732 32731 32730 32729 32728 32727 32726 32725 32724 32723 32722 32721 32720 32719 32718 32717 32716 32715 32714 32713 32712 32711 32710 32709 32708 32707 32706 32705 32704 32703 32702 32701 32700 32699 32698 32697 32696 32695 32694 32693 32692 32691 32690 32689 32688 32687 32686 32685 32684 32683 32682 32681 32680 32679 32678 32677 32676 32675 32674 32673 32672 32671 32670 32669 32668 32667 32666 32665 32664 32663 32662 32661 32660 32659 32658 32657 32656 32655 32654 32653 32652 32651 32650 32649 32648 32647 32646 32645 32644 32643 32642 32641 32640 32639 32638 32637 32636 32635 32634 32633 32632 32631 32630 32629 32628 32627 32626 32625 32624 32623 32622 32621 32620 32619 32618 32617 32616 32615 32614 32613 32612 32611 32610 32609 32608 32607 32606 32605 32604 32603 32602 32601 32600 32599 32598 32597 32596 32595 32594 32593 32592 32591 32590 32589 32588 32587 32586 32585 32584 32583 32582 32581 32580 32579 32578 32577 32576 32575 32574 32573 32572 32571 32570 32569 32568 32567 32566 32565 32564 32563 32562 32561 32560 32559 32558 32557 32556 32555 32554 32553 32552 32551 32550 32549 32548 32547 32546 32545 32544 32543 32542 32541 32540 32539 32538 32537 32536 32535 32534 32533 32532 32531 32530 32529 32528 32527 32526 32525 32524 32523 32522 32521 32520 32519 32518 32517 32516 32515 32514 32513 32512 32511 32510 32509 32508 32507 32506 32505 32504 32503 32502 32501 32500 32499 32498 32497 32496 32495 32494 32493 32492 32491 32490 32489 32488 32487 32486 32485 32484 32483 32482 32481 32480 32479 32478 32477 32476 32475 32474 32473 32472 32471 32470 32469 32468 32467 32466 32465 32464 32463 32462 32461 32460 32459 32458 32457 32456 32455 32454 32453 32452 32451 32450 32449 32448 32447 32446 32445 32444 32443 32442 32441 32440 32439 32438 32437 32436 32435 32434 32433 32432 32431 32430 32429 32428 32427 32426 32425 32424 32423 32422 32421 32420 32419 32418 32417 32416 32415 32414 32413 32412 32411 32410 32409 32408 32407 32406 32405 32404 32403 32402 32401 32400 32399 32398 32397 32396 32395 32394 32393 32392 32391 32390 32389 32388 32387 32386 32385 32384 32383 32382 32381 32380 32379 32378 32377 32376 32375 32374 32373 32372 32371 32370 32369 32368 32367 32366 32365 32364 32363 32362 32361 32360 32359 32358 32357 32356 32355 32354 32353 32352 32351 32350 32349 32348 32347 32346 32345 32344 32343 32342 32341 32340 32339 32338 32337 32336 32335 32334 32333 32332 32331 32330 32329 32328 32327 32326 32325 32324 32323 32322 32321 32320 32319 32318 32317 32316 32315 32314 32313 32312 32311 32310 32309 32308 32307 32306 32305 32304 32303 32302 32301 32300 32299 32298 32297 32296 32295 32294 32293 32292 32291 32290 32289 32288 32287 32286 32285 32284 32283 32282 32281 32280 32279 32278 32277 32276 32275 32274 32273 32272 32271 32270 32269 32268 32267 32266 32265 32264 32263 32262 32261 32260 32259 32258 32257 32256 32255 32254 32253 32252 32251 32250 32249 32248 32247 32246 32245 32244 32243 32242 32241 32240 32239 32238 32237 32236 32235 32234 32233 32232 32231 32230 32229 32228 32227 32226 32225 32224 32223 32222 32221 32220 32219 32218 32217 32216 32215 32214 32213 32212 32211 32210 32209 32208 32207 32206 32205 32204 32203 32202 32201 32200 32199 32198 32197 32196 32195 32194 32193 32192 32191 32190 32189 32188 32187 32186 32185 32184 32183 32182 32181 32180 32179 32178 32177 32176 32175 32174 32173 32172 32171 32170 32169 32168 32167 32166 32165 32164 32163 32162 32161 32160 32159 32158 32157 32156 32155 32154 32153 32152 32151 32150 32149 32148 32147 32146 32145 32144 32143 32142 32141 32140 32139 32138 32137 32136 32135 32134 32133 32132 32131 32130 32129 32128 32127 32126 32125 32124 32123 32122 32121 32120 32119 32118 32117 32116 32115 32114 32113 32112 32111 32110 32109 32108 32107 32106 32105 32104 32103 32102 32101 32100 32099 32098 32097 32096 32095 32094 32093 32092 32091 32090 32089 32088 32087 32086 32085 32084 32083 32082 32081 32080 32079 32078 32077 32076 32075 32074 32073 32072 32071 32070 32069 32068 32067 32066 32065 32064 32063 32062 32061 32060 32059 32058 32057 32056 32055 32054 32053 32052 32051 32050 32049 32048 32047 32046 32045 32044 32043 32042 32041 32040 32039 32038 32037 32036 32035 32034 32033 32032 32031 32030 32029 32028 32027 32026 32025 32024 32023 32022 32021 32020 32019 32018 32017 32016 32015 32014 32013 32012 32011 32010 32009 32008 32007 32006 32005 32004 32003 32002 32001 32000 31999 31998 31997 31996 31995 31994 31993 31992 31991 31990 31989 31988 31987 31986 31985 31984 31983 31982 31981 31980 31979 31978 31977 31976 31975 31974 31973 31972 31971 31970 31969 31968 31967 31966 31965 31964 31963 31962 31961 31960 31959 31958 31957 31956 31955 31954 31953 31952 31951 31950 31949 31948 31947 31946 31945 31944 31943 31942 31941 31940 31939 31938 31937 31936 31935 31934 31933 31932 31931 31930 31929 31928 31927 31926 31925 31924 31923 31922 31921 31920 31919 31918 31917 31916 31915 31914 31913 31912 31911 31910 31909 31908 31907 31906 31905 31904 31903 31902 31901 31900 31899 31898 31897 31896 31895 31894 31893 31892 31891 31890 31889 31888 31887 31886 31885 31884 31883 31882 31881 31880 31879 31878 31877 31876 31875 31874 31873 31872 31871 31870 31869 31868 31867 31866 31865 31864 31863 31862 31861 31860 31859 31858 31857 31856 31855 31854 31853 31852 31851 31850 31849 31848 31847 31846 31845 31844 31843 31842 31841 31840 31839 31838 31837 31836 31835 31834 31833 31832 31831 31830 31829 31828 31827 31826 31825 31824 31823 31822 31821 31820 31819 31818 31817 31816 31815 31814 31813 31812 31811 31810 31809 31808 31807 31806 31805 31804 31803 31802 31801 31800 31799 31798 31797 31796 31795 31794 31793 31792 31791 31790 31789 31788 31787 31786 31785 31784 31783 31782 31781 31780 31779 31778 31777 31776 31775 31774 31773 31772 31771 31770 31769 31768 31767 31766 31765 31764 31763 31762 31761 31760 31759 31758 31757 31756 31755 31754 31753 31752 31751 31750 31749 31748 31747 31746 31745 31744 31743 31742 31741 31740 31739 31738 31737 31736 31735 31734 31733 31732 31731 31730 31729 31728 31727 31726 31725 31724 31723 31722 31721 31720 31719 31718 31717 31716 31715 31714 31713 31712 31711 31710 31709 31708 31707 31706 31705 31704 31703 31702 31701 31700 31699 31698 31697 31696 31695 31694 31693 31692 31691 31690 31689 31688 31687 31686 31685 31684 31683 31682 31681 31680 31679 31678 31677 31676 31675 31674 31673 31672 31671 31670 31669 31668 31667 31666 31665 31664 31663 31662 31661 31660 31659 31658 31657 31656 31655 31654 31653 31652 31651 31650 31649 31648 31647 31646 31645 31644 31643 31642 31641 31640 31639 31638 31637 31636 31635 31634 31633 31632 31631 31630 31629 31628 31627 31626 31625 31624 31623 31622 31621 31620 31619 31618 31617 31616 31615 31614 31613 31612 31611 31610 31609 31608 31607 31606 31605 31604 31603 31602 31601 31600 31599 31598 31597 31596 31595 31594 31593 31592 31591 31590 31589 31588 31587 31586 31585 31584 31583 31582 31581 31580 31579 31578 31577 31576 31575 31574 31573 31572 31571 31570 31569 31568 31567 31566 31565 31564 31563 31562 31561 31560 31559 31558 31557 31556 31555 31554 31553 31552 31551 31550 31549 31548 31547 31546 31545 31544 31543 31542 31541 31540 31539 31538 31537 31536 31535 31534 31533 31532 31531 31530 31529 31528 31527 31526 31525 31524 31523 31522 31521 31520 31519 31518 31517 31516 31515 31514 31513 31512 31511 31510 31509 31508 31507 31506 31505 31504 31503 31502 31501 31500 31499 31498 31497 31496 31495 31494 31493 31492 31491 31490 31489 31488 31487 31486 31485 31484 31483 31482 31481 31480 31479 31478 31477 31476 31475 31474 31473 31472 31471 31470 31469 31468 31467 31466 31465 31464 31463 31462 31461 31460 31459 31458 31457 31456 31455 31454 31453 31452 31451 31450 31449 31448 31447 31446 31445 31444 31443 31442 31441 31440 31439 31438 31437 31436 31435 31434 31433 31432 31431 31430 31429 31428 31427 31426 31425 31424 31423 31422 31421 31420 31419 31418 31417 31416 31415 31414 31413 31412 31411 31410 31409 31408 31407 31406 31405 31404 31403 31402 31401 31400 31399 31398 31397 31396 31395 31394 31393 31392 31391 31390 31389 31388 31387 31386 31385 31384 31383 31382 31381 31380 31379 31378 31377 31376 31375 31374 31373 31372 31371 31370 31369 31368 31367 31366 31365 31364 31363 31362 31361 31360 31359 31358 31357 31356 31355 31354 31353 31352 31351 31350 31349 31348 31347 31346 31345 31344 31343 31342 31341 31340 31339 31338 31337 31336 31335 31334 31333 31332 31331 31330 31329 31328 31327 31326 31325 31324 31323 31322 31321 31320 31319 31318 31317 31316 31315 31314 31313 31312 31311 31310 31309 31308 31307 31306 31305 31304 31303 31302 31301 31300 31299 31298 31297 31296 31295 31294 31293 31292 31291 31290 31289 31288 31287 31286 31285 31284 31283 31282 31281 31280 31279 31278 31277 31276 31275 31274 31273 31272 31271 31270 31269 31268 31267 31266 31265 31264 31263 31262 31261 31260 31259 31258 31257 31256 31255 31254 31253 31252 31251 31250 31249 31248 31247 31246 31245 31244 31243 31242 31241 31240 31239 31238 31237 31236 31235 31234 31233 31232 31231 31230 31229 31228 31227 31226 31225 31224 31223 31222 31221 31220 31219 31218 31217 31216 31215 31214 31213 31212 31211 31210 31209 31208 31207 31206 31205 31204 31203 31202 31201 31200 31199 31198 31197 31196 31195 31194 31193 31192 31191 31190 31189 31188 31187 31186 31185 31184 31183 31182 31181 31180 31179 31178 31177 31176 31175 31174 31173 31172 31171 31170 31169 31168 31167 31166 31165 31164 31163 31162 31161 31160 31159 31158 31157 31156 31155 31154 31153 31152 31151 31150 31149 31148 31147 31146 31145 31144 31143 31142 31141 31140 31139 31138 31137 31136 31135 31134 31133 31132 31131 31130 31129 31128 31127 31126 31125 31124 31123 31122 31121 31120 31119 31118 31117 31116 31115 31114 31113 31112 31111 31110 31109 31108 31107 31106 31105 31104 31103 31102 31101 31100 31099 31098 31097 31096 31095 31094 31093 31092 31091 31090 31089 31088 31087 31086 31085 31084 31083 31082 31081 31080 31079 31078 31077 31076 31075 31074 31073 31072 31071 31070 31069 31068 31067 31066 31065 31064 31063 31062 31061 31060 31059 31058 31057 31056 31055 31054 31053 31052 31051 31050 31049 31048 31047 31046 31045 31044 31043 31042 31041 31040 31039 31038 31037 31036 31035 31034 31033 31032 31031 31030 31029 31028 31027 31026 31025 31024 31023 31022 31021 31020 31019 31018 31017 31016 31015 31014 31013 31012 31011 31010 31009 31008 31007 31006 31005 31004 31003 31002 31001 31000 30999 30998 30997 30996 30995 30994 30993 30992 30991 30990 30989 30988 30987 30986 30985 30984 30983 30982 30981 30980 30979 30978 30977 30976 30975 30974 30973 30972 30971 30970 30969 30968 30967 30966 30965 30964 30963 30962 30961 30960 30959 30958 30957 30956 30955 30954 30953 30952 30951 30950 30949 30948 30947 30946 30945 30944 30943 30942 30941 30940 30939 30938 30937 30936 30935 30934 30933 30932 30931 30930 30929 30928 30927 30926 30925 30924 30923 30922 30921 30920 30919 30918 30917 30916 30915 30914 30913 30912 30911 30910 30909 30908 30907 30906 30905 30904 30903 30902 30901 30900 30899 30898 30897 30896 30895 30894 30893 30892 30891 30890 30889 30888 30887 30886 30885 30884 30883 30882 30881 30880 30879 30878 30877 30876 30875 30874 30873 30872 30871 30870 30869 30868 30867 30866 30865 30864 30863 30862 30861 30860 30859 30858 30857 30856 30855 30854 30853 30852 30851 30850 30849 30848 30847 30846 30845 30844 30843 30842 30841 30840 30839 30838 30837 30836 30835 30834 30833 30832 30831 30830 30829 30828 30827 30826 30825 30824 30823 30822 30821 30820 30819 30818 30817 30816 30815 30814 30813 30812 30811 30810 30809 30808 30807 30806 30805 30804 30803 30802 30801 30800 30799 30798 30797 30796 30795 30794 30793 30792 30791 30790 30789 30788 30787 30786 30785 30784 30783 30782 30781 30780 30779 30778 30777 30776 30775 30774 30773 30772 30771 30770 30769 30768 30767 30766 30765 30764 30763 30762 30761 30760 30759 30758 30757 30756 30755 30754 30753 30752 30751 30750 30749 30748 30747 30746 30745 30744 30743 30742 30741 30740 30739 30738 30737 30736 30735 30734 30733 30732 30731 30730 30729 30728 30727 30726 30725 30724 30723 30722 30721 30720 30719 30718 30717 30716 30715 30714 30713 30712 30711 30710 30709 30708 30707 30706 30705 30704 30703 30702 30701 30700 30699 30698 30697 30696 30695 30694 30693 30692 30691 30690 30689 30688 30687 30686 30685 30684 30683 30682 30681 30680 30679 30678 30677 30676 30675 30674 30673 30672 30671 30670 30669 30668 30667 30666 30665 30664 30663 30662 30661 30660 30659 30658 30657 30656 30655 30654 30653 30652 30651 30650 30649 30648 30647 30646 30645 30644 30643 30642 30641 30640 30639 30638 30637 30636 30635 30634 30633 30632 30631 30630 30629 30628 30627 30626 30625 30624 30623 30622 30621 30620 30619 30618 30617 30616 30615 30614 30613 30612 30611 30610 30609 30608 30607 30606 30605 30604 30603 30602 30601 30600 30599 30598 30597 30596 30595 30594 30593 30592 30591 30590 30589 30588 30587 30586 30585 30584 30583 30582 30581 30580 30579 30578 30577 30576 30575 30574 30573 30572 30571 30570 30569 30568 30567 30566 30565 30564 30563 30562 30561 30560 30559 30558 30557 30556 30555 30554 30553 30552 30551 30550 30549 30548 30547 30546 30545 30544 30543 30542 30541 30540 30539 30538 30537 30536 30535 30534 30533 30532 30531 30530 30529 30528 30527 30526 30525 30524 30523 30522 30521 30520 30519 30518 30517 30516 30515 30514 30513 30512 30511 30510 30509 30508 30507 30506 30505 30504 30503 30502 30501 30500 30499 30498 30497 30496 30495 30494 30493 30492 30491 30490 30489 30488 30487 30486 30485 30484 30483 30482 30481 30480 30479 30478 30477 30476 30475 30474 30473 30472 30471 30470 30469 30468 30467 30466 30465 30464 30463 30462 30461 30460 30459 30458 30457 30456 30455 30454 30453 30452 30451 30450 30449 30448 30447 30446 30445 30444 30443 30442 30441 30440 30439 30438 30437 30436 30435 30434 30433 30432 30431 30430 30429 30428 30427 30426 30425 30424 30423 30422 30421 30420 30419 30418 30417 30416 30415 30414 30413 30412 30411 30410 30409 30408 30407 30406 30405 30404 30403 30402 30401 30400 30399 30398 30397 30396 30395 30394 30393 30392 30391 30390 30389 30388 30387 30386 30385 30384 30383 30382 30381 30380 30379 30378 30377 30376 30375 30374 30373 30372 30371 30370 30369 30368 30367 30366 30365 30364 30363 30362 30361 30360 30359 30358 30357 30356 30355 30354 30353 30352 30351 30350 30349 30348 30347 30346 30345 30344 30343 30342 30341 30340 30339 30338 30337 30336 30335 30334 30333 30332 30331 30330 30329 30328 30327 30326 30325 30324 30323 30322 30321 30320 30319 30318 30317 30316 30315 30314 30313 30312 30311 30310 30309 30308 30307 30306 30305 30304 30303 30302 30301 30300 30299 30298 30297 30296 30295 30294 30293 30292 30291 30290 30289 30288 30287 30286 30285 30284 30283 30282 30281 30280 30279 30278 30277 30276 30275 30274 30273 30272 30271 30270 30269 30268 30267 30266 30265 30264 30263 30262 30261 30260 30259 30258 30257 30256 30255 30254 30253 30252 30251 30250 30249 30248 30247 30246 30245 30244 30243 30242 30241 30240 30239 30238 30237 30236 30235 30234 30233 30232 30231 30230 30229 30228 30227 30226 30225 30224 30223 30222 30221 30220 30219 30218 30217 30216 30215 30214 30213 30212 30211 30210 30209 30208 30207 30206 30205 30204 30203 30202 30201 30200 30199 30198 30197 30196 30195 30194 30193 30192 30191 30190 30189 30188 30187 30186 30185 30184 30183 30182 30181 30180 30179 30178 30177 30176 30175 30174 30173 30172 30171 30170 30169 30168 30167 30166 30165 30164 30163 30162 30161 30160 30159 30158 30157 30156 30155 30154 30153 30152 30151 30150 30149 30148 30147 30146 30145 30144 30143 30142 30141 30140 30139 30138 30137 30136 30135 30134 30133 30132 30131 30130 30129 30128 30127 30126 30125 30124 30123 30122 30121 30120 30119 30118 30117 30116 30115 30114 30113 30112 30111 30110 30109 30108 30107 30106 30105 30104 30103 30102 30101 30100 30099 30098 30097 30096 30095 30094 30093 30092 30091 30090 30089 30088 30087 30086 30085 30084 30083 30082 30081 30080 30079 30078 30077 30076 30075 30074 30073 30072 30071 30070 30069 30068 30067 30066 30065 30064 30063 30062 30061 30060 30059 30058 30057 30056 30055 30054 30053 30052 30051 30050 30049 30048 30047 30046 30045 30044 30043 30042 30041 30040 30039 30038 30037 30036 30035 30034 30033 30032 30031 30030 30029 30028 30027 30026 30025 30024 30023 30022 30021 30020 30019 30018 30017 30016 30015 30014 30013 30012 30011 30010 30009 30008 30007 30006 30005 30004 30003 30002 30001 30000 29999 29998 29997 29996 29995 29994 29993 29992 29991 29990 29989 29988 29987 29986 29985 29984 29983 29982 29981 29980 29979 29978 29977 29976 29975 29974 29973 29972 29971 29970 29969 29968 29967 29966 29965 29964 29963 29962 29961 29960 29959 29958 29957 29956 29955 29954 29953 29952 29951 29950 29949 29948 29947 29946 29945 29944 29943 29942 29941 29940 29939 29938 29937 29936 29935 29934 29933 29932 29931 29930 29929 29928 29927 29926 29925 29924 29923 29922 29921 29920 29919 29918 29917 29916 29915 29914 29913 29912 29911 29910 29909 29908 29907 29906 29905 29904 29903 29902 29901 29900 29899 29898 29897 29896 29895 29894 29893 29892 29891 29890 29889 29888 29887 29886 29885 29884 29883 29882 29881 29880 29879 29878 29877 29876 29875 29874 29873 29872 29871 29870 29869 29868 29867 29866 29865 29864 29863 29862 29861 29860 29859 29858 29857 29856 29855 29854 29853 29852 29851 29850 29849 29848 29847 29846 29845 29844 29843 29842 29841 29840 29839 29838 29837 29836 29835 29834 29833 29832 29831 29830 29829 29828 29827 29826 29825 29824 29823 29822 29821 29820 29819 29818 29817 29816 29815 29814 29813 29812 29811 29810 29809 29808 29807 29806 29805 29804 29803 29802 29801 29800 29799 29798 29797 29796 29795 29794 29793 29792 29791 29790 29789 29788 29787 29786 29785 29784 29783 29782 29781 29780 29779 29778 29777 29776 29775 29774 29773 29772 29771 29770 29769 29768 29767 29766 29765 29764 29763 29762 29761 29760 29759 29758 29757 29756 29755 29754 29753 29752 29751 29750 29749 29748 29747 29746 29745 29744 29743 29742 29741 29740 29739 29738 29737 29736 29735 29734 29733 29732 29731 29730 29729 29728 29727 29726 29725 29724 29723 29722 29721 29720 29719 29718 29717 29716 29715 29714 29713 29712 29711 29710 29709 29708 29707 29706 29705 29704 29703 29702 29701 29700 29699 29698 29697 29696 29695 29694 29693 29692 29691 29690 29689 29688 29687 29686 29685 29684 29683 29682 29681 29680 29679 29678 29677 29676 29675 29674 29673 29672 29671 29670 29669 29668 29667 29666 29665 29664 29663 29662 29661 29660 29659 29658 29657 29656 29655 29654 29653 29652 29651 29650 29649 29648 29647 29646 29645 29644 29643 29642 29641 29640 29639 29638 29637 29636 29635 29634 29633 29632 29631 29630 29629 29628 29627 29626 29625 29624 29623 29622 29621 29620 29619 29618 29617 29616 29615 29614 29613 29612 29611 29610 29609 29608 29607 29606 29605 29604 29603 29602 29601 29600 29599 29598 29597 29596 29595 29594 29593 29592 29591 29590 29589 29588 29587 29586 29585 29584 29583 29582 29581 29580 29579 29578 29577 29576 29575 29574 29573 29572 29571 29570 29569 29568 29567 29566 29565 29564 29563 29562 29561 29560 29559 29558 29557 29556 29555 29554 29553 29552 29551 29550 29549 29548 29547 29546 29545 29544 29543 29542 29541 29540 29539 29538 29537 29536 29535 29534 29533 29532 29531 29530 29529 29528 29527 29526 29525 29524 29523 29522 29521 29520 29519 29518 29517 29516 29515 29514 29513 29512 29511 29510 29509 29508 29507 29506 29505 29504 29503 29502 29501 29500 29499 29498 29497 29496 29495 29494 29493 29492 29491 29490 29489 29488 29487 29486 29485 29484 29483 29482 29481 29480 29479 29478 29477 29476 29475 29474 29473 29472 29471 29470 29469 29468 29467 29466 29465 29464 29463 29462 29461 29460 29459 29458 29457 29456 29455 29454 29453 29452 29451 29450 29449 29448 29447 29446 29445 29444 29443 29442 29441 29440 29439 29438 29437 29436 29435 29434 29433 29432 29431 29430 29429 29428 29427 29426 29425 29424 29423 29422 29421 29420 29419 29418 29417 29416 29415 29414 29413 29412 29411 29410 29409 29408 29407 29406 29405 29404 29403 29402 29401 29400 29399 29398 29397 29396 29395 29394 29393 29392 29391 29390 29389 29388 29387 29386 29385 29384 29383 29382 29381 29380 29379 29378 29377 29376 29375 29374 29373 29372 29371 29370 29369 29368 29367 29366 29365 29364 29363 29362 29361 29360 29359 29358 29357 29356 29355 29354 29353 29352 29351 29350 29349 29348 29347 29346 29345 29344 29343 29342 29341 29340 29339 29338 29337 29336 29335 29334 29333 29332 29331 29330 29329 29328 29327 29326 29325 29324 29323 29322 29321 29320 29319 29318 29317 29316 29315 29314 29313 29312 29311 29310 29309 29308 29307 29306 29305 29304 29303 29302 29301 29300 29299 29298 29297 29296 29295 29294 29293 29292 29291 29290 29289 29288 29287 29286 29285 29284 29283 29282 29281 29280 29279 29278 29277 29276 29275 29274 29273 29272 29271 29270 29269 29268 29267 29266 29265 29264 29263 29262 29261 29260 29259 29258 29257 29256 29255 29254 29253 29252 29251 29250 29249 29248 29247 29246 29245 29244 29243 29242 29241 29240 29239 29238 29237 29236 29235 29234 29233 29232 29231 29230 29229 29228 29227 29226 29225 29224 29223 29222 29221 29220 29219 29218 29217 29216 29215 29214 29213 29212 29211 29210 29209 29208 29207 29206 29205 29204 29203 29202 29201 29200 29199 29198 29197 29196 29195 29194 29193 29192 29191 29190 29189 29188 29187 29186 29185 29184 29183 29182 29181 29180 29179 29178 29177 29176 29175 29174 29173 29172 29171 29170 29169 29168 29167 29166 29165 29164 29163 29162 29161 29160 29159 29158 29157 29156 29155 29154 29153 29152 29151 29150 29149 29148 29147 29146 29145 29144 29143 29142 29141 29140 29139 29138 29137 29136 29135 29134 29133 29132 29131 29130 29129 29128 29127 29126 29125 29124 29123 29122 29121 29120 29119 29118 29117 29116 29115 29114 29113 29112 29111 29110 29109 29108 29107 29106 29105 29104 29103 29102 29101 29100 29099 29098 29097 29096 29095 29094 29093 29092 29091 29090 29089 29088 29087 29086 29085 29084 29083 29082 29081 29080 29079 29078 29077 29076 29075 29074 29073 29072 29071 29070 29069 29068 29067 29066 29065 29064 29063 29062 29061 29060 29059 29058 29057 29056 29055 29054 29053 29052 29051 29050 29049 29048 29047 29046 29045 29044 29043 29042 29041 29040 29039 29038 29037 29036 29035 29034 29033 29032 29031 29030 29029 29028 29027 29026 29025 29024 29023 29022 29021 29020 29019 29018 29017 29016 29015 29014 29013 29012 29011 29010 29009 29008 29007 29006 29005 29004 29003 29002 29001 29000 28999 28998 28997 28996 28995 28994 28993 28992 28991 28990 28989 28988 28987 28986 28985 28984 28983 28982 28981 28980 28979 28978 28977 28976 28975 28974 28973 28972 28971 28970 28969 28968 28967 28966 28965 28964 28963 28962 28961 28960 28959 28958 28957 28956 28955 28954 28953 28952 28951 28950 28949 28948 28947 28946 28945 28944 28943 28942 28941 28940 28939 28938 28937 28936 28935 28934 28933 28932 28931 28930 28929 28928 28927 28926 28925 28924 28923 28922 28921 28920 28919 28918 28917 28916 28915 28914 28913 28912 28911 28910 28909 28908 28907 28906 28905 28904 28903 28902 28901 28900 28899 28898 28897 28896 28895 28894 28893 28892 28891 28890 28889 28888 28887 28886 28885 28884 28883 28882 28881 28880 28879 28878 28877 28876 28875 28874 28873 28872 28871 28870 28869 28868 28867 28866 28865 28864 28863 28862 28861 28860 28859 28858 28857 28856 28855 28854 28853 28852 28851 28850 28849 28848 28847 28846 28845 28844 28843 28842 28841 28840 28839 28838 28837 28836 28835 28834 28833 28832 28831 28830 28829 28828 28827 28826 28825 28824 28823 28822 28821 28820 28819 28818 28817 28816 28815 28814 28813 28812 28811 28810 28809 28808 28807 28806 28805 28804 28803 28802 28801 28800 28799 28798 28797 28796 28795 28794 28793 28792 28791 28790 28789 28788 28787 28786 28785 28784 28783 28782 28781 28780 28779 28778 28777 28776 28775 28774 28773 28772 28771 28770 28769 28768 28767 28766 28765 28764 28763 28762 28761 28760 28759 28758 28757 28756 28755 28754 28753 28752 28751 28750 28749 28748 28747 28746 28745 28744 28743 28742 28741 28740 28739 28738 28737 28736 28735 28734 28733 28732 28731 28730 28729 28728 28727 28726 28725 28724 28723 28722 28721 28720 28719 28718 28717 28716 28715 28714 28713 28712 28711 28710 28709 28708 28707 28706 28705 28704 28703 28702 28701 28700 28699 28698 28697 28696 28695 28694 28693 28692 28691 28690 28689 28688 28687 28686 28685 28684 28683 28682 28681 28680 28679 28678 28677 28676 28675 28674 28673 28672 28671 28670 28669 28668 28667 28666 28665 28664 28663 28662 28661 28660 28659 28658 28657 28656 28655 28654 28653 28652 28651 28650 28649 28648 28647 28646 28645 28644 28643 28642 28641 28640 28639 28638 28637 28636 28635 28634 28633 28632 28631 28630 28629 28628 28627 28626 28625 28624 28623 28622 28621 28620 28619 28618 28617 28616 28615 28614 28613 28612 28611 28610 28609 28608 28607 28606 28605 28604 28603 28602 28601 28600 28599 28598 28597 28596 28595 28594 28593 28592 28591 28590 28589 28588 28587 28586 28585 28584 28583 28582 28581 28580 28579 28578 28577 28576 28575 28574 28573 28572 28571 28570 28569 28568 28567 28566 28565 28564 28563 28562 28561 28560 28559 28558 28557 28556 28555 28554 28553 28552 28551 28550 28549 28548 28547 28546 28545 28544 28543 28542 28541 28540 28539 28538 28537 28536 28535 28534 28533 28532 28531 28530 28529 28528 28527 28526 28525 28524 28523 28522 28521 28520 28519 28518 28517 28516 28515 28514 28513 28512 28511 28510 28509 28508 28507 28506 28505 28504 28503 28502 28501 28500 28499 28498 28497 28496 28495 28494 28493 28492 28491 28490 28489 28488 28487 28486 28485 28484 28483 28482 28481 28480 28479 28478 28477 28476 28475 28474 28473 28472 28471 28470 28469 28468 28467 28466 28465 28464 28463 28462 28461 28460 28459 28458 28457 28456 28455 28454 28453 28452 28451 28450 28449 28448 28447 28446 28445 28444 28443 28442 28441 28440 28439 28438 28437 28436 28435 28434 28433 28432 28431 28430 28429 28428 28427 28426 28425 28424 28423 28422 28421 28420 28419 28418 28417 28416 28415 28414 28413 28412 28411 28410 28409 28408 28407 28406 28405 28404 28403 28402 28401 28400 28399 28398 28397 28396 28395 28394 28393 28392 28391 28390 28389 28388 28387 28386 28385 28384 28383 28382 28381 28380 28379 28378 28377 28376 28375 28374 28373 28372 28371 28370 28369 28368 28367 28366 28365 28364 28363 28362 28361 28360 28359 28358 28357 28356 28355 28354 28353 28352 28351 28350 28349 28348 28347 28346 28345 28344 28343 28342 28341 28340 28339 28338 28337 28336 28335 28334 28333 28332 28331 28330 28329 28328 28327 28326 28325 28324 28323 28322 28321 28320 28319 28318 28317 28316 28315 28314 28313 28312 28311 28310 28309 28308 28307 28306 28305 28304 28303 28302 28301 28300 28299 28298 28297 28296 28295 28294 28293 28292 28291 28290 28289 28288 28287 28286 28285 28284 28283 28282 28281 28280 28279 28278 28277 28276 28275 28274 28273 28272 28271 28270 28269 28268 28267 28266 28265 28264 28263 28262 28261 28260 28259 28258 28257 28256 28255 28254 28253 28252 28251 28250 28249 28248 28247 28246 28245 28244 28243 28242 28241 28240 28239 28238 28237 28236 28235 28234 28233 28232 28231 28230 28229 28228 28227 28226 28225 28224 28223 28222 28221 28220 28219 28218 28217 28216 28215 28214 28213 28212 28211 28210 28209 28208 28207 28206 28205 28204 28203 28202 28201 28200 28199 28198 28197 28196 28195 28194 28193 28192 28191 28190 28189 28188 28187 28186 28185 28184 28183 28182 28181 28180 28179 28178 28177 28176 28175 28174 28173 28172 28171 28170 28169 28168 28167 28166 28165 28164 28163 28162 28161 28160 28159 28158 28157 28156 28155 28154 28153 28152 28151 28150 28149 28148 28147 28146 28145 28144 28143 28142 28141 28140 28139 28138 28137 28136 28135 28134 28133 28132 28131 28130 28129 28128 28127 28126 28125 28124 28123 28122 28121 28120 28119 28118 28117 28116 28115 28114 28113 28112 28111 28110 28109 28108 28107 28106 28105 28104 28103 28102 28101 28100 28099 28098 28097 28096 28095 28094 28093 28092 28091 28090 28089 28088 28087 28086 28085 28084 28083 28082 28081 28080 28079 28078 28077 28076 28075 28074 28073 28072 28071 28070 28069 28068 28067 28066 28065 28064 28063 28062 28061 28060 28059 28058 28057 28056 28055 28054 28053 28052 28051 28050 28049 28048 28047 28046 28045 28044 28043 28042 28041 28040 28039 28038 28037 28036 28035 28034 28033 28032 28031 28030 28029 28028 28027 28026 28025 28024 28023 28022 28021 28020 28019 28018 28017 28016 28015 28014 28013 28012 28011 28010 28009 28008 28007 28006 28005 28004 28003 28002 28001 28000 27999 27998 27997 27996 27995 27994 27993 27992 27991 27990 27989 27988 27987 27986 27985 27984 27983 27982 27981 27980 27979 27978 27977 27976 27975 27974 27973 27972 27971 27970 27969 27968 27967 27966 27965 27964 27963 27962 27961 27960 27959 27958 27957 27956 27955 27954 27953 27952 27951 27950 27949 27948 27947 27946 27945 27944 27943 27942 27941 27940 27939 27938 27937 27936 27935 27934 27933 27932 27931 27930 27929 27928 27927 27926 27925 27924 27923 27922 27921 27920 27919 27918 27917 27916 27915 27914 27913 27912 27911 27910 27909 27908 27907 27906 27905 27904 27903 27902 27901 27900 27899 27898 27897 27896 27895 27894 27893 27892 27891 27890 27889 27888 27887 27886 27885 27884 27883 27882 27881 27880 27879 27878 27877 27876 27875 27874 27873 27872 27871 27870 27869 27868 27867 27866 27865 27864 27863 27862 27861 27860 27859 27858 27857 27856 27855 27854 27853 27852 27851 27850 27849 27848 27847 27846 27845 27844 27843 27842 27841 27840 27839 27838 27837 27836 27835 27834 27833 27832 27831 27830 27829 27828 27827 27826 27825 27824 27823 27822 27821 27820 27819 27818 27817 27816 27815 27814 27813 27812 27811 27810 27809 27808 27807 27806 27805 27804 27803 27802 27801 27800 27799 27798 27797 27796 27795 27794 27793 27792 27791 27790 27789 27788 27787 27786 27785 27784 27783 27782 27781 27780 27779 27778 27777 27776 27775 27774 27773 27772 27771 27770 27769 27768 27767 27766 27765 27764 27763 27762 27761 27760 27759 27758 27757 27756 27755 27754 27753 27752 27751 27750 27749 27748 27747 27746 27745 27744 27743 27742 27741 27740 27739 27738 27737 27736 27735 27734 27733 27732 27731 27730 27729 27728 27727 27726 27725 27724 27723 27722 27721 27720 27719 27718 27717 27716 27715 27714 27713 27712 27711 27710 27709 27708 27707 27706 27705 27704 27703 27702 27701 27700 27699 27698 27697 27696 27695 27694 27693 27692 27691 27690 27689 27688 27687 27686 27685 27684 27683 27682 27681 27680 27679 27678 27677 27676 27675 27674 27673 27672 27671 27670 27669 27668 27667 27666 27665 27664 27663 27662 27661 27660 27659 27658 27657 27656 27655 27654 27653 27652 27651 27650 27649 27648 27647 27646 27645 27644 27643 27642 27641 27640 27639 27638 27637 27636 27635 27634 27633 27632 27631 27630 27629 27628 27627 27626 27625 27624 27623 27622 27621 27620 27619 27618 27617 27616 27615 27614 27613 27612 27611 27610 27609 27608 27607 27606 27605 27604 27603 27602 27601 27600 27599 27598 27597 27596 27595 27594 27593 27592 27591 27590 27589 27588 27587 27586 27585 27584 27583 27582 27581 27580 27579 27578 27577 27576 27575 27574 27573 27572 27571 27570 27569 27568 27567 27566 27565 27564 27563 27562 27561 27560 27559 27558 27557 27556 27555 27554 27553 27552 27551 27550 27549 27548 27547 27546 27545 27544 27543 27542 27541 27540 27539 27538 27537 27536 27535 27534 27533 27532 27531 27530 27529 27528 27527 27526 27525 27524 27523 27522 27521 27520 27519 27518 27517 27516 27515 27514 27513 27512 27511 27510 27509 27508 27507 27506 27505 27504 27503 27502 27501 27500 27499 27498 27497 27496 27495 27494 27493 27492 27491 27490 27489 27488 27487 27486 27485 27484 27483 27482 27481 27480 27479 27478 27477 27476 27475 27474 27473 27472 27471 27470 27469 27468 27467 27466 27465 27464 27463 27462 27461 27460 27459 27458 27457 27456 27455 27454 27453 27452 27451 27450 27449 27448 27447 27446 27445 27444 27443 27442 27441 27440 27439 27438 27437 27436 27435 27434 27433 27432 27431 27430 27429 27428 27427 27426 27425 27424 27423 27422 27421 27420 27419 27418 27417 27416 27415 27414 27413 27412 27411 27410 27409 27408 27407 27406 27405 27404 27403 27402 27401 27400 27399 27398 27397 27396 27395 27394 27393 27392 27391 27390 27389 27388 27387 27386 27385 27384 27383 27382 27381 27380 27379 27378 27377 27376 27375 27374 27373 27372 27371 27370 27369 27368 27367 27366 27365 27364 27363 27362 27361 27360 27359 27358 27357 27356 27355 27354 27353 27352 27351 27350 27349 27348 27347 27346 27345 27344 27343 27342 27341 27340 27339 27338 27337 27336 27335 27334 27333 27332 27331 27330 27329 27328 27327 27326 27325 27324 27323 27322 27321 27320 27319 27318 27317 27316 27315 27314 27313 27312 27311 27310 27309 27308 27307 27306 27305 27304 27303 27302 27301 27300 27299 27298 27297 27296 27295 27294 27293 27292 27291 27290 27289 27288 27287 27286 27285 27284 27283 27282 27281 27280 27279 27278 27277 27276 27275 27274 27273 27272 27271 27270 27269 27268 27267 27266 27265 27264 27263 27262 27261 27260 27259 27258 27257 27256 27255 27254 27253 27252 27251 27250 27249 27248 27247 27246 27245 27244 27243 27242 27241 27240 27239 27238 27237 27236 27235 27234 27233 27232 27231 27230 27229 27228 27227 27226 27225 27224 27223 27222 27221 27220 27219 27218 27217 27216 27215 27214 27213 27212 27211 27210 27209 27208 27207 27206 27205 27204 27203 27202 27201 27200 27199 27198 27197 27196 27195 27194 27193 27192 27191 27190 27189 27188 27187 27186 27185 27184 27183 27182 27181 27180 27179 27178 27177 27176 27175 27174 27173 27172 27171 27170 27169 27168 27167 27166 27165 27164 27163 27162 27161 27160 27159 27158 27157 27156 27155 27154 27153 27152 27151 27150 27149 27148 27147 27146 27145 27144 27143 27142 27141 27140 27139 27138 27137 27136 27135 27134 27133 27132 27131 27130 27129 27128 27127 27126 27125 27124 27123 27122 27121 27120 27119 27118 27117 27116 27115 27114 27113 27112 27111 27110 27109 27108 27107 27106 27105 27104 27103 27102 27101 27100 27099 27098 27097 27096 27095 27094 27093 27092 27091 27090 27089 27088 27087 27086 27085 27084 27083 27082 27081 27080 27079 27078 27077 27076 27075 27074 27073 27072 27071 27070 27069 27068 27067 27066 27065 27064 27063 27062 27061 27060 27059 27058 27057 27056 27055 27054 27053 27052 27051 27050 27049 27048 27047 27046 27045 27044 27043 27042 27041 27040 27039 27038 27037 27036 27035 27034 27033 27032 27031 27030 27029 27028 27027 27026 27025 27024 27023 27022 27021 27020 27019 27018 27017 27016 27015 27014 27013 27012 27011 27010 27009 27008 27007 27006 27005 27004 27003 27002 27001 27000 26999 26998 26997 26996 26995 26994 26993 26992 26991 26990 26989 26988 26987 26986 26985 26984 26983 26982 26981 26980 26979 26978 26977 26976 26975 26974 26973 26972 26971 26970 26969 26968 26967 26966 26965 26964 26963 26962 26961 26960 26959 26958 26957 26956 26955 26954 26953 26952 26951 26950 26949 26948 26947 26946 26945 26944 26943 26942 26941 26940 26939 26938 26937 26936 26935 26934 26933 26932 26931 26930 26929 26928 26927 26926 26925 26924 26923 26922 26921 26920 26919 26918 26917 26916 26915 26914 26913 26912 26911 26910 26909 26908 26907 26906 26905 26904 26903 26902 26901 26900 26899 26898 26897 26896 26895 26894 26893 26892 26891 26890 26889 26888 26887 26886 26885 26884 26883 26882 26881 26880 26879 26878 26877 26876 26875 26874 26873 26872 26871 26870 26869 26868 26867 26866 26865 26864 26863 26862 26861 26860 26859 26858 26857 26856 26855 26854 26853 26852 26851 26850 26849 26848 26847 26846 26845 26844 26843 26842 26841 26840 26839 26838 26837 26836 26835 26834 26833 26832 26831 26830 26829 26828 26827 26826 26825 26824 26823 26822 26821 26820 26819 26818 26817 26816 26815 26814 26813 26812 26811 26810 26809 26808 26807 26806 26805 26804 26803 26802 26801 26800 26799 26798 26797 26796 26795 26794 26793 26792 26791 26790 26789 26788 26787 26786 26785 26784 26783 26782 26781 26780 26779 26778 26777 26776 26775 26774 26773 26772 26771 26770 26769 26768 26767 26766 26765 26764 26763 26762 26761 26760 26759 26758 26757 26756 26755 26754 26753 26752 26751 26750 26749 26748 26747 26746 26745 26744 26743 26742 26741 26740 26739 26738 26737 26736 26735 26734 26733 26732 26731 26730 26729 26728 26727 26726 26725 26724 26723 26722 26721 26720 26719 26718 26717 26716 26715 26714 26713 26712 26711 26710 26709 26708 26707 26706 26705 26704 26703 26702 26701 26700 26699 26698 26697 26696 26695 26694 26693 26692 26691 26690 26689 26688 26687 26686 26685 26684 26683 26682 26681 26680 26679 26678 26677 26676 26675 26674 26673 26672 26671 26670 26669 26668 26667 26666 26665 26664 26663 26662 26661 26660 26659 26658 26657 26656 26655 26654 26653 26652 26651 26650 26649 26648 26647 26646 26645 26644 26643 26642 26641 26640 26639 26638 26637 26636 26635 26634 26633 26632 26631 26630 26629 26628 26627 26626 26625 26624 26623 26622 26621 26620 26619 26618 26617 26616 26615 26614 26613 26612 26611 26610 26609 26608 26607 26606 26605 26604 26603 26602 26601 26600 26599 26598 26597 26596 26595 26594 26593 26592 26591 26590 26589 26588 26587 26586 26585 26584 26583 26582 26581 26580 26579 26578 26577 26576 26575 26574 26573 26572 26571 26570 26569 26568 26567 26566 26565 26564 26563 26562 26561 26560 26559 26558 26557 26556 26555 26554 26553 26552 26551 26550 26549 26548 26547 26546 26545 26544 26543 26542 26541 26540 26539 26538 26537 26536 26535 26534 26533 26532 26531 26530 26529 26528 26527 26526 26525 26524 26523 26522 26521 26520 26519 26518 26517 26516 26515 26514 26513 26512 26511 26510 26509 26508 26507 26506 26505 26504 26503 26502 26501 26500 26499 26498 26497 26496 26495 26494 26493 26492 26491 26490 26489 26488 26487 26486 26485 26484 26483 26482 26481 26480 26479 26478 26477 26476 26475 26474 26473 26472 26471 26470 26469 26468 26467 26466 26465 26464 26463 26462 26461 26460 26459 26458 26457 26456 26455 26454 26453 26452 26451 26450 26449 26448 26447 26446 26445 26444 26443 26442 26441 26440 26439 26438 26437 26436 26435 26434 26433 26432 26431 26430 26429 26428 26427 26426 26425 26424 26423 26422 26421 26420 26419 26418 26417 26416 26415 26414 26413 26412 26411 26410 26409 26408 26407 26406 26405 26404 26403 26402 26401 26400 26399 26398 26397 26396 26395 26394 26393 26392 26391 26390 26389 26388 26387 26386 26385 26384 26383 26382 26381 26380 26379 26378 26377 26376 26375 26374 26373 26372 26371 26370 26369 26368 26367 26366 26365 26364 26363 26362 26361 26360 26359 26358 26357 26356 26355 26354 26353 26352 26351 26350 26349 26348 26347 26346 26345 26344 26343 26342 26341 26340 26339 26338 26337 26336 26335 26334 26333 26332 26331 26330 26329 26328 26327 26326 26325 26324 26323 26322 26321 26320 26319 26318 26317 26316 26315 26314 26313 26312 26311 26310 26309 26308 26307 26306 26305 26304 26303 26302 26301 26300 26299 26298 26297 26296 26295 26294 26293 26292 26291 26290 26289 26288 26287 26286 26285 26284 26283 26282 26281 26280 26279 26278 26277 26276 26275 26274 26273 26272 26271 26270 26269 26268 26267 26266 26265 26264 26263 26262 26261 26260 26259 26258 26257 26256 26255 26254 26253 26252 26251 26250 26249 26248 26247 26246 26245 26244 26243 26242 26241 26240 26239 26238 26237 26236 26235 26234 26233 26232 26231 26230 26229 26228 26227 26226 26225 26224 26223 26222 26221 26220 26219 26218 26217 26216 26215 26214 26213 26212 26211 26210 26209 26208 26207 26206 26205 26204 26203 26202 26201 26200 26199 26198 26197 26196 26195 26194 26193 26192 26191 26190 26189 26188 26187 26186 26185 26184 26183 26182 26181 26180 26179 26178 26177 26176 26175 26174 26173 26172 26171 26170 26169 26168 26167 26166 26165 26164 26163 26162 26161 26160 26159 26158 26157 26156 26155 26154 26153 26152 26151 26150 26149 26148 26147 26146 26145 26144 26143 26142 26141 26140 26139 26138 26137 26136 26135 26134 26133 26132 26131 26130 26129 26128 26127 26126 26125 26124 26123 26122 26121 26120 26119 26118 26117 26116 26115 26114 26113 26112 26111 26110 26109 26108 26107 26106 26105 26104 26103 26102 26101 26100 26099 26098 26097 26096 26095 26094 26093 26092 26091 26090 26089 26088 26087 26086 26085 26084 26083 26082 26081 26080 26079 26078 26077 26076 26075 26074 26073 26072 26071 26070 26069 26068 26067 26066 26065 26064 26063 26062 26061 26060 26059 26058 26057 26056 26055 26054 26053 26052 26051 26050 26049 26048 26047 26046 26045 26044 26043 26042 26041 26040 26039 26038 26037 26036 26035 26034 26033 26032 26031 26030 26029 26028 26027 26026 26025 26024 26023 26022 26021 26020 26019 26018 26017 26016 26015 26014 26013 26012 26011 26010 26009 26008 26007 26006 26005 26004 26003 26002 26001 26000 25999 25998 25997 25996 25995 25994 25993 25992 25991 25990 25989 25988 25987 25986 25985 25984 25983 25982 25981 25980 25979 25978 25977 25976 25975 25974 25973 25972 25971 25970 25969 25968 25967 25966 25965 25964 25963 25962 25961 25960 25959 25958 25957 25956 25955 25954 25953 25952 25951 25950 25949 25948 25947 25946 25945 25944 25943 25942 25941 25940 25939 25938 25937 25936 25935 25934 25933 25932 25931 25930 25929 25928 25927 25926 25925 25924 25923 25922 25921 25920 25919 25918 25917 25916 25915 25914 25913 25912 25911 25910 25909 25908 25907 25906 25905 25904 25903 25902 25901 25900 25899 25898 25897 25896 25895 25894 25893 25892 25891 25890 25889 25888 25887 25886 25885 25884 25883 25882 25881 25880 25879 25878 25877 25876 25875 25874 25873 25872 25871 25870 25869 25868 25867 25866 25865 25864 25863 25862 25861 25860 25859 25858 25857 25856 25855 25854 25853 25852 25851 25850 25849 25848 25847 25846 25845 25844 25843 25842 25841 25840 25839 25838 25837 25836 25835 25834 25833 25832 25831 25830 25829 25828 25827 25826 25825 25824 25823 25822 25821 25820 25819 25818 25817 25816 25815 25814 25813 25812 25811 25810 25809 25808 25807 25806 25805 25804 25803 25802 25801 25800 25799 25798 25797 25796 25795 25794 25793 25792 25791 25790 25789 25788 25787 25786 25785 25784 25783 25782 25781 25780 25779 25778 25777 25776 25775 25774 25773 25772 25771 25770 25769 25768 25767 25766 25765 25764 25763 25762 25761 25760 25759 25758 25757 25756 25755 25754 25753 25752 25751 25750 25749 25748 25747 25746 25745 25744 25743 25742 25741 25740 25739 25738 25737 25736 25735 25734 25733 25732 25731 25730 25729 25728 25727 25726 25725 25724 25723 25722 25721 25720 25719 25718 25717 25716 25715 25714 25713 25712 25711 25710 25709 25708 25707 25706 25705 25704 25703 25702 25701 25700 25699 25698 25697 25696 25695 25694 25693 25692 25691 25690 25689 25688 25687 25686 25685 25684 25683 25682 25681 25680 25679 25678 25677 25676 25675 25674 25673 25672 25671 25670 25669 25668 25667 25666 25665 25664 25663 25662 25661 25660 25659 25658 25657 25656 25655 25654 25653 25652 25651 25650 25649 25648 25647 25646 25645 25644 25643 25642 25641 25640 25639 25638 25637 25636 25635 25634 25633 25632 25631 25630 25629 25628 25627 25626 25625 25624 25623 25622 25621 25620 25619 25618 25617 25616 25615 25614 25613 25612 25611 25610 25609 25608 25607 25606 25605 25604 25603 25602 25601 25600 25599 25598 25597 25596 25595 25594 25593 25592 25591 25590 25589 25588 25587 25586 25585 25584 25583 25582 25581 25580 25579 25578 25577 25576 25575 25574 25573 25572 25571 25570 25569 25568 25567 25566 25565 25564 25563 25562 25561 25560 25559 25558 25557 25556 25555 25554 25553 25552 25551 25550 25549 25548 25547 25546 25545 25544 25543 25542 25541 25540 25539 25538 25537 25536 25535 25534 25533 25532 25531 25530 25529 25528 25527 25526 25525 25524 25523 25522 25521 25520 25519 25518 25517 25516 25515 25514 25513 25512 25511 25510 25509 25508 25507 25506 25505 25504 25503 25502 25501 25500 25499 25498 25497 25496 25495 25494 25493 25492 25491 25490 25489 25488 25487 25486 25485 25484 25483 25482 25481 25480 25479 25478 25477 25476 25475 25474 25473 25472 25471 25470 25469 25468 25467 25466 25465 25464 25463 25462 25461 25460 25459 25458 25457 25456 25455 25454 25453 25452 25451 25450 25449 25448 25447 25446 25445 25444 25443 25442 25441 25440 25439 25438 25437 25436 25435 25434 25433 25432 25431 25430 25429 25428 25427 25426 25425 25424 25423 25422 25421 25420 25419 25418 25417 25416 25415 25414 25413 25412 25411 25410 25409 25408 25407 25406 25405 25404 25403 25402 25401 25400 25399 25398 25397 25396 25395 25394 25393 25392 25391 25390 25389 25388 25387 25386 25385 25384 25383 25382 25381 25380 25379 25378 25377 25376 25375 25374 25373 25372 25371 25370 25369 25368 25367 25366 25365 25364 25363 25362 25361 25360 25359 25358 25357 25356 25355 25354 25353 25352 25351 25350 25349 25348 25347 25346 25345 25344 25343 25342 25341 25340 25339 25338 25337 25336 25335 25334 25333 25332 25331 25330 25329 25328 25327 25326 25325 25324 25323 25322 25321 25320 25319 25318 25317 25316 25315 25314 25313 25312 25311 25310 25309 25308 25307 25306 25305 25304 25303 25302 25301 25300 25299 25298 25297 25296 25295 25294 25293 25292 25291 25290 25289 25288 25287 25286 25285 25284 25283 25282 25281 25280 25279 25278 25277 25276 25275 25274 25273 25272 25271 25270 25269 25268 25267 25266 25265 25264 25263 25262 25261 25260 25259 25258 25257 25256 25255 25254 25253 25252 25251 25250 25249 25248 25247 25246 25245 25244 25243 25242 25241 25240 25239 25238 25237 25236 25235 25234 25233 25232 25231 25230 25229 25228 25227 25226 25225 25224 25223 25222 25221 25220 25219 25218 25217 25216 25215 25214 25213 25212 25211 25210 25209 25208 25207 25206 25205 25204 25203 25202 25201 25200 25199 25198 25197 25196 25195 25194 25193 25192 25191 25190 25189 25188 25187 25186 25185 25184 25183 25182 25181 25180 25179 25178 25177 25176 25175 25174 25173 25172 25171 25170 25169 25168 25167 25166 25165 25164 25163 25162 25161 25160 25159 25158 25157 25156 25155 25154 25153 25152 25151 25150 25149 25148 25147 25146 25145 25144 25143 25142 25141 25140 25139 25138 25137 25136 25135 25134 25133 25132 25131 25130 25129 25128 25127 25126 25125 25124 25123 25122 25121 25120 25119 25118 25117 25116 25115 25114 25113 25112 25111 25110 25109 25108 25107 25106 25105 25104 25103 25102 25101 25100 25099 25098 25097 25096 25095 25094 25093 25092 25091 25090 25089 25088 25087 25086 25085 25084 25083 25082 25081 25080 25079 25078 25077 25076 25075 25074 25073 25072 25071 25070 25069 25068 25067 25066 25065 25064 25063 25062 25061 25060 25059 25058 25057 25056 25055 25054 25053 25052 25051 25050 25049 25048 25047 25046 25045 25044 25043 25042 25041 25040 25039 25038 25037 25036 25035 25034 25033 25032 25031 25030 25029 25028 25027 25026 25025 25024 25023 25022 25021 25020 25019 25018 25017 25016 25015 25014 25013 25012 25011 25010 25009 25008 25007 25006 25005 25004 25003 25002 25001 25000 24999 24998 24997 24996 24995 24994 24993 24992 24991 24990 24989 24988 24987 24986 24985 24984 24983 24982 24981 24980 24979 24978 24977 24976 24975 24974 24973 24972 24971 24970 24969 24968 24967 24966 24965 24964 24963 24962 24961 24960 24959 24958 24957 24956 24955 24954 24953 24952 24951 24950 24949 24948 24947 24946 24945 24944 24943 24942 24941 24940 24939 24938 24937 24936 24935 24934 24933 24932 24931 24930 24929 24928 24927 24926 24925 24924 24923 24922 24921 24920 24919 24918 24917 24916 24915 24914 24913 24912 24911 24910 24909 24908 24907 24906 24905 24904 24903 24902 24901 24900 24899 24898 24897 24896 24895 24894 24893 24892 24891 24890 24889 24888 24887 24886 24885 24884 24883 24882 24881 24880 24879 24878 24877 24876 24875 24874 24873 24872 24871 24870 24869 24868 24867 24866 24865 24864 24863 24862 24861 24860 24859 24858 24857 24856 24855 24854 24853 24852 24851 24850 24849 24848 24847 24846 24845 24844 24843 24842 24841 24840 24839 24838 24837 24836 24835 24834 24833 24832 24831 24830 24829 24828 24827 24826 24825 24824 24823 24822 24821 24820 24819 24818 24817 24816 24815 24814 24813 24812 24811 24810 24809 24808 24807 24806 24805 24804 24803 24802 24801 24800 24799 24798 24797 24796 24795 24794 24793 24792 24791 24790 24789 24788 24787 24786 24785 24784 24783 24782 24781 24780 24779 24778 24777 24776 24775 24774 24773 24772 24771 24770 24769 24768 24767 24766 24765 24764 24763 24762 24761 24760 24759 24758 24757 24756 24755 24754 24753 24752 24751 24750 24749 24748 24747 24746 24745 24744 24743 24742 24741 24740 24739 24738 24737 24736 24735 24734 24733 24732 24731 24730 24729 24728 24727 24726 24725 24724 24723 24722 24721 24720 24719 24718 24717 24716 24715 24714 24713 24712 24711 24710 24709 24708 24707 24706 24705 24704 24703 24702 24701 24700 24699 24698 24697 24696 24695 24694 24693 24692 24691 24690 24689 24688 24687 24686 24685 24684 24683 24682 24681 24680 24679 24678 24677 24676 24675 24674 24673 24672 24671 24670 24669 24668 24667 24666 24665 24664 24663 24662 24661 24660 24659 24658 24657 24656 24655 24654 24653 24652 24651 24650 24649 24648 24647 24646 24645 24644 24643 24642 24641 24640 24639 24638 24637 24636 24635 24634 24633 24632 24631 24630 24629 24628 24627 24626 24625 24624 24623 24622 24621 24620 24619 24618 24617 24616 24615 24614 24613 24612 24611 24610 24609 24608 24607 24606 24605 24604 24603 24602 24601 24600 24599 24598 24597 24596 24595 24594 24593 24592 24591 24590 24589 24588 24587 24586 24585 24584 24583 24582 24581 24580 24579 24578 24577 24576 24575 24574 24573 24572 24571 24570 24569 24568 24567 24566 24565 24564 24563 24562 24561 24560 24559 24558 24557 24556 24555 24554 24553 24552 24551 24550 24549 24548 24547 24546 24545 24544 24543 24542 24541 24540 24539 24538 24537 24536 24535 24534 24533 24532 24531 24530 24529 24528 24527 24526 24525 24524 24523 24522 24521 24520 24519 24518 24517 24516 24515 24514 24513 24512 24511 24510 24509 24508 24507 24506 24505 24504 24503 24502 24501 24500 24499 24498 24497 24496 24495 24494 24493 24492 24491 24490 24489 24488 24487 24486 24485 24484 24483 24482 24481 24480 24479 24478 24477 24476 24475 24474 24473 24472 24471 24470 24469 24468 24467 24466 24465 24464 24463 24462 24461 24460 24459 24458 24457 24456 24455 24454 24453 24452 24451 24450 24449 24448 24447 24446 24445 24444 24443 24442 24441 24440 24439 24438 24437 24436 24435 24434 24433 24432 24431 24430 24429 24428 24427 24426 24425 24424 24423 24422 24421 24420 24419 24418 24417 24416 24415 24414 24413 24412 24411 24410 24409 24408 24407 24406 24405 24404 24403 24402 24401 24400 24399 24398 24397 24396 24395 24394 24393 24392 24391 24390 24389 24388 24387 24386 24385 24384 24383 24382 24381 24380 24379 24378 24377 24376 24375 24374 24373 24372 24371 24370 24369 24368 24367 24366 24365 24364 24363 24362 24361 24360 24359 24358 24357 24356 24355 24354 24353 24352 24351 24350 24349 24348 24347 24346 24345 24344 24343 24342 24341 24340 24339 24338 24337 24336 24335 24334 24333 24332 24331 24330 24329 24328 24327 24326 24325 24324 24323 24322 24321 24320 24319 24318 24317 24316 24315 24314 24313 24312 24311 24310 24309 24308 24307 24306 24305 24304 24303 24302 24301 24300 24299 24298 24297 24296 24295 24294 24293 24292 24291 24290 24289 24288 24287 24286 24285 24284 24283 24282 24281 24280 24279 24278 24277 24276 24275 24274 24273 24272 24271 24270 24269 24268 24267 24266 24265 24264 24263 24262 24261 24260 24259 24258 24257 24256 24255 24254 24253 24252 24251 24250 24249 24248 24247 24246 24245 24244 24243 24242 24241 24240 24239 24238 24237 24236 24235 24234 24233 24232 24231 24230 24229 24228 24227 24226 24225 24224 24223 24222 24221 24220 24219 24218 24217 24216 24215 24214 24213 24212 24211 24210 24209 24208 24207 24206 24205 24204 24203 24202 24201 24200 24199 24198 24197 24196 24195 24194 24193 24192 24191 24190 24189 24188 24187 24186 24185 24184 24183 24182 24181 24180 24179 24178 24177 24176 24175 24174 24173 24172 24171 24170 24169 24168 24167 24166 24165 24164 24163 24162 24161 24160 24159 24158 24157 24156 24155 24154 24153 24152 24151 24150 24149 24148 24147 24146 24145 24144 24143 24142 24141 24140 24139 24138 24137 24136 24135 24134 24133 24132 24131 24130 24129 24128 24127 24126 24125 24124 24123 24122 24121 24120 24119 24118 24117 24116 24115 24114 24113 24112 24111 24110 24109 24108 24107 24106 24105 24104 24103 24102 24101 24100 24099 24098 24097 24096 24095 24094 24093 24092 24091 24090 24089 24088 24087 24086 24085 24084 24083 24082 24081 24080 24079 24078 24077 24076 24075 24074 24073 24072 24071 24070 24069 24068 24067 24066 24065 24064 24063 24062 24061 24060 24059 24058 24057 24056 24055 24054 24053 24052 24051 24050 24049 24048 24047 24046 24045 24044 24043 24042 24041 24040 24039 24038 24037 24036 24035 24034 24033 24032 24031 24030 24029 24028 24027 24026 24025 24024 24023 24022 24021 24020 24019 24018 24017 24016 24015 24014 24013 24012 24011 24010 24009 24008 24007 24006 24005 24004 24003 24002 24001 24000 23999 23998 23997 23996 23995 23994 23993 23992 23991 23990 23989 23988 23987 23986 23985 23984 23983 23982 23981 23980 23979 23978 23977 23976 23975 23974 23973 23972 23971 23970 23969 23968 23967 23966 23965 23964 23963 23962 23961 23960 23959 23958 23957 23956 23955 23954 23953 23952 23951 23950 23949 23948 23947 23946 23945 23944 23943 23942 23941 23940 23939 23938 23937 23936 23935 23934 23933 23932 23931 23930 23929 23928 23927 23926 23925 23924 23923 23922 23921 23920 23919 23918 23917 23916 23915 23914 23913 23912 23911 23910 23909 23908 23907 23906 23905 23904 23903 23902 23901 23900 23899 23898 23897 23896 23895 23894 23893 23892 23891 23890 23889 23888 23887 23886 23885 23884 23883 23882 23881 23880 23879 23878 23877 23876 23875 23874 23873 23872 23871 23870 23869 23868 23867 23866 23865 23864 23863 23862 23861 23860 23859 23858 23857 23856 23855 23854 23853 23852 23851 23850 23849 23848 23847 23846 23845 23844 23843 23842 23841 23840 23839 23838 23837 23836 23835 23834 23833 23832 23831 23830 23829 23828 23827 23826 23825 23824 23823 23822 23821 23820 23819 23818 23817 23816 23815 23814 23813 23812 23811 23810 23809 23808 23807 23806 23805 23804 23803 23802 23801 23800 23799 23798 23797 23796 23795 23794 23793 23792 23791 23790 23789 23788 23787 23786 23785 23784 23783 23782 23781 23780 23779 23778 23777 23776 23775 23774 23773 23772 23771 23770 23769 23768 23767 23766 23765 23764 23763 23762 23761 23760 23759 23758 23757 23756 23755 23754 23753 23752 23751 23750 23749 23748 23747 23746 23745 23744 23743 23742 23741 23740 23739 23738 23737 23736 23735 23734 23733 23732 23731 23730 23729 23728 23727 23726 23725 23724 23723 23722 23721 23720 23719 23718 23717 23716 23715 23714 23713 23712 23711 23710 23709 23708 23707 23706 23705 23704 23703 23702 23701 23700 23699 23698 23697 23696 23695 23694 23693 23692 23691 23690 23689 23688 23687 23686 23685 23684 23683 23682 23681 23680 23679 23678 23677 23676 23675 23674 23673 23672 23671 23670 23669 23668 23667 23666 23665 23664 23663 23662 23661 23660 23659 23658 23657 23656 23655 23654 23653 23652 23651 23650 23649 23648 23647 23646 23645 23644 23643 23642 23641 23640 23639 23638 23637 23636 23635 23634 23633 23632 23631 23630 23629 23628 23627 23626 23625 23624 23623 23622 23621 23620 23619 23618 23617 23616 23615 23614 23613 23612 23611 23610 23609 23608 23607 23606 23605 23604 23603 23602 23601 23600 23599 23598 23597 23596 23595 23594 23593 23592 23591 23590 23589 23588 23587 23586 23585 23584 23583 23582 23581 23580 23579 23578 23577 23576 23575 23574 23573 23572 23571 23570 23569 23568 23567 23566 23565 23564 23563 23562 23561 23560 23559 23558 23557 23556 23555 23554 23553 23552 23551 23550 23549 23548 23547 23546 23545 23544 23543 23542 23541 23540 23539 23538 23537 23536 23535 23534 23533 23532 23531 23530 23529 23528 23527 23526 23525 23524 23523 23522 23521 23520 23519 23518 23517 23516 23515 23514 23513 23512 23511 23510 23509 23508 23507 23506 23505 23504 23503 23502 23501 23500 23499 23498 23497 23496 23495 23494 23493 23492 23491 23490 23489 23488 23487 23486 23485 23484 23483 23482 23481 23480 23479 23478 23477 23476 23475 23474 23473 23472 23471 23470 23469 23468 23467 23466 23465 23464 23463 23462 23461 23460 23459 23458 23457 23456 23455 23454 23453 23452 23451 23450 23449 23448 23447 23446 23445 23444 23443 23442 23441 23440 23439 23438 23437 23436 23435 23434 23433 23432 23431 23430 23429 23428 23427 23426 23425 23424 23423 23422 23421 23420 23419 23418 23417 23416 23415 23414 23413 23412 23411 23410 23409 23408 23407 23406 23405 23404 23403 23402 23401 23400 23399 23398 23397 23396 23395 23394 23393 23392 23391 23390 23389 23388 23387 23386 23385 23384 23383 23382 23381 23380 23379 23378 23377 23376 23375 23374 23373 23372 23371 23370 23369 23368 23367 23366 23365 23364 23363 23362 23361 23360 23359 23358 23357 23356 23355 23354 23353 23352 23351 23350 23349 23348 23347 23346 23345 23344 23343 23342 23341 23340 23339 23338 23337 23336 23335 23334 23333 23332 23331 23330 23329 23328 23327 23326 23325 23324 23323 23322 23321 23320 23319 23318 23317 23316 23315 23314 23313 23312 23311 23310 23309 23308 23307 23306 23305 23304 23303 23302 23301 23300 23299 23298 23297 23296 23295 23294 23293 23292 23291 23290 23289 23288 23287 23286 23285 23284 23283 23282 23281 23280 23279 23278 23277 23276 23275 23274 23273 23272 23271 23270 23269 23268 23267 23266 23265 23264 23263 23262 23261 23260 23259 23258 23257 23256 23255 23254 23253 23252 23251 23250 23249 23248 23247 23246 23245 23244 23243 23242 23241 23240 23239 23238 23237 23236 23235 23234 23233 23232 23231 23230 23229 23228 23227 23226 23225 23224 23223 23222 23221 23220 23219 23218 23217 23216 23215 23214 23213 23212 23211 23210 23209 23208 23207 23206 23205 23204 23203 23202 23201 23200 23199 23198 23197 23196 23195 23194 23193 23192 23191 23190 23189 23188 23187 23186 23185 23184 23183 23182 23181 23180 23179 23178 23177 23176 23175 23174 23173 23172 23171 23170 23169 23168 23167 23166 23165 23164 23163 23162 23161 23160 23159 23158 23157 23156 23155 23154 23153 23152 23151 23150 23149 23148 23147 23146 23145 23144 23143 23142 23141 23140 23139 23138 23137 23136 23135 23134 23133 23132 23131 23130 23129 23128 23127 23126 23125 23124 23123 23122 23121 23120 23119 23118 23117 23116 23115 23114 23113 23112 23111 23110 23109 23108 23107 23106 23105 23104 23103 23102 23101 23100 23099 23098 23097 23096 23095 23094 23093 23092 23091 23090 23089 23088 23087 23086 23085 23084 23083 23082 23081 23080 23079 23078 23077 23076 23075 23074 23073 23072 23071 23070 23069 23068 23067 23066 23065 23064 23063 23062 23061 23060 23059 23058 23057 23056 23055 23054 23053 23052 23051 23050 23049 23048 23047 23046 23045 23044 23043 23042 23041 23040 23039 23038 23037 23036 23035 23034 23033 23032 23031 23030 23029 23028 23027 23026 23025 23024 23023 23022 23021 23020 23019 23018 23017 23016 23015 23014 23013 23012 23011 23010 23009 23008 23007 23006 23005 23004 23003 23002 23001 23000 22999 22998 22997 22996 22995 22994 22993 22992 22991 22990 22989 22988 22987 22986 22985 22984 22983 22982 22981 22980 22979 22978 22977 22976 22975 22974 22973 22972 22971 22970 22969 22968 22967 22966 22965 22964 22963 22962 22961 22960 22959 22958 22957 22956 22955 22954 22953 22952 22951 22950 22949 22948 22947 22946 22945 22944 22943 22942 22941 22940 22939 22938 22937 22936 22935 22934 22933 22932 22931 22930 22929 22928 22927 22926 22925 22924 22923 22922 22921 22920 22919 22918 22917 22916 22915 22914 22913 22912 22911 22910 22909 22908 22907 22906 22905 22904 22903 22902 22901 22900 22899 22898 22897 22896 22895 22894 22893 22892 22891 22890 22889 22888 22887 22886 22885 22884 22883 22882 22881 22880 22879 22878 22877 22876 22875 22874 22873 22872 22871 22870 22869 22868 22867 22866 22865 22864 22863 22862 22861 22860 22859 22858 22857 22856 22855 22854 22853 22852 22851 22850 22849 22848 22847 22846 22845 22844 22843 22842 22841 22840 22839 22838 22837 22836 22835 22834 22833 22832 22831 22830 22829 22828 22827 22826 22825 22824 22823 22822 22821 22820 22819 22818 22817 22816 22815 22814 22813 22812 22811 22810 22809 22808 22807 22806 22805 22804 22803 22802 22801 22800 22799 22798 22797 22796 22795 22794 22793 22792 22791 22790 22789 22788 22787 22786 22785 22784 22783 22782 22781 22780 22779 22778 22777 22776 22775 22774 22773 22772 22771 22770 22769 22768 22767 22766 22765 22764 22763 22762 22761 22760 22759 22758 22757 22756 22755 22754 22753 22752 22751 22750 22749 22748 22747 22746 22745 22744 22743 22742 22741 22740 22739 22738 22737 22736 22735 22734 22733 22732 22731 22730 22729 22728 22727 22726 22725 22724 22723 22722 22721 22720 22719 22718 22717 22716 22715 22714 22713 22712 22711 22710 22709 22708 22707 22706 22705 22704 22703 22702 22701 22700 22699 22698 22697 22696 22695 22694 22693 22692 22691 22690 22689 22688 22687 22686 22685 22684 22683 22682 22681 22680 22679 22678 22677 22676 22675 22674 22673 22672 22671 22670 22669 22668 22667 22666 22665 22664 22663 22662 22661 22660 22659 22658 22657 22656 22655 22654 22653 22652 22651 22650 22649 22648 22647 22646 22645 22644 22643 22642 22641 22640 22639 22638 22637 22636 22635 22634 22633 22632 22631 22630 22629 22628 22627 22626 22625 22624 22623 22622 22621 22620 22619 22618 22617 22616 22615 22614 22613 22612 22611 22610 22609 22608 22607 22606 22605 22604 22603 22602 22601 22600 22599 22598 22597 22596 22595 22594 22593 22592 22591 22590 22589 22588 22587 22586 22585 22584 22583 22582 22581 22580 22579 22578 22577 22576 22575 22574 22573 22572 22571 22570 22569 22568 22567 22566 22565 22564 22563 22562 22561 22560 22559 22558 22557 22556 22555 22554 22553 22552 22551 22550 22549 22548 22547 22546 22545 22544 22543 22542 22541 22540 22539 22538 22537 22536 22535 22534 22533 22532 22531 22530 22529 22528 22527 22526 22525 22524 22523 22522 22521 22520 22519 22518 22517 22516 22515 22514 22513 22512 22511 22510 22509 22508 22507 22506 22505 22504 22503 22502 22501 22500 22499 22498 22497 22496 22495 22494 22493 22492 22491 22490 22489 22488 22487 22486 22485 22484 22483 22482 22481 22480 22479 22478 22477 22476 22475 22474 22473 22472 22471 22470 22469 22468 22467 22466 22465 22464 22463 22462 22461 22460 22459 22458 22457 22456 22455 22454 22453 22452 22451 22450 22449 22448 22447 22446 22445 22444 22443 22442 22441 22440 22439 22438 22437 22436 22435 22434 22433 22432 22431 22430 22429 22428 22427 22426 22425 22424 22423 22422 22421 22420 22419 22418 22417 22416 22415 22414 22413 22412 22411 22410 22409 22408 22407 22406 22405 22404 22403 22402 22401 22400 22399 22398 22397 22396 22395 22394 22393 22392 22391 22390 22389 22388 22387 22386 22385 22384 22383 22382 22381 22380 22379 22378 22377 22376 22375 22374 22373 22372 22371 22370 22369 22368 22367 22366 22365 22364 22363 22362 22361 22360 22359 22358 22357 22356 22355 22354 22353 22352 22351 22350 22349 22348 22347 22346 22345 22344 22343 22342 22341 22340 22339 22338 22337 22336 22335 22334 22333 22332 22331 22330 22329 22328 22327 22326 22325 22324 22323 22322 22321 22320 22319 22318 22317 22316 22315 22314 22313 22312 22311 22310 22309 22308 22307 22306 22305 22304 22303 22302 22301 22300 22299 22298 22297 22296 22295 22294 22293 22292 22291 22290 22289 22288 22287 22286 22285 22284 22283 22282 22281 22280 22279 22278 22277 22276 22275 22274 22273 22272 22271 22270 22269 22268 22267 22266 22265 22264 22263 22262 22261 22260 22259 22258 22257 22256 22255 22254 22253 22252 22251 22250 22249 22248 22247 22246 22245 22244 22243 22242 22241 22240 22239 22238 22237 22236 22235 22234 22233 22232 22231 22230 22229 22228 22227 22226 22225 22224 22223 22222 22221 22220 22219 22218 22217 22216 22215 22214 22213 22212 22211 22210 22209 22208 22207 22206 22205 22204 22203 22202 22201 22200 22199 22198 22197 22196 22195 22194 22193 22192 22191 22190 22189 22188 22187 22186 22185 22184 22183 22182 22181 22180 22179 22178 22177 22176 22175 22174 22173 22172 22171 22170 22169 22168 22167 22166 22165 22164 22163 22162 22161 22160 22159 22158 22157 22156 22155 22154 22153 22152 22151 22150 22149 22148 22147 22146 22145 22144 22143 22142 22141 22140 22139 22138 22137 22136 22135 22134 22133 22132 22131 22130 22129 22128 22127 22126 22125 22124 22123 22122 22121 22120 22119 22118 22117 22116 22115 22114 22113 22112 22111 22110 22109 22108 22107 22106 22105 22104 22103 22102 22101 22100 22099 22098 22097 22096 22095 22094 22093 22092 22091 22090 22089 22088 22087 22086 22085 22084 22083 22082 22081 22080 22079 22078 22077 22076 22075 22074 22073 22072 22071 22070 22069 22068 22067 22066 22065 22064 22063 22062 22061 22060 22059 22058 22057 22056 22055 22054 22053 22052 22051 22050 22049 22048 22047 22046 22045 22044 22043 22042 22041 22040 22039 22038 22037 22036 22035 22034 22033 22032 22031 22030 22029 22028 22027 22026 22025 22024 22023 22022 22021 22020 22019 22018 22017 22016 22015 22014 22013 22012 22011 22010 22009 22008 22007 22006 22005 22004 22003 22002 22001 22000 21999 21998 21997 21996 21995 21994 21993 21992 21991 21990 21989 21988 21987 21986 21985 21984 21983 21982 21981 21980 21979 21978 21977 21976 21975 21974 21973 21972 21971 21970 21969 21968 21967 21966 21965 21964 21963 21962 21961 21960 21959 21958 21957 21956 21955 21954 21953 21952 21951 21950 21949 21948 21947 21946 21945 21944 21943 21942 21941 21940 21939 21938 21937 21936 21935 21934 21933 21932 21931 21930 21929 21928 21927 21926 21925 21924 21923 21922 21921 21920 21919 21918 21917 21916 21915 21914 21913 21912 21911 21910 21909 21908 21907 21906 21905 21904 21903 21902 21901 21900 21899 21898 21897 21896 21895 21894 21893 21892 21891 21890 21889 21888 21887 21886 21885 21884 21883 21882 21881 21880 21879 21878 21877 21876 21875 21874 21873 21872 21871 21870 21869 21868 21867 21866 21865 21864 21863 21862 21861 21860 21859 21858 21857 21856 21855 21854 21853 21852 21851 21850 21849 21848 21847 21846 21845 21844 21843 21842 21841 21840 21839 21838 21837 21836 21835 21834 21833 21832 21831 21830 21829 21828 21827 21826 21825 21824 21823 21822 21821 21820 21819 21818 21817 21816 21815 21814 21813 21812 21811 21810 21809 21808 21807 21806 21805 21804 21803 21802 21801 21800 21799 21798 21797 21796 21795 21794 21793 21792 21791 21790 21789 21788 21787 21786 21785 21784 21783 21782 21781 21780 21779 21778 21777 21776 21775 21774 21773 21772 21771 21770 21769 21768 21767 21766 21765 21764 21763 21762 21761 21760 21759 21758 21757 21756 21755 21754 21753 21752 21751 21750 21749 21748 21747 21746 21745 21744 21743 21742 21741 21740 21739 21738 21737 21736 21735 21734 21733 21732 21731 21730 21729 21728 21727 21726 21725 21724 21723 21722 21721 21720 21719 21718 21717 21716 21715 21714 21713 21712 21711 21710 21709 21708 21707 21706 21705 21704 21703 21702 21701 21700 21699 21698 21697 21696 21695 21694 21693 21692 21691 21690 21689 21688 21687 21686 21685 21684 21683 21682 21681 21680 21679 21678 21677 21676 21675 21674 21673 21672 21671 21670 21669 21668 21667 21666 21665 21664 21663 21662 21661 21660 21659 21658 21657 21656 21655 21654 21653 21652 21651 21650 21649 21648 21647 21646 21645 21644 21643 21642 21641 21640 21639 21638 21637 21636 21635 21634 21633 21632 21631 21630 21629 21628 21627 21626 21625 21624 21623 21622 21621 21620 21619 21618 21617 21616 21615 21614 21613 21612 21611 21610 21609 21608 21607 21606 21605 21604 21603 21602 21601 21600 21599 21598 21597 21596 21595 21594 21593 21592 21591 21590 21589 21588 21587 21586 21585 21584 21583 21582 21581 21580 21579 21578 21577 21576 21575 21574 21573 21572 21571 21570 21569 21568 21567 21566 21565 21564 21563 21562 21561 21560 21559 21558 21557 21556 21555 21554 21553 21552 21551 21550 21549 21548 21547 21546 21545 21544 21543 21542 21541 21540 21539 21538 21537 21536 21535 21534 21533 21532 21531 21530 21529 21528 21527 21526 21525 21524 21523 21522 21521 21520 21519 21518 21517 21516 21515 21514 21513 21512 21511 21510 21509 21508 21507 21506 21505 21504 21503 21502 21501 21500 21499 21498 21497 21496 21495 21494 21493 21492 21491 21490 21489 21488 21487 21486 21485 21484 21483 21482 21481 21480 21479 21478 21477 21476 21475 21474 21473 21472 21471 21470 21469 21468 21467 21466 21465 21464 21463 21462 21461 21460 21459 21458 21457 21456 21455 21454 21453 21452 21451 21450 21449 21448 21447 21446 21445 21444 21443 21442 21441 21440 21439 21438 21437 21436 21435 21434 21433 21432 21431 21430 21429 21428 21427 21426 21425 21424 21423 21422 21421 21420 21419 21418 21417 21416 21415 21414 21413 21412 21411 21410 21409 21408 21407 21406 21405 21404 21403 21402 21401 21400 21399 21398 21397 21396 21395 21394 21393 21392 21391 21390 21389 21388 21387 21386 21385 21384 21383 21382 21381 21380 21379 21378 21377 21376 21375 21374 21373 21372 21371 21370 21369 21368 21367 21366 21365 21364 21363 21362 21361 21360 21359 21358 21357 21356 21355 21354 21353 21352 21351 21350 21349 21348 21347 21346 21345 21344 21343 21342 21341 21340 21339 21338 21337 21336 21335 21334 21333 21332 21331 21330 21329 21328 21327 21326 21325 21324 21323 21322 21321 21320 21319 21318 21317 21316 21315 21314 21313 21312 21311 21310 21309 21308 21307 21306 21305 21304 21303 21302 21301 21300 21299 21298 21297 21296 21295 21294 21293 21292 21291 21290 21289 21288 21287 21286 21285 21284 21283 21282 21281 21280 21279 21278 21277 21276 21275 21274 21273 21272 21271 21270 21269 21268 21267 21266 21265 21264 21263 21262 21261 21260 21259 21258 21257 21256 21255 21254 21253 21252 21251 21250 21249 21248 21247 21246 21245 21244 21243 21242 21241 21240 21239 21238 21237 21236 21235 21234 21233 21232 21231 21230 21229 21228 21227 21226 21225 21224 21223 21222 21221 21220 21219 21218 21217 21216 21215 21214 21213 21212 21211 21210 21209 21208 21207 21206 21205 21204 21203 21202 21201 21200 21199 21198 21197 21196 21195 21194 21193 21192 21191 21190 21189 21188 21187 21186 21185 21184 21183 21182 21181 21180 21179 21178 21177 21176 21175 21174 21173 21172 21171 21170 21169 21168 21167 21166 21165 21164 21163 21162 21161 21160 21159 21158 21157 21156 21155 21154 21153 21152 21151 21150 21149 21148 21147 21146 21145 21144 21143 21142 21141 21140 21139 21138 21137 21136 21135 21134 21133 21132 21131 21130 21129 21128 21127 21126 21125 21124 21123 21122 21121 21120 21119 21118 21117 21116 21115 21114 21113 21112 21111 21110 21109 21108 21107 21106 21105 21104 21103 21102 21101 21100 21099 21098 21097 21096 21095 21094 21093 21092 21091 21090 21089 21088 21087 21086 21085 21084 21083 21082 21081 21080 21079 21078 21077 21076 21075 21074 21073 21072 21071 21070 21069 21068 21067 21066 21065 21064 21063 21062 21061 21060 21059 21058 21057 21056 21055 21054 21053 21052 21051 21050 21049 21048 21047 21046 21045 21044 21043 21042 21041 21040 21039 21038 21037 21036 21035 21034 21033 21032 21031 21030 21029 21028 21027 21026 21025 21024 21023 21022 21021 21020 21019 21018 21017 21016 21015 21014 21013 21012 21011 21010 21009 21008 21007 21006 21005 21004 21003 21002 21001 21000 20999 20998 20997 20996 20995 20994 20993 20992 20991 20990 20989 20988 20987 20986 20985 20984 20983 20982 20981 20980 20979 20978 20977 20976 20975 20974 20973 20972 20971 20970 20969 20968 20967 20966 20965 20964 20963 20962 20961 20960 20959 20958 20957 20956 20955 20954 20953 20952 20951 20950 20949 20948 20947 20946 20945 20944 20943 20942 20941 20940 20939 20938 20937 20936 20935 20934 20933 20932 20931 20930 20929 20928 20927 20926 20925 20924 20923 20922 20921 20920 20919 20918 20917 20916 20915 20914 20913 20912 20911 20910 20909 20908 20907 20906 20905 20904 20903 20902 20901 20900 20899 20898 20897 20896 20895 20894 20893 20892 20891 20890 20889 20888 20887 20886 20885 20884 20883 20882 20881 20880 20879 20878 20877 20876 20875 20874 20873 20872 20871 20870 20869 20868 20867 20866 20865 20864 20863 20862 20861 20860 20859 20858 20857 20856 20855 20854 20853 20852 20851 20850 20849 20848 20847 20846 20845 20844 20843 20842 20841 20840 20839 20838 20837 20836 20835 20834 20833 20832 20831 20830 20829 20828 20827 20826 20825 20824 20823 20822 20821 20820 20819 20818 20817 20816 20815 20814 20813 20812 20811 20810 20809 20808 20807 20806 20805 20804 20803 20802 20801 20800 20799 20798 20797 20796 20795 20794 20793 20792 20791 20790 20789 20788 20787 20786 20785 20784 20783 20782 20781 20780 20779 20778 20777 20776 20775 20774 20773 20772 20771 20770 20769 20768 20767 20766 20765 20764 20763 20762 20761 20760 20759 20758 20757 20756 20755 20754 20753 20752 20751 20750 20749 20748 20747 20746 20745 20744 20743 20742 20741 20740 20739 20738 20737 20736 20735 20734 20733 20732 20731 20730 20729 20728 20727 20726 20725 20724 20723 20722 20721 20720 20719 20718 20717 20716 20715 20714 20713 20712 20711 20710 20709 20708 20707 20706 20705 20704 20703 20702 20701 20700 20699 20698 20697 20696 20695 20694 20693 20692 20691 20690 20689 20688 20687 20686 20685 20684 20683 20682 20681 20680 20679 20678 20677 20676 20675 20674 20673 20672 20671 20670 20669 20668 20667 20666 20665 20664 20663 20662 20661 20660 20659 20658 20657 20656 20655 20654 20653 20652 20651 20650 20649 20648 20647 20646 20645 20644 20643 20642 20641 20640 20639 20638 20637 20636 20635 20634 20633 20632 20631 20630 20629 20628 20627 20626 20625 20624 20623 20622 20621 20620 20619 20618 20617 20616 20615 20614 20613 20612 20611 20610 20609 20608 20607 20606 20605 20604 20603 20602 20601 20600 20599 20598 20597 20596 20595 20594 20593 20592 20591 20590 20589 20588 20587 20586 20585 20584 20583 20582 20581 20580 20579 20578 20577 20576 20575 20574 20573 20572 20571 20570 20569 20568 20567 20566 20565 20564 20563 20562 20561 20560 20559 20558 20557 20556 20555 20554 20553 20552 20551 20550 20549 20548 20547 20546 20545 20544 20543 20542 20541 20540 20539 20538 20537 20536 20535 20534 20533 20532 20531 20530 20529 20528 20527 20526 20525 20524 20523 20522 20521 20520 20519 20518 20517 20516 20515 20514 20513 20512 20511 20510 20509 20508 20507 20506 20505 20504 20503 20502 20501 20500 20499 20498 20497 20496 20495 20494 20493 20492 20491 20490 20489 20488 20487 20486 20485 20484 20483 20482 20481 20480 20479 20478 20477 20476 20475 20474 20473 20472 20471 20470 20469 20468 20467 20466 20465 20464 20463 20462 20461 20460 20459 20458 20457 20456 20455 20454 20453 20452 20451 20450 20449 20448 20447 20446 20445 20444 20443 20442 20441 20440 20439 20438 20437 20436 20435 20434 20433 20432 20431 20430 20429 20428 20427 20426 20425 20424 20423 20422 20421 20420 20419 20418 20417 20416 20415 20414 20413 20412 20411 20410 20409 20408 20407 20406 20405 20404 20403 20402 20401 20400 20399 20398 20397 20396 20395 20394 20393 20392 20391 20390 20389 20388 20387 20386 20385 20384 20383 20382 20381 20380 20379 20378 20377 20376 20375 20374 20373 20372 20371 20370 20369 20368 20367 20366 20365 20364 20363 20362 20361 20360 20359 20358 20357 20356 20355 20354 20353 20352 20351 20350 20349 20348 20347 20346 20345 20344 20343 20342 20341 20340 20339 20338 20337 20336 20335 20334 20333 20332 20331 20330 20329 20328 20327 20326 20325 20324 20323 20322 20321 20320 20319 20318 20317 20316 20315 20314 20313 20312 20311 20310 20309 20308 20307 20306 20305 20304 20303 20302 20301 20300 20299 20298 20297 20296 20295 20294 20293 20292 20291 20290 20289 20288 20287 20286 20285 20284 20283 20282 20281 20280 20279 20278 20277 20276 20275 20274 20273 20272 20271 20270 20269 20268 20267 20266 20265 20264 20263 20262 20261 20260 20259 20258 20257 20256 20255 20254 20253 20252 20251 20250 20249 20248 20247 20246 20245 20244 20243 20242 20241 20240 20239 20238 20237 20236 20235 20234 20233 20232 20231 20230 20229 20228 20227 20226 20225 20224 20223 20222 20221 20220 20219 20218 20217 20216 20215 20214 20213 20212 20211 20210 20209 20208 20207 20206 20205 20204 20203 20202 20201 20200 20199 20198 20197 20196 20195 20194 20193 20192 20191 20190 20189 20188 20187 20186 20185 20184 20183 20182 20181 20180 20179 20178 20177 20176 20175 20174 20173 20172 20171 20170 20169 20168 20167 20166 20165 20164 20163 20162 20161 20160 20159 20158 20157 20156 20155 20154 20153 20152 20151 20150 20149 20148 20147 20146 20145 20144 20143 20142 20141 20140 20139 20138 20137 20136 20135 20134 20133 20132 20131 20130 20129 20128 20127 20126 20125 20124 20123 20122 20121 20120 20119 20118 20117 20116 20115 20114 20113 20112 20111 20110 20109 20108 20107 20106 20105 20104 20103 20102 20101 20100 20099 20098 20097 20096 20095 20094 20093 20092 20091 20090 20089 20088 20087 20086 20085 20084 20083 20082 20081 20080 20079 20078 20077 20076 20075 20074 20073 20072 20071 20070 20069 20068 20067 20066 20065 20064 20063 20062 20061 20060 20059 20058 20057 20056 20055 20054 20053 20052 20051 20050 20049 20048 20047 20046 20045 20044 20043 20042 20041 20040 20039 20038 20037 20036 20035 20034 20033 20032 20031 20030 20029 20028 20027 20026 20025 20024 20023 20022 20021 20020 20019 20018 20017 20016 20015 20014 20013 20012 20011 20010 20009 20008 20007 20006 20005 20004 20003 20002 20001 20000 19999 19998 19997 19996 19995 19994 19993 19992 19991 19990 19989 19988 19987 19986 19985 19984 19983 19982 19981 19980 19979 19978 19977 19976 19975 19974 19973 19972 19971 19970 19969 19968 19967 19966 19965 19964 19963 19962 19961 19960 19959 19958 19957 19956 19955 19954 19953 19952 19951 19950 19949 19948 19947 19946 19945 19944 19943 19942 19941 19940 19939 19938 19937 19936 19935 19934 19933 19932 19931 19930 19929 19928 19927 19926 19925 19924 19923 19922 19921 19920 19919 19918 19917 19916 19915 19914 19913 19912 19911 19910 19909 19908 19907 19906 19905 19904 19903 19902 19901 19900 19899 19898 19897 19896 19895 19894 19893 19892 19891 19890 19889 19888 19887 19886 19885 19884 19883 19882 19881 19880 19879 19878 19877 19876 19875 19874 19873 19872 19871 19870 19869 19868 19867 19866 19865 19864 19863 19862 19861 19860 19859 19858 19857 19856 19855 19854 19853 19852 19851 19850 19849 19848 19847 19846 19845 19844 19843 19842 19841 19840 19839 19838 19837 19836 19835 19834 19833 19832 19831 19830 19829 19828 19827 19826 19825 19824 19823 19822 19821 19820 19819 19818 19817 19816 19815 19814 19813 19812 19811 19810 19809 19808 19807 19806 19805 19804 19803 19802 19801 19800 19799 19798 19797 19796 19795 19794 19793 19792 19791 19790 19789 19788 19787 19786 19785 19784 19783 19782 19781 19780 19779 19778 19777 19776 19775 19774 19773 19772 19771 19770 19769 19768 19767 19766 19765 19764 19763 19762 19761 19760 19759 19758 19757 19756 19755 19754 19753 19752 19751 19750 19749 19748 19747 19746 19745 19744 19743 19742 19741 19740 19739 19738 19737 19736 19735 19734 19733 19732 19731 19730 19729 19728 19727 19726 19725 19724 19723 19722 19721 19720 19719 19718 19717 19716 19715 19714 19713 19712 19711 19710 19709 19708 19707 19706 19705 19704 19703 19702 19701 19700 19699 19698 19697 19696 19695 19694 19693 19692 19691 19690 19689 19688 19687 19686 19685 19684 19683 19682 19681 19680 19679 19678 19677 19676 19675 19674 19673 19672 19671 19670 19669 19668 19667 19666 19665 19664 19663 19662 19661 19660 19659 19658 19657 19656 19655 19654 19653 19652 19651 19650 19649 19648 19647 19646 19645 19644 19643 19642 19641 19640 19639 19638 19637 19636 19635 19634 19633 19632 19631 19630 19629 19628 19627 19626 19625 19624 19623 19622 19621 19620 19619 19618 19617 19616 19615 19614 19613 19612 19611 19610 19609 19608 19607 19606 19605 19604 19603 19602 19601 19600 19599 19598 19597 19596 19595 19594 19593 19592 19591 19590 19589 19588 19587 19586 19585 19584 19583 19582 19581 19580 19579 19578 19577 19576 19575 19574 19573 19572 19571 19570 19569 19568 19567 19566 19565 19564 19563 19562 19561 19560 19559 19558 19557 19556 19555 19554 19553 19552 19551 19550 19549 19548 19547 19546 19545 19544 19543 19542 19541 19540 19539 19538 19537 19536 19535 19534 19533 19532 19531 19530 19529 19528 19527 19526 19525 19524 19523 19522 19521 19520 19519 19518 19517 19516 19515 19514 19513 19512 19511 19510 19509 19508 19507 19506 19505 19504 19503 19502 19501 19500 19499 19498 19497 19496 19495 19494 19493 19492 19491 19490 19489 19488 19487 19486 19485 19484 19483 19482 19481 19480 19479 19478 19477 19476 19475 19474 19473 19472 19471 19470 19469 19468 19467 19466 19465 19464 19463 19462 19461 19460 19459 19458 19457 19456 19455 19454 19453 19452 19451 19450 19449 19448 19447 19446 19445 19444 19443 19442 19441 19440 19439 19438 19437 19436 19435 19434 19433 19432 19431 19430 19429 19428 19427 19426 19425 19424 19423 19422 19421 19420 19419 19418 19417 19416 19415 19414 19413 19412 19411 19410 19409 19408 19407 19406 19405 19404 19403 19402 19401 19400 19399 19398 19397 19396 19395 19394 19393 19392 19391 19390 19389 19388 19387 19386 19385 19384 19383 19382 19381 19380 19379 19378 19377 19376 19375 19374 19373 19372 19371 19370 19369 19368 19367 19366 19365 19364 19363 19362 19361 19360 19359 19358 19357 19356 19355 19354 19353 19352 19351 19350 19349 19348 19347 19346 19345 19344 19343 19342 19341 19340 19339 19338 19337 19336 19335 19334 19333 19332 19331 19330 19329 19328 19327 19326 19325 19324 19323 19322 19321 19320 19319 19318 19317 19316 19315 19314 19313 19312 19311 19310 19309 19308 19307 19306 19305 19304 19303 19302 19301 19300 19299 19298 19297 19296 19295 19294 19293 19292 19291 19290 19289 19288 19287 19286 19285 19284 19283 19282 19281 19280 19279 19278 19277 19276 19275 19274 19273 19272 19271 19270 19269 19268 19267 19266 19265 19264 19263 19262 19261 19260 19259 19258 19257 19256 19255 19254 19253 19252 19251 19250 19249 19248 19247 19246 19245 19244 19243 19242 19241 19240 19239 19238 19237 19236 19235 19234 19233 19232 19231 19230 19229 19228 19227 19226 19225 19224 19223 19222 19221 19220 19219 19218 19217 19216 19215 19214 19213 19212 19211 19210 19209 19208 19207 19206 19205 19204 19203 19202 19201 19200 19199 19198 19197 19196 19195 19194 19193 19192 19191 19190 19189 19188 19187 19186 19185 19184 19183 19182 19181 19180 19179 19178 19177 19176 19175 19174 19173 19172 19171 19170 19169 19168 19167 19166 19165 19164 19163 19162 19161 19160 19159 19158 19157 19156 19155 19154 19153 19152 19151 19150 19149 19148 19147 19146 19145 19144 19143 19142 19141 19140 19139 19138 19137 19136 19135 19134 19133 19132 19131 19130 19129 19128 19127 19126 19125 19124 19123 19122 19121 19120 19119 19118 19117 19116 19115 19114 19113 19112 19111 19110 19109 19108 19107 19106 19105 19104 19103 19102 19101 19100 19099 19098 19097 19096 19095 19094 19093 19092 19091 19090 19089 19088 19087 19086 19085 19084 19083 19082 19081 19080 19079 19078 19077 19076 19075 19074 19073 19072 19071 19070 19069 19068 19067 19066 19065 19064 19063 19062 19061 19060 19059 19058 19057 19056 19055 19054 19053 19052 19051 19050 19049 19048 19047 19046 19045 19044 19043 19042 19041 19040 19039 19038 19037 19036 19035 19034 19033 19032 19031 19030 19029 19028 19027 19026 19025 19024 19023 19022 19021 19020 19019 19018 19017 19016 19015 19014 19013 19012 19011 19010 19009 19008 19007 19006 19005 19004 19003 19002 19001 19000 18999 18998 18997 18996 18995 18994 18993 18992 18991 18990 18989 18988 18987 18986 18985 18984 18983 18982 18981 18980 18979 18978 18977 18976 18975 18974 18973 18972 18971 18970 18969 18968 18967 18966 18965 18964 18963 18962 18961 18960 18959 18958 18957 18956 18955 18954 18953 18952 18951 18950 18949 18948 18947 18946 18945 18944 18943 18942 18941 18940 18939 18938 18937 18936 18935 18934 18933 18932 18931 18930 18929 18928 18927 18926 18925 18924 18923 18922 18921 18920 18919 18918 18917 18916 18915 18914 18913 18912 18911 18910 18909 18908 18907 18906 18905 18904 18903 18902 18901 18900 18899 18898 18897 18896 18895 18894 18893 18892 18891 18890 18889 18888 18887 18886 18885 18884 18883 18882 18881 18880 18879 18878 18877 18876 18875 18874 18873 18872 18871 18870 18869 18868 18867 18866 18865 18864 18863 18862 18861 18860 18859 18858 18857 18856 18855 18854 18853 18852 18851 18850 18849 18848 18847 18846 18845 18844 18843 18842 18841 18840 18839 18838 18837 18836 18835 18834 18833 18832 18831 18830 18829 18828 18827 18826 18825 18824 18823 18822 18821 18820 18819 18818 18817 18816 18815 18814 18813 18812 18811 18810 18809 18808 18807 18806 18805 18804 18803 18802 18801 18800 18799 18798 18797 18796 18795 18794 18793 18792 18791 18790 18789 18788 18787 18786 18785 18784 18783 18782 18781 18780 18779 18778 18777 18776 18775 18774 18773 18772 18771 18770 18769 18768 18767 18766 18765 18764 18763 18762 18761 18760 18759 18758 18757 18756 18755 18754 18753 18752 18751 18750 18749 18748 18747 18746 18745 18744 18743 18742 18741 18740 18739 18738 18737 18736 18735 18734 18733 18732 18731 18730 18729 18728 18727 18726 18725 18724 18723 18722 18721 18720 18719 18718 18717 18716 18715 18714 18713 18712 18711 18710 18709 18708 18707 18706 18705 18704 18703 18702 18701 18700 18699 18698 18697 18696 18695 18694 18693 18692 18691 18690 18689 18688 18687 18686 18685 18684 18683 18682 18681 18680 18679 18678 18677 18676 18675 18674 18673 18672 18671 18670 18669 18668 18667 18666 18665 18664 18663 18662 18661 18660 18659 18658 18657 18656 18655 18654 18653 18652 18651 18650 18649 18648 18647 18646 18645 18644 18643 18642 18641 18640 18639 18638 18637 18636 18635 18634 18633 18632 18631 18630 18629 18628 18627 18626 18625 18624 18623 18622 18621 18620 18619 18618 18617 18616 18615 18614 18613 18612 18611 18610 18609 18608 18607 18606 18605 18604 18603 18602 18601 18600 18599 18598 18597 18596 18595 18594 18593 18592 18591 18590 18589 18588 18587 18586 18585 18584 18583 18582 18581 18580 18579 18578 18577 18576 18575 18574 18573 18572 18571 18570 18569 18568 18567 18566 18565 18564 18563 18562 18561 18560 18559 18558 18557 18556 18555 18554 18553 18552 18551 18550 18549 18548 18547 18546 18545 18544 18543 18542 18541 18540 18539 18538 18537 18536 18535 18534 18533 18532 18531 18530 18529 18528 18527 18526 18525 18524 18523 18522 18521 18520 18519 18518 18517 18516 18515 18514 18513 18512 18511 18510 18509 18508 18507 18506 18505 18504 18503 18502 18501 18500 18499 18498 18497 18496 18495 18494 18493 18492 18491 18490 18489 18488 18487 18486 18485 18484 18483 18482 18481 18480 18479 18478 18477 18476 18475 18474 18473 18472 18471 18470 18469 18468 18467 18466 18465 18464 18463 18462 18461 18460 18459 18458 18457 18456 18455 18454 18453 18452 18451 18450 18449 18448 18447 18446 18445 18444 18443 18442 18441 18440 18439 18438 18437 18436 18435 18434 18433 18432 18431 18430 18429 18428 18427 18426 18425 18424 18423 18422 18421 18420 18419 18418 18417 18416 18415 18414 18413 18412 18411 18410 18409 18408 18407 18406 18405 18404 18403 18402 18401 18400 18399 18398 18397 18396 18395 18394 18393 18392 18391 18390 18389 18388 18387 18386 18385 18384 18383 18382 18381 18380 18379 18378 18377 18376 18375 18374 18373 18372 18371 18370 18369 18368 18367 18366 18365 18364 18363 18362 18361 18360 18359 18358 18357 18356 18355 18354 18353 18352 18351 18350 18349 18348 18347 18346 18345 18344 18343 18342 18341 18340 18339 18338 18337 18336 18335 18334 18333 18332 18331 18330 18329 18328 18327 18326 18325 18324 18323 18322 18321 18320 18319 18318 18317 18316 18315 18314 18313 18312 18311 18310 18309 18308 18307 18306 18305 18304 18303 18302 18301 18300 18299 18298 18297 18296 18295 18294 18293 18292 18291 18290 18289 18288 18287 18286 18285 18284 18283 18282 18281 18280 18279 18278 18277 18276 18275 18274 18273 18272 18271 18270 18269 18268 18267 18266 18265 18264 18263 18262 18261 18260 18259 18258 18257 18256 18255 18254 18253 18252 18251 18250 18249 18248 18247 18246 18245 18244 18243 18242 18241 18240 18239 18238 18237 18236 18235 18234 18233 18232 18231 18230 18229 18228 18227 18226 18225 18224 18223 18222 18221 18220 18219 18218 18217 18216 18215 18214 18213 18212 18211 18210 18209 18208 18207 18206 18205 18204 18203 18202 18201 18200 18199 18198 18197 18196 18195 18194 18193 18192 18191 18190 18189 18188 18187 18186 18185 18184 18183 18182 18181 18180 18179 18178 18177 18176 18175 18174 18173 18172 18171 18170 18169 18168 18167 18166 18165 18164 18163 18162 18161 18160 18159 18158 18157 18156 18155 18154 18153 18152 18151 18150 18149 18148 18147 18146 18145 18144 18143 18142 18141 18140 18139 18138 18137 18136 18135 18134 18133 18132 18131 18130 18129 18128 18127 18126 18125 18124 18123 18122 18121 18120 18119 18118 18117 18116 18115 18114 18113 18112 18111 18110 18109 18108 18107 18106 18105 18104 18103 18102 18101 18100 18099 18098 18097 18096 18095 18094 18093 18092 18091 18090 18089 18088 18087 18086 18085 18084 18083 18082 18081 18080 18079 18078 18077 18076 18075 18074 18073 18072 18071 18070 18069 18068 18067 18066 18065 18064 18063 18062 18061 18060 18059 18058 18057 18056 18055 18054 18053 18052 18051 18050 18049 18048 18047 18046 18045 18044 18043 18042 18041 18040 18039 18038 18037 18036 18035 18034 18033 18032 18031 18030 18029 18028 18027 18026 18025 18024 18023 18022 18021 18020 18019 18018 18017 18016 18015 18014 18013 18012 18011 18010 18009 18008 18007 18006 18005 18004 18003 18002 18001 18000 17999 17998 17997 17996 17995 17994 17993 17992 17991 17990 17989 17988 17987 17986 17985 17984 17983 17982 17981 17980 17979 17978 17977 17976 17975 17974 17973 17972 17971 17970 17969 17968 17967 17966 17965 17964 17963 17962 17961 17960 17959 17958 17957 17956 17955 17954 17953 17952 17951 17950 17949 17948 17947 17946 17945 17944 17943 17942 17941 17940 17939 17938 17937 17936 17935 17934 17933 17932 17931 17930 17929 17928 17927 17926 17925 17924 17923 17922 17921 17920 17919 17918 17917 17916 17915 17914 17913 17912 17911 17910 17909 17908 17907 17906 17905 17904 17903 17902 17901 17900 17899 17898 17897 17896 17895 17894 17893 17892 17891 17890 17889 17888 17887 17886 17885 17884 17883 17882 17881 17880 17879 17878 17877 17876 17875 17874 17873 17872 17871 17870 17869 17868 17867 17866 17865 17864 17863 17862 17861 17860 17859 17858 17857 17856 17855 17854 17853 17852 17851 17850 17849 17848 17847 17846 17845 17844 17843 17842 17841 17840 17839 17838 17837 17836 17835 17834 17833 17832 17831 17830 17829 17828 17827 17826 17825 17824 17823 17822 17821 17820 17819 17818 17817 17816 17815 17814 17813 17812 17811 17810 17809 17808 17807 17806 17805 17804 17803 17802 17801 17800 17799 17798 17797 17796 17795 17794 17793 17792 17791 17790 17789 17788 17787 17786 17785 17784 17783 17782 17781 17780 17779 17778 17777 17776 17775 17774 17773 17772 17771 17770 17769 17768 17767 17766 17765 17764 17763 17762 17761 17760 17759 17758 17757 17756 17755 17754 17753 17752 17751 17750 17749 17748 17747 17746 17745 17744 17743 17742 17741 17740 17739 17738 17737 17736 17735 17734 17733 17732 17731 17730 17729 17728 17727 17726 17725 17724 17723 17722 17721 17720 17719 17718 17717 17716 17715 17714 17713 17712 17711 17710 17709 17708 17707 17706 17705 17704 17703 17702 17701 17700 17699 17698 17697 17696 17695 17694 17693 17692 17691 17690 17689 17688 17687 17686 17685 17684 17683 17682 17681 17680 17679 17678 17677 17676 17675 17674 17673 17672 17671 17670 17669 17668 17667 17666 17665 17664 17663 17662 17661 17660 17659 17658 17657 17656 17655 17654 17653 17652 17651 17650 17649 17648 17647 17646 17645 17644 17643 17642 17641 17640 17639 17638 17637 17636 17635 17634 17633 17632 17631 17630 17629 17628 17627 17626 17625 17624 17623 17622 17621 17620 17619 17618 17617 17616 17615 17614 17613 17612 17611 17610 17609 17608 17607 17606 17605 17604 17603 17602 17601 17600 17599 17598 17597 17596 17595 17594 17593 17592 17591 17590 17589 17588 17587 17586 17585 17584 17583 17582 17581 17580 17579 17578 17577 17576 17575 17574 17573 17572 17571 17570 17569 17568 17567 17566 17565 17564 17563 17562 17561 17560 17559 17558 17557 17556 17555 17554 17553 17552 17551 17550 17549 17548 17547 17546 17545 17544 17543 17542 17541 17540 17539 17538 17537 17536 17535 17534 17533 17532 17531 17530 17529 17528 17527 17526 17525 17524 17523 17522 17521 17520 17519 17518 17517 17516 17515 17514 17513 17512 17511 17510 17509 17508 17507 17506 17505 17504 17503 17502 17501 17500 17499 17498 17497 17496 17495 17494 17493 17492 17491 17490 17489 17488 17487 17486 17485 17484 17483 17482 17481 17480 17479 17478 17477 17476 17475 17474 17473 17472 17471 17470 17469 17468 17467 17466 17465 17464 17463 17462 17461 17460 17459 17458 17457 17456 17455 17454 17453 17452 17451 17450 17449 17448 17447 17446 17445 17444 17443 17442 17441 17440 17439 17438 17437 17436 17435 17434 17433 17432 17431 17430 17429 17428 17427 17426 17425 17424 17423 17422 17421 17420 17419 17418 17417 17416 17415 17414 17413 17412 17411 17410 17409 17408 17407 17406 17405 17404 17403 17402 17401 17400 17399 17398 17397 17396 17395 17394 17393 17392 17391 17390 17389 17388 17387 17386 17385 17384 17383 17382 17381 17380 17379 17378 17377 17376 17375 17374 17373 17372 17371 17370 17369 17368 17367 17366 17365 17364 17363 17362 17361 17360 17359 17358 17357 17356 17355 17354 17353 17352 17351 17350 17349 17348 17347 17346 17345 17344 17343 17342 17341 17340 17339 17338 17337 17336 17335 17334 17333 17332 17331 17330 17329 17328 17327 17326 17325 17324 17323 17322 17321 17320 17319 17318 17317 17316 17315 17314 17313 17312 17311 17310 17309 17308 17307 17306 17305 17304 17303 17302 17301 17300 17299 17298 17297 17296 17295 17294 17293 17292 17291 17290 17289 17288 17287 17286 17285 17284 17283 17282 17281 17280 17279 17278 17277 17276 17275 17274 17273 17272 17271 17270 17269 17268 17267 17266 17265 17264 17263 17262 17261 17260 17259 17258 17257 17256 17255 17254 17253 17252 17251 17250 17249 17248 17247 17246 17245 17244 17243 17242 17241 17240 17239 17238 17237 17236 17235 17234 17233 17232 17231 17230 17229 17228 17227 17226 17225 17224 17223 17222 17221 17220 17219 17218 17217 17216 17215 17214 17213 17212 17211 17210 17209 17208 17207 17206 17205 17204 17203 17202 17201 17200 17199 17198 17197 17196 17195 17194 17193 17192 17191 17190 17189 17188 17187 17186 17185 17184 17183 17182 17181 17180 17179 17178 17177 17176 17175 17174 17173 17172 17171 17170 17169 17168 17167 17166 17165 17164 17163 17162 17161 17160 17159 17158 17157 17156 17155 17154 17153 17152 17151 17150 17149 17148 17147 17146 17145 17144 17143 17142 17141 17140 17139 17138 17137 17136 17135 17134 17133 17132 17131 17130 17129 17128 17127 17126 17125 17124 17123 17122 17121 17120 17119 17118 17117 17116 17115 17114 17113 17112 17111 17110 17109 17108 17107 17106 17105 17104 17103 17102 17101 17100 17099 17098 17097 17096 17095 17094 17093 17092 17091 17090 17089 17088 17087 17086 17085 17084 17083 17082 17081 17080 17079 17078 17077 17076 17075 17074 17073 17072 17071 17070 17069 17068 17067 17066 17065 17064 17063 17062 17061 17060 17059 17058 17057 17056 17055 17054 17053 17052 17051 17050 17049 17048 17047 17046 17045 17044 17043 17042 17041 17040 17039 17038 17037 17036 17035 17034 17033 17032 17031 17030 17029 17028 17027 17026 17025 17024 17023 17022 17021 17020 17019 17018 17017 17016 17015 17014 17013 17012 17011 17010 17009 17008 17007 17006 17005 17004 17003 17002 17001 17000 16999 16998 16997 16996 16995 16994 16993 16992 16991 16990 16989 16988 16987 16986 16985 16984 16983 16982 16981 16980 16979 16978 16977 16976 16975 16974 16973 16972 16971 16970 16969 16968 16967 16966 16965 16964 16963 16962 16961 16960 16959 16958 16957 16956 16955 16954 16953 16952 16951 16950 16949 16948 16947 16946 16945 16944 16943 16942 16941 16940 16939 16938 16937 16936 16935 16934 16933 16932 16931 16930 16929 16928 16927 16926 16925 16924 16923 16922 16921 16920 16919 16918 16917 16916 16915 16914 16913 16912 16911 16910 16909 16908 16907 16906 16905 16904 16903 16902 16901 16900 16899 16898 16897 16896 16895 16894 16893 16892 16891 16890 16889 16888 16887 16886 16885 16884 16883 16882 16881 16880 16879 16878 16877 16876 16875 16874 16873 16872 16871 16870 16869 16868 16867 16866 16865 16864 16863 16862 16861 16860 16859 16858 16857 16856 16855 16854 16853 16852 16851 16850 16849 16848 16847 16846 16845 16844 16843 16842 16841 16840 16839 16838 16837 16836 16835 16834 16833 16832 16831 16830 16829 16828 16827 16826 16825 16824 16823 16822 16821 16820 16819 16818 16817 16816 16815 16814 16813 16812 16811 16810 16809 16808 16807 16806 16805 16804 16803 16802 16801 16800 16799 16798 16797 16796 16795 16794 16793 16792 16791 16790 16789 16788 16787 16786 16785 16784 16783 16782 16781 16780 16779 16778 16777 16776 16775 16774 16773 16772 16771 16770 16769 16768 16767 16766 16765 16764 16763 16762 16761 16760 16759 16758 16757 16756 16755 16754 16753 16752 16751 16750 16749 16748 16747 16746 16745 16744 16743 16742 16741 16740 16739 16738 16737 16736 16735 16734 16733 16732 16731 16730 16729 16728 16727 16726 16725 16724 16723 16722 16721 16720 16719 16718 16717 16716 16715 16714 16713 16712 16711 16710 16709 16708 16707 16706 16705 16704 16703 16702 16701 16700 16699 16698 16697 16696 16695 16694 16693 16692 16691 16690 16689 16688 16687 16686 16685 16684 16683 16682 16681 16680 16679 16678 16677 16676 16675 16674 16673 16672 16671 16670 16669 16668 16667 16666 16665 16664 16663 16662 16661 16660 16659 16658 16657 16656 16655 16654 16653 16652 16651 16650 16649 16648 16647 16646 16645 16644 16643 16642 16641 16640 16639 16638 16637 16636 16635 16634 16633 16632 16631 16630 16629 16628 16627 16626 16625 16624 16623 16622 16621 16620 16619 16618 16617 16616 16615 16614 16613 16612 16611 16610 16609 16608 16607 16606 16605 16604 16603 16602 16601 16600 16599 16598 16597 16596 16595 16594 16593 16592 16591 16590 16589 16588 16587 16586 16585 16584 16583 16582 16581 16580 16579 16578 16577 16576 16575 16574 16573 16572 16571 16570 16569 16568 16567 16566 16565 16564 16563 16562 16561 16560 16559 16558 16557 16556 16555 16554 16553 16552 16551 16550 16549 16548 16547 16546 16545 16544 16543 16542 16541 16540 16539 16538 16537 16536 16535 16534 16533 16532 16531 16530 16529 16528 16527 16526 16525 16524 16523 16522 16521 16520 16519 16518 16517 16516 16515 16514 16513 16512 16511 16510 16509 16508 16507 16506 16505 16504 16503 16502 16501 16500 16499 16498 16497 16496 16495 16494 16493 16492 16491 16490 16489 16488 16487 16486 16485 16484 16483 16482 16481 16480 16479 16478 16477 16476 16475 16474 16473 16472 16471 16470 16469 16468 16467 16466 16465 16464 16463 16462 16461 16460 16459 16458 16457 16456 16455 16454 16453 16452 16451 16450 16449 16448 16447 16446 16445 16444 16443 16442 16441 16440 16439 16438 16437 16436 16435 16434 16433 16432 16431 16430 16429 16428 16427 16426 16425 16424 16423 16422 16421 16420 16419 16418 16417 16416 16415 16414 16413 16412 16411 16410 16409 16408 16407 16406 16405 16404 16403 16402 16401 16400 16399 16398 16397 16396 16395 16394 16393 16392 16391 16390 16389 16388 16387 16386 16385 16384 16383 16382 16381 16380 16379 16378 16377 16376 16375 16374 16373 16372 16371 16370 16369 16368 16367 16366 16365 16364 16363 16362 16361 16360 16359 16358 16357 16356 16355 16354 16353 16352 16351 16350 16349 16348 16347 16346 16345 16344 16343 16342 16341 16340 16339 16338 16337 16336 16335 16334 16333 16332 16331 16330 16329 16328 16327 16326 16325 16324 16323 16322 16321 16320 16319 16318 16317 16316 16315 16314 16313 16312 16311 16310 16309 16308 16307 16306 16305 16304 16303 16302 16301 16300 16299 16298 16297 16296 16295 16294 16293 16292 16291 16290 16289 16288 16287 16286 16285 16284 16283 16282 16281 16280 16279 16278 16277 16276 16275 16274 16273 16272 16271 16270 16269 16268 16267 16266 16265 16264 16263 16262 16261 16260 16259 16258 16257 16256 16255 16254 16253 16252 16251 16250 16249 16248 16247 16246 16245 16244 16243 16242 16241 16240 16239 16238 16237 16236 16235 16234 16233 16232 16231 16230 16229 16228 16227 16226 16225 16224 16223 16222 16221 16220 16219 16218 16217 16216 16215 16214 16213 16212 16211 16210 16209 16208 16207 16206 16205 16204 16203 16202 16201 16200 16199 16198 16197 16196 16195 16194 16193 16192 16191 16190 16189 16188 16187 16186 16185 16184 16183 16182 16181 16180 16179 16178 16177 16176 16175 16174 16173 16172 16171 16170 16169 16168 16167 16166 16165 16164 16163 16162 16161 16160 16159 16158 16157 16156 16155 16154 16153 16152 16151 16150 16149 16148 16147 16146 16145 16144 16143 16142 16141 16140 16139 16138 16137 16136 16135 16134 16133 16132 16131 16130 16129 16128 16127 16126 16125 16124 16123 16122 16121 16120 16119 16118 16117 16116 16115 16114 16113 16112 16111 16110 16109 16108 16107 16106 16105 16104 16103 16102 16101 16100 16099 16098 16097 16096 16095 16094 16093 16092 16091 16090 16089 16088 16087 16086 16085 16084 16083 16082 16081 16080 16079 16078 16077 16076 16075 16074 16073 16072 16071 16070 16069 16068 16067 16066 16065 16064 16063 16062 16061 16060 16059 16058 16057 16056 16055 16054 16053 16052 16051 16050 16049 16048 16047 16046 16045 16044 16043 16042 16041 16040 16039 16038 16037 16036 16035 16034 16033 16032 16031 16030 16029 16028 16027 16026 16025 16024 16023 16022 16021 16020 16019 16018 16017 16016 16015 16014 16013 16012 16011 16010 16009 16008 16007 16006 16005 16004 16003 16002 16001 16000 15999 15998 15997 15996 15995 15994 15993 15992 15991 15990 15989 15988 15987 15986 15985 15984 15983 15982 15981 15980 15979 15978 15977 15976 15975 15974 15973 15972 15971 15970 15969 15968 15967 15966 15965 15964 15963 15962 15961 15960 15959 15958 15957 15956 15955 15954 15953 15952 15951 15950 15949 15948 15947 15946 15945 15944 15943 15942 15941 15940 15939 15938 15937 15936 15935 15934 15933 15932 15931 15930 15929 15928 15927 15926 15925 15924 15923 15922 15921 15920 15919 15918 15917 15916 15915 15914 15913 15912 15911 15910 15909 15908 15907 15906 15905 15904 15903 15902 15901 15900 15899 15898 15897 15896 15895 15894 15893 15892 15891 15890 15889 15888 15887 15886 15885 15884 15883 15882 15881 15880 15879 15878 15877 15876 15875 15874 15873 15872 15871 15870 15869 15868 15867 15866 15865 15864 15863 15862 15861 15860 15859 15858 15857 15856 15855 15854 15853 15852 15851 15850 15849 15848 15847 15846 15845 15844 15843 15842 15841 15840 15839 15838 15837 15836 15835 15834 15833 15832 15831 15830 15829 15828 15827 15826 15825 15824 15823 15822 15821 15820 15819 15818 15817 15816 15815 15814 15813 15812 15811 15810 15809 15808 15807 15806 15805 15804 15803 15802 15801 15800 15799 15798 15797 15796 15795 15794 15793 15792 15791 15790 15789 15788 15787 15786 15785 15784 15783 15782 15781 15780 15779 15778 15777 15776 15775 15774 15773 15772 15771 15770 15769 15768 15767 15766 15765 15764 15763 15762 15761 15760 15759 15758 15757 15756 15755 15754 15753 15752 15751 15750 15749 15748 15747 15746 15745 15744 15743 15742 15741 15740 15739 15738 15737 15736 15735 15734 15733 15732 15731 15730 15729 15728 15727 15726 15725 15724 15723 15722 15721 15720 15719 15718 15717 15716 15715 15714 15713 15712 15711 15710 15709 15708 15707 15706 15705 15704 15703 15702 15701 15700 15699 15698 15697 15696 15695 15694 15693 15692 15691 15690 15689 15688 15687 15686 15685 15684 15683 15682 15681 15680 15679 15678 15677 15676 15675 15674 15673 15672 15671 15670 15669 15668 15667 15666 15665 15664 15663 15662 15661 15660 15659 15658 15657 15656 15655 15654 15653 15652 15651 15650 15649 15648 15647 15646 15645 15644 15643 15642 15641 15640 15639 15638 15637 15636 15635 15634 15633 15632 15631 15630 15629 15628 15627 15626 15625 15624 15623 15622 15621 15620 15619 15618 15617 15616 15615 15614 15613 15612 15611 15610 15609 15608 15607 15606 15605 15604 15603 15602 15601 15600 15599 15598 15597 15596 15595 15594 15593 15592 15591 15590 15589 15588 15587 15586 15585 15584 15583 15582 15581 15580 15579 15578 15577 15576 15575 15574 15573 15572 15571 15570 15569 15568 15567 15566 15565 15564 15563 15562 15561 15560 15559 15558 15557 15556 15555 15554 15553 15552 15551 15550 15549 15548 15547 15546 15545 15544 15543 15542 15541 15540 15539 15538 15537 15536 15535 15534 15533 15532 15531 15530 15529 15528 15527 15526 15525 15524 15523 15522 15521 15520 15519 15518 15517 15516 15515 15514 15513 15512 15511 15510 15509 15508 15507 15506 15505 15504 15503 15502 15501 15500 15499 15498 15497 15496 15495 15494 15493 15492 15491 15490 15489 15488 15487 15486 15485 15484 15483 15482 15481 15480 15479 15478 15477 15476 15475 15474 15473 15472 15471 15470 15469 15468 15467 15466 15465 15464 15463 15462 15461 15460 15459 15458 15457 15456 15455 15454 15453 15452 15451 15450 15449 15448 15447 15446 15445 15444 15443 15442 15441 15440 15439 15438 15437 15436 15435 15434 15433 15432 15431 15430 15429 15428 15427 15426 15425 15424 15423 15422 15421 15420 15419 15418 15417 15416 15415 15414 15413 15412 15411 15410 15409 15408 15407 15406 15405 15404 15403 15402 15401 15400 15399 15398 15397 15396 15395 15394 15393 15392 15391 15390 15389 15388 15387 15386 15385 15384 15383 15382 15381 15380 15379 15378 15377 15376 15375 15374 15373 15372 15371 15370 15369 15368 15367 15366 15365 15364 15363 15362 15361 15360 15359 15358 15357 15356 15355 15354 15353 15352 15351 15350 15349 15348 15347 15346 15345 15344 15343 15342 15341 15340 15339 15338 15337 15336 15335 15334 15333 15332 15331 15330 15329 15328 15327 15326 15325 15324 15323 15322 15321 15320 15319 15318 15317 15316 15315 15314 15313 15312 15311 15310 15309 15308 15307 15306 15305 15304 15303 15302 15301 15300 15299 15298 15297 15296 15295 15294 15293 15292 15291 15290 15289 15288 15287 15286 15285 15284 15283 15282 15281 15280 15279 15278 15277 15276 15275 15274 15273 15272 15271 15270 15269 15268 15267 15266 15265 15264 15263 15262 15261 15260 15259 15258 15257 15256 15255 15254 15253 15252 15251 15250 15249 15248 15247 15246 15245 15244 15243 15242 15241 15240 15239 15238 15237 15236 15235 15234 15233 15232 15231 15230 15229 15228 15227 15226 15225 15224 15223 15222 15221 15220 15219 15218 15217 15216 15215 15214 15213 15212 15211 15210 15209 15208 15207 15206 15205 15204 15203 15202 15201 15200 15199 15198 15197 15196 15195 15194 15193 15192 15191 15190 15189 15188 15187 15186 15185 15184 15183 15182 15181 15180 15179 15178 15177 15176 15175 15174 15173 15172 15171 15170 15169 15168 15167 15166 15165 15164 15163 15162 15161 15160 15159 15158 15157 15156 15155 15154 15153 15152 15151 15150 15149 15148 15147 15146 15145 15144 15143 15142 15141 15140 15139 15138 15137 15136 15135 15134 15133 15132 15131 15130 15129 15128 15127 15126 15125 15124 15123 15122 15121 15120 15119 15118 15117 15116 15115 15114 15113 15112 15111 15110 15109 15108 15107 15106 15105 15104 15103 15102 15101 15100 15099 15098 15097 15096 15095 15094 15093 15092 15091 15090 15089 15088 15087 15086 15085 15084 15083 15082 15081 15080 15079 15078 15077 15076 15075 15074 15073 15072 15071 15070 15069 15068 15067 15066 15065 15064 15063 15062 15061 15060 15059 15058 15057 15056 15055 15054 15053 15052 15051 15050 15049 15048 15047 15046 15045 15044 15043 15042 15041 15040 15039 15038 15037 15036 15035 15034 15033 15032 15031 15030 15029 15028 15027 15026 15025 15024 15023 15022 15021 15020 15019 15018 15017 15016 15015 15014 15013 15012 15011 15010 15009 15008 15007 15006 15005 15004 15003 15002 15001 15000 14999 14998 14997 14996 14995 14994 14993 14992 14991 14990 14989 14988 14987 14986 14985 14984 14983 14982 14981 14980 14979 14978 14977 14976 14975 14974 14973 14972 14971 14970 14969 14968 14967 14966 14965 14964 14963 14962 14961 14960 14959 14958 14957 14956 14955 14954 14953 14952 14951 14950 14949 14948 14947 14946 14945 14944 14943 14942 14941 14940 14939 14938 14937 14936 14935 14934 14933 14932 14931 14930 14929 14928 14927 14926 14925 14924 14923 14922 14921 14920 14919 14918 14917 14916 14915 14914 14913 14912 14911 14910 14909 14908 14907 14906 14905 14904 14903 14902 14901 14900 14899 14898 14897 14896 14895 14894 14893 14892 14891 14890 14889 14888 14887 14886 14885 14884 14883 14882 14881 14880 14879 14878 14877 14876 14875 14874 14873 14872 14871 14870 14869 14868 14867 14866 14865 14864 14863 14862 14861 14860 14859 14858 14857 14856 14855 14854 14853 14852 14851 14850 14849 14848 14847 14846 14845 14844 14843 14842 14841 14840 14839 14838 14837 14836 14835 14834 14833 14832 14831 14830 14829 14828 14827 14826 14825 14824 14823 14822 14821 14820 14819 14818 14817 14816 14815 14814 14813 14812 14811 14810 14809 14808 14807 14806 14805 14804 14803 14802 14801 14800 14799 14798 14797 14796 14795 14794 14793 14792 14791 14790 14789 14788 14787 14786 14785 14784 14783 14782 14781 14780 14779 14778 14777 14776 14775 14774 14773 14772 14771 14770 14769 14768 14767 14766 14765 14764 14763 14762 14761 14760 14759 14758 14757 14756 14755 14754 14753 14752 14751 14750 14749 14748 14747 14746 14745 14744 14743 14742 14741 14740 14739 14738 14737 14736 14735 14734 14733 14732 14731 14730 14729 14728 14727 14726 14725 14724 14723 14722 14721 14720 14719 14718 14717 14716 14715 14714 14713 14712 14711 14710 14709 14708 14707 14706 14705 14704 14703 14702 14701 14700 14699 14698 14697 14696 14695 14694 14693 14692 14691 14690 14689 14688 14687 14686 14685 14684 14683 14682 14681 14680 14679 14678 14677 14676 14675 14674 14673 14672 14671 14670 14669 14668 14667 14666 14665 14664 14663 14662 14661 14660 14659 14658 14657 14656 14655 14654 14653 14652 14651 14650 14649 14648 14647 14646 14645 14644 14643 14642 14641 14640 14639 14638 14637 14636 14635 14634 14633 14632 14631 14630 14629 14628 14627 14626 14625 14624 14623 14622 14621 14620 14619 14618 14617 14616 14615 14614 14613 14612 14611 14610 14609 14608 14607 14606 14605 14604 14603 14602 14601 14600 14599 14598 14597 14596 14595 14594 14593 14592 14591 14590 14589 14588 14587 14586 14585 14584 14583 14582 14581 14580 14579 14578 14577 14576 14575 14574 14573 14572 14571 14570 14569 14568 14567 14566 14565 14564 14563 14562 14561 14560 14559 14558 14557 14556 14555 14554 14553 14552 14551 14550 14549 14548 14547 14546 14545 14544 14543 14542 14541 14540 14539 14538 14537 14536 14535 14534 14533 14532 14531 14530 14529 14528 14527 14526 14525 14524 14523 14522 14521 14520 14519 14518 14517 14516 14515 14514 14513 14512 14511 14510 14509 14508 14507 14506 14505 14504 14503 14502 14501 14500 14499 14498 14497 14496 14495 14494 14493 14492 14491 14490 14489 14488 14487 14486 14485 14484 14483 14482 14481 14480 14479 14478 14477 14476 14475 14474 14473 14472 14471 14470 14469 14468 14467 14466 14465 14464 14463 14462 14461 14460 14459 14458 14457 14456 14455 14454 14453 14452 14451 14450 14449 14448 14447 14446 14445 14444 14443 14442 14441 14440 14439 14438 14437 14436 14435 14434 14433 14432 14431 14430 14429 14428 14427 14426 14425 14424 14423 14422 14421 14420 14419 14418 14417 14416 14415 14414 14413 14412 14411 14410 14409 14408 14407 14406 14405 14404 14403 14402 14401 14400 14399 14398 14397 14396 14395 14394 14393 14392 14391 14390 14389 14388 14387 14386 14385 14384 14383 14382 14381 14380 14379 14378 14377 14376 14375 14374 14373 14372 14371 14370 14369 14368 14367 14366 14365 14364 14363 14362 14361 14360 14359 14358 14357 14356 14355 14354 14353 14352 14351 14350 14349 14348 14347 14346 14345 14344 14343 14342 14341 14340 14339 14338 14337 14336 14335 14334 14333 14332 14331 14330 14329 14328 14327 14326 14325 14324 14323 14322 14321 14320 14319 14318 14317 14316 14315 14314 14313 14312 14311 14310 14309 14308 14307 14306 14305 14304 14303 14302 14301 14300 14299 14298 14297 14296 14295 14294 14293 14292 14291 14290 14289 14288 14287 14286 14285 14284 14283 14282 14281 14280 14279 14278 14277 14276 14275 14274 14273 14272 14271 14270 14269 14268 14267 14266 14265 14264 14263 14262 14261 14260 14259 14258 14257 14256 14255 14254 14253 14252 14251 14250 14249 14248 14247 14246 14245 14244 14243 14242 14241 14240 14239 14238 14237 14236 14235 14234 14233 14232 14231 14230 14229 14228 14227 14226 14225 14224 14223 14222 14221 14220 14219 14218 14217 14216 14215 14214 14213 14212 14211 14210 14209 14208 14207 14206 14205 14204 14203 14202 14201 14200 14199 14198 14197 14196 14195 14194 14193 14192 14191 14190 14189 14188 14187 14186 14185 14184 14183 14182 14181 14180 14179 14178 14177 14176 14175 14174 14173 14172 14171 14170 14169 14168 14167 14166 14165 14164 14163 14162 14161 14160 14159 14158 14157 14156 14155 14154 14153 14152 14151 14150 14149 14148 14147 14146 14145 14144 14143 14142 14141 14140 14139 14138 14137 14136 14135 14134 14133 14132 14131 14130 14129 14128 14127 14126 14125 14124 14123 14122 14121 14120 14119 14118 14117 14116 14115 14114 14113 14112 14111 14110 14109 14108 14107 14106 14105 14104 14103 14102 14101 14100 14099 14098 14097 14096 14095 14094 14093 14092 14091 14090 14089 14088 14087 14086 14085 14084 14083 14082 14081 14080 14079 14078 14077 14076 14075 14074 14073 14072 14071 14070 14069 14068 14067 14066 14065 14064 14063 14062 14061 14060 14059 14058 14057 14056 14055 14054 14053 14052 14051 14050 14049 14048 14047 14046 14045 14044 14043 14042 14041 14040 14039 14038 14037 14036 14035 14034 14033 14032 14031 14030 14029 14028 14027 14026 14025 14024 14023 14022 14021 14020 14019 14018 14017 14016 14015 14014 14013 14012 14011 14010 14009 14008 14007 14006 14005 14004 14003 14002 14001 14000 13999 13998 13997 13996 13995 13994 13993 13992 13991 13990 13989 13988 13987 13986 13985 13984 13983 13982 13981 13980 13979 13978 13977 13976 13975 13974 13973 13972 13971 13970 13969 13968 13967 13966 13965 13964 13963 13962 13961 13960 13959 13958 13957 13956 13955 13954 13953 13952 13951 13950 13949 13948 13947 13946 13945 13944 13943 13942 13941 13940 13939 13938 13937 13936 13935 13934 13933 13932 13931 13930 13929 13928 13927 13926 13925 13924 13923 13922 13921 13920 13919 13918 13917 13916 13915 13914 13913 13912 13911 13910 13909 13908 13907 13906 13905 13904 13903 13902 13901 13900 13899 13898 13897 13896 13895 13894 13893 13892 13891 13890 13889 13888 13887 13886 13885 13884 13883 13882 13881 13880 13879 13878 13877 13876 13875 13874 13873 13872 13871 13870 13869 13868 13867 13866 13865 13864 13863 13862 13861 13860 13859 13858 13857 13856 13855 13854 13853 13852 13851 13850 13849 13848 13847 13846 13845 13844 13843 13842 13841 13840 13839 13838 13837 13836 13835 13834 13833 13832 13831 13830 13829 13828 13827 13826 13825 13824 13823 13822 13821 13820 13819 13818 13817 13816 13815 13814 13813 13812 13811 13810 13809 13808 13807 13806 13805 13804 13803 13802 13801 13800 13799 13798 13797 13796 13795 13794 13793 13792 13791 13790 13789 13788 13787 13786 13785 13784 13783 13782 13781 13780 13779 13778 13777 13776 13775 13774 13773 13772 13771 13770 13769 13768 13767 13766 13765 13764 13763 13762 13761 13760 13759 13758 13757 13756 13755 13754 13753 13752 13751 13750 13749 13748 13747 13746 13745 13744 13743 13742 13741 13740 13739 13738 13737 13736 13735 13734 13733 13732 13731 13730 13729 13728 13727 13726 13725 13724 13723 13722 13721 13720 13719 13718 13717 13716 13715 13714 13713 13712 13711 13710 13709 13708 13707 13706 13705 13704 13703 13702 13701 13700 13699 13698 13697 13696 13695 13694 13693 13692 13691 13690 13689 13688 13687 13686 13685 13684 13683 13682 13681 13680 13679 13678 13677 13676 13675 13674 13673 13672 13671 13670 13669 13668 13667 13666 13665 13664 13663 13662 13661 13660 13659 13658 13657 13656 13655 13654 13653 13652 13651 13650 13649 13648 13647 13646 13645 13644 13643 13642 13641 13640 13639 13638 13637 13636 13635 13634 13633 13632 13631 13630 13629 13628 13627 13626 13625 13624 13623 13622 13621 13620 13619 13618 13617 13616 13615 13614 13613 13612 13611 13610 13609 13608 13607 13606 13605 13604 13603 13602 13601 13600 13599 13598 13597 13596 13595 13594 13593 13592 13591 13590 13589 13588 13587 13586 13585 13584 13583 13582 13581 13580 13579 13578 13577 13576 13575 13574 13573 13572 13571 13570 13569 13568 13567 13566 13565 13564 13563 13562 13561 13560 13559 13558 13557 13556 13555 13554 13553 13552 13551 13550 13549 13548 13547 13546 13545 13544 13543 13542 13541 13540 13539 13538 13537 13536 13535 13534 13533 13532 13531 13530 13529 13528 13527 13526 13525 13524 13523 13522 13521 13520 13519 13518 13517 13516 13515 13514 13513 13512 13511 13510 13509 13508 13507 13506 13505 13504 13503 13502 13501 13500 13499 13498 13497 13496 13495 13494 13493 13492 13491 13490 13489 13488 13487 13486 13485 13484 13483 13482 13481 13480 13479 13478 13477 13476 13475 13474 13473 13472 13471 13470 13469 13468 13467 13466 13465 13464 13463 13462 13461 13460 13459 13458 13457 13456 13455 13454 13453 13452 13451 13450 13449 13448 13447 13446 13445 13444 13443 13442 13441 13440 13439 13438 13437 13436 13435 13434 13433 13432 13431 13430 13429 13428 13427 13426 13425 13424 13423 13422 13421 13420 13419 13418 13417 13416 13415 13414 13413 13412 13411 13410 13409 13408 13407 13406 13405 13404 13403 13402 13401 13400 13399 13398 13397 13396 13395 13394 13393 13392 13391 13390 13389 13388 13387 13386 13385 13384 13383 13382 13381 13380 13379 13378 13377 13376 13375 13374 13373 13372 13371 13370 13369 13368 13367 13366 13365 13364 13363 13362 13361 13360 13359 13358 13357 13356 13355 13354 13353 13352 13351 13350 13349 13348 13347 13346 13345 13344 13343 13342 13341 13340 13339 13338 13337 13336 13335 13334 13333 13332 13331 13330 13329 13328 13327 13326 13325 13324 13323 13322 13321 13320 13319 13318 13317 13316 13315 13314 13313 13312 13311 13310 13309 13308 13307 13306 13305 13304 13303 13302 13301 13300 13299 13298 13297 13296 13295 13294 13293 13292 13291 13290 13289 13288 13287 13286 13285 13284 13283 13282 13281 13280 13279 13278 13277 13276 13275 13274 13273 13272 13271 13270 13269 13268 13267 13266 13265 13264 13263 13262 13261 13260 13259 13258 13257 13256 13255 13254 13253 13252 13251 13250 13249 13248 13247 13246 13245 13244 13243 13242 13241 13240 13239 13238 13237 13236 13235 13234 13233 13232 13231 13230 13229 13228 13227 13226 13225 13224 13223 13222 13221 13220 13219 13218 13217 13216 13215 13214 13213 13212 13211 13210 13209 13208 13207 13206 13205 13204 13203 13202 13201 13200 13199 13198 13197 13196 13195 13194 13193 13192 13191 13190 13189 13188 13187 13186 13185 13184 13183 13182 13181 13180 13179 13178 13177 13176 13175 13174 13173 13172 13171 13170 13169 13168 13167 13166 13165 13164 13163 13162 13161 13160 13159 13158 13157 13156 13155 13154 13153 13152 13151 13150 13149 13148 13147 13146 13145 13144 13143 13142 13141 13140 13139 13138 13137 13136 13135 13134 13133 13132 13131 13130 13129 13128 13127 13126 13125 13124 13123 13122 13121 13120 13119 13118 13117 13116 13115 13114 13113 13112 13111 13110 13109 13108 13107 13106 13105 13104 13103 13102 13101 13100 13099 13098 13097 13096 13095 13094 13093 13092 13091 13090 13089 13088 13087 13086 13085 13084 13083 13082 13081 13080 13079 13078 13077 13076 13075 13074 13073 13072 13071 13070 13069 13068 13067 13066 13065 13064 13063 13062 13061 13060 13059 13058 13057 13056 13055 13054 13053 13052 13051 13050 13049 13048 13047 13046 13045 13044 13043 13042 13041 13040 13039 13038 13037 13036 13035 13034 13033 13032 13031 13030 13029 13028 13027 13026 13025 13024 13023 13022 13021 13020 13019 13018 13017 13016 13015 13014 13013 13012 13011 13010 13009 13008 13007 13006 13005 13004 13003 13002 13001 13000 12999 12998 12997 12996 12995 12994 12993 12992 12991 12990 12989 12988 12987 12986 12985 12984 12983 12982 12981 12980 12979 12978 12977 12976 12975 12974 12973 12972 12971 12970 12969 12968 12967 12966 12965 12964 12963 12962 12961 12960 12959 12958 12957 12956 12955 12954 12953 12952 12951 12950 12949 12948 12947 12946 12945 12944 12943 12942 12941 12940 12939 12938 12937 12936 12935 12934 12933 12932 12931 12930 12929 12928 12927 12926 12925 12924 12923 12922 12921 12920 12919 12918 12917 12916 12915 12914 12913 12912 12911 12910 12909 12908 12907 12906 12905 12904 12903 12902 12901 12900 12899 12898 12897 12896 12895 12894 12893 12892 12891 12890 12889 12888 12887 12886 12885 12884 12883 12882 12881 12880 12879 12878 12877 12876 12875 12874 12873 12872 12871 12870 12869 12868 12867 12866 12865 12864 12863 12862 12861 12860 12859 12858 12857 12856 12855 12854 12853 12852 12851 12850 12849 12848 12847 12846 12845 12844 12843 12842 12841 12840 12839 12838 12837 12836 12835 12834 12833 12832 12831 12830 12829 12828 12827 12826 12825 12824 12823 12822 12821 12820 12819 12818 12817 12816 12815 12814 12813 12812 12811 12810 12809 12808 12807 12806 12805 12804 12803 12802 12801 12800 12799 12798 12797 12796 12795 12794 12793 12792 12791 12790 12789 12788 12787 12786 12785 12784 12783 12782 12781 12780 12779 12778 12777 12776 12775 12774 12773 12772 12771 12770 12769 12768 12767 12766 12765 12764 12763 12762 12761 12760 12759 12758 12757 12756 12755 12754 12753 12752 12751 12750 12749 12748 12747 12746 12745 12744 12743 12742 12741 12740 12739 12738 12737 12736 12735 12734 12733 12732 12731 12730 12729 12728 12727 12726 12725 12724 12723 12722 12721 12720 12719 12718 12717 12716 12715 12714 12713 12712 12711 12710 12709 12708 12707 12706 12705 12704 12703 12702 12701 12700 12699 12698 12697 12696 12695 12694 12693 12692 12691 12690 12689 12688 12687 12686 12685 12684 12683 12682 12681 12680 12679 12678 12677 12676 12675 12674 12673 12672 12671 12670 12669 12668 12667 12666 12665 12664 12663 12662 12661 12660 12659 12658 12657 12656 12655 12654 12653 12652 12651 12650 12649 12648 12647 12646 12645 12644 12643 12642 12641 12640 12639 12638 12637 12636 12635 12634 12633 12632 12631 12630 12629 12628 12627 12626 12625 12624 12623 12622 12621 12620 12619 12618 12617 12616 12615 12614 12613 12612 12611 12610 12609 12608 12607 12606 12605 12604 12603 12602 12601 12600 12599 12598 12597 12596 12595 12594 12593 12592 12591 12590 12589 12588 12587 12586 12585 12584 12583 12582 12581 12580 12579 12578 12577 12576 12575 12574 12573 12572 12571 12570 12569 12568 12567 12566 12565 12564 12563 12562 12561 12560 12559 12558 12557 12556 12555 12554 12553 12552 12551 12550 12549 12548 12547 12546 12545 12544 12543 12542 12541 12540 12539 12538 12537 12536 12535 12534 12533 12532 12531 12530 12529 12528 12527 12526 12525 12524 12523 12522 12521 12520 12519 12518 12517 12516 12515 12514 12513 12512 12511 12510 12509 12508 12507 12506 12505 12504 12503 12502 12501 12500 12499 12498 12497 12496 12495 12494 12493 12492 12491 12490 12489 12488 12487 12486 12485 12484 12483 12482 12481 12480 12479 12478 12477 12476 12475 12474 12473 12472 12471 12470 12469 12468 12467 12466 12465 12464 12463 12462 12461 12460 12459 12458 12457 12456 12455 12454 12453 12452 12451 12450 12449 12448 12447 12446 12445 12444 12443 12442 12441 12440 12439 12438 12437 12436 12435 12434 12433 12432 12431 12430 12429 12428 12427 12426 12425 12424 12423 12422 12421 12420 12419 12418 12417 12416 12415 12414 12413 12412 12411 12410 12409 12408 12407 12406 12405 12404 12403 12402 12401 12400 12399 12398 12397 12396 12395 12394 12393 12392 12391 12390 12389 12388 12387 12386 12385 12384 12383 12382 12381 12380 12379 12378 12377 12376 12375 12374 12373 12372 12371 12370 12369 12368 12367 12366 12365 12364 12363 12362 12361 12360 12359 12358 12357 12356 12355 12354 12353 12352 12351 12350 12349 12348 12347 12346 12345 12344 12343 12342 12341 12340 12339 12338 12337 12336 12335 12334 12333 12332 12331 12330 12329 12328 12327 12326 12325 12324 12323 12322 12321 12320 12319 12318 12317 12316 12315 12314 12313 12312 12311 12310 12309 12308 12307 12306 12305 12304 12303 12302 12301 12300 12299 12298 12297 12296 12295 12294 12293 12292 12291 12290 12289 12288 12287 12286 12285 12284 12283 12282 12281 12280 12279 12278 12277 12276 12275 12274 12273 12272 12271 12270 12269 12268 12267 12266 12265 12264 12263 12262 12261 12260 12259 12258 12257 12256 12255 12254 12253 12252 12251 12250 12249 12248 12247 12246 12245 12244 12243 12242 12241 12240 12239 12238 12237 12236 12235 12234 12233 12232 12231 12230 12229 12228 12227 12226 12225 12224 12223 12222 12221 12220 12219 12218 12217 12216 12215 12214 12213 12212 12211 12210 12209 12208 12207 12206 12205 12204 12203 12202 12201 12200 12199 12198 12197 12196 12195 12194 12193 12192 12191 12190 12189 12188 12187 12186 12185 12184 12183 12182 12181 12180 12179 12178 12177 12176 12175 12174 12173 12172 12171 12170 12169 12168 12167 12166 12165 12164 12163 12162 12161 12160 12159 12158 12157 12156 12155 12154 12153 12152 12151 12150 12149 12148 12147 12146 12145 12144 12143 12142 12141 12140 12139 12138 12137 12136 12135 12134 12133 12132 12131 12130 12129 12128 12127 12126 12125 12124 12123 12122 12121 12120 12119 12118 12117 12116 12115 12114 12113 12112 12111 12110 12109 12108 12107 12106 12105 12104 12103 12102 12101 12100 12099 12098 12097 12096 12095 12094 12093 12092 12091 12090 12089 12088 12087 12086 12085 12084 12083 12082 12081 12080 12079 12078 12077 12076 12075 12074 12073 12072 12071 12070 12069 12068 12067 12066 12065 12064 12063 12062 12061 12060 12059 12058 12057 12056 12055 12054 12053 12052 12051 12050 12049 12048 12047 12046 12045 12044 12043 12042 12041 12040 12039 12038 12037 12036 12035 12034 12033 12032 12031 12030 12029 12028 12027 12026 12025 12024 12023 12022 12021 12020 12019 12018 12017 12016 12015 12014 12013 12012 12011 12010 12009 12008 12007 12006 12005 12004 12003 12002 12001 12000 11999 11998 11997 11996 11995 11994 11993 11992 11991 11990 11989 11988 11987 11986 11985 11984 11983 11982 11981 11980 11979 11978 11977 11976 11975 11974 11973 11972 11971 11970 11969 11968 11967 11966 11965 11964 11963 11962 11961 11960 11959 11958 11957 11956 11955 11954 11953 11952 11951 11950 11949 11948 11947 11946 11945 11944 11943 11942 11941 11940 11939 11938 11937 11936 11935 11934 11933 11932 11931 11930 11929 11928 11927 11926 11925 11924 11923 11922 11921 11920 11919 11918 11917 11916 11915 11914 11913 11912 11911 11910 11909 11908 11907 11906 11905 11904 11903 11902 11901 11900 11899 11898 11897 11896 11895 11894 11893 11892 11891 11890 11889 11888 11887 11886 11885 11884 11883 11882 11881 11880 11879 11878 11877 11876 11875 11874 11873 11872 11871 11870 11869 11868 11867 11866 11865 11864 11863 11862 11861 11860 11859 11858 11857 11856 11855 11854 11853 11852 11851 11850 11849 11848 11847 11846 11845 11844 11843 11842 11841 11840 11839 11838 11837 11836 11835 11834 11833 11832 11831 11830 11829 11828 11827 11826 11825 11824 11823 11822 11821 11820 11819 11818 11817 11816 11815 11814 11813 11812 11811 11810 11809 11808 11807 11806 11805 11804 11803 11802 11801 11800 11799 11798 11797 11796 11795 11794 11793 11792 11791 11790 11789 11788 11787 11786 11785 11784 11783 11782 11781 11780 11779 11778 11777 11776 11775 11774 11773 11772 11771 11770 11769 11768 11767 11766 11765 11764 11763 11762 11761 11760 11759 11758 11757 11756 11755 11754 11753 11752 11751 11750 11749 11748 11747 11746 11745 11744 11743 11742 11741 11740 11739 11738 11737 11736 11735 11734 11733 11732 11731 11730 11729 11728 11727 11726 11725 11724 11723 11722 11721 11720 11719 11718 11717 11716 11715 11714 11713 11712 11711 11710 11709 11708 11707 11706 11705 11704 11703 11702 11701 11700 11699 11698 11697 11696 11695 11694 11693 11692 11691 11690 11689 11688 11687 11686 11685 11684 11683 11682 11681 11680 11679 11678 11677 11676 11675 11674 11673 11672 11671 11670 11669 11668 11667 11666 11665 11664 11663 11662 11661 11660 11659 11658 11657 11656 11655 11654 11653 11652 11651 11650 11649 11648 11647 11646 11645 11644 11643 11642 11641 11640 11639 11638 11637 11636 11635 11634 11633 11632 11631 11630 11629 11628 11627 11626 11625 11624 11623 11622 11621 11620 11619 11618 11617 11616 11615 11614 11613 11612 11611 11610 11609 11608 11607 11606 11605 11604 11603 11602 11601 11600 11599 11598 11597 11596 11595 11594 11593 11592 11591 11590 11589 11588 11587 11586 11585 11584 11583 11582 11581 11580 11579 11578 11577 11576 11575 11574 11573 11572 11571 11570 11569 11568 11567 11566 11565 11564 11563 11562 11561 11560 11559 11558 11557 11556 11555 11554 11553 11552 11551 11550 11549 11548 11547 11546 11545 11544 11543 11542 11541 11540 11539 11538 11537 11536 11535 11534 11533 11532 11531 11530 11529 11528 11527 11526 11525 11524 11523 11522 11521 11520 11519 11518 11517 11516 11515 11514 11513 11512 11511 11510 11509 11508 11507 11506 11505 11504 11503 11502 11501 11500 11499 11498 11497 11496 11495 11494 11493 11492 11491 11490 11489 11488 11487 11486 11485 11484 11483 11482 11481 11480 11479 11478 11477 11476 11475 11474 11473 11472 11471 11470 11469 11468 11467 11466 11465 11464 11463 11462 11461 11460 11459 11458 11457 11456 11455 11454 11453 11452 11451 11450 11449 11448 11447 11446 11445 11444 11443 11442 11441 11440 11439 11438 11437 11436 11435 11434 11433 11432 11431 11430 11429 11428 11427 11426 11425 11424 11423 11422 11421 11420 11419 11418 11417 11416 11415 11414 11413 11412 11411 11410 11409 11408 11407 11406 11405 11404 11403 11402 11401 11400 11399 11398 11397 11396 11395 11394 11393 11392 11391 11390 11389 11388 11387 11386 11385 11384 11383 11382 11381 11380 11379 11378 11377 11376 11375 11374 11373 11372 11371 11370 11369 11368 11367 11366 11365 11364 11363 11362 11361 11360 11359 11358 11357 11356 11355 11354 11353 11352 11351 11350 11349 11348 11347 11346 11345 11344 11343 11342 11341 11340 11339 11338 11337 11336 11335 11334 11333 11332 11331 11330 11329 11328 11327 11326 11325 11324 11323 11322 11321 11320 11319 11318 11317 11316 11315 11314 11313 11312 11311 11310 11309 11308 11307 11306 11305 11304 11303 11302 11301 11300 11299 11298 11297 11296 11295 11294 11293 11292 11291 11290 11289 11288 11287 11286 11285 11284 11283 11282 11281 11280 11279 11278 11277 11276 11275 11274 11273 11272 11271 11270 11269 11268 11267 11266 11265 11264 11263 11262 11261 11260 11259 11258 11257 11256 11255 11254 11253 11252 11251 11250 11249 11248 11247 11246 11245 11244 11243 11242 11241 11240 11239 11238 11237 11236 11235 11234 11233 11232 11231 11230 11229 11228 11227 11226 11225 11224 11223 11222 11221 11220 11219 11218 11217 11216 11215 11214 11213 11212 11211 11210 11209 11208 11207 11206 11205 11204 11203 11202 11201 11200 11199 11198 11197 11196 11195 11194 11193 11192 11191 11190 11189 11188 11187 11186 11185 11184 11183 11182 11181 11180 11179 11178 11177 11176 11175 11174 11173 11172 11171 11170 11169 11168 11167 11166 11165 11164 11163 11162 11161 11160 11159 11158 11157 11156 11155 11154 11153 11152 11151 11150 11149 11148 11147 11146 11145 11144 11143 11142 11141 11140 11139 11138 11137 11136 11135 11134 11133 11132 11131 11130 11129 11128 11127 11126 11125 11124 11123 11122 11121 11120 11119 11118 11117 11116 11115 11114 11113 11112 11111 11110 11109 11108 11107 11106 11105 11104 11103 11102 11101 11100 11099 11098 11097 11096 11095 11094 11093 11092 11091 11090 11089 11088 11087 11086 11085 11084 11083 11082 11081 11080 11079 11078 11077 11076 11075 11074 11073 11072 11071 11070 11069 11068 11067 11066 11065 11064 11063 11062 11061 11060 11059 11058 11057 11056 11055 11054 11053 11052 11051 11050 11049 11048 11047 11046 11045 11044 11043 11042 11041 11040 11039 11038 11037 11036 11035 11034 11033 11032 11031 11030 11029 11028 11027 11026 11025 11024 11023 11022 11021 11020 11019 11018 11017 11016 11015 11014 11013 11012 11011 11010 11009 11008 11007 11006 11005 11004 11003 11002 11001 11000 10999 10998 10997 10996 10995 10994 10993 10992 10991 10990 10989 10988 10987 10986 10985 10984 10983 10982 10981 10980 10979 10978 10977 10976 10975 10974 10973 10972 10971 10970 10969 10968 10967 10966 10965 10964 10963 10962 10961 10960 10959 10958 10957 10956 10955 10954 10953 10952 10951 10950 10949 10948 10947 10946 10945 10944 10943 10942 10941 10940 10939 10938 10937 10936 10935 10934 10933 10932 10931 10930 10929 10928 10927 10926 10925 10924 10923 10922 10921 10920 10919 10918 10917 10916 10915 10914 10913 10912 10911 10910 10909 10908 10907 10906 10905 10904 10903 10902 10901 10900 10899 10898 10897 10896 10895 10894 10893 10892 10891 10890 10889 10888 10887 10886 10885 10884 10883 10882 10881 10880 10879 10878 10877 10876 10875 10874 10873 10872 10871 10870 10869 10868 10867 10866 10865 10864 10863 10862 10861 10860 10859 10858 10857 10856 10855 10854 10853 10852 10851 10850 10849 10848 10847 10846 10845 10844 10843 10842 10841 10840 10839 10838 10837 10836 10835 10834 10833 10832 10831 10830 10829 10828 10827 10826 10825 10824 10823 10822 10821 10820 10819 10818 10817 10816 10815 10814 10813 10812 10811 10810 10809 10808 10807 10806 10805 10804 10803 10802 10801 10800 10799 10798 10797 10796 10795 10794 10793 10792 10791 10790 10789 10788 10787 10786 10785 10784 10783 10782 10781 10780 10779 10778 10777 10776 10775 10774 10773 10772 10771 10770 10769 10768 10767 10766 10765 10764 10763 10762 10761 10760 10759 10758 10757 10756 10755 10754 10753 10752 10751 10750 10749 10748 10747 10746 10745 10744 10743 10742 10741 10740 10739 10738 10737 10736 10735 10734 10733 10732 10731 10730 10729 10728 10727 10726 10725 10724 10723 10722 10721 10720 10719 10718 10717 10716 10715 10714 10713 10712 10711 10710 10709 10708 10707 10706 10705 10704 10703 10702 10701 10700 10699 10698 10697 10696 10695 10694 10693 10692 10691 10690 10689 10688 10687 10686 10685 10684 10683 10682 10681 10680 10679 10678 10677 10676 10675 10674 10673 10672 10671 10670 10669 10668 10667 10666 10665 10664 10663 10662 10661 10660 10659 10658 10657 10656 10655 10654 10653 10652 10651 10650 10649 10648 10647 10646 10645 10644 10643 10642 10641 10640 10639 10638 10637 10636 10635 10634 10633 10632 10631 10630 10629 10628 10627 10626 10625 10624 10623 10622 10621 10620 10619 10618 10617 10616 10615 10614 10613 10612 10611 10610 10609 10608 10607 10606 10605 10604 10603 10602 10601 10600 10599 10598 10597 10596 10595 10594 10593 10592 10591 10590 10589 10588 10587 10586 10585 10584 10583 10582 10581 10580 10579 10578 10577 10576 10575 10574 10573 10572 10571 10570 10569 10568 10567 10566 10565 10564 10563 10562 10561 10560 10559 10558 10557 10556 10555 10554 10553 10552 10551 10550 10549 10548 10547 10546 10545 10544 10543 10542 10541 10540 10539 10538 10537 10536 10535 10534 10533 10532 10531 10530 10529 10528 10527 10526 10525 10524 10523 10522 10521 10520 10519 10518 10517 10516 10515 10514 10513 10512 10511 10510 10509 10508 10507 10506 10505 10504 10503 10502 10501 10500 10499 10498 10497 10496 10495 10494 10493 10492 10491 10490 10489 10488 10487 10486 10485 10484 10483 10482 10481 10480 10479 10478 10477 10476 10475 10474 10473 10472 10471 10470 10469 10468 10467 10466 10465 10464 10463 10462 10461 10460 10459 10458 10457 10456 10455 10454 10453 10452 10451 10450 10449 10448 10447 10446 10445 10444 10443 10442 10441 10440 10439 10438 10437 10436 10435 10434 10433 10432 10431 10430 10429 10428 10427 10426 10425 10424 10423 10422 10421 10420 10419 10418 10417 10416 10415 10414 10413 10412 10411 10410 10409 10408 10407 10406 10405 10404 10403 10402 10401 10400 10399 10398 10397 10396 10395 10394 10393 10392 10391 10390 10389 10388 10387 10386 10385 10384 10383 10382 10381 10380 10379 10378 10377 10376 10375 10374 10373 10372 10371 10370 10369 10368 10367 10366 10365 10364 10363 10362 10361 10360 10359 10358 10357 10356 10355 10354 10353 10352 10351 10350 10349 10348 10347 10346 10345 10344 10343 10342 10341 10340 10339 10338 10337 10336 10335 10334 10333 10332 10331 10330 10329 10328 10327 10326 10325 10324 10323 10322 10321 10320 10319 10318 10317 10316 10315 10314 10313 10312 10311 10310 10309 10308 10307 10306 10305 10304 10303 10302 10301 10300 10299 10298 10297 10296 10295 10294 10293 10292 10291 10290 10289 10288 10287 10286 10285 10284 10283 10282 10281 10280 10279 10278 10277 10276 10275 10274 10273 10272 10271 10270 10269 10268 10267 10266 10265 10264 10263 10262 10261 10260 10259 10258 10257 10256 10255 10254 10253 10252 10251 10250 10249 10248 10247 10246 10245 10244 10243 10242 10241 10240 10239 10238 10237 10236 10235 10234 10233 10232 10231 10230 10229 10228 10227 10226 10225 10224 10223 10222 10221 10220 10219 10218 10217 10216 10215 10214 10213 10212 10211 10210 10209 10208 10207 10206 10205 10204 10203 10202 10201 10200 10199 10198 10197 10196 10195 10194 10193 10192 10191 10190 10189 10188 10187 10186 10185 10184 10183 10182 10181 10180 10179 10178 10177 10176 10175 10174 10173 10172 10171 10170 10169 10168 10167 10166 10165 10164 10163 10162 10161 10160 10159 10158 10157 10156 10155 10154 10153 10152 10151 10150 10149 10148 10147 10146 10145 10144 10143 10142 10141 10140 10139 10138 10137 10136 10135 10134 10133 10132 10131 10130 10129 10128 10127 10126 10125 10124 10123 10122 10121 10120 10119 10118 10117 10116 10115 10114 10113 10112 10111 10110 10109 10108 10107 10106 10105 10104 10103 10102 10101 10100 10099 10098 10097 10096 10095 10094 10093 10092 10091 10090 10089 10088 10087 10086 10085 10084 10083 10082 10081 10080 10079 10078 10077 10076 10075 10074 10073 10072 10071 10070 10069 10068 10067 10066 10065 10064 10063 10062 10061 10060 10059 10058 10057 10056 10055 10054 10053 10052 10051 10050 10049 10048 10047 10046 10045 10044 10043 10042 10041 10040 10039 10038 10037 10036 10035 10034 10033 10032 10031 10030 10029 10028 10027 10026 10025 10024 10023 10022 10021 10020 10019 10018 10017 10016 10015 10014 10013 10012 10011 10010 10009 10008 10007 10006 10005 10004 10003 10002 10001 10000 9999 9998 9997 9996 9995 9994 9993 9992 9991 9990 9989 9988 9987 9986 9985 9984 9983 9982 9981 9980 9979 9978 9977 9976 9975 9974 9973 9972 9971 9970 9969 9968 9967 9966 9965 9964 9963 9962 9961 9960 9959 9958 9957 9956 9955 9954 9953 9952 9951 9950 9949 9948 9947 9946 9945 9944 9943 9942 9941 9940 9939 9938 9937 9936 9935 9934 9933 9932 9931 9930 9929 9928 9927 9926 9925 9924 9923 9922 9921 9920 9919 9918 9917 9916 9915 9914 9913 9912 9911 9910 9909 9908 9907 9906 9905 9904 9903 9902 9901 9900 9899 9898 9897 9896 9895 9894 9893 9892 9891 9890 9889 9888 9887 9886 9885 9884 9883 9882 9881 9880 9879 9878 9877 9876 9875 9874 9873 9872 9871 9870 9869 9868 9867 9866 9865 9864 9863 9862 9861 9860 9859 9858 9857 9856 9855 9854 9853 9852 9851 9850 9849 9848 9847 9846 9845 9844 9843 9842 9841 9840 9839 9838 9837 9836 9835 9834 9833 9832 9831 9830 9829 9828 9827 9826 9825 9824 9823 9822 9821 9820 9819 9818 9817 9816 9815 9814 9813 9812 9811 9810 9809 9808 9807 9806 9805 9804 9803 9802 9801 9800 9799 9798 9797 9796 9795 9794 9793 9792 9791 9790 9789 9788 9787 9786 9785 9784 9783 9782 9781 9780 9779 9778 9777 9776 9775 9774 9773 9772 9771 9770 9769 9768 9767 9766 9765 9764 9763 9762 9761 9760 9759 9758 9757 9756 9755 9754 9753 9752 9751 9750 9749 9748 9747 9746 9745 9744 9743 9742 9741 9740 9739 9738 9737 9736 9735 9734 9733 9732 9731 9730 9729 9728 9727 9726 9725 9724 9723 9722 9721 9720 9719 9718 9717 9716 9715 9714 9713 9712 9711 9710 9709 9708 9707 9706 9705 9704 9703 9702 9701 9700 9699 9698 9697 9696 9695 9694 9693 9692 9691 9690 9689 9688 9687 9686 9685 9684 9683 9682 9681 9680 9679 9678 9677 9676 9675 9674 9673 9672 9671 9670 9669 9668 9667 9666 9665 9664 9663 9662 9661 9660 9659 9658 9657 9656 9655 9654 9653 9652 9651 9650 9649 9648 9647 9646 9645 9644 9643 9642 9641 9640 9639 9638 9637 9636 9635 9634 9633 9632 9631 9630 9629 9628 9627 9626 9625 9624 9623 9622 9621 9620 9619 9618 9617 9616 9615 9614 9613 9612 9611 9610 9609 9608 9607 9606 9605 9604 9603 9602 9601 9600 9599 9598 9597 9596 9595 9594 9593 9592 9591 9590 9589 9588 9587 9586 9585 9584 9583 9582 9581 9580 9579 9578 9577 9576 9575 9574 9573 9572 9571 9570 9569 9568 9567 9566 9565 9564 9563 9562 9561 9560 9559 9558 9557 9556 9555 9554 9553 9552 9551 9550 9549 9548 9547 9546 9545 9544 9543 9542 9541 9540 9539 9538 9537 9536 9535 9534 9533 9532 9531 9530 9529 9528 9527 9526 9525 9524 9523 9522 9521 9520 9519 9518 9517 9516 9515 9514 9513 9512 9511 9510 9509 9508 9507 9506 9505 9504 9503 9502 9501 9500 9499 9498 9497 9496 9495 9494 9493 9492 9491 9490 9489 9488 9487 9486 9485 9484 9483 9482 9481 9480 9479 9478 9477 9476 9475 9474 9473 9472 9471 9470 9469 9468 9467 9466 9465 9464 9463 9462 9461 9460 9459 9458 9457 9456 9455 9454 9453 9452 9451 9450 9449 9448 9447 9446 9445 9444 9443 9442 9441 9440 9439 9438 9437 9436 9435 9434 9433 9432 9431 9430 9429 9428 9427 9426 9425 9424 9423 9422 9421 9420 9419 9418 9417 9416 9415 9414 9413 9412 9411 9410 9409 9408 9407 9406 9405 9404 9403 9402 9401 9400 9399 9398 9397 9396 9395 9394 9393 9392 9391 9390 9389 9388 9387 9386 9385 9384 9383 9382 9381 9380 9379 9378 9377 9376 9375 9374 9373 9372 9371 9370 9369 9368 9367 9366 9365 9364 9363 9362 9361 9360 9359 9358 9357 9356 9355 9354 9353 9352 9351 9350 9349 9348 9347 9346 9345 9344 9343 9342 9341 9340 9339 9338 9337 9336 9335 9334 9333 9332 9331 9330 9329 9328 9327 9326 9325 9324 9323 9322 9321 9320 9319 9318 9317 9316 9315 9314 9313 9312 9311 9310 9309 9308 9307 9306 9305 9304 9303 9302 9301 9300 9299 9298 9297 9296 9295 9294 9293 9292 9291 9290 9289 9288 9287 9286 9285 9284 9283 9282 9281 9280 9279 9278 9277 9276 9275 9274 9273 9272 9271 9270 9269 9268 9267 9266 9265 9264 9263 9262 9261 9260 9259 9258 9257 9256 9255 9254 9253 9252 9251 9250 9249 9248 9247 9246 9245 9244 9243 9242 9241 9240 9239 9238 9237 9236 9235 9234 9233 9232 9231 9230 9229 9228 9227 9226 9225 9224 9223 9222 9221 9220 9219 9218 9217 9216 9215 9214 9213 9212 9211 9210 9209 9208 9207 9206 9205 9204 9203 9202 9201 9200 9199 9198 9197 9196 9195 9194 9193 9192 9191 9190 9189 9188 9187 9186 9185 9184 9183 9182 9181 9180 9179 9178 9177 9176 9175 9174 9173 9172 9171 9170 9169 9168 9167 9166 9165 9164 9163 9162 9161 9160 9159 9158 9157 9156 9155 9154 9153 9152 9151 9150 9149 9148 9147 9146 9145 9144 9143 9142 9141 9140 9139 9138 9137 9136 9135 9134 9133 9132 9131 9130 9129 9128 9127 9126 9125 9124 9123 9122 9121 9120 9119 9118 9117 9116 9115 9114 9113 9112 9111 9110 9109 9108 9107 9106 9105 9104 9103 9102 9101 9100 9099 9098 9097 9096 9095 9094 9093 9092 9091 9090 9089 9088 9087 9086 9085 9084 9083 9082 9081 9080 9079 9078 9077 9076 9075 9074 9073 9072 9071 9070 9069 9068 9067 9066 9065 9064 9063 9062 9061 9060 9059 9058 9057 9056 9055 9054 9053 9052 9051 9050 9049 9048 9047 9046 9045 9044 9043 9042 9041 9040 9039 9038 9037 9036 9035 9034 9033 9032 9031 9030 9029 9028 9027 9026 9025 9024 9023 9022 9021 9020 9019 9018 9017 9016 9015 9014 9013 9012 9011 9010 9009 9008 9007 9006 9005 9004 9003 9002 9001 9000 8999 8998 8997 8996 8995 8994 8993 8992 8991 8990 8989 8988 8987 8986 8985 8984 8983 8982 8981 8980 8979 8978 8977 8976 8975 8974 8973 8972 8971 8970 8969 8968 8967 8966 8965 8964 8963 8962 8961 8960 8959 8958 8957 8956 8955 8954 8953 8952 8951 8950 8949 8948 8947 8946 8945 8944 8943 8942 8941 8940 8939 8938 8937 8936 8935 8934 8933 8932 8931 8930 8929 8928 8927 8926 8925 8924 8923 8922 8921 8920 8919 8918 8917 8916 8915 8914 8913 8912 8911 8910 8909 8908 8907 8906 8905 8904 8903 8902 8901 8900 8899 8898 8897 8896 8895 8894 8893 8892 8891 8890 8889 8888 8887 8886 8885 8884 8883 8882 8881 8880 8879 8878 8877 8876 8875 8874 8873 8872 8871 8870 8869 8868 8867 8866 8865 8864 8863 8862 8861 8860 8859 8858 8857 8856 8855 8854 8853 8852 8851 8850 8849 8848 8847 8846 8845 8844 8843 8842 8841 8840 8839 8838 8837 8836 8835 8834 8833 8832 8831 8830 8829 8828 8827 8826 8825 8824 8823 8822 8821 8820 8819 8818 8817 8816 8815 8814 8813 8812 8811 8810 8809 8808 8807 8806 8805 8804 8803 8802 8801 8800 8799 8798 8797 8796 8795 8794 8793 8792 8791 8790 8789 8788 8787 8786 8785 8784 8783 8782 8781 8780 8779 8778 8777 8776 8775 8774 8773 8772 8771 8770 8769 8768 8767 8766 8765 8764 8763 8762 8761 8760 8759 8758 8757 8756 8755 8754 8753 8752 8751 8750 8749 8748 8747 8746 8745 8744 8743 8742 8741 8740 8739 8738 8737 8736 8735 8734 8733 8732 8731 8730 8729 8728 8727 8726 8725 8724 8723 8722 8721 8720 8719 8718 8717 8716 8715 8714 8713 8712 8711 8710 8709 8708 8707 8706 8705 8704 8703 8702 8701 8700 8699 8698 8697 8696 8695 8694 8693 8692 8691 8690 8689 8688 8687 8686 8685 8684 8683 8682 8681 8680 8679 8678 8677 8676 8675 8674 8673 8672 8671 8670 8669 8668 8667 8666 8665 8664 8663 8662 8661 8660 8659 8658 8657 8656 8655 8654 8653 8652 8651 8650 8649 8648 8647 8646 8645 8644 8643 8642 8641 8640 8639 8638 8637 8636 8635 8634 8633 8632 8631 8630 8629 8628 8627 8626 8625 8624 8623 8622 8621 8620 8619 8618 8617 8616 8615 8614 8613 8612 8611 8610 8609 8608 8607 8606 8605 8604 8603 8602 8601 8600 8599 8598 8597 8596 8595 8594 8593 8592 8591 8590 8589 8588 8587 8586 8585 8584 8583 8582 8581 8580 8579 8578 8577 8576 8575 8574 8573 8572 8571 8570 8569 8568 8567 8566 8565 8564 8563 8562 8561 8560 8559 8558 8557 8556 8555 8554 8553 8552 8551 8550 8549 8548 8547 8546 8545 8544 8543 8542 8541 8540 8539 8538 8537 8536 8535 8534 8533 8532 8531 8530 8529 8528 8527 8526 8525 8524 8523 8522 8521 8520 8519 8518 8517 8516 8515 8514 8513 8512 8511 8510 8509 8508 8507 8506 8505 8504 8503 8502 8501 8500 8499 8498 8497 8496 8495 8494 8493 8492 8491 8490 8489 8488 8487 8486 8485 8484 8483 8482 8481 8480 8479 8478 8477 8476 8475 8474 8473 8472 8471 8470 8469 8468 8467 8466 8465 8464 8463 8462 8461 8460 8459 8458 8457 8456 8455 8454 8453 8452 8451 8450 8449 8448 8447 8446 8445 8444 8443 8442 8441 8440 8439 8438 8437 8436 8435 8434 8433 8432 8431 8430 8429 8428 8427 8426 8425 8424 8423 8422 8421 8420 8419 8418 8417 8416 8415 8414 8413 8412 8411 8410 8409 8408 8407 8406 8405 8404 8403 8402 8401 8400 8399 8398 8397 8396 8395 8394 8393 8392 8391 8390 8389 8388 8387 8386 8385 8384 8383 8382 8381 8380 8379 8378 8377 8376 8375 8374 8373 8372 8371 8370 8369 8368 8367 8366 8365 8364 8363 8362 8361 8360 8359 8358 8357 8356 8355 8354 8353 8352 8351 8350 8349 8348 8347 8346 8345 8344 8343 8342 8341 8340 8339 8338 8337 8336 8335 8334 8333 8332 8331 8330 8329 8328 8327 8326 8325 8324 8323 8322 8321 8320 8319 8318 8317 8316 8315 8314 8313 8312 8311 8310 8309 8308 8307 8306 8305 8304 8303 8302 8301 8300 8299 8298 8297 8296 8295 8294 8293 8292 8291 8290 8289 8288 8287 8286 8285 8284 8283 8282 8281 8280 8279 8278 8277 8276 8275 8274 8273 8272 8271 8270 8269 8268 8267 8266 8265 8264 8263 8262 8261 8260 8259 8258 8257 8256 8255 8254 8253 8252 8251 8250 8249 8248 8247 8246 8245 8244 8243 8242 8241 8240 8239 8238 8237 8236 8235 8234 8233 8232 8231 8230 8229 8228 8227 8226 8225 8224 8223 8222 8221 8220 8219 8218 8217 8216 8215 8214 8213 8212 8211 8210 8209 8208 8207 8206 8205 8204 8203 8202 8201 8200 8199 8198 8197 8196 8195 8194 8193 8192 8191 8190 8189 8188 8187 8186 8185 8184 8183 8182 8181 8180 8179 8178 8177 8176 8175 8174 8173 8172 8171 8170 8169 8168 8167 8166 8165 8164 8163 8162 8161 8160 8159 8158 8157 8156 8155 8154 8153 8152 8151 8150 8149 8148 8147 8146 8145 8144 8143 8142 8141 8140 8139 8138 8137 8136 8135 8134 8133 8132 8131 8130 8129 8128 8127 8126 8125 8124 8123 8122 8121 8120 8119 8118 8117 8116 8115 8114 8113 8112 8111 8110 8109 8108 8107 8106 8105 8104 8103 8102 8101 8100 8099 8098 8097 8096 8095 8094 8093 8092 8091 8090 8089 8088 8087 8086 8085 8084 8083 8082 8081 8080 8079 8078 8077 8076 8075 8074 8073 8072 8071 8070 8069 8068 8067 8066 8065 8064 8063 8062 8061 8060 8059 8058 8057 8056 8055 8054 8053 8052 8051 8050 8049 8048 8047 8046 8045 8044 8043 8042 8041 8040 8039 8038 8037 8036 8035 8034 8033 8032 8031 8030 8029 8028 8027 8026 8025 8024 8023 8022 8021 8020 8019 8018 8017 8016 8015 8014 8013 8012 8011 8010 8009 8008 8007 8006 8005 8004 8003 8002 8001 8000 7999 7998 7997 7996 7995 7994 7993 7992 7991 7990 7989 7988 7987 7986 7985 7984 7983 7982 7981 7980 7979 7978 7977 7976 7975 7974 7973 7972 7971 7970 7969 7968 7967 7966 7965 7964 7963 7962 7961 7960 7959 7958 7957 7956 7955 7954 7953 7952 7951 7950 7949 7948 7947 7946 7945 7944 7943 7942 7941 7940 7939 7938 7937 7936 7935 7934 7933 7932 7931 7930 7929 7928 7927 7926 7925 7924 7923 7922 7921 7920 7919 7918 7917 7916 7915 7914 7913 7912 7911 7910 7909 7908 7907 7906 7905 7904 7903 7902 7901 7900 7899 7898 7897 7896 7895 7894 7893 7892 7891 7890 7889 7888 7887 7886 7885 7884 7883 7882 7881 7880 7879 7878 7877 7876 7875 7874 7873 7872 7871 7870 7869 7868 7867 7866 7865 7864 7863 7862 7861 7860 7859 7858 7857 7856 7855 7854 7853 7852 7851 7850 7849 7848 7847 7846 7845 7844 7843 7842 7841 7840 7839 7838 7837 7836 7835 7834 7833 7832 7831 7830 7829 7828 7827 7826 7825 7824 7823 7822 7821 7820 7819 7818 7817 7816 7815 7814 7813 7812 7811 7810 7809 7808 7807 7806 7805 7804 7803 7802 7801 7800 7799 7798 7797 7796 7795 7794 7793 7792 7791 7790 7789 7788 7787 7786 7785 7784 7783 7782 7781 7780 7779 7778 7777 7776 7775 7774 7773 7772 7771 7770 7769 7768 7767 7766 7765 7764 7763 7762 7761 7760 7759 7758 7757 7756 7755 7754 7753 7752 7751 7750 7749 7748 7747 7746 7745 7744 7743 7742 7741 7740 7739 7738 7737 7736 7735 7734 7733 7732 7731 7730 7729 7728 7727 7726 7725 7724 7723 7722 7721 7720 7719 7718 7717 7716 7715 7714 7713 7712 7711 7710 7709 7708 7707 7706 7705 7704 7703 7702 7701 7700 7699 7698 7697 7696 7695 7694 7693 7692 7691 7690 7689 7688 7687 7686 7685 7684 7683 7682 7681 7680 7679 7678 7677 7676 7675 7674 7673 7672 7671 7670 7669 7668 7667 7666 7665 7664 7663 7662 7661 7660 7659 7658 7657 7656 7655 7654 7653 7652 7651 7650 7649 7648 7647 7646 7645 7644 7643 7642 7641 7640 7639 7638 7637 7636 7635 7634 7633 7632 7631 7630 7629 7628 7627 7626 7625 7624 7623 7622 7621 7620 7619 7618 7617 7616 7615 7614 7613 7612 7611 7610 7609 7608 7607 7606 7605 7604 7603 7602 7601 7600 7599 7598 7597 7596 7595 7594 7593 7592 7591 7590 7589 7588 7587 7586 7585 7584 7583 7582 7581 7580 7579 7578 7577 7576 7575 7574 7573 7572 7571 7570 7569 7568 7567 7566 7565 7564 7563 7562 7561 7560 7559 7558 7557 7556 7555 7554 7553 7552 7551 7550 7549 7548 7547 7546 7545 7544 7543 7542 7541 7540 7539 7538 7537 7536 7535 7534 7533 7532 7531 7530 7529 7528 7527 7526 7525 7524 7523 7522 7521 7520 7519 7518 7517 7516 7515 7514 7513 7512 7511 7510 7509 7508 7507 7506 7505 7504 7503 7502 7501 7500 7499 7498 7497 7496 7495 7494 7493 7492 7491 7490 7489 7488 7487 7486 7485 7484 7483 7482 7481 7480 7479 7478 7477 7476 7475 7474 7473 7472 7471 7470 7469 7468 7467 7466 7465 7464 7463 7462 7461 7460 7459 7458 7457 7456 7455 7454 7453 7452 7451 7450 7449 7448 7447 7446 7445 7444 7443 7442 7441 7440 7439 7438 7437 7436 7435 7434 7433 7432 7431 7430 7429 7428 7427 7426 7425 7424 7423 7422 7421 7420 7419 7418 7417 7416 7415 7414 7413 7412 7411 7410 7409 7408 7407 7406 7405 7404 7403 7402 7401 7400 7399 7398 7397 7396 7395 7394 7393 7392 7391 7390 7389 7388 7387 7386 7385 7384 7383 7382 7381 7380 7379 7378 7377 7376 7375 7374 7373 7372 7371 7370 7369 7368 7367 7366 7365 7364 7363 7362 7361 7360 7359 7358 7357 7356 7355 7354 7353 7352 7351 7350 7349 7348 7347 7346 7345 7344 7343 7342 7341 7340 7339 7338 7337 7336 7335 7334 7333 7332 7331 7330 7329 7328 7327 7326 7325 7324 7323 7322 7321 7320 7319 7318 7317 7316 7315 7314 7313 7312 7311 7310 7309 7308 7307 7306 7305 7304 7303 7302 7301 7300 7299 7298 7297 7296 7295 7294 7293 7292 7291 7290 7289 7288 7287 7286 7285 7284 7283 7282 7281 7280 7279 7278 7277 7276 7275 7274 7273 7272 7271 7270 7269 7268 7267 7266 7265 7264 7263 7262 7261 7260 7259 7258 7257 7256 7255 7254 7253 7252 7251 7250 7249 7248 7247 7246 7245 7244 7243 7242 7241 7240 7239 7238 7237 7236 7235 7234 7233 7232 7231 7230 7229 7228 7227 7226 7225 7224 7223 7222 7221 7220 7219 7218 7217 7216 7215 7214 7213 7212 7211 7210 7209 7208 7207 7206 7205 7204 7203 7202 7201 7200 7199 7198 7197 7196 7195 7194 7193 7192 7191 7190 7189 7188 7187 7186 7185 7184 7183 7182 7181 7180 7179 7178 7177 7176 7175 7174 7173 7172 7171 7170 7169 7168 7167 7166 7165 7164 7163 7162 7161 7160 7159 7158 7157 7156 7155 7154 7153 7152 7151 7150 7149 7148 7147 7146 7145 7144 7143 7142 7141 7140 7139 7138 7137 7136 7135 7134 7133 7132 7131 7130 7129 7128 7127 7126 7125 7124 7123 7122 7121 7120 7119 7118 7117 7116 7115 7114 7113 7112 7111 7110 7109 7108 7107 7106 7105 7104 7103 7102 7101 7100 7099 7098 7097 7096 7095 7094 7093 7092 7091 7090 7089 7088 7087 7086 7085 7084 7083 7082 7081 7080 7079 7078 7077 7076 7075 7074 7073 7072 7071 7070 7069 7068 7067 7066 7065 7064 7063 7062 7061 7060 7059 7058 7057 7056 7055 7054 7053 7052 7051 7050 7049 7048 7047 7046 7045 7044 7043 7042 7041 7040 7039 7038 7037 7036 7035 7034 7033 7032 7031 7030 7029 7028 7027 7026 7025 7024 7023 7022 7021 7020 7019 7018 7017 7016 7015 7014 7013 7012 7011 7010 7009 7008 7007 7006 7005 7004 7003 7002 7001 7000 6999 6998 6997 6996 6995 6994 6993 6992 6991 6990 6989 6988 6987 6986 6985 6984 6983 6982 6981 6980 6979 6978 6977 6976 6975 6974 6973 6972 6971 6970 6969 6968 6967 6966 6965 6964 6963 6962 6961 6960 6959 6958 6957 6956 6955 6954 6953 6952 6951 6950 6949 6948 6947 6946 6945 6944 6943 6942 6941 6940 6939 6938 6937 6936 6935 6934 6933 6932 6931 6930 6929 6928 6927 6926 6925 6924 6923 6922 6921 6920 6919 6918 6917 6916 6915 6914 6913 6912 6911 6910 6909 6908 6907 6906 6905 6904 6903 6902 6901 6900 6899 6898 6897 6896 6895 6894 6893 6892 6891 6890 6889 6888 6887 6886 6885 6884 6883 6882 6881 6880 6879 6878 6877 6876 6875 6874 6873 6872 6871 6870 6869 6868 6867 6866 6865 6864 6863 6862 6861 6860 6859 6858 6857 6856 6855 6854 6853 6852 6851 6850 6849 6848 6847 6846 6845 6844 6843 6842 6841 6840 6839 6838 6837 6836 6835 6834 6833 6832 6831 6830 6829 6828 6827 6826 6825 6824 6823 6822 6821 6820 6819 6818 6817 6816 6815 6814 6813 6812 6811 6810 6809 6808 6807 6806 6805 6804 6803 6802 6801 6800 6799 6798 6797 6796 6795 6794 6793 6792 6791 6790 6789 6788 6787 6786 6785 6784 6783 6782 6781 6780 6779 6778 6777 6776 6775 6774 6773 6772 6771 6770 6769 6768 6767 6766 6765 6764 6763 6762 6761 6760 6759 6758 6757 6756 6755 6754 6753 6752 6751 6750 6749 6748 6747 6746 6745 6744 6743 6742 6741 6740 6739 6738 6737 6736 6735 6734 6733 6732 6731 6730 6729 6728 6727 6726 6725 6724 6723 6722 6721 6720 6719 6718 6717 6716 6715 6714 6713 6712 6711 6710 6709 6708 6707 6706 6705 6704 6703 6702 6701 6700 6699 6698 6697 6696 6695 6694 6693 6692 6691 6690 6689 6688 6687 6686 6685 6684 6683 6682 6681 6680 6679 6678 6677 6676 6675 6674 6673 6672 6671 6670 6669 6668 6667 6666 6665 6664 6663 6662 6661 6660 6659 6658 6657 6656 6655 6654 6653 6652 6651 6650 6649 6648 6647 6646 6645 6644 6643 6642 6641 6640 6639 6638 6637 6636 6635 6634 6633 6632 6631 6630 6629 6628 6627 6626 6625 6624 6623 6622 6621 6620 6619 6618 6617 6616 6615 6614 6613 6612 6611 6610 6609 6608 6607 6606 6605 6604 6603 6602 6601 6600 6599 6598 6597 6596 6595 6594 6593 6592 6591 6590 6589 6588 6587 6586 6585 6584 6583 6582 6581 6580 6579 6578 6577 6576 6575 6574 6573 6572 6571 6570 6569 6568 6567 6566 6565 6564 6563 6562 6561 6560 6559 6558 6557 6556 6555 6554 6553 6552 6551 6550 6549 6548 6547 6546 6545 6544 6543 6542 6541 6540 6539 6538 6537 6536 6535 6534 6533 6532 6531 6530 6529 6528 6527 6526 6525 6524 6523 6522 6521 6520 6519 6518 6517 6516 6515 6514 6513 6512 6511 6510 6509 6508 6507 6506 6505 6504 6503 6502 6501 6500 6499 6498 6497 6496 6495 6494 6493 6492 6491 6490 6489 6488 6487 6486 6485 6484 6483 6482 6481 6480 6479 6478 6477 6476 6475 6474 6473 6472 6471 6470 6469 6468 6467 6466 6465 6464 6463 6462 6461 6460 6459 6458 6457 6456 6455 6454 6453 6452 6451 6450 6449 6448 6447 6446 6445 6444 6443 6442 6441 6440 6439 6438 6437 6436 6435 6434 6433 6432 6431 6430 6429 6428 6427 6426 6425 6424 6423 6422 6421 6420 6419 6418 6417 6416 6415 6414 6413 6412 6411 6410 6409 6408 6407 6406 6405 6404 6403 6402 6401 6400 6399 6398 6397 6396 6395 6394 6393 6392 6391 6390 6389 6388 6387 6386 6385 6384 6383 6382 6381 6380 6379 6378 6377 6376 6375 6374 6373 6372 6371 6370 6369 6368 6367 6366 6365 6364 6363 6362 6361 6360 6359 6358 6357 6356 6355 6354 6353 6352 6351 6350 6349 6348 6347 6346 6345 6344 6343 6342 6341 6340 6339 6338 6337 6336 6335 6334 6333 6332 6331 6330 6329 6328 6327 6326 6325 6324 6323 6322 6321 6320 6319 6318 6317 6316 6315 6314 6313 6312 6311 6310 6309 6308 6307 6306 6305 6304 6303 6302 6301 6300 6299 6298 6297 6296 6295 6294 6293 6292 6291 6290 6289 6288 6287 6286 6285 6284 6283 6282 6281 6280 6279 6278 6277 6276 6275 6274 6273 6272 6271 6270 6269 6268 6267 6266 6265 6264 6263 6262 6261 6260 6259 6258 6257 6256 6255 6254 6253 6252 6251 6250 6249 6248 6247 6246 6245 6244 6243 6242 6241 6240 6239 6238 6237 6236 6235 6234 6233 6232 6231 6230 6229 6228 6227 6226 6225 6224 6223 6222 6221 6220 6219 6218 6217 6216 6215 6214 6213 6212 6211 6210 6209 6208 6207 6206 6205 6204 6203 6202 6201 6200 6199 6198 6197 6196 6195 6194 6193 6192 6191 6190 6189 6188 6187 6186 6185 6184 6183 6182 6181 6180 6179 6178 6177 6176 6175 6174 6173 6172 6171 6170 6169 6168 6167 6166 6165 6164 6163 6162 6161 6160 6159 6158 6157 6156 6155 6154 6153 6152 6151 6150 6149 6148 6147 6146 6145 6144 6143 6142 6141 6140 6139 6138 6137 6136 6135 6134 6133 6132 6131 6130 6129 6128 6127 6126 6125 6124 6123 6122 6121 6120 6119 6118 6117 6116 6115 6114 6113 6112 6111 6110 6109 6108 6107 6106 6105 6104 6103 6102 6101 6100 6099 6098 6097 6096 6095 6094 6093 6092 6091 6090 6089 6088 6087 6086 6085 6084 6083 6082 6081 6080 6079 6078 6077 6076 6075 6074 6073 6072 6071 6070 6069 6068 6067 6066 6065 6064 6063 6062 6061 6060 6059 6058 6057 6056 6055 6054 6053 6052 6051 6050 6049 6048 6047 6046 6045 6044 6043 6042 6041 6040 6039 6038 6037 6036 6035 6034 6033 6032 6031 6030 6029 6028 6027 6026 6025 6024 6023 6022 6021 6020 6019 6018 6017 6016 6015 6014 6013 6012 6011 6010 6009 6008 6007 6006 6005 6004 6003 6002 6001 6000 5999 5998 5997 5996 5995 5994 5993 5992 5991 5990 5989 5988 5987 5986 5985 5984 5983 5982 5981 5980 5979 5978 5977 5976 5975 5974 5973 5972 5971 5970 5969 5968 5967 5966 5965 5964 5963 5962 5961 5960 5959 5958 5957 5956 5955 5954 5953 5952 5951 5950 5949 5948 5947 5946 5945 5944 5943 5942 5941 5940 5939 5938 5937 5936 5935 5934 5933 5932 5931 5930 5929 5928 5927 5926 5925 5924 5923 5922 5921 5920 5919 5918 5917 5916 5915 5914 5913 5912 5911 5910 5909 5908 5907 5906 5905 5904 5903 5902 5901 5900 5899 5898 5897 5896 5895 5894 5893 5892 5891 5890 5889 5888 5887 5886 5885 5884 5883 5882 5881 5880 5879 5878 5877 5876 5875 5874 5873 5872 5871 5870 5869 5868 5867 5866 5865 5864 5863 5862 5861 5860 5859 5858 5857 5856 5855 5854 5853 5852 5851 5850 5849 5848 5847 5846 5845 5844 5843 5842 5841 5840 5839 5838 5837 5836 5835 5834 5833 5832 5831 5830 5829 5828 5827 5826 5825 5824 5823 5822 5821 5820 5819 5818 5817 5816 5815 5814 5813 5812 5811 5810 5809 5808 5807 5806 5805 5804 5803 5802 5801 5800 5799 5798 5797 5796 5795 5794 5793 5792 5791 5790 5789 5788 5787 5786 5785 5784 5783 5782 5781 5780 5779 5778 5777 5776 5775 5774 5773 5772 5771 5770 5769 5768 5767 5766 5765 5764 5763 5762 5761 5760 5759 5758 5757 5756 5755 5754 5753 5752 5751 5750 5749 5748 5747 5746 5745 5744 5743 5742 5741 5740 5739 5738 5737 5736 5735 5734 5733 5732 5731 5730 5729 5728 5727 5726 5725 5724 5723 5722 5721 5720 5719 5718 5717 5716 5715 5714 5713 5712 5711 5710 5709 5708 5707 5706 5705 5704 5703 5702 5701 5700 5699 5698 5697 5696 5695 5694 5693 5692 5691 5690 5689 5688 5687 5686 5685 5684 5683 5682 5681 5680 5679 5678 5677 5676 5675 5674 5673 5672 5671 5670 5669 5668 5667 5666 5665 5664 5663 5662 5661 5660 5659 5658 5657 5656 5655 5654 5653 5652 5651 5650 5649 5648 5647 5646 5645 5644 5643 5642 5641 5640 5639 5638 5637 5636 5635 5634 5633 5632 5631 5630 5629 5628 5627 5626 5625 5624 5623 5622 5621 5620 5619 5618 5617 5616 5615 5614 5613 5612 5611 5610 5609 5608 5607 5606 5605 5604 5603 5602 5601 5600 5599 5598 5597 5596 5595 5594 5593 5592 5591 5590 5589 5588 5587 5586 5585 5584 5583 5582 5581 5580 5579 5578 5577 5576 5575 5574 5573 5572 5571 5570 5569 5568 5567 5566 5565 5564 5563 5562 5561 5560 5559 5558 5557 5556 5555 5554 5553 5552 5551 5550 5549 5548 5547 5546 5545 5544 5543 5542 5541 5540 5539 5538 5537 5536 5535 5534 5533 5532 5531 5530 5529 5528 5527 5526 5525 5524 5523 5522 5521 5520 5519 5518 5517 5516 5515 5514 5513 5512 5511 5510 5509 5508 5507 5506 5505 5504 5503 5502 5501 5500 5499 5498 5497 5496 5495 5494 5493 5492 5491 5490 5489 5488 5487 5486 5485 5484 5483 5482 5481 5480 5479 5478 5477 5476 5475 5474 5473 5472 5471 5470 5469 5468 5467 5466 5465 5464 5463 5462 5461 5460 5459 5458 5457 5456 5455 5454 5453 5452 5451 5450 5449 5448 5447 5446 5445 5444 5443 5442 5441 5440 5439 5438 5437 5436 5435 5434 5433 5432 5431 5430 5429 5428 5427 5426 5425 5424 5423 5422 5421 5420 5419 5418 5417 5416 5415 5414 5413 5412 5411 5410 5409 5408 5407 5406 5405 5404 5403 5402 5401 5400 5399 5398 5397 5396 5395 5394 5393 5392 5391 5390 5389 5388 5387 5386 5385 5384 5383 5382 5381 5380 5379 5378 5377 5376 5375 5374 5373 5372 5371 5370 5369 5368 5367 5366 5365 5364 5363 5362 5361 5360 5359 5358 5357 5356 5355 5354 5353 5352 5351 5350 5349 5348 5347 5346 5345 5344 5343 5342 5341 5340 5339 5338 5337 5336 5335 5334 5333 5332 5331 5330 5329 5328 5327 5326 5325 5324 5323 5322 5321 5320 5319 5318 5317 5316 5315 5314 5313 5312 5311 5310 5309 5308 5307 5306 5305 5304 5303 5302 5301 5300 5299 5298 5297 5296 5295 5294 5293 5292 5291 5290 5289 5288 5287 5286 5285 5284 5283 5282 5281 5280 5279 5278 5277 5276 5275 5274 5273 5272 5271 5270 5269 5268 5267 5266 5265 5264 5263 5262 5261 5260 5259 5258 5257 5256 5255 5254 5253 5252 5251 5250 5249 5248 5247 5246 5245 5244 5243 5242 5241 5240 5239 5238 5237 5236 5235 5234 5233 5232 5231 5230 5229 5228 5227 5226 5225 5224 5223 5222 5221 5220 5219 5218 5217 5216 5215 5214 5213 5212 5211 5210 5209 5208 5207 5206 5205 5204 5203 5202 5201 5200 5199 5198 5197 5196 5195 5194 5193 5192 5191 5190 5189 5188 5187 5186 5185 5184 5183 5182 5181 5180 5179 5178 5177 5176 5175 5174 5173 5172 5171 5170 5169 5168 5167 5166 5165 5164 5163 5162 5161 5160 5159 5158 5157 5156 5155 5154 5153 5152 5151 5150 5149 5148 5147 5146 5145 5144 5143 5142 5141 5140 5139 5138 5137 5136 5135 5134 5133 5132 5131 5130 5129 5128 5127 5126 5125 5124 5123 5122 5121 5120 5119 5118 5117 5116 5115 5114 5113 5112 5111 5110 5109 5108 5107 5106 5105 5104 5103 5102 5101 5100 5099 5098 5097 5096 5095 5094 5093 5092 5091 5090 5089 5088 5087 5086 5085 5084 5083 5082 5081 5080 5079 5078 5077 5076 5075 5074 5073 5072 5071 5070 5069 5068 5067 5066 5065 5064 5063 5062 5061 5060 5059 5058 5057 5056 5055 5054 5053 5052 5051 5050 5049 5048 5047 5046 5045 5044 5043 5042 5041 5040 5039 5038 5037 5036 5035 5034 5033 5032 5031 5030 5029 5028 5027 5026 5025 5024 5023 5022 5021 5020 5019 5018 5017 5016 5015 5014 5013 5012 5011 5010 5009 5008 5007 5006 5005 5004 5003 5002 5001 5000 4999 4998 4997 4996 4995 4994 4993 4992 4991 4990 4989 4988 4987 4986 4985 4984 4983 4982 4981 4980 4979 4978 4977 4976 4975 4974 4973 4972 4971 4970 4969 4968 4967 4966 4965 4964 4963 4962 4961 4960 4959 4958 4957 4956 4955 4954 4953 4952 4951 4950 4949 4948 4947 4946 4945 4944 4943 4942 4941 4940 4939 4938 4937 4936 4935 4934 4933 4932 4931 4930 4929 4928 4927 4926 4925 4924 4923 4922 4921 4920 4919 4918 4917 4916 4915 4914 4913 4912 4911 4910 4909 4908 4907 4906 4905 4904 4903 4902 4901 4900 4899 4898 4897 4896 4895 4894 4893 4892 4891 4890 4889 4888 4887 4886 4885 4884 4883 4882 4881 4880 4879 4878 4877 4876 4875 4874 4873 4872 4871 4870 4869 4868 4867 4866 4865 4864 4863 4862 4861 4860 4859 4858 4857 4856 4855 4854 4853 4852 4851 4850 4849 4848 4847 4846 4845 4844 4843 4842 4841 4840 4839 4838 4837 4836 4835 4834 4833 4832 4831 4830 4829 4828 4827 4826 4825 4824 4823 4822 4821 4820 4819 4818 4817 4816 4815 4814 4813 4812 4811 4810 4809 4808 4807 4806 4805 4804 4803 4802 4801 4800 4799 4798 4797 4796 4795 4794 4793 4792 4791 4790 4789 4788 4787 4786 4785 4784 4783 4782 4781 4780 4779 4778 4777 4776 4775 4774 4773 4772 4771 4770 4769 4768 4767 4766 4765 4764 4763 4762 4761 4760 4759 4758 4757 4756 4755 4754 4753 4752 4751 4750 4749 4748 4747 4746 4745 4744 4743 4742 4741 4740 4739 4738 4737 4736 4735 4734 4733 4732 4731 4730 4729 4728 4727 4726 4725 4724 4723 4722 4721 4720 4719 4718 4717 4716 4715 4714 4713 4712 4711 4710 4709 4708 4707 4706 4705 4704 4703 4702 4701 4700 4699 4698 4697 4696 4695 4694 4693 4692 4691 4690 4689 4688 4687 4686 4685 4684 4683 4682 4681 4680 4679 4678 4677 4676 4675 4674 4673 4672 4671 4670 4669 4668 4667 4666 4665 4664 4663 4662 4661 4660 4659 4658 4657 4656 4655 4654 4653 4652 4651 4650 4649 4648 4647 4646 4645 4644 4643 4642 4641 4640 4639 4638 4637 4636 4635 4634 4633 4632 4631 4630 4629 4628 4627 4626 4625 4624 4623 4622 4621 4620 4619 4618 4617 4616 4615 4614 4613 4612 4611 4610 4609 4608 4607 4606 4605 4604 4603 4602 4601 4600 4599 4598 4597 4596 4595 4594 4593 4592 4591 4590 4589 4588 4587 4586 4585 4584 4583 4582 4581 4580 4579 4578 4577 4576 4575 4574 4573 4572 4571 4570 4569 4568 4567 4566 4565 4564 4563 4562 4561 4560 4559 4558 4557 4556 4555 4554 4553 4552 4551 4550 4549 4548 4547 4546 4545 4544 4543 4542 4541 4540 4539 4538 4537 4536 4535 4534 4533 4532 4531 4530 4529 4528 4527 4526 4525 4524 4523 4522 4521 4520 4519 4518 4517 4516 4515 4514 4513 4512 4511 4510 4509 4508 4507 4506 4505 4504 4503 4502 4501 4500 4499 4498 4497 4496 4495 4494 4493 4492 4491 4490 4489 4488 4487 4486 4485 4484 4483 4482 4481 4480 4479 4478 4477 4476 4475 4474 4473 4472 4471 4470 4469 4468 4467 4466 4465 4464 4463 4462 4461 4460 4459 4458 4457 4456 4455 4454 4453 4452 4451 4450 4449 4448 4447 4446 4445 4444 4443 4442 4441 4440 4439 4438 4437 4436 4435 4434 4433 4432 4431 4430 4429 4428 4427 4426 4425 4424 4423 4422 4421 4420 4419 4418 4417 4416 4415 4414 4413 4412 4411 4410 4409 4408 4407 4406 4405 4404 4403 4402 4401 4400 4399 4398 4397 4396 4395 4394 4393 4392 4391 4390 4389 4388 4387 4386 4385 4384 4383 4382 4381 4380 4379 4378 4377 4376 4375 4374 4373 4372 4371 4370 4369 4368 4367 4366 4365 4364 4363 4362 4361 4360 4359 4358 4357 4356 4355 4354 4353 4352 4351 4350 4349 4348 4347 4346 4345 4344 4343 4342 4341 4340 4339 4338 4337 4336 4335 4334 4333 4332 4331 4330 4329 4328 4327 4326 4325 4324 4323 4322 4321 4320 4319 4318 4317 4316 4315 4314 4313 4312 4311 4310 4309 4308 4307 4306 4305 4304 4303 4302 4301 4300 4299 4298 4297 4296 4295 4294 4293 4292 4291 4290 4289 4288 4287 4286 4285 4284 4283 4282 4281 4280 4279 4278 4277 4276 4275 4274 4273 4272 4271 4270 4269 4268 4267 4266 4265 4264 4263 4262 4261 4260 4259 4258 4257 4256 4255 4254 4253 4252 4251 4250 4249 4248 4247 4246 4245 4244 4243 4242 4241 4240 4239 4238 4237 4236 4235 4234 4233 4232 4231 4230 4229 4228 4227 4226 4225 4224 4223 4222 4221 4220 4219 4218 4217 4216 4215 4214 4213 4212 4211 4210 4209 4208 4207 4206 4205 4204 4203 4202 4201 4200 4199 4198 4197 4196 4195 4194 4193 4192 4191 4190 4189 4188 4187 4186 4185 4184 4183 4182 4181 4180 4179 4178 4177 4176 4175 4174 4173 4172 4171 4170 4169 4168 4167 4166 4165 4164 4163 4162 4161 4160 4159 4158 4157 4156 4155 4154 4153 4152 4151 4150 4149 4148 4147 4146 4145 4144 4143 4142 4141 4140 4139 4138 4137 4136 4135 4134 4133 4132 4131 4130 4129 4128 4127 4126 4125 4124 4123 4122 4121 4120 4119 4118 4117 4116 4115 4114 4113 4112 4111 4110 4109 4108 4107 4106 4105 4104 4103 4102 4101 4100 4099 4098 4097 4096 4095 4094 4093 4092 4091 4090 4089 4088 4087 4086 4085 4084 4083 4082 4081 4080 4079 4078 4077 4076 4075 4074 4073 4072 4071 4070 4069 4068 4067 4066 4065 4064 4063 4062 4061 4060 4059 4058 4057 4056 4055 4054 4053 4052 4051 4050 4049 4048 4047 4046 4045 4044 4043 4042 4041 4040 4039 4038 4037 4036 4035 4034 4033 4032 4031 4030 4029 4028 4027 4026 4025 4024 4023 4022 4021 4020 4019 4018 4017 4016 4015 4014 4013 4012 4011 4010 4009 4008 4007 4006 4005 4004 4003 4002 4001 4000 3999 3998 3997 3996 3995 3994 3993 3992 3991 3990 3989 3988 3987 3986 3985 3984 3983 3982 3981 3980 3979 3978 3977 3976 3975 3974 3973 3972 3971 3970 3969 3968 3967 3966 3965 3964 3963 3962 3961 3960 3959 3958 3957 3956 3955 3954 3953 3952 3951 3950 3949 3948 3947 3946 3945 3944 3943 3942 3941 3940 3939 3938 3937 3936 3935 3934 3933 3932 3931 3930 3929 3928 3927 3926 3925 3924 3923 3922 3921 3920 3919 3918 3917 3916 3915 3914 3913 3912 3911 3910 3909 3908 3907 3906 3905 3904 3903 3902 3901 3900 3899 3898 3897 3896 3895 3894 3893 3892 3891 3890 3889 3888 3887 3886 3885 3884 3883 3882 3881 3880 3879 3878 3877 3876 3875 3874 3873 3872 3871 3870 3869 3868 3867 3866 3865 3864 3863 3862 3861 3860 3859 3858 3857 3856 3855 3854 3853 3852 3851 3850 3849 3848 3847 3846 3845 3844 3843 3842 3841 3840 3839 3838 3837 3836 3835 3834 3833 3832 3831 3830 3829 3828 3827 3826 3825 3824 3823 3822 3821 3820 3819 3818 3817 3816 3815 3814 3813 3812 3811 3810 3809 3808 3807 3806 3805 3804 3803 3802 3801 3800 3799 3798 3797 3796 3795 3794 3793 3792 3791 3790 3789 3788 3787 3786 3785 3784 3783 3782 3781 3780 3779 3778 3777 3776 3775 3774 3773 3772 3771 3770 3769 3768 3767 3766 3765 3764 3763 3762 3761 3760 3759 3758 3757 3756 3755 3754 3753 3752 3751 3750 3749 3748 3747 3746 3745 3744 3743 3742 3741 3740 3739 3738 3737 3736 3735 3734 3733 3732 3731 3730 3729 3728 3727 3726 3725 3724 3723 3722 3721 3720 3719 3718 3717 3716 3715 3714 3713 3712 3711 3710 3709 3708 3707 3706 3705 3704 3703 3702 3701 3700 3699 3698 3697 3696 3695 3694 3693 3692 3691 3690 3689 3688 3687 3686 3685 3684 3683 3682 3681 3680 3679 3678 3677 3676 3675 3674 3673 3672 3671 3670 3669 3668 3667 3666 3665 3664 3663 3662 3661 3660 3659 3658 3657 3656 3655 3654 3653 3652 3651 3650 3649 3648 3647 3646 3645 3644 3643 3642 3641 3640 3639 3638 3637 3636 3635 3634 3633 3632 3631 3630 3629 3628 3627 3626 3625 3624 3623 3622 3621 3620 3619 3618 3617 3616 3615 3614 3613 3612 3611 3610 3609 3608 3607 3606 3605 3604 3603 3602 3601 3600 3599 3598 3597 3596 3595 3594 3593 3592 3591 3590 3589 3588 3587 3586 3585 3584 3583 3582 3581 3580 3579 3578 3577 3576 3575 3574 3573 3572 3571 3570 3569 3568 3567 3566 3565 3564 3563 3562 3561 3560 3559 3558 3557 3556 3555 3554 3553 3552 3551 3550 3549 3548 3547 3546 3545 3544 3543 3542 3541 3540 3539 3538 3537 3536 3535 3534 3533 3532 3531 3530 3529 3528 3527 3526 3525 3524 3523 3522 3521 3520 3519 3518 3517 3516 3515 3514 3513 3512 3511 3510 3509 3508 3507 3506 3505 3504 3503 3502 3501 3500 3499 3498 3497 3496 3495 3494 3493 3492 3491 3490 3489 3488 3487 3486 3485 3484 3483 3482 3481 3480 3479 3478 3477 3476 3475 3474 3473 3472 3471 3470 3469 3468 3467 3466 3465 3464 3463 3462 3461 3460 3459 3458 3457 3456 3455 3454 3453 3452 3451 3450 3449 3448 3447 3446 3445 3444 3443 3442 3441 3440 3439 3438 3437 3436 3435 3434 3433 3432 3431 3430 3429 3428 3427 3426 3425 3424 3423 3422 3421 3420 3419 3418 3417 3416 3415 3414 3413 3412 3411 3410 3409 3408 3407 3406 3405 3404 3403 3402 3401 3400 3399 3398 3397 3396 3395 3394 3393 3392 3391 3390 3389 3388 3387 3386 3385 3384 3383 3382 3381 3380 3379 3378 3377 3376 3375 3374 3373 3372 3371 3370 3369 3368 3367 3366 3365 3364 3363 3362 3361 3360 3359 3358 3357 3356 3355 3354 3353 3352 3351 3350 3349 3348 3347 3346 3345 3344 3343 3342 3341 3340 3339 3338 3337 3336 3335 3334 3333 3332 3331 3330 3329 3328 3327 3326 3325 3324 3323 3322 3321 3320 3319 3318 3317 3316 3315 3314 3313 3312 3311 3310 3309 3308 3307 3306 3305 3304 3303 3302 3301 3300 3299 3298 3297 3296 3295 3294 3293 3292 3291 3290 3289 3288 3287 3286 3285 3284 3283 3282 3281 3280 3279 3278 3277 3276 3275 3274 3273 3272 3271 3270 3269 3268 3267 3266 3265 3264 3263 3262 3261 3260 3259 3258 3257 3256 3255 3254 3253 3252 3251 3250 3249 3248 3247 3246 3245 3244 3243 3242 3241 3240 3239 3238 3237 3236 3235 3234 3233 3232 3231 3230 3229 3228 3227 3226 3225 3224 3223 3222 3221 3220 3219 3218 3217 3216 3215 3214 3213 3212 3211 3210 3209 3208 3207 3206 3205 3204 3203 3202 3201 3200 3199 3198 3197 3196 3195 3194 3193 3192 3191 3190 3189 3188 3187 3186 3185 3184 3183 3182 3181 3180 3179 3178 3177 3176 3175 3174 3173 3172 3171 3170 3169 3168 3167 3166 3165 3164 3163 3162 3161 3160 3159 3158 3157 3156 3155 3154 3153 3152 3151 3150 3149 3148 3147 3146 3145 3144 3143 3142 3141 3140 3139 3138 3137 3136 3135 3134 3133 3132 3131 3130 3129 3128 3127 3126 3125 3124 3123 3122 3121 3120 3119 3118 3117 3116 3115 3114 3113 3112 3111 3110 3109 3108 3107 3106 3105 3104 3103 3102 3101 3100 3099 3098 3097 3096 3095 3094 3093 3092 3091 3090 3089 3088 3087 3086 3085 3084 3083 3082 3081 3080 3079 3078 3077 3076 3075 3074 3073 3072 3071 3070 3069 3068 3067 3066 3065 3064 3063 3062 3061 3060 3059 3058 3057 3056 3055 3054 3053 3052 3051 3050 3049 3048 3047 3046 3045 3044 3043 3042 3041 3040 3039 3038 3037 3036 3035 3034 3033 3032 3031 3030 3029 3028 3027 3026 3025 3024 3023 3022 3021 3020 3019 3018 3017 3016 3015 3014 3013 3012 3011 3010 3009 3008 3007 3006 3005 3004 3003 3002 3001 3000 2999 2998 2997 2996 2995 2994 2993 2992 2991 2990 2989 2988 2987 2986 2985 2984 2983 2982 2981 2980 2979 2978 2977 2976 2975 2974 2973 2972 2971 2970 2969 2968 2967 2966 2965 2964 2963 2962 2961 2960 2959 2958 2957 2956 2955 2954 2953 2952 2951 2950 2949 2948 2947 2946 2945 2944 2943 2942 2941 2940 2939 2938 2937 2936 2935 2934 2933 2932 2931 2930 2929 2928 2927 2926 2925 2924 2923 2922 2921 2920 2919 2918 2917 2916 2915 2914 2913 2912 2911 2910 2909 2908 2907 2906 2905 2904 2903 2902 2901 2900 2899 2898 2897 2896 2895 2894 2893 2892 2891 2890 2889 2888 2887 2886 2885 2884 2883 2882 2881 2880 2879 2878 2877 2876 2875 2874 2873 2872 2871 2870 2869 2868 2867 2866 2865 2864 2863 2862 2861 2860 2859 2858 2857 2856 2855 2854 2853 2852 2851 2850 2849 2848 2847 2846 2845 2844 2843 2842 2841 2840 2839 2838 2837 2836 2835 2834 2833 2832 2831 2830 2829 2828 2827 2826 2825 2824 2823 2822 2821 2820 2819 2818 2817 2816 2815 2814 2813 2812 2811 2810 2809 2808 2807 2806 2805 2804 2803 2802 2801 2800 2799 2798 2797 2796 2795 2794 2793 2792 2791 2790 2789 2788 2787 2786 2785 2784 2783 2782 2781 2780 2779 2778 2777 2776 2775 2774 2773 2772 2771 2770 2769 2768 2767 2766 2765 2764 2763 2762 2761 2760 2759 2758 2757 2756 2755 2754 2753 2752 2751 2750 2749 2748 2747 2746 2745 2744 2743 2742 2741 2740 2739 2738 2737 2736 2735 2734 2733 2732 2731 2730 2729 2728 2727 2726 2725 2724 2723 2722 2721 2720 2719 2718 2717 2716 2715 2714 2713 2712 2711 2710 2709 2708 2707 2706 2705 2704 2703 2702 2701 2700 2699 2698 2697 2696 2695 2694 2693 2692 2691 2690 2689 2688 2687 2686 2685 2684 2683 2682 2681 2680 2679 2678 2677 2676 2675 2674 2673 2672 2671 2670 2669 2668 2667 2666 2665 2664 2663 2662 2661 2660 2659 2658 2657 2656 2655 2654 2653 2652 2651 2650 2649 2648 2647 2646 2645 2644 2643 2642 2641 2640 2639 2638 2637 2636 2635 2634 2633 2632 2631 2630 2629 2628 2627 2626 2625 2624 2623 2622 2621 2620 2619 2618 2617 2616 2615 2614 2613 2612 2611 2610 2609 2608 2607 2606 2605 2604 2603 2602 2601 2600 2599 2598 2597 2596 2595 2594 2593 2592 2591 2590 2589 2588 2587 2586 2585 2584 2583 2582 2581 2580 2579 2578 2577 2576 2575 2574 2573 2572 2571 2570 2569 2568 2567 2566 2565 2564 2563 2562 2561 2560 2559 2558 2557 2556 2555 2554 2553 2552 2551 2550 2549 2548 2547 2546 2545 2544 2543 2542 2541 2540 2539 2538 2537 2536 2535 2534 2533 2532 2531 2530 2529 2528 2527 2526 2525 2524 2523 2522 2521 2520 2519 2518 2517 2516 2515 2514 2513 2512 2511 2510 2509 2508 2507 2506 2505 2504 2503 2502 2501 2500 2499 2498 2497 2496 2495 2494 2493 2492 2491 2490 2489 2488 2487 2486 2485 2484 2483 2482 2481 2480 2479 2478 2477 2476 2475 2474 2473 2472 2471 2470 2469 2468 2467 2466 2465 2464 2463 2462 2461 2460 2459 2458 2457 2456 2455 2454 2453 2452 2451 2450 2449 2448 2447 2446 2445 2444 2443 2442 2441 2440 2439 2438 2437 2436 2435 2434 2433 2432 2431 2430 2429 2428 2427 2426 2425 2424 2423 2422 2421 2420 2419 2418 2417 2416 2415 2414 2413 2412 2411 2410 2409 2408 2407 2406 2405 2404 2403 2402 2401 2400 2399 2398 2397 2396 2395 2394 2393 2392 2391 2390 2389 2388 2387 2386 2385 2384 2383 2382 2381 2380 2379 2378 2377 2376 2375 2374 2373 2372 2371 2370 2369 2368 2367 2366 2365 2364 2363 2362 2361 2360 2359 2358 2357 2356 2355 2354 2353 2352 2351 2350 2349 2348 2347 2346 2345 2344 2343 2342 2341 2340 2339 2338 2337 2336 2335 2334 2333 2332 2331 2330 2329 2328 2327 2326 2325 2324 2323 2322 2321 2320 2319 2318 2317 2316 2315 2314 2313 2312 2311 2310 2309 2308 2307 2306 2305 2304 2303 2302 2301 2300 2299 2298 2297 2296 2295 2294 2293 2292 2291 2290 2289 2288 2287 2286 2285 2284 2283 2282 2281 2280 2279 2278 2277 2276 2275 2274 2273 2272 2271 2270 2269 2268 2267 2266 2265 2264 2263 2262 2261 2260 2259 2258 2257 2256 2255 2254 2253 2252 2251 2250 2249 2248 2247 2246 2245 2244 2243 2242 2241 2240 2239 2238 2237 2236 2235 2234 2233 2232 2231 2230 2229 2228 2227 2226 2225 2224 2223 2222 2221 2220 2219 2218 2217 2216 2215 2214 2213 2212 2211 2210 2209 2208 2207 2206 2205 2204 2203 2202 2201 2200 2199 2198 2197 2196 2195 2194 2193 2192 2191 2190 2189 2188 2187 2186 2185 2184 2183 2182 2181 2180 2179 2178 2177 2176 2175 2174 2173 2172 2171 2170 2169 2168 2167 2166 2165 2164 2163 2162 2161 2160 2159 2158 2157 2156 2155 2154 2153 2152 2151 2150 2149 2148 2147 2146 2145 2144 2143 2142 2141 2140 2139 2138 2137 2136 2135 2134 2133 2132 2131 2130 2129 2128 2127 2126 2125 2124 2123 2122 2121 2120 2119 2118 2117 2116 2115 2114 2113 2112 2111 2110 2109 2108 2107 2106 2105 2104 2103 2102 2101 2100 2099 2098 2097 2096 2095 2094 2093 2092 2091 2090 2089 2088 2087 2086 2085 2084 2083 2082 2081 2080 2079 2078 2077 2076 2075 2074 2073 2072 2071 2070 2069 2068 2067 2066 2065 2064 2063 2062 2061 2060 2059 2058 2057 2056 2055 2054 2053 2052 2051 2050 2049 2048 2047 2046 2045 2044 2043 2042 2041 2040 2039 2038 2037 2036 2035 2034 2033 2032 2031 2030 2029 2028 2027 2026 2025 2024 2023 2022 2021 2020 2019 2018 2017 2016 2015 2014 2013 2012 2011 2010 2009 2008 2007 2006 2005 2004 2003 2002 2001 2000 1999 1998 1997 1996 1995 1994 1993 1992 1991 1990 1989 1988 1987 1986 1985 1984 1983 1982 1981 1980 1979 1978 1977 1976 1975 1974 1973 1972 1971 1970 1969 1968 1967 1966 1965 1964 1963 1962 1961 1960 1959 1958 1957 1956 1955 1954 1953 1952 1951 1950 1949 1948 1947 1946 1945 1944 1943 1942 1941 1940 1939 1938 1937 1936 1935 1934 1933 1932 1931 1930 1929 1928 1927 1926 1925 1924 1923 1922 1921 1920 1919 1918 1917 1916 1915 1914 1913 1912 1911 1910 1909 1908 1907 1906 1905 1904 1903 1902 1901 1900 1899 1898 1897 1896 1895 1894 1893 1892 1891 1890 1889 1888 1887 1886 1885 1884 1883 1882 1881 1880 1879 1878 1877 1876 1875 1874 1873 1872 1871 1870 1869 1868 1867 1866 1865 1864 1863 1862 1861 1860 1859 1858 1857 1856 1855 1854 1853 1852 1851 1850 1849 1848 1847 1846 1845 1844 1843 1842 1841 1840 1839 1838 1837 1836 1835 1834 1833 1832 1831 1830 1829 1828 1827 1826 1825 1824 1823 1822 1821 1820 1819 1818 1817 1816 1815 1814 1813 1812 1811 1810 1809 1808 1807 1806 1805 1804 1803 1802 1801 1800 1799 1798 1797 1796 1795 1794 1793 1792 1791 1790 1789 1788 1787 1786 1785 1784 1783 1782 1781 1780 1779 1778 1777 1776 1775 1774 1773 1772 1771 1770 1769 1768 1767 1766 1765 1764 1763 1762 1761 1760 1759 1758 1757 1756 1755 1754 1753 1752 1751 1750 1749 1748 1747 1746 1745 1744 1743 1742 1741 1740 1739 1738 1737 1736 1735 1734 1733 1732 1731 1730 1729 1728 1727 1726 1725 1724 1723 1722 1721 1720 1719 1718 1717 1716 1715 1714 1713 1712 1711 1710 1709 1708 1707 1706 1705 1704 1703 1702 1701 1700 1699 1698 1697 1696 1695 1694 1693 1692 1691 1690 1689 1688 1687 1686 1685 1684 1683 1682 1681 1680 1679 1678 1677 1676 1675 1674 1673 1672 1671 1670 1669 1668 1667 1666 1665 1664 1663 1662 1661 1660 1659 1658 1657 1656 1655 1654 1653 1652 1651 1650 1649 1648 1647 1646 1645 1644 1643 1642 1641 1640 1639 1638 1637 1636 1635 1634 1633 1632 1631 1630 1629 1628 1627 1626 1625 1624 1623 1622 1621 1620 1619 1618 1617 1616 1615 1614 1613 1612 1611 1610 1609 1608 1607 1606 1605 1604 1603 1602 1601 1600 1599 1598 1597 1596 1595 1594 1593 1592 1591 1590 1589 1588 1587 1586 1585 1584 1583 1582 1581 1580 1579 1578 1577 1576 1575 1574 1573 1572 1571 1570 1569 1568 1567 1566 1565 1564 1563 1562 1561 1560 1559 1558 1557 1556 1555 1554 1553 1552 1551 1550 1549 1548 1547 1546 1545 1544 1543 1542 1541 1540 1539 1538 1537 1536 1535 1534 1533 1532 1531 1530 1529 1528 1527 1526 1525 1524 1523 1522 1521 1520 1519 1518 1517 1516 1515 1514 1513 1512 1511 1510 1509 1508 1507 1506 1505 1504 1503 1502 1501 1500 1499 1498 1497 1496 1495 1494 1493 1492 1491 1490 1489 1488 1487 1486 1485 1484 1483 1482 1481 1480 1479 1478 1477 1476 1475 1474 1473 1472 1471 1470 1469 1468 1467 1466 1465 1464 1463 1462 1461 1460 1459 1458 1457 1456 1455 1454 1453 1452 1451 1450 1449 1448 1447 1446 1445 1444 1443 1442 1441 1440 1439 1438 1437 1436 1435 1434 1433 1432 1431 1430 1429 1428 1427 1426 1425 1424 1423 1422 1421 1420 1419 1418 1417 1416 1415 1414 1413 1412 1411 1410 1409 1408 1407 1406 1405 1404 1403 1402 1401 1400 1399 1398 1397 1396 1395 1394 1393 1392 1391 1390 1389 1388 1387 1386 1385 1384 1383 1382 1381 1380 1379 1378 1377 1376 1375 1374 1373 1372 1371 1370 1369 1368 1367 1366 1365 1364 1363 1362 1361 1360 1359 1358 1357 1356 1355 1354 1353 1352 1351 1350 1349 1348 1347 1346 1345 1344 1343 1342 1341 1340 1339 1338 1337 1336 1335 1334 1333 1332 1331 1330 1329 1328 1327 1326 1325 1324 1323 1322 1321 1320 1319 1318 1317 1316 1315 1314 1313 1312 1311 1310 1309 1308 1307 1306 1305 1304 1303 1302 1301 1300 1299 1298 1297 1296 1295 1294 1293 1292 1291 1290 1289 1288 1287 1286 1285 1284 1283 1282 1281 1280 1279 1278 1277 1276 1275 1274 1273 1272 1271 1270 1269 1268 1267 1266 1265 1264 1263 1262 1261 1260 1259 1258 1257 1256 1255 1254 1253 1252 1251 1250 1249 1248 1247 1246 1245 1244 1243 1242 1241 1240 1239 1238 1237 1236 1235 1234 1233 1232 1231 1230 1229 1228 1227 1226 1225 1224 1223 1222 1221 1220 1219 1218 1217 1216 1215 1214 1213 1212 1211 1210 1209 1208 1207 1206 1205 1204 1203 1202 1201 1200 1199 1198 1197 1196 1195 1194 1193 1192 1191 1190 1189 1188 1187 1186 1185 1184 1183 1182 1181 1180 1179 1178 1177 1176 1175 1174 1173 1172 1171 1170 1169 1168 1167 1166 1165 1164 1163 1162 1161 1160 1159 1158 1157 1156 1155 1154 1153 1152 1151 1150 1149 1148 1147 1146 1145 1144 1143 1142 1141 1140 1139 1138 1137 1136 1135 1134 1133 1132 1131 1130 1129 1128 1127 1126 1125 1124 1123 1122 1121 1120 1119 1118 1117 1116 1115 1114 1113 1112 1111 1110 1109 1108 1107 1106 1105 1104 1103 1102 1101 1100 1099 1098 1097 1096 1095 1094 1093 1092 1091 1090 1089 1088 1087 1086 1085 1084 1083 1082 1081 1080 1079 1078 1077 1076 1075 1074 1073 1072 1071 1070 1069 1068 1067 1066 1065 1064 1063 1062 1061 1060 1059 1058 1057 1056 1055 1054 1053 1052 1051 1050 1049 1048 1047 1046 1045 1044 1043 1042 1041 1040 1039 1038 1037 1036 1035 1034 1033 1032 1031 1030 1029 1028 1027 1026 1025 1024 1023 1022 1021 1020 1019 1018 1017 1016 1015 1014 1013 1012 1011 1010 1009 1008 1007 1006 1005 1004 1003 1002 1001 1000 999 998 997 996 995 994 993 992 991 990 989 988 987 986 985 984 983 982 981 980 979 978 977 976 975 974 973 972 971 970 969 968 967 966 965 964 963 962 961 960 959 958 957 956 955 954 953 952 951 950 949 948 947 946 945 944 943 942 941 940 939 938 937 936 935 934 933 932 931 930 929 928 927 926 925 924 923 922 921 920 919 918 917 916 915 914 913 912 911 910 909 908 907 906 905 904 903 902 901 900 899 898 897 896 895 894 893 892 891 890 889 888 887 886 885 884 883 882 881 880 879 878 877 876 875 874 873 872 871 870 869 868 867 866 865 864 863 862 861 860 859 858 857 856 855 854 853 852 851 850 849 848 847 846 845 844 843 842 841 840 839 838 837 836 835 834 833 832 831 830 829 828 827 826 825 824 823 822 821 820 819 818 817 816 815 814 813 812 811 810 809 808 807 806 805 804 803 802 801 800 799 798 797 796 795 794 793 792 791 790 789 788 787 786 785 784 783 782 781 780 779 778 777 776 775 774 773 772 771 770 769 768 767 766 765 764 763 762 761 760 759 758 757 756 755 754 753 752 751 750 749 748 747 746 745 744 743 742 741 740 739 738 737 736 735 734 733 732 731 730 729 728 727 726 725 724 723 722 721 720 719 718 717 716 715 714 713 712 711 710 709 708 707 706 705 704 703 702 701 700 699 698 697 696 695 694 693 692 691 690 689 688 687 686 685 684 683 682 681 680 679 678 677 676 675 674 673 672 671 670 669 668 667 666 665 664 663 662 661 660 659 658 657 656 655 654 653 652 651 650 649 648 647 646 645 644 643 642 641 640 639 638 637 636 635 634 633 632 631 630 629 628 627 626 625 624 623 622 621 620 619 618 617 616 615 614 613 612 611 610 609 608 607 606 605 604 603 602 601 600 599 598 597 596 595 594 593 592 591 590 589 588 587 586 585 584 583 582 581 580 579 578 577 576 575 574 573 572 571 570 569 568 567 566 565 564 563 562 561 560 559 558 557 556 555 554 553 552 551 550 549 548 547 546 545 544 543 542 541 540 539 538 537 536 535 534 533 532 531 530 529 528 527 526 525 524 523 522 521 520 519 518 517 516 515 514 513 512 511 510 509 508 507 506 505 504 503 502 501 500 499 498 497 496 495 494 493 492 491 490 489 488 487 486 485 484 483 482 481 480 479 478 477 476 475 474 473 472 471 470 469 468 467 466 465 464 463 462 461 460 459 458 457 456 455 454 453 452 451 450 449 448 447 446 445 444 443 442 441 440 439 438 437 436 435 434 433 432 431 430 429 428 427 426 425 424 423 422 421 420 419 418 417 416 415 414 413 412 411 410 409 408 407 406 405 404 403 402 401 400 399 398 397 396 395 394 393 392 391 390 389 388 387 386 385 384 383 382 381 380 379 378 377 376 375 374 373 372 371 370 369 368 367 366 365 364 363 362 361 360 359 358 357 356 355 354 353 352 351 350 349 348 347 346 345 344 343 342 341 340 339 338 337 336 335 334 333 332 331 330 329 328 327 326 325 324 323 322 321 320 319 318 317 316 315 314 313 312 311 310 309 308 307 306 305 304 303 302 301 300 299 298 297 296 295 294 293 292 291 290 289 288 287 286 285 284 283 282 281 280 279 278 277 276 275 274 273 272 271 270 269 268 267 266 265 264 263 262 261 260 259 258 257 256 255 254 253 252 251 250 249 248 247 246 245 244 243 242 241 240 239 238 237 236 235 234 233 232 231 230 229 228 227 226 225 224 223 222 221 220 219 218 217 216 215 214 213 212 211 210 209 208 207 206 205 204 203 202 201 200 199 198 197 196 195 194 193 192 191 190 189 188 187 186 185 184 183 182 181 180 179 178 177 176 175 174 173 172 171 170 169 168 167 166 165 164 163 162 161 160 159 158 157 156 155 154 153 152 151 150 149 148 147 146 145 144 143 142 141 140 139 138 137 136 135 134 133 132 131 130 129 128 127 126 125 124 123 122 121 120 119 118 117 116 115 114 113 112 111 110 109 108 107 106 105 104 103 102 101 100 99 98 97 96 95 94 93 92 91 90 89 88 87 86 85 84 83 82 81 80 79 78 77 76 75 74 73 72 71 70 69 68 67 66 65 64 63 62 61 60 59 58 57 56 55 54 53 52 51 50 49 48 47 46 45 44 43 42 41 40 39 38 37 36 35 34 33 32 31 30 29 28 27 26 25 24 23 22 21 20 19 18 17 16 15 14 13 12 11 10 9 8 7 6 5 4 3 2 1" "Enter sequence of integers, each followed by a space: Number of inversions (fast): 4999950000"
 
 # END fast tests
+
+# The templated counters on element types and comparators the command line never uses
+run_test_with_args_and_input "check" "" "count_inversions<double>: ok
+count_inversions<long long, greater>: ok
+count_inversions<string, by length>: ok
+count_inversions_radix<int64_t>: ok
+count_inversions_radix<uint8_t>: ok"
+
+# The multithreaded merge sort. Inputs over PARALLEL_CUTOFF values get split between threads.
+run_test_with_args_and_input "parallel" "2 1" "Enter sequence of integers, each followed by a space: Number of inversions (parallel): 1"
+run_test_with_args_and_input "parallel" "3 1 2 5 -4" "Enter sequence of integers, each followed by a space: Number of inversions (parallel): 6"
+run_test_with_args_and_input "parallel" "$(echo {1..100000})" "Enter sequence of integers, each followed by a space: Number of inversions (parallel): 0"
+run_test_with_args_and_input "parallel" "$(echo {100000..1})" "Enter sequence of integers, each followed by a space: Number of inversions (parallel): 4999950000"
+run_test_with_args_and_input "parallel" "$(awk 'BEGIN{for(i=0;i<100000;i++) printf "%d ", (i*7919)%100003}')" "Enter sequence of integers, each followed by a space: Number of inversions (parallel): 2500038684"
+run_test_with_args_and_input "parallel" "$(awk 'BEGIN{for(i=0;i<100000;i++) printf "%d ", (i*7919)%10}')" "Enter sequence of integers, each followed by a space: Number of inversions (parallel): 2250135000"
+
+# A fixed thread count, so the forks and merge_parallel() run even on one core. 300,000 values split into halves
+# bigger than PARALLEL_CUTOFF, so 4 and 8 threads fork twice, and 3 threads splits them unevenly.
+run_test_with_args_and_input "parallel 1" "$(awk 'BEGIN{for(i=0;i<300000;i++) printf "%d ", (i*7919)%300007 - 150000}')" "Enter sequence of integers, each followed by a space: Number of inversions (parallel): 22497242147"
+run_test_with_args_and_input "parallel 2" "$(awk 'BEGIN{for(i=0;i<300000;i++) printf "%d ", (i*7919)%300007 - 150000}')" "Enter sequence of integers, each followed by a space: Number of inversions (parallel): 22497242147"
+run_test_with_args_and_input "parallel 3" "$(awk 'BEGIN{for(i=0;i<300000;i++) printf "%d ", (i*7919)%300007 - 150000}')" "Enter sequence of integers, each followed by a space: Number of inversions (parallel): 22497242147"
+run_test_with_args_and_input "parallel 4" "$(awk 'BEGIN{for(i=0;i<300000;i++) printf "%d ", (i*7919)%10}')" "Enter sequence of integers, each followed by a space: Number of inversions (parallel): 20250405000"
+run_test_with_args_and_input "parallel 8" "$(echo {100000..1})" "Enter sequence of integers, each followed by a space: Number of inversions (parallel): 4999950000"
+run_test_with_args_and_input "parallel 8" "3 1 2 5 -4" "Enter sequence of integers, each followed by a space: Number of inversions (parallel): 6"
+run_test_with_args_and_input "parallel 0" "" "Error: Invalid thread count '0'."
+run_test_with_args_and_input "parallel x" "" "Error: Invalid thread count 'x'."
+
+# The bottom-up merge sort. Runs of INSERTION_SORT_RUN values get insertion sorted first, then merged in passes.
+# 16 and 17 values are one full run, and one run plus a run of 1.
+run_test_with_args_and_input "bottomup" "$(echo {16..1})" "Enter sequence of integers, each followed by a space: Number of inversions (bottomup): 120"
+run_test_with_args_and_input "bottomup" "$(echo {17..1})" "Enter sequence of integers, each followed by a space: Number of inversions (bottomup): 136"
+run_test_with_args_and_input "bottomup" "$(awk 'BEGIN{for(i=0;i<33;i++) printf "%d ", (i*7)%5}')" "Enter sequence of integers, each followed by a space: Number of inversions (bottomup): 204"
+run_test_with_args_and_input "bottomup" "$(awk 'BEGIN{for(i=0;i<1000;i++) printf "%d ", (i*7919)%1009 - 500}')" "Enter sequence of integers, each followed by a space: Number of inversions (bottomup): 250308"
+run_test_with_args_and_input "bottomup" "$(awk 'BEGIN{for(i=0;i<100000;i++) printf "%d ", (i*7919)%100003}')" "Enter sequence of integers, each followed by a space: Number of inversions (bottomup): 2500038684"
+run_test_with_args_and_input "bottomup" "$(awk 'BEGIN{for(i=0;i<100000;i++) printf "%d ", (i*7919)%10}')" "Enter sequence of integers, each followed by a space: Number of inversions (bottomup): 2250135000"
+run_test_with_args_and_input "bottomup" "1 x 2" "Enter sequence of integers, each followed by a space: Error: Non-integer value 'x' received at index 1."
+
+# The Fenwick tree counter, and the counts for every prefix and every window
+run_test_with_args_and_input "fenwick" "2 1" "Enter sequence of integers, each followed by a space: Number of inversions (fenwick): 1"
+run_test_with_args_and_input "fenwick" "3 1 2 5 -4" "Enter sequence of integers, each followed by a space: Number of inversions (fenwick): 6"
+run_test_with_args_and_input "fenwick" "$(echo {100000..1})" "Enter sequence of integers, each followed by a space: Number of inversions (fenwick): 4999950000"
+run_test_with_args_and_input "fenwick" "$(awk 'BEGIN{for(i=0;i<100000;i++) printf "%d ", (i*7919)%10}')" "Enter sequence of integers, each followed by a space: Number of inversions (fenwick): 2250135000"
+run_test_with_args_and_input "prefix" "3 1 2 5 -4" "Enter sequence of integers, each followed by a space: Number of inversions in each prefix: 0 1 2 2 6"
+run_test_with_args_and_input "prefix" "5 5 3 3 9 -1" "Enter sequence of integers, each followed by a space: Number of inversions in each prefix: 0 0 2 4 4 9"
+run_test_with_args_and_input "prefix" "1 x 2" "Enter sequence of integers, each followed by a space: Error: Non-integer value 'x' received at index 1."
+run_test_with_args_and_input "window 3" "3 1 2 5 -4" "Enter sequence of integers, each followed by a space: Number of inversions in each window of 3: 2 0 2"
+run_test_with_args_and_input "window 4" "5 5 3 3 9 -1" "Enter sequence of integers, each followed by a space: Number of inversions in each window of 4: 4 2 3"
+run_test_with_args_and_input "window 5" "3 1 2 5 -4" "Enter sequence of integers, each followed by a space: Number of inversions in each window of 5: 6"
+run_test_with_args_and_input "window 1" "3 1 2 5 -4" "Enter sequence of integers, each followed by a space: Number of inversions in each window of 1: 0 0 0 0 0"
+run_test_with_args_and_input "window 6" "3 1 2 5 -4" "Enter sequence of integers, each followed by a space: Error: Window size 6 is larger than the 5 values received."
+run_test_with_args_and_input "window 2" "" "Enter sequence of integers, each followed by a space: Error: Sequence of integers not received."
+run_test_with_args_and_input "window 0" "" "Error: Invalid window size '0'."
+run_test_with_args_and_input "window x" "" "Error: Invalid window size 'x'."
+run_test_with_args_and_input "window" "" "Usage: ./inversioncounter [slow | parallel [threads] | bottomup | fenwick | prefix | window <size> | radix | external [MB] | check | bench]"
+
+# The external counter. With a 1 MB budget, 300,000 values get sorted in 3 runs and then merged in one pass.
+run_test_with_args_and_input "external" "2 1" "Enter sequence of integers, each followed by a space: Number of inversions (external): 1"
+run_test_with_args_and_input "external" "3 1 2 5 -4" "Enter sequence of integers, each followed by a space: Number of inversions (external): 6"
+run_test_with_args_and_input "external 1" "$(echo {100000..1})" "Enter sequence of integers, each followed by a space: Number of inversions (external): 4999950000"
+run_test_with_args_and_input "external 1" "$(awk 'BEGIN{for(i=0;i<300000;i++) printf "%d ", (i*7919)%300007 - 150000}')" "Enter sequence of integers, each followed by a space: Number of inversions (external): 22497242147"
+run_test_with_args_and_input "external 1" "$(awk 'BEGIN{for(i=0;i<300000;i++) printf "%d ", (i*7919)%10}')" "Enter sequence of integers, each followed by a space: Number of inversions (external): 20250405000"
+# 2,500,000 values make 20 runs of 131,072, more than the 15 one merge can hold in 1 MB, so it takes two merge passes.
+maxtime=8
+run_test_with_args_and_input "external 1" "$(awk 'BEGIN{for(i=0;i<2500000;i++) printf "%d ", (i*7919)%2500009 - 1250000}')" "Enter sequence of integers, each followed by a space: Number of inversions (external): 1562317979763"
+maxtime=1
+run_test_with_args_and_input "external" "1 x 2" "Enter sequence of integers, each followed by a space: Error: Non-integer value 'x' received at index 1."
+run_test_with_args_and_input "external" "" "Enter sequence of integers, each followed by a space: Error: Sequence of integers not received."
+run_test_with_args_and_input "external 0" "" "Error: Invalid memory budget '0'."
+run_test_with_args_and_input "external x" "" "Error: Invalid memory budget 'x'."
+run_test_with_args_and_input "external 1 2" "" "Usage: ./inversioncounter [slow | parallel [threads] | bottomup | fenwick | prefix | window <size> | radix | external [MB] | check | bench]"
 ############################################################
 echo
 echo "Total tests run: $num_tests"
@@ -10,15 +10,66 @@
 #include <fstream>
 #include <sstream>
 #include <algorithm>
+#include <numeric>
 #include <limits>
 #include <cmath>
 #include <iomanip>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <unordered_map>
+#include <deque>
+#include <string_view>
+#include <charconv>
+#include <cctype>
+#include <cstdint>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// The SIMD relaxation kernels are x86 only. Everything else falls back to the plain C++ kernel.
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SHORTESTPATHS_X86 1
+#endif
 
 using namespace std;
 
-// We use long max because we must declare a long array due to specifications saying we must handle INT_MAX
+// We use long because we must declare a long array due to specifications saying we must handle INT_MAX
 // This is obtained from https://stackoverflow.com/questions/8690567/setting-an-int-to-infinity-in-c
-long INF = numeric_limits<long>::max();
+// We use half of long max so that INF + INF still fits in a long. That lets the inner Floyd loop just add two cells
+// without checking for INF or overflow first: anything that went through an INF cell comes out >= INF, so it never wins.
+// A shortest path uses at most MAX_VERTICES - 1 edges of at most INT_MAX each, so real path lengths stay under 2^55.
+long INF = numeric_limits<long>::max() / 2;
+
+/**
+ * The INF of a matrix cell of type T. It's the same trick as INF (half of the max), just for narrower cells.
+ * The intermediate vertex and successor matrices also use it to mean "no vertex".
+ * @return Half of the largest T
+*/
+template <typename T>
+constexpr T infinity()
+{
+    return numeric_limits<T>::max() / 2;
+}
+
+// Side length of one tile in the blocked version of Floyd's algorithm.
+// 64 x 64 longs is 32 KB per tile, so the 3 tiles touched in one tile update (the tile itself, its row tile
+// and its column tile) fit in L2 cache. With 32-bit distances and 16-bit vertices, they take up a lot less.
+const int FLOYD_BLOCK_SIZE = 64;
+
+// How many cells the generic relax_row kernel does per chunk (see relax_row_scalar())
+const int RELAX_CHUNK = 64;
+
+// The most vertices a graph file can declare. Past this, the per-vertex arrays of the sparse engine alone take over a GB.
+// Keep in mind that printing every pair is n^2 lines no matter which engine runs, so for graphs anywhere near this big,
+// --pairs (which only answers the pairs you ask for) is the way to go.
+const int MAX_VERTICES = 1 << 24;
 
 /**
  * Converts vertex number integer to letter. A = 1, B = 2....
@@ -51,28 +102,64 @@ long normalize(long item)
 }
 
 /**
- * Deallocates memory to prevent valgrind
+ * Allocates a num_vertices x num_vertices matrix as one contiguous row-major block.
+ * We still hand out a T** so matrix[i][j] works everywhere, but every row pointer points into the same block.
+ * That way, matrix[0] is the whole matrix laid out flat (row i starts at matrix[0] + i * num_vertices),
+ * which is what the blocked Floyd kernel wants.
+ * @param num_vertices The number of vertices in the graph
+ * @return The row pointers of the new matrix. Free it with deallocate_matrix()
 */
-void deallocate_memory(int num_vertices, long** weight_matrix, long** traceback_matrix, long** path_matrix)
+template <typename T>
+T** allocate_matrix(int num_vertices)
 {
-    for (int i = 0; i < num_vertices; i++)
+    // An empty graph still gets one row pointer so matrix[0] is always there to free
+    T** matrix = new T*[max(num_vertices, 1)];
+    matrix[0] = new T[(size_t)num_vertices * num_vertices];
+
+    for (int i = 1; i < num_vertices; i++)
     {
-        delete[] weight_matrix[i];
-        delete[] traceback_matrix[i];
-        delete[] path_matrix[i];
+        matrix[i] = matrix[0] + (size_t)i * num_vertices;
     }
-    delete[] weight_matrix;
-    delete[] traceback_matrix;
-    delete[] path_matrix;
+
+    return matrix;
 }
 
 /**
- * Computes Floyd's algorithm for calculating the shortest path
+ * Frees a matrix made by allocate_matrix()
+ * @param matrix The matrix to free
+*/
+template <typename T>
+void deallocate_matrix(T** matrix)
+{
+    if (matrix == nullptr)
+    {
+        return;
+    }
+    delete[] matrix[0];
+    delete[] matrix;
+}
+
+/**
+ * Deallocates memory to prevent valgrind
+*/
+template <typename Dist, typename Hop>
+void deallocate_memory(Dist** weight_matrix, Hop** traceback_matrix, Dist** path_matrix)
+{
+    deallocate_matrix(weight_matrix);
+    deallocate_matrix(traceback_matrix);
+    deallocate_matrix(path_matrix);
+}
+
+/**
+ * Computes Floyd's algorithm for calculating the shortest path.
+ * This is the original textbook version with the INF and overflow checks inside the innermost loop.
+ * We don't use it to solve graphs anymore (see floyds_algorithm()), but --bench uses it as the baseline.
  * @param path_matrix The path matrix of the initial graph. Initially, this should be R0
  * @param num_vertices The number of vertices in the graph
  * @param backtrack_array An empty array of num_vertices x num_vertices that is used to backtrack node path
+ * @param successor_matrix The next hop on every path. Initially, this is j wherever i -> j has an edge (see make_successor_matrix())
 */
-void floyds_algorithm(long** path_matrix, int num_vertices, long** backtrack_array)
+void floyds_algorithm_textbook(long** path_matrix, int num_vertices, long** backtrack_array, long** successor_matrix)
 {
     // First step in Floyd - iterate up to R^k.
     // The beauty of the Warshall algorithm is that we don't have to worry about arr[i][k] or arr[k][j] being updated
@@ -115,15 +202,439 @@ void floyds_algorithm(long** path_matrix, int num_vertices, long** backtrack_arr
                 if (will_update)
                 {
                     // Fix the backtrack array
-                    // Fill it out with the current letter that represents R^k
-                    // But since k is indexed, we should add 1 when doing the conversion
-                    backtrack_array[i][j] = int_to_letter(k + 1);
+                    // Fill it out with the vertex that represents R^k
+                    backtrack_array[i][j] = k;
+
+                    // The new path starts out the same way as the path from i to k
+                    successor_matrix[i][j] = successor_matrix[i][k];
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Does one row of the Floyd relaxation: row_i[j] = min(row_i[j], dist_ik + row_k[j]) for j in [j_begin, j_end).
+ * Whenever that actually makes the path shorter, inter_i[j] becomes via and next_i[j] becomes next_ik (the new path
+ * leaves i the same way the path from i to k does).
+ * dist_ik must not be INF. Because INF is only half of the max, dist_ik + row_k[j] can't overflow, and any sum that used
+ * an INF cell is >= INF so it never counts as shorter. That means the loop has no branches and the compiler can vectorize it.
+ * Dist is the type of a distance cell and Hop is the type of a vertex cell. They don't have to be the same width.
+ * When they aren't, one loop that does all 3 matrices vectorizes badly (the lanes don't line up), so we do the distances
+ * first and keep a mask for each cell, then apply the masks to the vertex rows in a second loop. RELAX_CHUNK cells at a time
+ * keeps the masks in L1.
+ * @param row_i The row of the distance matrix we're updating
+ * @param inter_i The matching row of the intermediate vertex matrix
+ * @param next_i The matching row of the successor matrix
+ * @param row_k Row k of the distance matrix
+ * @param dist_ik The distance from i to k
+ * @param via The intermediate vertex to record (k)
+ * @param next_ik The first hop from i to k
+*/
+template <typename Dist, typename Hop>
+inline __attribute__((always_inline)) void relax_row_body(Dist* row_i, Hop* inter_i, Hop* next_i, const Dist* row_k, Dist dist_ik, Hop via, Hop next_ik, int j_begin, int j_end)
+{
+    for (int chunk = j_begin; chunk < j_end; chunk += RELAX_CHUNK)
+    {
+        const int chunk_end = min(chunk + RELAX_CHUNK, j_end);
+
+        // All 1s where the path got shorter, all 0s where it didn't
+        Hop will_update[RELAX_CHUNK];
+        for (int j = chunk; j < chunk_end; j++)
+        {
+            const Dist path_val = dist_ik + row_k[j];
+            const bool shorter = path_val < row_i[j];
+
+            row_i[j] = shorter ? path_val : row_i[j];
+            will_update[j - chunk] = -(Hop)shorter;
+        }
+
+        for (int j = chunk; j < chunk_end; j++)
+        {
+            const Hop mask = will_update[j - chunk];
+            inter_i[j] = (via & mask) | (inter_i[j] & ~mask);
+            next_i[j] = (next_ik & mask) | (next_i[j] & ~mask);
+        }
+    }
+}
+
+/**
+ * The relax_row kernel for CPUs without AVX2 (see relax_row_body())
+*/
+template <typename Dist, typename Hop>
+void relax_row_scalar(Dist* row_i, Hop* inter_i, Hop* next_i, const Dist* row_k, Dist dist_ik, Hop via, Hop next_ik, int j_begin, int j_end)
+{
+    relax_row_body(row_i, inter_i, next_i, row_k, dist_ik, via, next_ik, j_begin, j_end);
+}
+
+#ifdef SHORTESTPATHS_X86
+/**
+ * AVX2 version of relax_row_scalar(). It's the same code, the compiler just gets to use 256-bit registers for it.
+ * The 64-bit version is written out by hand below.
+*/
+template <typename Dist, typename Hop>
+__attribute__((target("avx2")))
+void relax_row_avx2(Dist* row_i, Hop* inter_i, Hop* next_i, const Dist* row_k, Dist dist_ik, Hop via, Hop next_ik, int j_begin, int j_end)
+{
+    relax_row_body(row_i, inter_i, next_i, row_k, dist_ik, via, next_ik, j_begin, j_end);
+}
+
+/**
+ * AVX2 version of relax_row_scalar() for 64-bit cells. It does 4 cells at a time.
+ * AVX2 has no 64-bit min, so we compare to get a mask and then blend the distances, intermediate vertices and successors through it.
+*/
+template <>
+__attribute__((target("avx2")))
+void relax_row_avx2<long, long>(long* row_i, long* inter_i, long* next_i, const long* row_k, long dist_ik, long via, long next_ik, int j_begin, int j_end)
+{
+    const __m256i dist_ik_vec = _mm256_set1_epi64x(dist_ik);
+    const __m256i via_vec = _mm256_set1_epi64x(via);
+    const __m256i next_ik_vec = _mm256_set1_epi64x(next_ik);
+
+    int j = j_begin;
+    for (; j + 4 <= j_end; j += 4)
+    {
+        __m256i current = _mm256_loadu_si256((const __m256i*)(row_i + j));
+        __m256i path_val = _mm256_add_epi64(dist_ik_vec, _mm256_loadu_si256((const __m256i*)(row_k + j)));
+
+        // will_update is all 1s in the lanes where current > path_val
+        __m256i will_update = _mm256_cmpgt_epi64(current, path_val);
+
+        _mm256_storeu_si256((__m256i*)(row_i + j), _mm256_blendv_epi8(current, path_val, will_update));
+
+        __m256i inter = _mm256_loadu_si256((const __m256i*)(inter_i + j));
+        _mm256_storeu_si256((__m256i*)(inter_i + j), _mm256_blendv_epi8(inter, via_vec, will_update));
+
+        __m256i next = _mm256_loadu_si256((const __m256i*)(next_i + j));
+        _mm256_storeu_si256((__m256i*)(next_i + j), _mm256_blendv_epi8(next, next_ik_vec, will_update));
+    }
+
+    // The last < 4 cells
+    relax_row_scalar(row_i, inter_i, next_i, row_k, dist_ik, via, next_ik, j, j_end);
+}
+
+/**
+ * AVX-512 version of relax_row_scalar(). Like relax_row_avx2(), the compiler vectorizes it for us.
+ * 16-bit vertex cells need AVX-512BW.
+*/
+template <typename Dist, typename Hop>
+__attribute__((target("avx512f,avx512bw")))
+void relax_row_avx512(Dist* row_i, Hop* inter_i, Hop* next_i, const Dist* row_k, Dist dist_ik, Hop via, Hop next_ik, int j_begin, int j_end)
+{
+    relax_row_body(row_i, inter_i, next_i, row_k, dist_ik, via, next_ik, j_begin, j_end);
+}
+
+/**
+ * AVX-512 version of relax_row_scalar() for 64-bit cells. It does 8 cells at a time.
+ * AVX-512 compares straight into a mask register, so we can use masked stores and only write the cells that got shorter.
+ * The leftover cells at the end of the row use a partial mask instead of a scalar loop.
+*/
+template <>
+__attribute__((target("avx512f,avx512bw")))
+void relax_row_avx512<long, long>(long* row_i, long* inter_i, long* next_i, const long* row_k, long dist_ik, long via, long next_ik, int j_begin, int j_end)
+{
+    const __m512i dist_ik_vec = _mm512_set1_epi64(dist_ik);
+    const __m512i via_vec = _mm512_set1_epi64(via);
+    const __m512i next_ik_vec = _mm512_set1_epi64(next_ik);
+
+    for (int j = j_begin; j < j_end; j += 8)
+    {
+        const int remaining = j_end - j;
+        const __mmask8 lanes = remaining >= 8 ? (__mmask8)0xFF : (__mmask8)((1u << remaining) - 1);
+
+        __m512i current = _mm512_maskz_loadu_epi64(lanes, row_i + j);
+        __m512i path_val = _mm512_add_epi64(dist_ik_vec, _mm512_maskz_loadu_epi64(lanes, row_k + j));
+        __mmask8 will_update = _mm512_mask_cmplt_epi64_mask(lanes, path_val, current);
+
+        _mm512_mask_storeu_epi64(row_i + j, will_update, path_val);
+        _mm512_mask_storeu_epi64(inter_i + j, will_update, via_vec);
+        _mm512_mask_storeu_epi64(next_i + j, will_update, next_ik_vec);
+    }
+}
+#endif
+
+// Signature shared by all of the relax_row kernels
+template <typename Dist, typename Hop>
+using relax_row_fn = void (*)(Dist*, Hop*, Hop*, const Dist*, Dist, Hop, Hop, int, int);
+
+/**
+ * Picks the widest relax_row kernel this CPU can actually run.
+ * @return The kernel to use
+*/
+template <typename Dist, typename Hop>
+relax_row_fn<Dist, Hop> pick_relax_row()
+{
+#ifdef SHORTESTPATHS_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+    {
+        return relax_row_avx512<Dist, Hop>;
+    }
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return relax_row_avx2<Dist, Hop>;
+    }
+#endif
+    return relax_row_scalar<Dist, Hop>;
+}
+
+// The relax_row kernel every Floyd variant uses, one per cell width. We pick them once at startup.
+template <typename Dist, typename Hop>
+const relax_row_fn<Dist, Hop> relax_row = pick_relax_row<Dist, Hop>();
+
+/**
+ * Computes Floyd's algorithm for calculating the shortest path
+ * This gives the exact same path lengths, intermediate vertices and successors as floyds_algorithm_textbook(), but
+ * d[i][k] is pulled out of the j loop and the j loop itself is the branchless relax_row() kernel.
+ * @param path_matrix The path matrix of the initial graph. Initially, this should be R0
+ * @param num_vertices The number of vertices in the graph
+ * @param backtrack_array An empty array of num_vertices x num_vertices that is used to backtrack node path
+ * @param successor_matrix The next hop on every path (see make_successor_matrix())
+*/
+template <typename Dist, typename Hop>
+void floyds_algorithm(Dist** path_matrix, int num_vertices, Hop** backtrack_array, Hop** successor_matrix)
+{
+    // First step in Floyd - iterate up to R^k.
+    // The beauty of the Warshall algorithm is that we don't have to worry about arr[i][k] or arr[k][j] being updated
+    // On the current iteration due to how transitive closures work (not reflexive)
+    for (int k = 0; k < num_vertices; k++)
+    {
+        for (int i = 0; i < num_vertices; i++)
+        {
+            // If we can't get from i to k, going through k can't help anything in row i
+            const Dist dist_ik = path_matrix[i][k];
+            if (dist_ik != infinity<Dist>())
+            {
+                relax_row<Dist, Hop>(path_matrix[i], backtrack_array[i], successor_matrix[i], path_matrix[k], dist_ik, k, successor_matrix[i][k], 0, num_vertices);
+            }
+        }
+    }
+}
+
+/**
+ * A reusable barrier for the parallel Floyd kernel. C++17 doesn't have std::barrier yet, so we make one out of a mutex
+ * and a condition variable. Every thread calls wait() and nobody leaves until all num_threads threads got there.
+ * The generation counter lets us reuse the same barrier for every k.
+*/
+class Barrier {
+public:
+    explicit Barrier(int num_threads) : num_threads_{num_threads}, waiting_{0}, generation_{0} { }
+
+    void wait() {
+        unique_lock<mutex> lock(mutex_);
+        const unsigned long generation = generation_;
+
+        // The last thread to show up lets everyone go
+        if (++waiting_ == num_threads_) {
+            waiting_ = 0;
+            ++generation_;
+            all_here_.notify_all();
+        } else {
+            all_here_.wait(lock, [this, generation] { return generation != generation_; });
+        }
+    }
+
+private:
+    mutex mutex_;
+    condition_variable all_here_;
+    const int num_threads_;
+    int waiting_;
+    unsigned long generation_;
+};
+
+/**
+ * Computes Floyd's algorithm with the rows split across num_threads threads.
+ * For a fixed k, row k and column k don't change (d[k][k] = 0), so every other row i only reads its own row and row k.
+ * That means the threads can each take a chunk of rows and only have to sync up once per k.
+ * The thread that owns row k skips it, so nobody writes to row k while everyone else is reading it.
+ * Each cell still sees the same relaxations in the same order as floyds_algorithm(), so all 3 matrices come out bit-identical.
+ * @param path_matrix The path matrix of the initial graph. Initially, this should be R0
+ * @param num_vertices The number of vertices in the graph
+ * @param backtrack_array An empty array of num_vertices x num_vertices that is used to backtrack node path
+ * @param successor_matrix The next hop on every path (see make_successor_matrix())
+ * @param num_threads How many threads to use (including the calling thread)
+*/
+template <typename Dist, typename Hop>
+void floyds_algorithm_parallel(Dist** path_matrix, int num_vertices, Hop** backtrack_array, Hop** successor_matrix, int num_threads)
+{
+    num_threads = max(1, min(num_threads, num_vertices));
+    Barrier barrier(num_threads);
+
+    // Each thread runs this on its own chunk of rows [row_begin, row_end)
+    auto worker = [&](int row_begin, int row_end) {
+        for (int k = 0; k < num_vertices; k++)
+        {
+            for (int i = row_begin; i < row_end; i++)
+            {
+                const Dist dist_ik = path_matrix[i][k];
+                if (i != k && dist_ik != infinity<Dist>())
+                {
+                    relax_row<Dist, Hop>(path_matrix[i], backtrack_array[i], successor_matrix[i], path_matrix[k], dist_ik, k, successor_matrix[i][k], 0, num_vertices);
+                }
+            }
+
+            // Row k + 1 has to be done before anyone uses it
+            barrier.wait();
+        }
+    };
+
+    // Spread the rows out as evenly as possible. The calling thread takes the first chunk.
+    vector<thread> threads;
+    for (int t = 1; t < num_threads; t++)
+    {
+        threads.emplace_back(worker, (int)((long)num_vertices * t / num_threads), (int)((long)num_vertices * (t + 1) / num_threads));
+    }
+    worker(0, num_vertices / num_threads);
+
+    for (thread &t : threads)
+    {
+        t.join();
+    }
+}
+
+/**
+ * Runs the Floyd update for k in [k_begin, k_end) on one tile of the matrix: rows [i_begin, i_end) x columns [j_begin, j_end).
+ * This is the exact same relaxation as floyds_algorithm(), just restricted to a rectangle of a flat row-major matrix.
+ * @param dist The flat distance matrix (row i starts at dist + i * n)
+ * @param inter The flat intermediate vertex matrix, laid out the same way
+ * @param next The flat successor matrix, laid out the same way
+ * @param n The number of vertices in the graph (the row length)
+*/
+template <typename Dist, typename Hop>
+void floyd_tile(Dist* dist, Hop* inter, Hop* next, int n, int k_begin, int k_end, int i_begin, int i_end, int j_begin, int j_end)
+{
+    for (int k = k_begin; k < k_end; k++)
+    {
+        const Dist* row_k = dist + (size_t)k * n;
+
+        for (int i = i_begin; i < i_end; i++)
+        {
+            Dist* row_i = dist + (size_t)i * n;
+            Hop* inter_i = inter + (size_t)i * n;
+            Hop* next_i = next + (size_t)i * n;
+
+            // d[i][k] is the same for the whole row, so we check it once instead of once per j.
+            // If we can't even reach k from i, nothing in this row can improve.
+            const Dist dist_ik = row_i[k];
+            if (dist_ik == infinity<Dist>())
+            {
+                continue;
+            }
+
+            relax_row<Dist, Hop>(row_i, inter_i, next_i, row_k, dist_ik, k, next_i[k], j_begin, j_end);
+        }
+    }
+}
+
+/**
+ * Computes Floyd's algorithm using cache-sized tiles (blocked Floyd-Warshall).
+ * The textbook version sweeps the whole n x n matrix once per k, so for thousands of vertices every k pass
+ * streams the entire matrix through memory. Here, we instead go through the k's one block at a time and, for each block:
+ *  1) Update the diagonal tile (K, K). It only depends on itself.
+ *  2) Update the rest of row K and column K. Those only depend on themselves and the finished diagonal tile.
+ *  3) Update every remaining tile (I, J). It only depends on the finished tiles (I, K) and (K, J).
+ * Each tile update then does FLOYD_BLOCK_SIZE k-steps on data that's already sitting in cache.
+ * The path lengths are the same as floyds_algorithm(). When two paths tie, the intermediate vertex and successor we record
+ * can differ, but they always reconstruct a shortest path.
+ * @param path_matrix The path matrix of the initial graph. It must come from allocate_matrix()
+ * @param num_vertices The number of vertices in the graph
+ * @param backtrack_array The intermediate vertex matrix. It must come from allocate_matrix()
+ * @param successor_matrix The successor matrix. It must come from allocate_matrix()
+*/
+template <typename Dist, typename Hop>
+void floyds_algorithm_blocked(Dist** path_matrix, int num_vertices, Hop** backtrack_array, Hop** successor_matrix)
+{
+    Dist* dist = path_matrix[0];
+    Hop* inter = backtrack_array[0];
+    Hop* next = successor_matrix[0];
+    const int n = num_vertices;
+    const int B = FLOYD_BLOCK_SIZE;
+
+    for (int kb = 0; kb < n; kb += B)
+    {
+        const int ke = min(kb + B, n);
+
+        // Phase 1: The diagonal tile
+        floyd_tile(dist, inter, next, n, kb, ke, kb, ke, kb, ke);
+
+        // Phase 2: The rest of row block K and column block K
+        for (int b = 0; b < n; b += B)
+        {
+            if (b == kb)
+            {
+                continue;
+            }
+            const int be = min(b + B, n);
+            floyd_tile(dist, inter, next, n, kb, ke, kb, ke, b, be);      // Row tile (K, b)
+            floyd_tile(dist, inter, next, n, kb, ke, b, be, kb, ke);      // Column tile (b, K)
+        }
+
+        // Phase 3: Everything else
+        for (int ib = 0; ib < n; ib += B)
+        {
+            if (ib == kb)
+            {
+                continue;
+            }
+            const int ie = min(ib + B, n);
+
+            for (int jb = 0; jb < n; jb += B)
+            {
+                if (jb == kb)
+                {
+                    continue;
                 }
+                floyd_tile(dist, inter, next, n, kb, ke, ib, ie, jb, min(jb + B, n));
             }
         }
     }
 }
 
+/**
+ * Updates already-solved Floyd matrices after the edge u -> v is added or gets shorter, in O(n^2) instead of rerunning
+ * the whole O(n^3) algorithm.
+ * Any path that gets shorter now has to use the new edge, so it's (shortest i -> u) + w + (shortest v -> j). Neither of
+ * those halves can use the new edge themselves (that would be a cycle, and every weight is positive), so we can read them
+ * while we write. For each row i that is just relax_row() with d[i][u] + w against row v.
+ * The intermediate vertex of an improved path is u (or v for paths that start at u), and the successor is the first hop
+ * towards u (or v itself), so both matrices keep working for path reconstruction.
+ * Making an edge longer can't be done this way, since we don't know which paths relied on it. Callers should check for that.
+ * d[i][u] + w has to stay below INF, so with 32-bit distances the caller has to make sure the new weight fits too.
+ * @param path_matrix The solved path matrix
+ * @param backtrack_array The solved intermediate vertex matrix
+ * @param successor_matrix The solved successor matrix
+ * @param num_vertices The number of vertices in the graph
+ * @param u Where the edge starts
+ * @param v Where the edge ends
+ * @param weight The new weight of the edge
+*/
+template <typename Dist, typename Hop>
+void apply_edge_update(Dist** path_matrix, Hop** backtrack_array, Hop** successor_matrix, int num_vertices, int u, int v, Dist weight)
+{
+    // If there's already a path from u to v this short, nothing can get shorter
+    if (weight >= path_matrix[u][v])
+    {
+        return;
+    }
+
+    for (int i = 0; i < num_vertices; i++)
+    {
+        const Dist dist_iu = path_matrix[i][u];
+        if (dist_iu == infinity<Dist>())
+        {
+            continue;
+        }
+
+        // Paths out of u leave through the new edge. Everything else leaves the way its path to u does.
+        const Hop via = i == u ? v : u;
+        const Hop next_iu = i == u ? v : successor_matrix[i][u];
+        relax_row<Dist, Hop>(path_matrix[i], backtrack_array[i], successor_matrix[i], path_matrix[v], dist_iu + weight, via, next_iu, 0, num_vertices);
+    }
+
+    // u -> v itself is now just the edge, with nothing in between
+    backtrack_array[u][v] = infinity<Hop>();
+}
+
 /**
  * Displays the matrix on the screen as formatted by the table. This code is stolen directly from PA7.
  * @param matrix The matrix to print
@@ -131,13 +642,14 @@ void floyds_algorithm(long** path_matrix, int num_vertices, long** backtrack_arr
  * @param num_vertices The number of vertices in the matrix. This should be constant regardless of which matrix you use
  * @param use_letters Whether or not to display using letters. This is false by default.
 */
-void display_table(long ** const matrix, const string & label, int num_vertices, const bool use_letters = false) {
+template <typename T>
+void display_table(T ** const matrix, const string & label, int num_vertices, const bool use_letters = false) {
     cout << label << endl;
     long max_val = 0;
     for (int i = 0; i < num_vertices; i++) {
         for (int j = 0; j < num_vertices; j++) {
             long cell = matrix[i][j];
-            if (cell < INF && cell > max_val) {
+            if (cell < infinity<T>() && cell > max_val) {
                 max_val = matrix[i][j];
             }
         }
@@ -155,10 +667,10 @@ void display_table(long ** const matrix, const string & label, int num_vertices,
         cout << static_cast < char > (i + 'A');
         for (int j = 0; j < num_vertices; j++) {
             cout << " " << setw(max_cell_width);
-            if (matrix[i][j] == INF) {
+            if (matrix[i][j] == infinity<T>()) {
                 cout << "-";
             } else if (use_letters) {
-                cout << char(matrix[i][j]);
+                cout << int_to_letter(matrix[i][j] + 1);
             } else {
                 cout << matrix[i][j];
             }
@@ -169,67 +681,80 @@ void display_table(long ** const matrix, const string & label, int num_vertices,
 }
 
 /**
- * Returns a string that contains the direction we took to get to a certain array.
- * This does it recursively.
- * @param backtrack_array The backtrack array
- * @param num_vertices The number of vertices in the graph
- * @param destination The node to arrive from
- * @param target The node we want to arrive at after the intermediate
+ * Appends the path from source to target onto out, like "A -> C -> B".
+ * We just follow the successor matrix one hop at a time, so this is linear in the length of the path and never copies
+ * anything but the names themselves. There has to be a path (the distance can't be INF).
+ * The matrix and the names can be anything that indexes like them: Hop** and vector<string> in memory, or
+ * FlatMatrix and SnapshotNames straight out of a snapshot.
+ * @param out The buffer to add the path to
+ * @param successor_matrix The next hop on every shortest path
+ * @param vertex_names The name of every vertex (strings or string_views)
+ * @param source The vertex the path starts at
+ * @param target The vertex the path ends at
 */
-string get_directions(long** backtrack_array, int num_vertices, char destination, char target)
+template <typename HopMatrix, typename Names>
+void append_directions(string &out, const HopMatrix &successor_matrix, const Names &vertex_names, int source, int target)
 {
-    // We assume things are in A -> D order
-    // We will use i as horizontal index and j as vertical index
+    out += vertex_names[source];
+    for (int v = source; v != target; )
+    {
+        v = successor_matrix[v][target];
+        out += " -> ";
+        out += vertex_names[v];
+    }
+}
 
-    int i = letter_to_int(destination) - 1;
-    int j = letter_to_int(target) - 1;
+/**
+ * Appends one line of the traceback onto out, like "A -> B, distance: 5, path: A -> C -> B" plus a newline.
+ * The matrices and names can be anything that indexes like them (see append_directions()).
+ * @param out The buffer to add the line to
+ * @param path_matrix The matrix that represents the path distances
+ * @param successor_matrix The next hop on every shortest path
+ * @param vertex_names The name of every vertex
+ * @param i The vertex the path starts at
+ * @param j The vertex the path ends at
+*/
+template <typename DistMatrix, typename HopMatrix, typename Names>
+void append_traceback_line(string &out, const DistMatrix &path_matrix, const HopMatrix &successor_matrix, const Names &vertex_names, int i, int j)
+{
+    typedef typename remove_cv<typename remove_reference<decltype(path_matrix[i][j])>::type>::type Dist;
 
-    long intermediate_letter = backtrack_array[i][j];
+    // A -> A
+    out += vertex_names[i];
+    out += " -> ";
+    out += vertex_names[j];
 
-    // If there is no intermediate letter, the recursion stops. Just return destination --> target
-    if (intermediate_letter == INF)
-    {   
-        // We have 2 cases here. The first one is that we see something like A -> A (self loop)
-        // Here, we rid duplicates. Just return the destination letter itself as a string
-        if (destination == target)
-        {
-            return string(1, destination);
-        }
-        else
-        {
-            // The second case is normal. You just have A -> B. In that case, return it.
-            string make_str = string(1, destination) + " -> " + string(1, target);
-            return make_str;
-        }
-    }
-    else
+    // If something's distance is infinity, we need special treatment
+    if (path_matrix[i][j] == infinity<Dist>())
     {
-        // Now, let's get the left and right directions of A -> D
-        string dir_left = get_directions(backtrack_array, num_vertices, destination, char(intermediate_letter));
-        string dir_right = get_directions(backtrack_array, num_vertices, char(intermediate_letter), target);
-
-        // cout << dir_left << endl;
-        // cout << dir_right << endl;
+        out += ", distance: infinity, path: none\n";
+        return;
+    }
 
-        // Now, at this step, we have "A -> B" and "B -> C". We need to get rid of duplicate Bs
-        // Remember that we just need to cut B out. So just skip idx 0 on the right 
-        // "B" is length 1. So we start from index 1
-        // To capture "-> C -> D" (9) from "B -> C -> D" (11), we capture str_len - 1
+    // distance: _
+    out += ", distance: ";
+    out += to_string(path_matrix[i][j]);
 
-        // Substring function obtained from https://cplusplus.com/reference/string/string/substr/
-        string combined_dir = dir_left + dir_right.substr(1, dir_right.length() - 1);
-        return combined_dir;
-    }
+    // find the path:
+    out += ", path: ";
+    append_directions(out, successor_matrix, vertex_names, i, j);
+    out += '\n';
 }
 
 /**
  * Prints the traceback onto the console
+ * Every line gets built in the same buffer and then written out in one go, so printing all n^2 paths is linear in
+ * the size of the output.
  * @param path_matrix The matrix that represents the path distances
- * @param backtrack_array The array that contains the intermediate vertices
- * @param num_vertices The number of vertices in the graph
+ * @param successor_matrix The next hop on every shortest path
+ * @param vertex_names The name of every vertex
 */
-void print_traceback(long** path_matrix, long** backtrack_array, int num_vertices)
+template <typename Dist, typename Hop>
+void print_traceback(Dist** path_matrix, Hop** successor_matrix, const vector<string> &vertex_names)
 {
+    const int num_vertices = vertex_names.size();
+    string line;
+
     // Loop through everything in path matrix. Then, return the necessary data.
     // Remember that the row is the destination
     for (int i = 0; i < num_vertices; i++)
@@ -237,261 +762,1698 @@ void print_traceback(long** path_matrix, long** backtrack_array, int num_vertice
         // And the column is target
         for (int j = 0; j < num_vertices; j++)
         {
-            // A -> A. Remember we add 1 to the number because we're indexing
-            cout << int_to_letter(i + 1) << " -> " << int_to_letter(j + 1) << ", ";
-
-            // If something's distance is infinity, we need special treatment
-            if (path_matrix[i][j] == INF)
-            {
-                cout << "distance: infinity, path: none" << endl;
-            }
-            else
-            {
-                // distance: _
-                cout << "distance: " << path_matrix[i][j] << ", ";
-
-                // find the path:
-                cout << "path: " << get_directions(backtrack_array, num_vertices, int_to_letter(i + 1), int_to_letter(j + 1)) << endl;
-            }
+            line.clear();
+            append_traceback_line(line, path_matrix, successor_matrix, vertex_names, i, j);
+            cout.write(line.data(), line.size());
         }
     }
+    cout.flush();
 }
 
-int main(int argc, const char *argv[]) {
-    // First, declare an istringstream (iss) that we will use to parse numbers
-    istringstream iss;
-
-    // Then, declare a weight matrix and a path matrix. We will change this later
-    // We will use double pointers to represent the 2D array (since 2D arrays are an array that contains pointers to arrays)
-    int num_vertices;
-    long** weight_matrix;   // This is the initial state
-    long** path_matrix;     // This is the path state
-
-    // We will then declare a traceback matrix we will use to track back the paths in the Floyd Algorithm
-    long** traceback_matrix;
+/**
+ * One edge from the graph file. Vertices are 0-indexed.
+*/
+struct Edge {
+    int from;
+    int to;
+    long weight;
+};
 
-    // ⭐ Create a string that represents the valid_char range. This will be used to report error messages.
-    char valid_char_start = 'A';
-    char valid_char_end;
-    
-    // Make sure the right number of command line arguments exist.
-    if (argc != 2) {
-        cerr << "Usage: " << argv[0] << " <filename>" << endl;
-        return 1;
-    }
-    // Create an ifstream object.
-    ifstream input_file(argv[1]);
-    // If it does not exist, print an error message.
-    if (!input_file) {
-        cerr << "Error: Cannot open file '" << argv[1] << "'." << endl;
-        return 1;
+/**
+ * Hash table from vertex name to vertex number, for graphs that are too big to name with letters.
+ * Vertices get numbered in the order their names first show up in the file.
+ * The keys are string_views into names_, so looking a name up straight out of the file doesn't make a string.
+ * names_ is a deque because a deque never moves its elements when it grows, so the views stay valid.
+*/
+class VertexTable {
+public:
+    /**
+     * @param num_vertices How many vertices the graph has, so the most names the table will take
+     * @param expected_names Roughly how many names we'll actually see, so the hash table can be sized once up front
+    */
+    VertexTable(int num_vertices, size_t expected_names) : num_vertices_{num_vertices} {
+        ids_.reserve(min((size_t)num_vertices, expected_names));
     }
-    // Add read errors to the list of exceptions the ifstream will handle.
-    input_file.exceptions(ifstream::badbit);
-    string line;
-    try {
-        unsigned int line_number = 1;
 
-        while (getline(input_file, line)) {
-            // ⭐ First, we do error checking
+    // Copying would leave the keys pointing into the other table's names
+    VertexTable(const VertexTable&) = delete;
+    VertexTable& operator=(const VertexTable&) = delete;
+    VertexTable(VertexTable&&) = default;
+    VertexTable& operator=(VertexTable&&) = default;
 
-            // If the number of vertices is not between 1 and 26, throw an error
-            if (line_number == 1)
-            {
-                iss.str(line);
+    /**
+     * Looks up the vertex number of a name, giving it the next free number if it's new
+     * @param name The name of the vertex
+     * @return The vertex number, or -1 if the name is new and every vertex already has a name
+    */
+    int lookup_or_add(string_view name) {
+        auto found = ids_.find(name);
+        if (found != ids_.end()) {
+            return found->second;
+        }
+        if ((int)names_.size() == num_vertices_) {
+            return -1;
+        }
+        names_.emplace_back(name);
+        ids_.emplace(names_.back(), names_.size() - 1);
+        return names_.size() - 1;
+    }
 
-                if (!(iss >> num_vertices))
-                {
-                    cerr << "Error: Invalid number of vertices '" << line <<"' on line 1." << endl;
-                    return 1;
-                }
+    /**
+     * Looks up the vertex number of a name without adding it
+     * @param name The name of the vertex
+     * @return The vertex number, or -1 if the name never showed up
+    */
+    int lookup(string_view name) const {
+        auto found = ids_.find(name);
+        return found == ids_.end() ? -1 : found->second;
+    }
 
-                if (!(num_vertices >= 1 && num_vertices <= 26))
-                {
-                    cerr << "Error: Invalid number of vertices '" << line <<"' on line 1." << endl;
-                    return 1;
-                }
+    /**
+     * Returns the name of every vertex. Vertices that never showed up in the file are called #<vertex number>, with
+     * more #s in front if the file already used that name for another vertex.
+    */
+    vector<string> names() const {
+        vector<string> all_names(names_.begin(), names_.end());
+        for (int i = all_names.size(); i < num_vertices_; i++) {
+            string name = "#" + to_string(i + 1);
+            while (ids_.count(name) != 0) {
+                name.insert(0, 1, '#');
+            }
+            all_names.push_back(name);
+        }
+        return all_names;
+    }
 
-                iss.clear();
+private:
+    int num_vertices_;
+    unordered_map<string_view, int> ids_;
+    deque<string> names_;
+};
 
-                // If the number is valid, make a weight matrix, path matrix, and the traceback matrix
-                // This method of declaring 2D arrays is taken from
-                // https://www.geeksforgeeks.org/how-to-declare-a-2d-array-dynamically-in-c-using-new-operator/
-                weight_matrix = new long*[num_vertices];
-                traceback_matrix = new long*[num_vertices];
-                path_matrix = new long*[num_vertices];
+/**
+ * A graph in compressed sparse row (CSR) form.
+ * The edges leaving vertex u are targets[offsets[u]] ... targets[offsets[u + 1] - 1], with the matching weights.
+ * Everything is in 3 flat arrays, so walking a vertex's edges is one sequential read.
+*/
+struct CsrGraph {
+    int num_vertices;
+    vector<size_t> offsets;
+    vector<int> targets;
+    vector<long> weights;
+};
 
-                for (int i = 0; i < num_vertices; i++)
+/**
+ * Builds a CSR graph out of an edge list.
+ * If the same edge shows up more than once, the last one in the file wins, same as when we fill in a matrix.
+ * @param num_vertices The number of vertices in the graph
+ * @param edges The edges, in the order they appear in the file
+ * @return The CSR graph
+*/
+CsrGraph build_csr(int num_vertices, vector<Edge> edges)
+{
+    // Sort by (from, to). stable_sort keeps file order for repeated edges, so the last copy is the one to keep.
+    stable_sort(edges.begin(), edges.end(), [](const Edge &a, const Edge &b) {
+        return a.from < b.from || (a.from == b.from && a.to < b.to);
+    });
+
+    CsrGraph graph;
+    graph.num_vertices = num_vertices;
+    graph.offsets.assign(num_vertices + 1, 0);
+    graph.targets.reserve(edges.size());
+    graph.weights.reserve(edges.size());
+
+    for (size_t e = 0; e < edges.size(); e++)
+    {
+        // Skip this copy if the next edge is the same one
+        if (e + 1 < edges.size() && edges[e + 1].from == edges[e].from && edges[e + 1].to == edges[e].to)
+        {
+            continue;
+        }
+        graph.targets.push_back(edges[e].to);
+        graph.weights.push_back(edges[e].weight);
+        graph.offsets[edges[e].from + 1]++;
+    }
+
+    // Turn the per-vertex counts into starting offsets
+    for (int u = 0; u < num_vertices; u++)
+    {
+        graph.offsets[u + 1] += graph.offsets[u];
+    }
+
+    return graph;
+}
+
+/**
+ * Binary min-heap of vertices keyed by their current distance, with decrease-key.
+ * position_ remembers where every vertex sits in the heap (or -1), so decreasing a key is just a sift up.
+ * The keys live in the distance array that Dijkstra is filling in, so the heap doesn't keep its own copy.
+*/
+class IndexedMinHeap {
+public:
+    explicit IndexedMinHeap(const vector<long> &keys) : keys_(keys), position_(keys.size(), -1) { }
+
+    bool empty() const {
+        return heap_.empty();
+    }
+
+    /**
+     * Adds a vertex, or moves it up if it's already in the heap and its key just got smaller
+    */
+    void push_or_decrease(int vertex) {
+        if (position_[vertex] == -1) {
+            position_[vertex] = heap_.size();
+            heap_.push_back(vertex);
+        }
+        sift_up(position_[vertex]);
+    }
+
+    /**
+     * Empties the heap without popping everything one at a time
+    */
+    void clear() {
+        for (int vertex : heap_) {
+            position_[vertex] = -1;
+        }
+        heap_.clear();
+    }
+
+    /**
+     * Removes and returns the vertex with the smallest key
+    */
+    int pop() {
+        int top = heap_[0];
+        position_[top] = -1;
+
+        heap_[0] = heap_.back();
+        heap_.pop_back();
+        if (!heap_.empty()) {
+            position_[heap_[0]] = 0;
+            sift_down(0);
+        }
+        return top;
+    }
+
+private:
+    const vector<long> &keys_;
+    vector<int> heap_;
+    vector<int> position_;
+
+    void place(size_t index, int vertex) {
+        heap_[index] = vertex;
+        position_[vertex] = index;
+    }
+
+    void sift_up(size_t index) {
+        int vertex = heap_[index];
+        while (index > 0 && keys_[heap_[(index - 1) / 2]] > keys_[vertex]) {
+            place(index, heap_[(index - 1) / 2]);
+            index = (index - 1) / 2;
+        }
+        place(index, vertex);
+    }
+
+    void sift_down(size_t index) {
+        int vertex = heap_[index];
+        while (2 * index + 1 < heap_.size()) {
+            size_t child = 2 * index + 1;
+            if (child + 1 < heap_.size() && keys_[heap_[child + 1]] < keys_[heap_[child]]) {
+                child++;
+            }
+            if (keys_[heap_[child]] >= keys_[vertex]) {
+                break;
+            }
+            place(index, heap_[child]);
+            index = child;
+        }
+        place(index, vertex);
+    }
+};
+
+/**
+ * Dijkstra's algorithm from one source over a CSR graph.
+ * @param graph The graph
+ * @param source Where to start
+ * @param dist Gets the distance to every vertex (INF if unreachable). It must have num_vertices entries
+ * @param parent Gets the vertex before every vertex on its shortest path (-1 for the source and unreachable vertices)
+ * @param heap A heap over dist. It's empty again when we return, so the caller can reuse it for the next source
+ * @param is_target If this isn't nullptr, we stop as soon as every vertex marked in it is done. Only those vertices (and
+ *                  the ones on their paths) are guaranteed to have their final dist and parent then.
+ * @param num_targets How many vertices are marked in is_target
+*/
+void dijkstra(const CsrGraph &graph, int source, vector<long> &dist, vector<int> &parent, IndexedMinHeap &heap,
+              const vector<char> *is_target = nullptr, int num_targets = 0)
+{
+    fill(dist.begin(), dist.end(), INF);
+    fill(parent.begin(), parent.end(), -1);
+
+    dist[source] = 0;
+    heap.push_or_decrease(source);
+
+    while (!heap.empty())
+    {
+        int u = heap.pop();
+
+        // Once a vertex is popped its distance is final. If that was the last one we care about, we're done.
+        if (is_target != nullptr && (*is_target)[u] && --num_targets == 0)
+        {
+            heap.clear();
+            return;
+        }
+
+        // Relax every edge out of u
+        for (size_t e = graph.offsets[u]; e < graph.offsets[u + 1]; e++)
+        {
+            int v = graph.targets[e];
+            long path_val = dist[u] + graph.weights[e];
+            if (path_val < dist[v])
+            {
+                dist[v] = path_val;
+                parent[v] = u;
+                heap.push_or_decrease(v);
+            }
+        }
+    }
+}
+
+/**
+ * Appends one line of the traceback onto out, like append_traceback_line(), but out of a finished dijkstra() run
+ * @param out The buffer to add the line to
+ * @param dist The distances dijkstra() found from source
+ * @param parent The parents dijkstra() found from source
+ * @param vertex_names The name of every vertex
+ * @param source The vertex dijkstra() started at
+ * @param target The vertex the path ends at
+ * @param path Scratch space for walking the path, so it doesn't get allocated again for every line
+*/
+void append_dijkstra_line(string &out, const vector<long> &dist, const vector<int> &parent, const vector<string> &vertex_names,
+                          int source, int target, vector<int> &path)
+{
+    out += vertex_names[source];
+    out += " -> ";
+    out += vertex_names[target];
+
+    if (dist[target] == INF)
+    {
+        out += ", distance: infinity, path: none\n";
+        return;
+    }
+    out += ", distance: ";
+    out += to_string(dist[target]);
+    out += ", path: ";
+
+    // Walk the parents back to the source, then add them front to back
+    path.clear();
+    for (int v = target; v != -1; v = parent[v])
+    {
+        path.push_back(v);
+    }
+    for (size_t p = path.size(); p-- > 0; )
+    {
+        out += vertex_names[path[p]];
+        if (p > 0)
+        {
+            out += " -> ";
+        }
+    }
+    out += '\n';
+}
+
+/**
+ * Decides whether a graph is sparse enough that Johnson's algorithm beats Floyd's.
+ * Floyd is n^3 no matter what (but very fast per step), and Johnson is about n * m * log(n) heap work.
+ * We also always go sparse once three n x n matrices of longs would take more than a few GB.
+ * @param num_vertices The number of vertices (n)
+ * @param num_edges The number of edges (m)
+*/
+bool use_sparse_engine(int num_vertices, size_t num_edges)
+{
+    const double n = num_vertices;
+    return num_vertices > 16384 || num_edges * log2(n + 1) * 8 < n * n;
+}
+
+/**
+ * Johnson's algorithm for all pairs shortest paths on a sparse graph, printed in the same format as print_traceback().
+ * Johnson's normally starts with Bellman-Ford to reweight the edges so none are negative. Our graph files can only have
+ * positive weights (main() rejects anything else), so every potential would be 0 and we skip straight to running
+ * Dijkstra from every source. We print each source's row as soon as we have it, so we only ever store O(n + m).
+ * The output is still one line per pair, so n^2 lines (see MAX_VERTICES).
+ * @param graph The graph
+ * @param vertex_names The name of every vertex
+*/
+void johnsons_algorithm(const CsrGraph &graph, const vector<string> &vertex_names)
+{
+    const int num_vertices = graph.num_vertices;
+    vector<long> dist(num_vertices);
+    vector<int> parent(num_vertices);
+    vector<int> path;
+    IndexedMinHeap heap(dist);
+    string line;
+
+    for (int source = 0; source < num_vertices; source++)
+    {
+        dijkstra(graph, source, dist, parent, heap);
+
+        // Same output buffer trick as print_traceback()
+        for (int target = 0; target < num_vertices; target++)
+        {
+            line.clear();
+            append_dijkstra_line(line, dist, parent, vertex_names, source, target, path);
+            cout.write(line.data(), line.size());
+        }
+    }
+    cout.flush();
+}
+
+/**
+ * Fills a flat num_vertices x num_vertices distance matrix with a random dense graph, the same way main() would
+ * after reading a graph file (0 on the diagonal, INF where there's no edge). The intermediate matrix is set to INF,
+ * and the successor matrix is set up like make_successor_matrix() does.
+ * @param dist The flat distance matrix to fill
+ * @param inter The flat intermediate vertex matrix to fill
+ * @param next The flat successor matrix to fill
+ * @param num_vertices The number of vertices in the graph
+ * @param seed The seed for the random number generator, so every kernel gets the same graph
+*/
+template <typename Dist, typename Hop>
+void make_random_graph(Dist* dist, Hop* inter, Hop* next, int num_vertices, unsigned seed)
+{
+    mt19937 rng(seed);
+    uniform_int_distribution<int> coin(0, 3);
+    uniform_int_distribution<long> weight(1, 1000);
+
+    for (size_t i = 0; i < (size_t)num_vertices; i++)
+    {
+        for (size_t j = 0; j < (size_t)num_vertices; j++)
+        {
+            // Roughly 1 in 4 pairs gets an edge
+            Dist cell = infinity<Dist>();
+            if (i == j)
+            {
+                cell = 0;
+            }
+            else if (coin(rng) == 0)
+            {
+                cell = weight(rng);
+            }
+            dist[i * num_vertices + j] = cell;
+            inter[i * num_vertices + j] = infinity<Hop>();
+            next[i * num_vertices + j] = cell == infinity<Dist>() ? infinity<Hop>() : j;
+        }
+    }
+}
+
+/**
+ * Returns the name of the relax_row kernel we picked, for the benchmark output
+*/
+string relax_row_name()
+{
+#ifdef SHORTESTPATHS_X86
+    if (relax_row<long, long> == relax_row_avx512<long, long>)
+    {
+        return "AVX-512";
+    }
+    if (relax_row<long, long> == relax_row_avx2<long, long>)
+    {
+        return "AVX2";
+    }
+#endif
+    return "scalar";
+}
+
+/**
+ * Times one Floyd kernel on a fresh copy of the random graph for size n
+ * @param kernel The Floyd kernel to run
+ * @param dist Gets filled with the path lengths the kernel computed. It must come from allocate_matrix()
+ * @param inter Gets filled with the intermediate vertices the kernel computed. It must come from allocate_matrix()
+ * @param next Gets filled with the successors the kernel computed. It must come from allocate_matrix()
+ * @param n The number of vertices
+ * @return How many seconds the kernel took
+*/
+template <typename Dist, typename Hop>
+double time_floyd_kernel(void (*kernel)(Dist**, int, Hop**, Hop**), Dist** dist, Hop** inter, Hop** next, int n)
+{
+    make_random_graph(dist[0], inter[0], next[0], n, 385);
+
+    auto start = chrono::steady_clock::now();
+    kernel(dist, n, inter, next);
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * Benchmarks the Floyd kernels on random dense graphs and prints how long each took.
+ * Usage: ./shortestpaths --bench [n ...]. If no sizes are given, we run n = 500, 1000, 2000, 4000, 8000.
+ * The textbook kernel has branches in its innermost loop and no tiling, so we only time it up to n = 2000.
+ * After that it takes forever. The speedup columns are relative to the textbook kernel, except for the last one:
+ * that's the blocked kernel with 32-bit distances and 16-bit vertices (the widths main() picks when the graph allows it),
+ * compared to the same kernel with 64-bit cells.
+ * @return The exit code for main()
+*/
+int run_benchmark(int argc, const char *argv[])
+{
+    vector<int> sizes;
+    for (int i = 2; i < argc; i++)
+    {
+        istringstream iss(argv[i]);
+        int n;
+        if (!(iss >> n) || n < 1)
+        {
+            cerr << "Error: Invalid benchmark size '" << argv[i] << "'." << endl;
+            return 1;
+        }
+        sizes.push_back(n);
+    }
+    if (sizes.empty())
+    {
+        sizes = {500, 1000, 2000, 4000, 8000};
+    }
+
+    cout << "relax_row kernel: " << relax_row_name() << endl;
+    cout << setw(6) << "n" << setw(14) << "textbook (s)" << setw(14) << "row simd (s)" << setw(10) << "speedup"
+         << setw(14) << "blocked (s)" << setw(10) << "speedup" << setw(14) << "compact (s)" << setw(10) << "speedup" << endl;
+    cout << fixed << setprecision(3);
+
+    for (int n : sizes)
+    {
+        long** reference = allocate_matrix<long>(n);
+        long** reference_inter = allocate_matrix<long>(n);
+        long** reference_next = allocate_matrix<long>(n);
+        long** dist = allocate_matrix<long>(n);
+        long** inter = allocate_matrix<long>(n);
+        long** next = allocate_matrix<long>(n);
+        bool ok = true;
+        const size_t bytes = sizeof(long) * n * n;
+
+        double textbook_time = 0;
+        if (n <= 2000)
+        {
+            textbook_time = time_floyd_kernel(floyds_algorithm_textbook, reference, reference_inter, reference_next, n);
+        }
+
+        // The row kernel does the same relaxations in the same order, so all 3 matrices have to match exactly
+        double simd_time = time_floyd_kernel(floyds_algorithm<long, long>, dist, inter, next, n);
+        if (n <= 2000)
+        {
+            ok = memcmp(reference[0], dist[0], bytes) == 0 && memcmp(reference_inter[0], inter[0], bytes) == 0
+                 && memcmp(reference_next[0], next[0], bytes) == 0;
+        }
+        else
+        {
+            // Too slow to run the textbook kernel, so the row kernel is the reference now
+            swap(reference, dist);
+            swap(reference_inter, inter);
+            swap(reference_next, next);
+        }
+
+        // The blocked kernel can pick a different intermediate vertex when paths tie, so we only compare the lengths
+        double blocked_time = time_floyd_kernel(floyds_algorithm_blocked<long, long>, dist, inter, next, n);
+        ok = ok && memcmp(reference[0], dist[0], bytes) == 0;
+
+        // Same kernel, same graph, narrower cells. It does the exact same relaxations as the 64-bit blocked kernel.
+        double compact_time = 0;
+        if (n <= infinity<int16_t>())
+        {
+            int32_t** compact_dist = allocate_matrix<int32_t>(n);
+            int16_t** compact_inter = allocate_matrix<int16_t>(n);
+            int16_t** compact_next = allocate_matrix<int16_t>(n);
+
+            compact_time = time_floyd_kernel(floyds_algorithm_blocked<int32_t, int16_t>, compact_dist, compact_inter, compact_next, n);
+            for (size_t cell = 0; ok && cell < (size_t)n * n; cell++)
+            {
+                const bool both_inf = reference[0][cell] == INF && compact_dist[0][cell] == infinity<int32_t>();
+                ok = both_inf || reference[0][cell] == compact_dist[0][cell];
+            }
+
+            deallocate_matrix(compact_dist);
+            deallocate_matrix(compact_inter);
+            deallocate_matrix(compact_next);
+        }
+
+        deallocate_memory(reference, reference_inter, dist);
+        deallocate_memory(reference_next, inter, next);
+
+        if (!ok)
+        {
+            cerr << "Error: Floyd kernels disagree for n = " << n << "." << endl;
+            return 1;
+        }
+
+        cout << setw(6) << n;
+        if (n <= 2000)
+        {
+            cout << setw(14) << textbook_time << setw(14) << simd_time << setw(9) << textbook_time / simd_time << "x"
+                 << setw(14) << blocked_time << setw(9) << textbook_time / blocked_time << "x";
+        }
+        else
+        {
+            cout << setw(14) << "skipped" << setw(14) << simd_time << setw(10) << "-"
+                 << setw(14) << blocked_time << setw(10) << "-";
+        }
+
+        if (n <= infinity<int16_t>())
+        {
+            cout << setw(14) << compact_time << setw(9) << blocked_time / compact_time << "x" << endl;
+        }
+        else
+        {
+            cout << setw(14) << "skipped" << setw(10) << "-" << endl;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * Strong-scaling benchmark for floyds_algorithm_parallel(): same graph, more and more threads.
+ * Usage: ./shortestpaths --bench-threads [n ...]. If no sizes are given, we run n = 2000.
+ * Thread counts go 1, 2, 4, ... up to the number of hardware threads. Every run is checked against floyds_algorithm().
+ * @return The exit code for main()
+*/
+int run_thread_benchmark(int argc, const char *argv[])
+{
+    vector<int> sizes;
+    for (int i = 2; i < argc; i++)
+    {
+        istringstream iss(argv[i]);
+        int n;
+        if (!(iss >> n) || n < 1)
+        {
+            cerr << "Error: Invalid benchmark size '" << argv[i] << "'." << endl;
+            return 1;
+        }
+        sizes.push_back(n);
+    }
+    if (sizes.empty())
+    {
+        sizes = {2000};
+    }
+
+    const int max_threads = max(1u, thread::hardware_concurrency());
+    vector<int> thread_counts;
+    for (int t = 1; t < max_threads; t *= 2)
+    {
+        thread_counts.push_back(t);
+    }
+    thread_counts.push_back(max_threads);
+
+    cout << "relax_row kernel: " << relax_row_name() << endl;
+    cout << setw(6) << "n" << setw(9) << "threads" << setw(12) << "time (s)" << setw(10) << "speedup" << setw(12) << "efficiency" << endl;
+    cout << fixed << setprecision(3);
+
+    for (int n : sizes)
+    {
+        long** reference = allocate_matrix<long>(n);
+        long** reference_inter = allocate_matrix<long>(n);
+        long** reference_next = allocate_matrix<long>(n);
+        long** dist = allocate_matrix<long>(n);
+        long** inter = allocate_matrix<long>(n);
+        long** next = allocate_matrix<long>(n);
+        const size_t bytes = sizeof(long) * n * n;
+
+        double serial_time = time_floyd_kernel(floyds_algorithm<long, long>, reference, reference_inter, reference_next, n);
+        cout << setw(6) << n << setw(9) << "serial" << setw(12) << serial_time << setw(10) << "-" << setw(12) << "-" << endl;
+
+        for (int t : thread_counts)
+        {
+            make_random_graph(dist[0], inter[0], next[0], n, 385);
+            auto start = chrono::steady_clock::now();
+            floyds_algorithm_parallel<long, long>(dist, n, inter, next, t);
+            double time = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+            if (memcmp(reference[0], dist[0], bytes) != 0 || memcmp(reference_inter[0], inter[0], bytes) != 0
+                || memcmp(reference_next[0], next[0], bytes) != 0)
+            {
+                cerr << "Error: Parallel kernel with " << t << " threads disagrees with the serial kernel for n = " << n << "." << endl;
+                deallocate_memory(reference, reference_inter, dist);
+                deallocate_memory(reference_next, inter, next);
+                return 1;
+            }
+
+            cout << setw(6) << n << setw(9) << t << setw(12) << time << setw(9) << serial_time / time << "x"
+                 << setw(11) << 100 * serial_time / time / t << "%" << endl;
+        }
+
+        deallocate_memory(reference, reference_inter, dist);
+        deallocate_memory(reference_next, inter, next);
+    }
+
+    return 0;
+}
+
+/**
+ * Everything we read out of a graph file
+*/
+struct GraphFile {
+    int num_vertices = 0;
+
+    // Graphs with up to 26 vertices use the letters A-Z as vertex names.
+    // Anything bigger uses whatever names show up in the file, looked up through vertex_table.
+    bool use_letters = true;
+    VertexTable vertex_table{0, 0};
+
+    vector<Edge> edges;
+};
+
+/**
+ * Parses an int the same way istringstream >> int does: skip leading whitespace, optional sign, then digits.
+ * Anything after the digits is ignored, and it fails if there are no digits or the number doesn't fit in an int.
+ * The actual conversion is std::from_chars, which doesn't touch locales or allocate anything.
+ * @param text The text to parse
+ * @param value Gets the parsed number
+ * @return Whether it worked
+*/
+bool parse_int(string_view text, int &value)
+{
+    size_t start = 0;
+    while (start < text.size() && isspace((unsigned char)text[start]))
+    {
+        start++;
+    }
+
+    // from_chars doesn't take a leading +, but >> does
+    if (start + 1 < text.size() && text[start] == '+' && isdigit((unsigned char)text[start + 1]))
+    {
+        start++;
+    }
+
+    from_chars_result result = from_chars(text.data() + start, text.data() + text.size(), value);
+    return result.ec == errc();
+}
+
+/**
+ * Reads and validates a graph file. If anything is wrong, it prints the error and returns false.
+ * The file gets mmapped and we walk through it in place: lines and fields are string_views into the mapping and numbers
+ * go through parse_int(), so no line or field is ever copied into a string. The error messages and line numbers are
+ * the same as they've always been.
+ * @param filename The graph file
+ * @param graph Gets everything we read
+ * @return Whether the file was valid
+*/
+bool load_graph(const char *filename, GraphFile &graph)
+{
+    // Open the file. If it does not exist, print an error message.
+    int fd = open(filename, O_RDONLY);
+    if (fd == -1) {
+        cerr << "Error: Cannot open file '" << filename << "'." << endl;
+        return false;
+    }
+
+    struct stat file_info;
+    if (fstat(fd, &file_info) == -1 || !S_ISREG(file_info.st_mode)) {
+        close(fd);
+        cerr << "Error: An I/O error occurred reading '" << filename << "'.";
+        return false;
+    }
+
+    // mmap can't map 0 bytes. An empty file just has no lines.
+    const size_t file_size = file_info.st_size;
+    const char *data = "";
+    if (file_size > 0)
+    {
+        void *mapping = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED) {
+            close(fd);
+            cerr << "Error: An I/O error occurred reading '" << filename << "'.";
+            return false;
+        }
+        madvise(mapping, file_size, MADV_SEQUENTIAL);
+        data = (const char*)mapping;
+    }
+    close(fd);
+
+    // ⭐ Create a string that represents the valid_char range. This will be used to report error messages.
+    char valid_char_start = 'A';
+    char valid_char_end = valid_char_start;
+
+    // Every edge line is at least 6 bytes ("A B 1\n"), so this is enough room without going overboard
+    graph.edges.reserve(file_size / 6);
+
+    bool valid = true;
+    unsigned int line_number = 1;
+    for (size_t line_start = 0; line_start < file_size && valid; ++line_number)
+    {
+        // Find the end of the line. Like getline, the last line doesn't need a newline.
+        const char *newline = (const char*)memchr(data + line_start, '\n', file_size - line_start);
+        size_t line_end = newline == nullptr ? file_size : newline - data;
+        string_view line(data + line_start, line_end - line_start);
+        line_start = line_end + 1;
+
+        // ⭐ First, we do error checking
+
+        // If the number of vertices is not positive, throw an error
+        if (line_number == 1)
+        {
+            if (!parse_int(line, graph.num_vertices) || graph.num_vertices < 1 || graph.num_vertices > MAX_VERTICES)
+            {
+                cerr << "Error: Invalid number of vertices '" << line << "' on line 1." << endl;
+                valid = false;
+                break;
+            }
+
+            // ⭐ Pick how vertices are named, and create the valid chars (mainly, valid char end)
+            graph.use_letters = graph.num_vertices <= 26;
+            if (graph.use_letters)
+            {
+                valid_char_end = int_to_letter(graph.num_vertices);
+            }
+            else
+            {
+                // Every edge line is at least 6 bytes and names 2 vertices, so the file can't name more than a third
+                // as many vertices as it has bytes. A huge vertex count in a small file doesn't get a huge table.
+                graph.vertex_table = VertexTable(graph.num_vertices, file_size / 3);
+            }
+            continue;
+        }
+
+        // Check invalid edge data - they should have 3 components
+        // The trick is that these are space delimited, so we should expect exactly 2 spaces.
+        // We find them with memchr, which also splits the line into its 3 fields
+        const char *first_space = (const char*)memchr(line.data(), ' ', line.size());
+        const char *second_space = first_space == nullptr ? nullptr
+            : (const char*)memchr(first_space + 1, ' ', line.data() + line.size() - first_space - 1);
+        if (second_space == nullptr || memchr(second_space + 1, ' ', line.data() + line.size() - second_space - 1) != nullptr)
+        {
+            cerr << "Error: Invalid edge data '" << line << "' on line " << line_number << "." << endl;
+            valid = false;
+            break;
+        }
+
+        string_view line_data[3] = {
+            string_view(line.data(), first_space - line.data()),
+            string_view(first_space + 1, second_space - first_space - 1),
+            string_view(second_space + 1, line.data() + line.size() - second_space - 1)
+        };
+
+        // The starting index must be in range. Check for that.
+        // More specifically, the first two names (that represent nodes) must be in range
+        int endpoints[2];
+        for (int i = 0; i < 2 && valid; i++)
+        {
+            // if it's line_data[0], this is the starting vertex
+            // if it's the line_data[1], this is the ending vertex
+            const char *starting_or_ending = i == 0 ? "Starting" : "Ending";
+
+            // Big graphs: any name works, as long as we don't end up with more names than vertices
+            if (!graph.use_letters)
+            {
+                endpoints[i] = line_data[i].empty() ? -1 : graph.vertex_table.lookup_or_add(line_data[i]);
+                if (endpoints[i] == -1)
                 {
-                    weight_matrix[i] = new long[num_vertices];
-                    traceback_matrix[i] = new long[num_vertices];
-                    path_matrix[i] = new long[num_vertices];
-
-                    // Then, we need to initialize all weights to INF when starting out (assuming no edges)
-                    // This works for weight_matrix and path_matrix
-                    for (int j = 0; j < num_vertices; j++)
-                    {
-                        // A self loop has a length of 0
-                        if (i == j)
-                        {
-                            weight_matrix[i][j] = 0;
-                            path_matrix[i][j] = 0;
-                        }
-                        else
-                        {
-                            // We use long int 
-                            weight_matrix[i][j] = INF;
-                            path_matrix[i][j] = INF;
-                        }
-                        // A traceback matrix should be infinite
-                        traceback_matrix[i][j] = INF;
-                    }
+                    cerr << "Error: " << starting_or_ending << " vertex '" << line_data[i] << "' on line " << line_number << " is not among the " << graph.num_vertices << " declared vertices." << endl;
+                    valid = false;
                 }
+                continue;
+            }
+
+            // First, if there are multiple characters in the letters, that is invalid.
+            // There is no index that could be named "NYC"
+            // That != 1 size also checked that the string is not empty (0 length char)
+            // Also we should make sure the letter to int is not < 1 because if that's the case, we are dealing with invalid chars like '.'
+            if (line_data[i].length() != 1 || letter_to_int(line_data[i][0]) > graph.num_vertices || letter_to_int(line_data[i][0]) < 1)
+            {
+                cerr << "Error: " << starting_or_ending << " vertex '" << line_data[i] << "' on line " << line_number << " is not among valid values " << valid_char_start << "-" << valid_char_end << "." << endl;
+                valid = false;
+                continue;
+            }
+
+            // We subtract 1 from the vertex number integer since we now calculating indices
+            endpoints[i] = letter_to_int(line_data[i][0]) - 1;
+        }
+        if (!valid)
+        {
+            break;
+        }
+
+        // Finally, make sure the all edges are positive integers
+        // The edges are contained in line_data[2]
+        // If it's not even a integer to begin with, we have problems.
+        // Else, make sure the weight is positive
+        // Edge weight 0 will throw an error since 0 is neither positive nor negative
+        int edge_weight;
+        if (!parse_int(line_data[2], edge_weight) || edge_weight < 1)
+        {
+            cerr << "Error: Invalid edge weight '" << line_data[2] << "' on line " << line_number << ".";
+            valid = false;
+            break;
+        }
+
+        // 📰 Now finally, save the edge
+        graph.edges.push_back({endpoints[0], endpoints[1], edge_weight});
+    }
+
+    if (file_size > 0)
+    {
+        munmap((void*)data, file_size);
+    }
+    return valid;
+}
+
+/**
+ * Returns the name of every vertex: the letters for small graphs, or the names from the file for big ones
+ * @param graph The graph we read from the file
+*/
+vector<string> vertex_names_of(const GraphFile &graph)
+{
+    if (!graph.use_letters)
+    {
+        return graph.vertex_table.names();
+    }
+
+    vector<string> letters;
+    for (int i = 0; i < graph.num_vertices; i++)
+    {
+        letters.push_back(string(1, int_to_letter(i + 1)));
+    }
+    return letters;
+}
+
+/**
+ * Looks up a vertex by name, the same way the graph file names them. For big graphs, only names that showed up in the
+ * file count, so a typo in a query is an error instead of a vertex with no edges.
+ * @param graph The graph we read from the file
+ * @param name The name of the vertex
+ * @return The vertex number, or -1 if there is no such vertex
+*/
+int lookup_vertex(const GraphFile &graph, string_view name)
+{
+    if (graph.use_letters)
+    {
+        const bool valid = name.size() == 1 && letter_to_int(name[0]) >= 1 && letter_to_int(name[0]) <= graph.num_vertices;
+        return valid ? letter_to_int(name[0]) - 1 : -1;
+    }
+    return graph.vertex_table.lookup(name);
+}
+
+/**
+ * Runs whichever Floyd kernel is fastest for this graph size, out of the ones that break ties like floyds_algorithm().
+ * Big graphs get split across all the cores if there's more than one. Everything else uses the plain kernel.
+ * The cache-blocked kernel would be faster on one core, but it can pick a different intermediate vertex when two paths
+ * tie, so the printed paths would depend on how many cores the machine has. It's only in the benchmark.
+ * @param path_matrix The path matrix of the initial graph. It must come from allocate_matrix()
+ * @param num_vertices The number of vertices in the graph
+ * @param backtrack_array The intermediate vertex matrix. It must come from allocate_matrix()
+ * @param successor_matrix The successor matrix. It must come from make_successor_matrix()
+*/
+template <typename Dist, typename Hop>
+void solve_floyd(Dist** path_matrix, int num_vertices, Hop** backtrack_array, Hop** successor_matrix)
+{
+    const int num_threads = thread::hardware_concurrency();
+    if (num_vertices >= 2 * FLOYD_BLOCK_SIZE && num_threads > 1)
+    {
+        floyds_algorithm_parallel(path_matrix, num_vertices, backtrack_array, successor_matrix, num_threads);
+    }
+    else
+    {
+        floyds_algorithm(path_matrix, num_vertices, backtrack_array, successor_matrix);
+    }
+}
+
+/**
+ * Makes the starting matrix for Floyd's algorithm out of the edge list: 0 on the diagonal, the edge weight where there's
+ * an edge, and INF everywhere else. If an edge shows up twice, the last one wins.
+ * Every weight has to fit in a Dist (see pick_cell_widths()).
+ * @param edges The edges from the graph file
+ * @param num_vertices The number of vertices in the graph
+ * @return The new matrix. Free it with deallocate_matrix()
+*/
+template <typename Dist>
+Dist** make_weight_matrix(const vector<Edge> &edges, int num_vertices)
+{
+    // This method of declaring 2D arrays is taken from
+    // https://www.geeksforgeeks.org/how-to-declare-a-2d-array-dynamically-in-c-using-new-operator/
+    // Each matrix is one contiguous block (see allocate_matrix) so the blocked kernel can tile it.
+    Dist** matrix = allocate_matrix<Dist>(num_vertices);
+
+    // We need to initialize all weights to INF when starting out (assuming no edges)
+    // A self loop has a length of 0
+    for (int i = 0; i < num_vertices; i++)
+    {
+        for (int j = 0; j < num_vertices; j++)
+        {
+            matrix[i][j] = i == j ? 0 : infinity<Dist>();
+        }
+    }
+
+    for (const Edge &edge : edges)
+    {
+        matrix[edge.from][edge.to] = edge.weight;
+    }
+
+    return matrix;
+}
+
+/**
+ * Makes an intermediate vertex matrix with no intermediate vertices yet (all INF)
+ * @param num_vertices The number of vertices in the graph
+ * @return The new matrix. Free it with deallocate_matrix()
+*/
+template <typename Hop>
+Hop** make_traceback_matrix(int num_vertices)
+{
+    Hop** matrix = allocate_matrix<Hop>(num_vertices);
+    fill(matrix[0], matrix[0] + (size_t)num_vertices * num_vertices, infinity<Hop>());
+    return matrix;
+}
+
+/**
+ * Makes the starting successor ("next hop") matrix: before Floyd's algorithm runs, the only paths are single edges, so the
+ * next hop from i to j is j itself if there's an edge (or i == j), and there's no next hop (INF) otherwise.
+ * Floyd's algorithm then keeps it up to date every time it finds a shorter path.
+ * @param path_matrix The starting path matrix (from make_weight_matrix())
+ * @param num_vertices The number of vertices in the graph
+ * @return The new matrix. Free it with deallocate_matrix()
+*/
+template <typename Hop, typename Dist>
+Hop** make_successor_matrix(Dist** path_matrix, int num_vertices)
+{
+    Hop** matrix = allocate_matrix<Hop>(num_vertices);
+    for (int i = 0; i < num_vertices; i++)
+    {
+        for (int j = 0; j < num_vertices; j++)
+        {
+            matrix[i][j] = path_matrix[i][j] == infinity<Dist>() ? infinity<Hop>() : j;
+        }
+    }
+    return matrix;
+}
+
+/**
+ * Reads a stream of edge updates and queries from stdin and answers them off the solved Floyd matrices.
+ * Each line is either
+ *   "<from> <to> <weight>" to add the edge or make it shorter (see apply_edge_update()), or
+ *   "<from> <to>" to print the shortest path, in the same format as the traceback.
+ * Vertices are named the same way as in the graph file, and a name that isn't in it is an error (see lookup_vertex()).
+ * Any weight up to INT_MAX can show up later in the stream, so Dist has to be picked with that in mind (see pick_cell_widths()).
+ * @param graph The graph we read from the file
+ * @return The exit code for main()
+*/
+template <typename Dist, typename Hop>
+int run_update_stream(GraphFile &graph)
+{
+    const int num_vertices = graph.num_vertices;
+    Dist** weight_matrix = make_weight_matrix<Dist>(graph.edges, num_vertices);
+    Dist** path_matrix = make_weight_matrix<Dist>(graph.edges, num_vertices);
+    Hop** traceback_matrix = make_traceback_matrix<Hop>(num_vertices);
+    Hop** successor_matrix = make_successor_matrix<Hop>(path_matrix, num_vertices);
+    solve_floyd(path_matrix, num_vertices, traceback_matrix, successor_matrix);
+
+    const vector<string> vertex_names = vertex_names_of(graph);
+
+    string line;
+    string out;
+    int exit_code = 0;
+    for (unsigned int line_number = 1; exit_code == 0 && getline(cin, line); line_number++)
+    {
+        // Split the line on spaces. There should be 2 or 3 fields.
+        string_view fields[3];
+        int num_fields = 0;
+        size_t start = 0;
+        while (num_fields < 3 && start <= line.size())
+        {
+            size_t end = min(line.find(' ', start), line.size());
+            fields[num_fields++] = string_view(line).substr(start, end - start);
+            start = end + 1;
+        }
+        if (num_fields < 2 || start <= line.size())
+        {
+            cerr << "Error: Invalid update '" << line << "' on line " << line_number << " of the update stream." << endl;
+            exit_code = 1;
+            break;
+        }
 
-                // ⭐ Create the valid chars (mainly, valid char end)
-                valid_char_end = int_to_letter(num_vertices);
+        // Look up both vertices. They have to be in the graph file.
+        int endpoints[2];
+        for (int i = 0; i < 2; i++)
+        {
+            endpoints[i] = lookup_vertex(graph, fields[i]);
+            if (endpoints[i] == -1)
+            {
+                cerr << "Error: Unknown vertex '" << fields[i] << "' on line " << line_number << " of the update stream." << endl;
+                exit_code = 1;
+                break;
             }
-            else
+        }
+        if (exit_code != 0)
+        {
+            break;
+        }
+        const int u = endpoints[0];
+        const int v = endpoints[1];
+
+        // Query: print the path
+        if (num_fields == 2)
+        {
+            out.clear();
+            append_traceback_line(out, path_matrix, successor_matrix, vertex_names, u, v);
+            cout << out << flush;
+            continue;
+        }
+
+        // Update: the weight follows the same rules as in the graph file
+        int edge_weight;
+        if (!parse_int(fields[2], edge_weight) || edge_weight < 1)
+        {
+            cerr << "Error: Invalid edge weight '" << fields[2] << "' on line " << line_number << " of the update stream." << endl;
+            exit_code = 1;
+            break;
+        }
+
+        // A self loop never changes a shortest path, and a longer edge would need a full re-solve
+        if (u == v)
+        {
+            continue;
+        }
+        if (edge_weight > weight_matrix[u][v])
+        {
+            cerr << "Warning: Ignoring weight increase of edge '" << fields[0] << " " << fields[1] << "' on line " << line_number
+                 << " of the update stream." << endl;
+            continue;
+        }
+
+        weight_matrix[u][v] = edge_weight;
+        apply_edge_update<Dist, Hop>(path_matrix, traceback_matrix, successor_matrix, num_vertices, u, v, edge_weight);
+    }
+
+    deallocate_memory(weight_matrix, traceback_matrix, path_matrix);
+    deallocate_matrix(successor_matrix);
+    return exit_code;
+}
+
+/**
+ * Answers a list of shortest path queries from stdin without solving every pair. Each line is "<from> <to>", with the
+ * vertices named the same way as in the graph file (see lookup_vertex()), and each answer is printed like a line of the
+ * traceback.
+ * We read all of the queries first and group them by source. Then dijkstra() runs once per distinct source and stops as soon as
+ * all of that source's targets are done. For s distinct sources that's O(s * (m + n log n)) instead of Floyd's n^3.
+ * The answers still come out in the same order as the queries.
+ * @param graph The graph we read from the file
+ * @return The exit code for main()
+*/
+int run_pair_queries(GraphFile &graph)
+{
+    const int num_vertices = graph.num_vertices;
+
+    struct Query {
+        int source;
+        int target;
+    };
+    vector<Query> queries;
+
+    string line;
+    for (unsigned int line_number = 1; getline(cin, line); line_number++)
+    {
+        // There should be exactly 2 fields
+        const size_t space = line.find(' ');
+        if (space == string::npos || line.find(' ', space + 1) != string::npos)
+        {
+            cerr << "Error: Invalid query '" << line << "' on line " << line_number << " of the query stream." << endl;
+            return 1;
+        }
+        const string_view fields[2] = {string_view(line).substr(0, space), string_view(line).substr(space + 1)};
+
+        int endpoints[2];
+        for (int i = 0; i < 2; i++)
+        {
+            endpoints[i] = lookup_vertex(graph, fields[i]);
+            if (endpoints[i] == -1)
             {
-                // Check invalid edge data - they should have 3 components
-                // The trick is that these are space delimited, so we should expect 2 spaces
+                cerr << "Error: Unknown vertex '" << fields[i] << "' on line " << line_number << " of the query stream." << endl;
+                return 1;
+            }
+        }
+        queries.push_back({endpoints[0], endpoints[1]});
+    }
 
-                int num_spaces = 0;
-                for (size_t i = 0; i < line.length(); i++) 
-                {
-                    //cout << line[i] << endl;
-                    if (line[i] == ' ')
-                    {
-                        num_spaces += 1;
-                    }
-                }
-                if (num_spaces != 2)
-                {
-                    cerr << "Error: Invalid edge data '" << line << "' on line " << line_number << "." << endl;
-                    deallocate_memory(num_vertices, weight_matrix, traceback_matrix, path_matrix);
-                    return 1;
-                }
+    const vector<string> vertex_names = vertex_names_of(graph);
+    const CsrGraph csr = build_csr(num_vertices, move(graph.edges));
 
-                // Now that we know we have 3 items, chuck them into a line_data array
-                string line_data[3];
-                string current_str = "";
+    // Group the queries by source. stable_sort keeps them in order within each source.
+    vector<size_t> order(queries.size());
+    iota(order.begin(), order.end(), 0);
+    stable_sort(order.begin(), order.end(), [&queries](size_t a, size_t b) {
+        return queries[a].source < queries[b].source;
+    });
 
-                for (size_t i = 0, idx = 0; i <= line.length(); i++)      
-                {
-                    // If we run into a delimiter or we reached the end of the string and need to chuck the last item into line_data
-                    // Then, we chuck it in line_data and resets all tracker variables
-                    if (line[i] == ' ' || i == line.length())
-                    {
-                        line_data[idx] = current_str;
-                        current_str = "";
-                        idx++;
-                    }
-                    else
-                    {
-                        // Otherwise, add to current line
-                        current_str += line[i];
-                    }
-                }
+    vector<long> dist(num_vertices);
+    vector<int> parent(num_vertices);
+    vector<int> path;
+    vector<char> is_target(num_vertices, 0);
+    IndexedMinHeap heap(dist);
+    vector<string> answers(queries.size());
 
-                // The starting index must be in range. Check for that.
-                // More specifically, the first two letters (that represent nodes) must be in range
-                for (int i = 0; i < 2; i++)
-                {
-                    // if it's line_data[0], this is the starting vertex
-                    // if it's the line_data[1], this is the ending vertex
-                    string starting_or_ending;
-                    if (i == 0)
-                    {
-                        starting_or_ending = "Starting";
-                    }
-                    else
-                    {
-                        starting_or_ending = "Ending";
-                    }
-
-                    // First, if there are multiple characters in the letters, that is invalid.
-                    // There is no index that could be named "NYC"
-                    if (line_data[i].length() != 1)      
-                    {
-                        cerr << "Error: " << starting_or_ending << " vertex '" << line_data[i] << "' on line " << line_number << " is not among valid values " << valid_char_start << "-" << valid_char_end << "." << endl;
-                        deallocate_memory(num_vertices, weight_matrix, traceback_matrix, path_matrix);
-                        return 1;
-                    }
-                    
-                    // If the string item is not within range, it is invalid and throw an error
-                    // We already checked that the string only has 1 char and hence, we can just call the 0th item
-                    // That != 1 size also checked that the string is not empty (0 length char)
-                    // Also we should make sure the letter to int is not < 0 because if that's the case, we are dealing with invalid chars like '.'
-                    if (letter_to_int(line_data[i][0]) > num_vertices || letter_to_int(line_data[i][0]) < 0)
-                    {
-                        cerr << "Error: " << starting_or_ending << " vertex '" << line_data[i] << "' on line " << line_number << " is not among valid values " << valid_char_start << "-" << valid_char_end << "." << endl;
-                        deallocate_memory(num_vertices, weight_matrix, traceback_matrix, path_matrix);
-                        return 1;
-                    }
-                }
+    for (size_t begin = 0; begin < order.size(); )
+    {
+        // Mark every target of this source. The same target can show up more than once.
+        const int source = queries[order[begin]].source;
+        size_t end = begin;
+        int num_targets = 0;
+        for (; end < order.size() && queries[order[end]].source == source; end++)
+        {
+            const int target = queries[order[end]].target;
+            num_targets += !is_target[target];
+            is_target[target] = 1;
+        }
 
-                // Finally, make sure the all edges are positive integers
-                // The edges are contained in line_data[2] as a string
-                // We will do the conversion using istringstream
+        dijkstra(csr, source, dist, parent, heap, &is_target, num_targets);
 
-                int edge_weight;
-                iss.str(line_data[2]);
+        for (size_t q = begin; q < end; q++)
+        {
+            const int target = queries[order[q]].target;
+            append_dijkstra_line(answers[order[q]], dist, parent, vertex_names, source, target, path);
+            is_target[target] = 0;
+        }
+        begin = end;
+    }
 
-                // If it's not even a integer to begin with, we have problems.
-                if (!(iss >> edge_weight))
-                {
-                    cerr << "Error: Invalid edge weight '" << line_data[2] << "' on line " << line_number << ".";
-                    deallocate_memory(num_vertices, weight_matrix, traceback_matrix, path_matrix);
-                    return 1;
-                }
+    for (const string &answer : answers)
+    {
+        cout.write(answer.data(), answer.size());
+    }
+    cout.flush();
+    return 0;
+}
 
-                // Else, make sure the weight is positive
-                // Edge weight 0 will throw an error since 0 is neither positive nor negative
-                if (edge_weight < 1)
-                {
-                    cerr << "Error: Invalid edge weight '" << line_data[2] << "' on line " << line_number << ".";
-                    deallocate_memory(num_vertices, weight_matrix, traceback_matrix, path_matrix);
-                    return 1;
-                }
+// Snapshot files start with these 8 bytes, so we can tell them apart from anything else
+const char SNAPSHOT_MAGIC[8] = {'A', 'P', 'S', 'P', 'S', 'N', 'A', 'P'};
+
+// Bump this whenever the layout of a snapshot changes. Old snapshots then get rejected instead of misread.
+// Version 2 added the name index.
+const uint32_t SNAPSHOT_VERSION = 2;
+
+// Written as a native integer. A machine with the other byte order reads it back as 0x04030201 and rejects the file.
+const uint32_t SNAPSHOT_BYTE_ORDER = 0x01020304;
+
+/**
+ * The start of a snapshot file (see write_snapshot()). Every offset is from the start of the file and a multiple of 8,
+ * so the matrices can be used right out of an mmap without copying them.
+ * The names section is num_vertices + 1 uint64_t offsets, followed by the names themselves back to back. Name i is the
+ * bytes from offset i to offset i + 1, counting from the end of the offsets.
+ * The name index is num_vertices uint32_t vertex numbers, sorted by name, so a query can binary search for a name.
+*/
+struct SnapshotHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;
+    uint32_t num_vertices;
+    uint32_t dist_bytes;        // sizeof(Dist), 4 or 8
+    uint32_t hop_bytes;         // sizeof(Hop), 2 or 4
+    uint32_t reserved;
+    uint64_t names_offset;
+    uint64_t dist_offset;       // The flat num_vertices x num_vertices path length matrix
+    uint64_t successor_offset;  // The flat num_vertices x num_vertices successor matrix
+    uint64_t name_index_offset;
+};
+
+/**
+ * Row access to a flat num_vertices x num_vertices matrix, so matrix[i][j] works the same as it does on a T**
+*/
+template <typename T>
+struct FlatMatrix {
+    const T* cells;
+    size_t num_vertices;
+
+    const T* operator[](size_t row) const {
+        return cells + row * num_vertices;
+    }
+};
+
+/**
+ * The vertex names in a mapped snapshot. names[v] is a view straight into the mapping.
+ * Nothing here checks the offsets, so check a name with valid() before using it.
+*/
+struct SnapshotNames {
+    const uint64_t* offsets;    // num_vertices + 1 of them
+    const char* start;          // Where the names themselves start
+    uint64_t size;              // How many bytes of the file there are from start on
+
+    bool valid(int v) const {
+        return offsets[v] <= offsets[v + 1] && offsets[v + 1] <= size;
+    }
+
+    string_view operator[](int v) const {
+        return string_view(start + offsets[v], offsets[v + 1] - offsets[v]);
+    }
+};
+
+/**
+ * Rounds offset up to the next multiple of 8
+*/
+uint64_t align_to_8(uint64_t offset)
+{
+    return (offset + 7) / 8 * 8;
+}
+
+/**
+ * Saves the solved path length and successor matrices to a snapshot file, so --query can answer questions about the
+ * graph later without reading and solving it again. The cells are written exactly as they are in memory.
+ * @param filename Where to write the snapshot
+ * @param path_matrix The solved path matrix. It must come from allocate_matrix()
+ * @param successor_matrix The solved successor matrix. It must come from allocate_matrix()
+ * @param vertex_names The name of every vertex
+ * @return Whether the whole snapshot got written
+*/
+template <typename Dist, typename Hop>
+bool write_snapshot(const char *filename, Dist** path_matrix, Hop** successor_matrix, const vector<string> &vertex_names)
+{
+    const uint64_t num_vertices = vertex_names.size();
+    const uint64_t num_cells = num_vertices * num_vertices;
+
+    vector<uint64_t> name_offsets = {0};
+    for (const string &name : vertex_names)
+    {
+        name_offsets.push_back(name_offsets.back() + name.size());
+    }
+
+    SnapshotHeader header = {};
+    memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+    header.version = SNAPSHOT_VERSION;
+    header.byte_order = SNAPSHOT_BYTE_ORDER;
+    header.num_vertices = num_vertices;
+    header.dist_bytes = sizeof(Dist);
+    header.hop_bytes = sizeof(Hop);
+    header.names_offset = sizeof(SnapshotHeader);
+    header.dist_offset = align_to_8(header.names_offset + sizeof(uint64_t) * name_offsets.size() + name_offsets.back());
+    header.successor_offset = align_to_8(header.dist_offset + sizeof(Dist) * num_cells);
+    header.name_index_offset = align_to_8(header.successor_offset + sizeof(Hop) * num_cells);
+
+    // stable_sort so that if two vertices have the same name, the lower number comes first and wins the lookup
+    vector<uint32_t> name_index(num_vertices);
+    for (uint32_t v = 0; v < num_vertices; v++)
+    {
+        name_index[v] = v;
+    }
+    stable_sort(name_index.begin(), name_index.end(), [&](uint32_t a, uint32_t b) {
+        return vertex_names[a] < vertex_names[b];
+    });
+
+    ofstream output(filename, ios::binary | ios::trunc);
+
+    // Zeros to pad each section out to a multiple of 8
+    const char padding[8] = {};
+    auto pad_to = [&](uint64_t offset) {
+        output.write(padding, offset - (uint64_t)output.tellp());
+    };
+
+    output.write((const char*)&header, sizeof(header));
+    output.write((const char*)name_offsets.data(), sizeof(uint64_t) * name_offsets.size());
+    for (const string &name : vertex_names)
+    {
+        output.write(name.data(), name.size());
+    }
+    pad_to(header.dist_offset);
+    output.write((const char*)path_matrix[0], sizeof(Dist) * num_cells);
+    pad_to(header.successor_offset);
+    output.write((const char*)successor_matrix[0], sizeof(Hop) * num_cells);
+    pad_to(header.name_index_offset);
+    output.write((const char*)name_index.data(), sizeof(uint32_t) * num_vertices);
+    output.close();
+
+    if (!output)
+    {
+        cerr << "Error: Cannot write snapshot '" << filename << "'." << endl;
+        return false;
+    }
+    return true;
+}
 
-                // 📰 Now finally, update the weight_matrix and path_matrix
-                // Remember weight_matrix items are initialized to undefined!!!!!!
-                // We subtract 1 from the vertex number integer since we now calculating indices
-                weight_matrix[letter_to_int(line_data[0][0]) - 1][letter_to_int(line_data[1][0]) - 1] = edge_weight;
-                path_matrix[letter_to_int(line_data[0][0]) - 1][letter_to_int(line_data[1][0]) - 1] = edge_weight;
+/**
+ * Answers source -> target straight out of a mapped snapshot. The line looks exactly like the traceback does.
+ * Only the cells on the path and the names of the vertices on it get touched, so this takes time proportional to the
+ * length of the path.
+ * @param data The start of the mapped snapshot
+ * @param header The snapshot's header, already checked by run_snapshot_query()
+ * @param vertex_names The name of every vertex
+ * @param source The vertex the path starts at
+ * @param target The vertex the path ends at
+ * @param out Gets the line with the answer
+ * @return False if the successors don't lead from source to target or a name on the path is bad, which means the
+ *         snapshot is corrupt
+*/
+template <typename Dist, typename Hop>
+bool answer_snapshot_query(const char *data, const SnapshotHeader &header, const SnapshotNames &vertex_names, int source, int target, string &out)
+{
+    const int num_vertices = header.num_vertices;
+    const FlatMatrix<Dist> dist = {(const Dist*)(data + header.dist_offset), (size_t)num_vertices};
+    const FlatMatrix<Hop> next = {(const Hop*)(data + header.successor_offset), (size_t)num_vertices};
 
-                // Clear istringstream
-                iss.clear();
+    // Walk the path once before printing it. A bad successor would otherwise send us off the end of the matrix or in circles.
+    if (dist[source][target] != infinity<Dist>())
+    {
+        int v = source;
+        for (int hops = 0; v != target; hops++)
+        {
+            v = next[v][target];
+            if (v < 0 || v >= num_vertices || hops == num_vertices || !vertex_names.valid(v))
+            {
+                return false;
             }
+        }
+    }
+
+    append_traceback_line(out, dist, next, vertex_names, source, target);
+    return true;
+}
 
-            ++line_number;
+/**
+ * Looks up a vertex by name in a mapped snapshot, with a binary search over its name index
+ * @param name_index The snapshot's name index
+ * @param vertex_names The names in the snapshot
+ * @param num_vertices The number of vertices
+ * @param name The name to look for
+ * @param vertex Gets the vertex number, or -1 if no vertex has that name
+ * @return False if an entry we looked at is bad, which means the snapshot is corrupt
+*/
+bool find_snapshot_vertex(const uint32_t *name_index, const SnapshotNames &vertex_names, uint32_t num_vertices, string_view name, int &vertex)
+{
+    // Find the first entry whose name isn't less than name
+    uint32_t low = 0, high = num_vertices;
+    while (low < high)
+    {
+        const uint32_t mid = low + (high - low) / 2;
+        if (name_index[mid] >= num_vertices || !vertex_names.valid(name_index[mid]))
+        {
+            return false;
+        }
+        if (vertex_names[name_index[mid]] < name)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    // Every entry up to low - 1 got checked along the way, but low itself might not have
+    if (low < num_vertices && (name_index[low] >= num_vertices || !vertex_names.valid(name_index[low])))
+    {
+        return false;
+    }
+    vertex = low < num_vertices && vertex_names[name_index[low]] == name ? name_index[low] : -1;
+    return true;
+}
+
+/**
+ * Answers one query from a snapshot: ./shortestpaths --query <snapshot> <from> <to>
+ * The snapshot gets mapped instead of read, so only the pages the answer needs ever get loaded: the header, the
+ * O(log n) name index entries and names the two lookups hit, and the path.
+ * @return The exit code for main()
+*/
+int run_snapshot_query(int argc, const char *argv[])
+{
+    if (argc != 5)
+    {
+        cerr << "Usage: " << argv[0] << " --query <snapshot> <from> <to>" << endl;
+        return 1;
+    }
+    const char *filename = argv[2];
+
+    int fd = open(filename, O_RDONLY);
+    if (fd == -1) {
+        cerr << "Error: Cannot open file '" << filename << "'." << endl;
+        return 1;
+    }
+
+    struct stat file_info;
+    if (fstat(fd, &file_info) == -1 || !S_ISREG(file_info.st_mode)) {
+        close(fd);
+        cerr << "Error: An I/O error occurred reading '" << filename << "'." << endl;
+        return 1;
+    }
+
+    const uint64_t file_size = file_info.st_size;
+    void *mapping = file_size < sizeof(SnapshotHeader) ? MAP_FAILED : mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        cerr << "Error: '" << filename << "' is not a valid snapshot." << endl;
+        return 1;
+    }
+    madvise(mapping, file_size, MADV_RANDOM);
+    const char *data = (const char*)mapping;
+
+    // Check everything in the header before we trust any of it.
+    // Every offset gets checked against the file size before anything is added to it, so nothing can wrap around.
+    SnapshotHeader header;
+    memcpy(&header, data, sizeof(header));
+    const uint64_t n = header.num_vertices;
+    const bool valid = memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic)) == 0
+                 && header.version == SNAPSHOT_VERSION && header.byte_order == SNAPSHOT_BYTE_ORDER
+                 && n >= 1 && n <= (uint64_t)numeric_limits<int>::max()
+                 && (header.dist_bytes == 4 || header.dist_bytes == 8) && (header.hop_bytes == 2 || header.hop_bytes == 4)
+                 && header.names_offset % 8 == 0 && header.dist_offset % 8 == 0 && header.successor_offset % 8 == 0
+                 && header.name_index_offset % 8 == 0
+                 && header.names_offset <= file_size && n + 1 <= (file_size - header.names_offset) / sizeof(uint64_t)
+                 && header.dist_offset <= file_size && n * n <= (file_size - header.dist_offset) / header.dist_bytes
+                 && header.successor_offset <= file_size && n * n <= (file_size - header.successor_offset) / header.hop_bytes
+                 && header.name_index_offset <= file_size && n <= (file_size - header.name_index_offset) / sizeof(uint32_t);
+    if (!valid)
+    {
+        munmap(mapping, file_size);
+        cerr << "Error: '" << filename << "' is not a valid snapshot." << endl;
+        return 1;
+    }
+
+    // The names are just views into the mapping. Each one gets checked when a lookup or the path touches it.
+    const uint64_t names_start = header.names_offset + sizeof(uint64_t) * (n + 1);
+    const SnapshotNames vertex_names = {(const uint64_t*)(data + header.names_offset), data + names_start, file_size - names_start};
+    const uint32_t* name_index = (const uint32_t*)(data + header.name_index_offset);
+
+    // Look up both vertices by name
+    int endpoints[2];
+    for (int i = 0; i < 2; i++)
+    {
+        if (!find_snapshot_vertex(name_index, vertex_names, n, argv[3 + i], endpoints[i]))
+        {
+            munmap(mapping, file_size);
+            cerr << "Error: '" << filename << "' is not a valid snapshot." << endl;
+            return 1;
         }
+        if (endpoints[i] == -1)
+        {
+            munmap(mapping, file_size);
+            cerr << "Error: Unknown vertex '" << argv[3 + i] << "' in snapshot '" << filename << "'." << endl;
+            return 1;
+        }
+    }
+
+    string out;
+    bool answered;
+    if (header.dist_bytes == 4 && header.hop_bytes == 2)
+    {
+        answered = answer_snapshot_query<int32_t, int16_t>(data, header, vertex_names, endpoints[0], endpoints[1], out);
+    }
+    else if (header.dist_bytes == 4)
+    {
+        answered = answer_snapshot_query<int32_t, int32_t>(data, header, vertex_names, endpoints[0], endpoints[1], out);
+    }
+    else if (header.hop_bytes == 2)
+    {
+        answered = answer_snapshot_query<long, int16_t>(data, header, vertex_names, endpoints[0], endpoints[1], out);
+    }
+    else
+    {
+        answered = answer_snapshot_query<long, int32_t>(data, header, vertex_names, endpoints[0], endpoints[1], out);
+    }
+    munmap(mapping, file_size);
 
-        // Don't forget to close the file.
-        input_file.close();
-    } catch (const ifstream::failure &f) {
-        cerr << "Error: An I/O error occurred reading '" << argv[1] << "'.";
+    if (!answered)
+    {
+        cerr << "Error: '" << filename << "' is not a valid snapshot." << endl;
         return 1;
     }
+    cout << out << flush;
+    return 0;
+}
+
+/**
+ * Solves the graph with Floyd's algorithm and prints the results, with Dist distance cells and Hop vertex cells.
+ * Letter graphs get the 3 tables and the traceback. Named graphs just get the traceback.
+ * @param graph The graph we read from the file
+ * @param update_stream Whether to take updates and queries from stdin afterwards instead (see run_update_stream())
+ * @param snapshot_file If this isn't nullptr, we save a snapshot there instead of printing anything (see write_snapshot())
+ * @return The exit code for main()
+*/
+template <typename Dist, typename Hop>
+int run_floyd_engine(GraphFile &graph, bool update_stream, const char *snapshot_file)
+{
+    if (update_stream)
+    {
+        return run_update_stream<Dist, Hop>(graph);
+    }
+
+    const int num_vertices = graph.num_vertices;
+    const vector<Edge> &edges = graph.edges;
+    Dist** path_matrix = make_weight_matrix<Dist>(edges, num_vertices);
+    Hop** traceback_matrix = make_traceback_matrix<Hop>(num_vertices);
+    Hop** successor_matrix = make_successor_matrix<Hop>(path_matrix, num_vertices);
+
+    if (snapshot_file != nullptr)
+    {
+        solve_floyd(path_matrix, num_vertices, traceback_matrix, successor_matrix);
+        const bool written = write_snapshot(snapshot_file, path_matrix, successor_matrix, vertex_names_of(graph));
+
+        deallocate_matrix(path_matrix);
+        deallocate_matrix(traceback_matrix);
+        deallocate_matrix(successor_matrix);
+        return written ? 0 : 1;
+    }
+
+    // Big dense graphs have names that don't fit in the tables, so they just get the paths
+    if (!graph.use_letters)
+    {
+        solve_floyd(path_matrix, num_vertices, traceback_matrix, successor_matrix);
+        print_traceback(path_matrix, successor_matrix, graph.vertex_table.names());
+
+        deallocate_matrix(path_matrix);
+        deallocate_matrix(traceback_matrix);
+        deallocate_matrix(successor_matrix);
+        return 0;
+    }
 
     // If we get to the first step, print the original matrix
+    Dist** weight_matrix = make_weight_matrix<Dist>(edges, num_vertices);
     display_table(weight_matrix, "Distance matrix:", num_vertices);
-    //cout << endl;
 
     // Now, we run Floyd's algorithm and display the path matrix
-    floyds_algorithm(path_matrix, num_vertices, traceback_matrix);
+    solve_floyd(path_matrix, num_vertices, traceback_matrix, successor_matrix);
     display_table(path_matrix, "Path lengths:", num_vertices);
-    //cout << endl;
 
     // Now, we print the intermediate vertices
     display_table(traceback_matrix, "Intermediate vertices:", num_vertices, true);
-    //cout << endl;
 
     // Lastly, we printout the traceback
-    print_traceback(path_matrix, traceback_matrix, num_vertices);
+    print_traceback(path_matrix, successor_matrix, vertex_names_of(graph));
 
     // At the end, we deallocate memory so Valgrind doesn't yell at us
-    deallocate_memory(num_vertices, weight_matrix, traceback_matrix, path_matrix);
+    deallocate_memory(weight_matrix, traceback_matrix, path_matrix);
+    deallocate_matrix(successor_matrix);
 
     return 0;
 }
+
+/**
+ * Whether every shortest path in a graph fits in a Dist cell without reaching infinity<Dist>().
+ * A shortest path never repeats a vertex, so it has at most num_vertices - 1 edges, and (num_vertices - 1) * max_weight
+ * is the longest it can be. Floyd's algorithm adds two cells that are both below INF, so that can't overflow either.
+ * Every weight has to fit on its own too, even with 1 vertex: a self loop goes into its diagonal cell as is.
+ * @param num_vertices The number of vertices in the graph
+ * @param max_weight The heaviest edge weight
+*/
+template <typename Dist>
+bool distances_fit(int num_vertices, long max_weight)
+{
+    return max_weight <= (infinity<Dist>() - 1) / max(num_vertices - 1, 1);
+}
+
+/**
+ * Picks the narrowest cells the graph fits in and runs Floyd's algorithm with them (see run_floyd_engine()).
+ * Distances are 32-bit if every shortest path fits (see distances_fit()) and 64-bit otherwise.
+ * Vertex numbers are 16-bit if there are at most infinity<int16_t>() vertices, so INF can't be a real vertex, and 32-bit otherwise.
+ * Narrower cells mean more of each row fits in one SIMD register and in cache. For 16-bit vertices and 32-bit distances, the
+ * 3 matrices take up a third of the memory that 64-bit cells do.
+ * @param graph The graph we read from the file
+ * @param update_stream Whether we're about to take updates from stdin. Those can have any weight up to INT_MAX.
+ * @param snapshot_file Where to save a snapshot, or nullptr to print the results (see run_floyd_engine())
+ * @return The exit code for main()
+*/
+int pick_cell_widths(GraphFile &graph, bool update_stream, const char *snapshot_file)
+{
+    const int num_vertices = graph.num_vertices;
+
+    long max_weight = update_stream ? numeric_limits<int>::max() : 0;
+    for (const Edge &edge : graph.edges)
+    {
+        max_weight = max(max_weight, edge.weight);
+    }
+
+    const bool small_distances = distances_fit<int32_t>(num_vertices, max_weight);
+    const bool small_vertices = num_vertices <= infinity<int16_t>();
+
+    if (small_distances && small_vertices)
+    {
+        return run_floyd_engine<int32_t, int16_t>(graph, update_stream, snapshot_file);
+    }
+    if (small_distances)
+    {
+        return run_floyd_engine<int32_t, int32_t>(graph, update_stream, snapshot_file);
+    }
+    if (small_vertices)
+    {
+        return run_floyd_engine<long, int16_t>(graph, update_stream, snapshot_file);
+    }
+    return run_floyd_engine<long, int32_t>(graph, update_stream, snapshot_file);
+}
+
+int main(int argc, const char *argv[]) {
+    // ./shortestpaths --bench [n ...] times the Floyd kernels instead of reading a graph
+    if (argc >= 2 && strcmp(argv[1], "--bench") == 0)
+    {
+        return run_benchmark(argc, argv);
+    }
+
+    // ./shortestpaths --bench-threads [n ...] is the strong-scaling benchmark for the parallel kernel
+    if (argc >= 2 && strcmp(argv[1], "--bench-threads") == 0)
+    {
+        return run_thread_benchmark(argc, argv);
+    }
+    
+    // ./shortestpaths --query <snapshot> <from> <to> answers one path out of a snapshot without solving anything
+    if (argc >= 2 && strcmp(argv[1], "--query") == 0)
+    {
+        return run_snapshot_query(argc, argv);
+    }
+
+    // ./shortestpaths <filename> --updates solves the graph once and then takes edge updates and queries from stdin
+    const bool update_stream = argc == 3 && strcmp(argv[2], "--updates") == 0;
+
+    // ./shortestpaths <filename> --pairs only answers the queries on stdin, with Dijkstra's algorithm instead of Floyd's
+    const bool pair_queries = argc == 3 && strcmp(argv[2], "--pairs") == 0;
+
+    // ./shortestpaths <filename> --snapshot <snapshot> solves the graph and saves the results for --query
+    const char *snapshot_file = argc == 4 && strcmp(argv[2], "--snapshot") == 0 ? argv[3] : nullptr;
+
+    // Make sure the right number of command line arguments exist.
+    if (argc != 2 && !update_stream && !pair_queries && snapshot_file == nullptr) {
+        cerr << "Usage: " << argv[0] << " <filename> [--updates | --pairs | --snapshot <snapshot>]" << endl
+             << "       " << argv[0] << " --query <snapshot> <from> <to>" << endl
+             << "       " << argv[0] << " --bench [n ...]" << endl
+             << "       " << argv[0] << " --bench-threads [n ...]" << endl;
+        return 1;
+    }
+
+    // Read the graph into an edge list first. Only once we know how dense the graph is do we pick between
+    // Floyd's algorithm (n x n matrices) and Johnson's algorithm (CSR adjacency)
+    GraphFile graph;
+    if (!load_graph(argv[1], graph))
+    {
+        return 1;
+    }
+    const int num_vertices = graph.num_vertices;
+    const vector<Edge> &edges = graph.edges;
+
+    if (update_stream)
+    {
+        return pick_cell_widths(graph, true, nullptr);
+    }
+
+    if (pair_queries)
+    {
+        return run_pair_queries(graph);
+    }
+
+    // Snapshots hold the whole matrices, so they always come from Floyd's algorithm, even for sparse graphs
+    if (snapshot_file != nullptr)
+    {
+        return pick_cell_widths(graph, false, snapshot_file);
+    }
+
+    // Big sparse graphs: Johnson's algorithm over CSR adjacency. There are no matrices to print, just the paths.
+    if (!graph.use_letters && use_sparse_engine(num_vertices, edges.size()))
+    {
+        johnsons_algorithm(build_csr(num_vertices, edges), graph.vertex_table.names());
+        return 0;
+    }
+
+    // Everything else uses Floyd's algorithm
+    return pick_cell_widths(graph, false, nullptr);
+}
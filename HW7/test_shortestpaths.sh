@@ -135,7 +135,10 @@ run_test_with_input() {
 graphfile=$(mktemp)
 
 # Test 1
-run_test_with_args "" "Usage: ./shortestpaths <filename>"
+run_test_with_args "" "Usage: ./shortestpaths <filename> [--updates | --pairs | --snapshot <snapshot>]
+       ./shortestpaths --query <snapshot> <from> <to>
+       ./shortestpaths --bench [n ...]
+       ./shortestpaths --bench-threads [n ...]"
 
 # Test 2
 run_test_with_args "notfound.txt" "Error: Cannot open file 'notfound.txt'."
@@ -584,7 +587,468 @@ G -> E, distance: 29, path: G -> E
 G -> F, distance: 39, path: G -> E -> F
 G -> G, distance: 0, path: G"
 
-rm -f "$graphfile"
+# Test 19
+printf '3\nA B 2\nB C 3' > "$graphfile"
+run_test_with_args "$graphfile" "Distance matrix:
+  A B C
+A 0 2 -
+B - 0 3
+C - - 0
+
+Path lengths:
+  A B C
+A 0 2 5
+B - 0 3
+C - - 0
+
+Intermediate vertices:
+  A B C
+A - - B
+B - - -
+C - - -
+
+A -> A, distance: 0, path: A
+A -> B, distance: 2, path: A -> B
+A -> C, distance: 5, path: A -> B -> C
+B -> A, distance: infinity, path: none
+B -> B, distance: 0, path: B
+B -> C, distance: 3, path: B -> C
+C -> A, distance: infinity, path: none
+C -> B, distance: infinity, path: none
+C -> C, distance: 0, path: C"
+
+# Test 20
+printf '3\r\nA B 2\r\nB C +3\r\n' > "$graphfile"
+run_test_with_args "$graphfile" "Distance matrix:
+  A B C
+A 0 2 -
+B - 0 3
+C - - 0
+
+Path lengths:
+  A B C
+A 0 2 5
+B - 0 3
+C - - 0
+
+Intermediate vertices:
+  A B C
+A - - B
+B - - -
+C - - -
+
+A -> A, distance: 0, path: A
+A -> B, distance: 2, path: A -> B
+A -> C, distance: 5, path: A -> B -> C
+B -> A, distance: infinity, path: none
+B -> B, distance: 0, path: B
+B -> C, distance: 3, path: B -> C
+C -> A, distance: infinity, path: none
+C -> B, distance: infinity, path: none
+C -> C, distance: 0, path: C"
+
+# Test 21
+printf '3\nA B 2\n\nB C 3\n' > "$graphfile"
+run_test_with_args "$graphfile" "Error: Invalid edge data '' on line 3."
+
+# Test 22
+printf '3\nA B 2 \nB C 3\n' > "$graphfile"
+run_test_with_args "$graphfile" "Error: Invalid edge data 'A B 2 ' on line 2."
+
+# Test 23
+cat << ENDOFINPUT > "$graphfile"
+27
+Newark Hoboken 1
+Hoboken Jersey_City 1
+Jersey_City Bayonne 1
+Bayonne Staten_Island 1
+Staten_Island Manhattan 1
+Manhattan Brooklyn 1
+Brooklyn Queens 1
+Queens Bronx 1
+Bronx Yonkers 1
+Yonkers White_Plains 1
+White_Plains Stamford 1
+Stamford Norwalk 1
+Norwalk Bridgeport 1
+Bridgeport New_Haven 1
+New_Haven Hartford 1
+Hartford Springfield 1
+Springfield Worcester 1
+Worcester Boston 1
+Boston Providence 1
+Providence Newport 1
+Newport New_London 1
+New_London Mystic 1
+Mystic Westerly 1
+Westerly Kingston 1
+Kingston Warwick 1
+Warwick Cranston 1
+Cranston Pawtucket 1
+ENDOFINPUT
+run_test_with_args "$graphfile" "Error: Ending vertex 'Pawtucket' on line 28 is not among the 27 declared vertices."
+
+# Test 24
+cat << ENDOFINPUT > "$graphfile"
+2000000000
+A B 1
+ENDOFINPUT
+run_test_with_args "$graphfile" "Error: Invalid number of vertices '2000000000' on line 1."
+
+# Test 25
+cat << ENDOFINPUT > "$graphfile"
+4
+A C 2
+A D 10
+B A 7
+B C 5
+B D 1
+C B 3
+D A 2
+D B 6
+D C 6
+ENDOFINPUT
+run_test_with_args_and_input "$graphfile --updates" "A D
+A B 1
+A D
+D B
+B D 4
+C C 5
+C C" "A -> D, distance: 6, path: A -> C -> B -> D
+A -> D, distance: 2, path: A -> B -> D
+D -> B, distance: 3, path: D -> A -> B
+Warning: Ignoring weight increase of edge 'B D' on line 5 of the update stream.
+C -> C, distance: 0, path: C"
+
+# Test 26
+run_test_with_args_and_input "$graphfile --updates" "A B
+A Z 3
+A B" "A -> B, distance: 5, path: A -> C -> B
+Error: Unknown vertex 'Z' on line 2 of the update stream."
+
+# Test 27
+run_test_with_args_and_input "$graphfile --updates" "A B 0" "Error: Invalid edge weight '0' on line 1 of the update stream."
+
+# Test 28
+run_test_with_args_and_input "$graphfile --updates" "A B 1 2" "Error: Invalid update 'A B 1 2' on line 1 of the update stream."
+
+# Test 29
+cat << ENDOFINPUT > "$graphfile"
+3
+A B 5
+ENDOFINPUT
+run_test_with_args_and_input "$graphfile --updates" "B C 2147483647
+A C
+C A 2147483647
+C B" "A -> C, distance: 2147483652, path: A -> B -> C
+C -> B, distance: 2147483652, path: C -> A -> B"
+
+# Test 30
+cat << ENDOFINPUT > "$graphfile"
+3
+A B 536870911
+B C 536870911
+C A 1
+ENDOFINPUT
+run_test_with_args "$graphfile" "Distance matrix:
+          A         B         C
+A         0 536870911         -
+B         -         0 536870911
+C         1         -         0
+
+Path lengths:
+           A          B          C
+A          0  536870911 1073741822
+B  536870912          0  536870911
+C          1  536870912          0
+
+Intermediate vertices:
+  A B C
+A - - B
+B C - -
+C - A -
+
+A -> A, distance: 0, path: A
+A -> B, distance: 536870911, path: A -> B
+A -> C, distance: 1073741822, path: A -> B -> C
+B -> A, distance: 536870912, path: B -> C -> A
+B -> B, distance: 0, path: B
+B -> C, distance: 536870911, path: B -> C
+C -> A, distance: 1, path: C -> A
+C -> B, distance: 536870912, path: C -> A -> B
+C -> C, distance: 0, path: C"
+
+# Test 31
+cat << ENDOFINPUT > "$graphfile"
+3
+A B 536870912
+B C 536870912
+C A 1
+ENDOFINPUT
+run_test_with_args "$graphfile" "Distance matrix:
+          A         B         C
+A         0 536870912         -
+B         -         0 536870912
+C         1         -         0
+
+Path lengths:
+           A          B          C
+A          0  536870912 1073741824
+B  536870913          0  536870912
+C          1  536870913          0
+
+Intermediate vertices:
+  A B C
+A - - B
+B C - -
+C - A -
+
+A -> A, distance: 0, path: A
+A -> B, distance: 536870912, path: A -> B
+A -> C, distance: 1073741824, path: A -> B -> C
+B -> A, distance: 536870913, path: B -> C -> A
+B -> B, distance: 0, path: B
+B -> C, distance: 536870912, path: B -> C
+C -> A, distance: 1, path: C -> A
+C -> B, distance: 536870913, path: C -> A -> B
+C -> C, distance: 0, path: C"
+
+# Test 32
+cat << ENDOFINPUT > "$graphfile"
+4
+A B 2147483647
+B C 2147483647
+C D 2147483647
+ENDOFINPUT
+run_test_with_args "$graphfile" "Distance matrix:
+           A          B          C          D
+A          0 2147483647          -          -
+B          -          0 2147483647          -
+C          -          -          0 2147483647
+D          -          -          -          0
+
+Path lengths:
+           A          B          C          D
+A          0 2147483647 4294967294 6442450941
+B          -          0 2147483647 4294967294
+C          -          -          0 2147483647
+D          -          -          -          0
+
+Intermediate vertices:
+  A B C D
+A - - B C
+B - - - C
+C - - - -
+D - - - -
+
+A -> A, distance: 0, path: A
+A -> B, distance: 2147483647, path: A -> B
+A -> C, distance: 4294967294, path: A -> B -> C
+A -> D, distance: 6442450941, path: A -> B -> C -> D
+B -> A, distance: infinity, path: none
+B -> B, distance: 0, path: B
+B -> C, distance: 2147483647, path: B -> C
+B -> D, distance: 4294967294, path: B -> C -> D
+C -> A, distance: infinity, path: none
+C -> B, distance: infinity, path: none
+C -> C, distance: 0, path: C
+C -> D, distance: 2147483647, path: C -> D
+D -> A, distance: infinity, path: none
+D -> B, distance: infinity, path: none
+D -> C, distance: infinity, path: none
+D -> D, distance: 0, path: D"
+
+snapshotfile=$(mktemp)
+
+# Test 33
+cat << ENDOFINPUT > "$graphfile"
+4
+A C 2
+A D 10
+B A 7
+B C 5
+B D 1
+C B 3
+D A 2
+D B 6
+D C 6
+ENDOFINPUT
+run_test_with_args "$graphfile --snapshot $snapshotfile" ""
+
+# Test 34
+run_test_with_args "--query $snapshotfile A B" "A -> B, distance: 5, path: A -> C -> B"
+
+# Test 35
+run_test_with_args "--query $snapshotfile B A" "B -> A, distance: 3, path: B -> D -> A"
+
+# Test 36
+run_test_with_args "--query $snapshotfile D D" "D -> D, distance: 0, path: D"
+
+# Test 37
+run_test_with_args "--query $snapshotfile A" "Usage: ./shortestpaths --query <snapshot> <from> <to>"
+
+# Test 38
+run_test_with_args "--query $snapshotfile A Q" "Error: Unknown vertex 'Q' in snapshot '$snapshotfile'."
+
+# Test 39
+run_test_with_args "--query $graphfile A B" "Error: '$graphfile' is not a valid snapshot."
+
+# Test 40
+run_test_with_args "--query notfound.snap A B" "Error: Cannot open file 'notfound.snap'."
+
+# Test 41
+head -c 40 "$snapshotfile" > "$graphfile"
+run_test_with_args "--query $graphfile A B" "Error: '$graphfile' is not a valid snapshot."
+
+# Test 42
+cat << ENDOFINPUT > "$graphfile"
+27
+Newark Hoboken 1
+Hoboken Jersey_City 1
+Jersey_City Bayonne 1
+Bayonne Staten_Island 1
+Staten_Island Manhattan 1
+Manhattan Brooklyn 1
+Brooklyn Queens 1
+Queens Bronx 1
+Bronx Yonkers 1
+Yonkers White_Plains 1
+White_Plains Stamford 1
+Stamford Norwalk 1
+Norwalk Bridgeport 1
+Bridgeport New_Haven 1
+New_Haven Hartford 1
+Hartford Springfield 1
+Springfield Worcester 1
+Worcester Boston 1
+Boston Providence 1
+Providence Newport 1
+Newport New_London 1
+New_London Mystic 1
+Mystic Westerly 1
+Westerly Kingston 1
+Kingston Warwick 1
+Warwick Cranston 1
+Cranston Newark 5
+ENDOFINPUT
+run_test_with_args "$graphfile --snapshot $snapshotfile" ""
+
+# Test 43
+run_test_with_args "--query $snapshotfile Mystic Hoboken" "Mystic -> Hoboken, distance: 10, path: Mystic -> Westerly -> Kingston -> Warwick -> Cranston -> Newark -> Hoboken"
+
+# Test 44
+run_test_with_args "--query $snapshotfile Newark Pawtucket" "Error: Unknown vertex 'Pawtucket' in snapshot '$snapshotfile'."
+
+# Test 45
+cat << ENDOFINPUT > "$graphfile"
+1
+A A 2147483647
+ENDOFINPUT
+run_test_with_args "$graphfile" "Distance matrix:
+           A
+A 2147483647
+
+Path lengths:
+           A
+A 2147483647
+
+Intermediate vertices:
+  A
+A -
+
+A -> A, distance: 2147483647, path: A"
+
+# Test 46
+# 130 vertices is enough for the multithreaded kernel, and with weights of 1-3 lots of paths tie.
+# Every kernel main() can pick has to break those ties the same way, however many cores there are.
+awk 'BEGIN{n=130; print n; for(i=0;i<n;i++) printf "v%d v%d 1\n", i, (i+1)%n; for(i=0;i<400;i++){a=(i*37)%n; b=(i*61+7)%n; if(a!=b) printf "v%d v%d %d\n", a, b, 1+i%3}}' > "$graphfile"
+run_test_with_args "$graphfile --snapshot $snapshotfile" ""
+
+# Test 47
+run_test_with_args "--query $snapshotfile v0 v58" "v0 -> v58, distance: 12, path: v0 -> v1 -> v100 -> v101 -> v102 -> v103 -> v96 -> v97 -> v58"
+
+# Test 48
+run_test_with_args "--query $snapshotfile v0 v97" "v0 -> v97, distance: 10, path: v0 -> v1 -> v100 -> v101 -> v102 -> v103 -> v96 -> v97"
+
+# Test 49
+run_test_with_args "--query $snapshotfile v0 v122" "v0 -> v122, distance: 10, path: v0 -> v1 -> v2 -> v63 -> v16 -> v17 -> v18 -> v121 -> v122"
+
+# Test 50
+run_test_with_args "--query $snapshotfile v64 v63" "v64 -> v63, distance: 9, path: v64 -> v109 -> v110 -> v111 -> v60 -> v61 -> v62 -> v63"
+
+# Test 51
+cat << ENDOFINPUT > "$graphfile"
+4
+A C 2
+A D 10
+B A 7
+B C 5
+B D 1
+C B 3
+D A 2
+D B 6
+D C 6
+ENDOFINPUT
+run_test_with_args_and_input "$graphfile --pairs" "A D
+D B
+A B
+C C
+A D
+B A" "A -> D, distance: 6, path: A -> C -> B -> D
+D -> B, distance: 6, path: D -> B
+A -> B, distance: 5, path: A -> C -> B
+C -> C, distance: 0, path: C
+A -> D, distance: 6, path: A -> C -> B -> D
+B -> A, distance: 3, path: B -> D -> A"
+
+# Test 52
+run_test_with_args_and_input "$graphfile --pairs" "A B
+A Q" "Error: Unknown vertex 'Q' on line 2 of the query stream."
+
+# Test 53
+run_test_with_args_and_input "$graphfile --pairs" "A" "Error: Invalid query 'A' on line 1 of the query stream."
+
+# Test 54
+awk 'BEGIN{print 30; for(i=1;i<=27;i++) printf "v%d v%d 1\n", i, i+1; print "#30 v1 2"}' > "$graphfile"
+run_test_with_args_and_input "$graphfile --pairs" "v1 v5
+v5 v1
+v1 v3
+v1 v1
+#30 v4" "v1 -> v5, distance: 4, path: v1 -> v2 -> v3 -> v4 -> v5
+v5 -> v1, distance: infinity, path: none
+v1 -> v3, distance: 2, path: v1 -> v2 -> v3
+v1 -> v1, distance: 0, path: v1
+#30 -> v4, distance: 5, path: #30 -> v1 -> v2 -> v3 -> v4"
+
+# Test 55
+run_test_with_args_and_input "$graphfile --pairs" "v1 v5
+v1 zzz" "Error: Unknown vertex 'zzz' on line 2 of the query stream."
+
+# Test 56
+run_test_with_args_and_input "$graphfile --pairs" "v1 #29" "Error: Unknown vertex '#29' on line 1 of the query stream."
+
+# Test 57
+run_test_with_args_and_input "$graphfile --updates" "v5 v1
+v5 v1 3
+v5 v1
+v1 zzz" "v5 -> v1, distance: infinity, path: none
+v5 -> v1, distance: 3, path: v5 -> v1
+Error: Unknown vertex 'zzz' on line 4 of the update stream."
+
+# Test 58
+# A named graph this sparse goes through Johnson's algorithm. It has to print the same paths as Floyd's algorithm,
+# ties included, which we read back out of a snapshot (snapshots always come from Floyd's). Vertex 30 never shows up
+# and "#30" is already taken, so it is called "##30".
+awk 'BEGIN{print 30; for(i=1;i<12;i++) printf "v%d v%d 1\n", i, i+1; print "v1 v4 3"; print "v5 v8 3"; print "v9 v12 3"; print "#30 v1 2"; print "v12 #30 1"}' > "$graphfile"
+"$command" "$graphfile" --snapshot "$snapshotfile"
+floyd_paths=$(for from in v{1..12} "#30" "#"{14..29} "##30"; do
+    for to in v{1..12} "#30" "#"{14..29} "##30"; do
+        "$command" --query "$snapshotfile" "$from" "$to"
+    done
+done)
+run_test_with_args "$graphfile" "$floyd_paths"
+
+rm -f "$graphfile" "$snapshotfile"
 ############################################################
 echo
 echo "Total tests run: $num_tests"
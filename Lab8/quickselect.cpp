@@ -9,9 +9,20 @@
 #include <sstream>
 #include <algorithm>
 #include <vector>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <chrono>
+#include <iomanip>
+#include <array>
+#include <thread>
+#include <limits>
+#include <memory>
+#include "../Common/intreader.h"
 
 using namespace std;
 
+//The partition from the assignment. quick_select() uses block_partition() now, which doesn't branch on every value.
 size_t lomuto_partition(int array[], size_t left, size_t right) {
     // TODO
     // DO NOT change the function header in any way, otherwise you will lose points.
@@ -72,105 +83,1149 @@ size_t lomuto_partition(int array[], size_t left, size_t right) {
     return s;
 }
 
+// Ranges this short get insertion sorted instead of partitioned
+const size_t SMALL_RANGE = 16;
+
+// block_partition() classifies this many values from each end before it swaps any. It has to fit in an unsigned char.
+const size_t PARTITION_BLOCK = 128;
+
+// floyd_rivest_select() hands ranges this short to select_kth(). Sampling doesn't pay for itself below this.
+const size_t FLOYD_RIVEST_CUTOFF = 600;
+
+// floyd_rivest_select() gives up on sampling after this many passes that didn't shrink the range enough, and lets
+// select_kth() finish with its O(n) worst case.
+const int FLOYD_RIVEST_MAX_PASSES = 4;
+
+// parallel_select() does ranges this short on one thread. Starting threads costs more than partitioning this many ints.
+const size_t PARALLEL_SELECT_CUTOFF = 1 << 18;
+
+// How many values parallel_select() counts into each of its three kinds, one per thread
+using BucketCounts = std::array<size_t, 3>;
+
+// KllSketch keeps about KLL_ERROR_CONSTANT / epsilon values in its top level. The rank error comes out around
+// epsilon * n with that much room (the benchmark checks it).
+const double KLL_ERROR_CONSTANT = 2.0;
+
+// The error bound --approx uses when it isn't given one
+const double APPROX_DEFAULT_EPSILON = 0.01;
+
+// --approx feeds the sketch this many values at a time, so the input never has to fit in memory
+const size_t APPROX_READ_CHUNK = 1 << 16;
+
+/**
+ * Insertion sorts array[low...high) by is_less
+*/
+template <typename T, typename Compare>
+static void insertion_sort(T array[], size_t low, size_t high, Compare is_less) {
+    for (size_t i = low + 1; i < high; i++)
+    {
+        T value = move(array[i]);
+        size_t j = i;
+        while (j > low && is_less(value, array[j - 1]))
+        {
+            array[j] = move(array[j - 1]);
+            j--;
+        }
+        array[j] = move(value);
+    }
+}
+
+/**
+ * Partitions array[low...high) so everything goes_left() says yes to comes first. BlockQuicksort style:
+ * lomuto_partition() has an if for every value, and on random data that branch guesses wrong half the time.
+ * Here, we go through a block of PARTITION_BLOCK values from the left and write down where the ones that belong on the
+ * right are, without an if (the offset always gets written, and the count only goes up when it's one of them).
+ * Then we do the same from the right for the ones that belong on the left, and swap the two lists in pairs.
+ * Whichever block runs out of offsets first moves on to the next block.
+ * @param array[] The array
+ * @param low The first index to partition
+ * @param high One past the last index to partition
+ * @param goes_left Whether a value belongs on the left side
+ * @return Where the right side starts
+*/
+template <typename T, typename GoesLeft>
+static size_t block_partition(T array[], size_t low, size_t high, GoesLeft goes_left) {
+    unsigned char offsets_left[PARTITION_BLOCK];
+    unsigned char offsets_right[PARTITION_BLOCK];
+    size_t num_left = 0, num_right = 0;         //How many offsets each list has left
+    size_t start_left = 0, start_right = 0;     //Where those start in the list
+
+    //Everything before first goes left, everything from last on goes right
+    T *first = array + low;
+    T *last = array + high;
+
+    //The left block is first[0...PARTITION_BLOCK) and the right block is last[-PARTITION_BLOCK...0). They can't overlap.
+    while ((size_t)(last - first) >= 2 * PARTITION_BLOCK)
+    {
+        if (num_left == 0)
+        {
+            start_left = 0;
+            for (size_t i = 0; i < PARTITION_BLOCK; i++)
+            {
+                offsets_left[num_left] = i;
+                num_left += !goes_left(first[i]);
+            }
+        }
+        if (num_right == 0)
+        {
+            start_right = 0;
+            for (size_t i = 0; i < PARTITION_BLOCK; i++)
+            {
+                offsets_right[num_right] = i;
+                num_right += goes_left(*(last - 1 - i));
+            }
+        }
+
+        const size_t num_swaps = min(num_left, num_right);
+        for (size_t i = 0; i < num_swaps; i++)
+        {
+            swap(first[offsets_left[start_left + i]], *(last - 1 - offsets_right[start_right + i]));
+        }
+        num_left -= num_swaps;
+        num_right -= num_swaps;
+        start_left += num_swaps;
+        start_right += num_swaps;
+
+        if (num_left == 0)
+        {
+            first += PARTITION_BLOCK;
+        }
+        if (num_right == 0)
+        {
+            last -= PARTITION_BLOCK;
+        }
+    }
+
+    //Less than 2 blocks are left (one of them might be partly done, which doesn't hurt). Finish with a plain Hoare partition.
+    while (true)
+    {
+        while (first < last && goes_left(*first))
+        {
+            first++;
+        }
+        while (first < last && !goes_left(*(last - 1)))
+        {
+            last--;
+        }
+        if (last - first < 2)
+        {
+            break;
+        }
+        swap(*first, *(last - 1));
+        first++;
+        last--;
+    }
+    return first - array;
+}
+
+// Function prototype. median_of_medians() and select_kth() call each other.
+template <typename T, typename Compare = less<T>>
+static T select_kth(T array[], size_t low, size_t high, size_t target, size_t depth_limit, Compare is_less = Compare());
+
+/**
+ * Returns floor(lg n) for n >= 1
+*/
+static size_t floor_log2(size_t n) {
+    size_t log = 0;
+    while (n >>= 1)
+    {
+        log++;
+    }
+    return log;
+}
+
+/**
+ * Finds a pivot that's guaranteed to be decent: the median of the medians of groups of 5.
+ * At least 3/10 of the range is no bigger than it and at least 3/10 is no smaller, so partitioning around it throws
+ * away at least 3/10 of the range every time. That's what makes selection O(n) in the worst case.
+ * The group medians get moved to the front of the range and we select their median recursively.
+ * @param array[] The array
+ * @param low The first index of the range
+ * @param high One past the last index of the range. It has to hold at least 5 values
+ * @param is_less The comparator. is_less(a, b) is true when a goes before b
+ * @return The index of the pivot
+*/
+template <typename T, typename Compare>
+static size_t median_of_medians(T array[], size_t low, size_t high, Compare is_less) {
+    size_t num_groups = 0;
+    for (size_t group = low; group + 5 <= high; group += 5)
+    {
+        insertion_sort(array, group, group + 5, is_less);
+        swap(array[low + num_groups], array[group + 2]);
+        num_groups++;
+    }
+
+    const size_t middle = low + num_groups / 2;
+    select_kth(array, low, low + num_groups, middle, 2 * floor_log2(num_groups), is_less);
+    return middle;
+}
+
+/**
+ * Introselect: quickselect on array[low...high) that finds the value that goes at index target, and puts it there.
+ * It's one loop with the range in low and high, so nothing piles up on the stack no matter how bad the pivots get
+ * (the old recursive quick_select() could go n calls deep). Only median_of_medians() recurses, on a fifth of the range.
+ * Pivots are the median of 3 and partitioning is block_partition(). If that takes more than depth_limit partitions,
+ * the pivots were bad (or someone built an input to make them bad), so we switch to median_of_medians() pivots, which
+ * can't be bad. That caps the worst case at O(n).
+ * Lots of duplicates: a plain < partition puts every copy of the pivot on the right, and an array of all the same value
+ * would only lose one value per partition. So when we go right, we remember the pivot, since everything left is at
+ * least that. If a later pivot is the same value, we partition with <= instead, which puts every copy of it on the left
+ * at once. Either the target is one of them and we're done, or they all get thrown away together.
+ * @param array[] The array
+ * @param low The first index of the range
+ * @param high One past the last index of the range
+ * @param target The index (in the whole array) of the value we want. low <= target < high
+ * @param depth_limit How many partitions to do before switching to median_of_medians()
+ * @param is_less The comparator. is_less(a, b) is true when a goes before b
+ * @return The value that goes at index target if the array was sorted
+*/
+template <typename T, typename Compare>
+static T select_kth(T array[], size_t low, size_t high, size_t target, size_t depth_limit, Compare is_less) {
+    bool has_lower_bound = false;
+    T lower_bound = T();        //When has_lower_bound, everything in the range is at least this
+
+    while (high - low > SMALL_RANGE)
+    {
+        //Pick the pivot and move it to the front
+        size_t pivot_index;
+        if (depth_limit == 0)
+        {
+            pivot_index = median_of_medians(array, low, high, is_less);
+        }
+        else
+        {
+            depth_limit--;
+            const size_t mid = low + (high - low) / 2;
+            const T &a = array[low], &b = array[mid], &c = array[high - 1];
+            pivot_index = is_less(a, b) ? (is_less(b, c) ? mid : (is_less(a, c) ? high - 1 : low))
+                                        : (is_less(a, c) ? low : (is_less(b, c) ? high - 1 : mid));
+        }
+        const T pivot = array[pivot_index];
+        swap(array[low], array[pivot_index]);
+
+        if (has_lower_bound && !is_less(lower_bound, pivot))
+        {
+            //The pivot is the smallest value in the range, so <= pivot means == pivot
+            const size_t equal_end = block_partition(array, low + 1, high, [&](const T &value) { return !is_less(pivot, value); });
+            if (target < equal_end)
+            {
+                return pivot;
+            }
+            low = equal_end;
+            continue;
+        }
+
+        //Put the pivot between the two sides
+        const size_t s = block_partition(array, low + 1, high, [&](const T &value) { return is_less(value, pivot); }) - 1;
+        swap(array[low], array[s]);
+
+        if (s == target)
+        {
+            return pivot;
+        }
+        else if (s > target)        //The target is on the left
+        {
+            high = s;
+        }
+        else                        //The target is on the right
+        {
+            low = s + 1;
+            has_lower_bound = true;
+            lower_bound = pivot;
+        }
+    }
+
+    insertion_sort(array, low, high, is_less);
+    return array[target];
+}
+
+/**
+ * Floyd-Rivest selection on array[low...high): finds the value that goes at index target and puts it there.
+ * Quickselect with a median of 3 pivot partitions about 3.4n values before it finds the target. Instead, we take an
+ * evenly spaced sample of about n^(2/3) values and select two values u <= v out of it that should have the target
+ * between them, about sqrt(sample lg n) ranks apart in the sample. Then two partitions do most of the work:
+ * if the target is in the lower half, the whole range gets split on <= v first (n comparisons), and only the part
+ * that's <= v gets split on < u (about k more). The upper half does the same thing the other way around.
+ * That's about n + min(k, n - k) comparisons, and what's left between u and v is only about n^(2/3) values.
+ * Most of the time the target lands between u and v. If it doesn't, we go again on whichever side it landed in.
+ * After FLOYD_RIVEST_MAX_PASSES passes, or once the range is down to FLOYD_RIVEST_CUTOFF values, select_kth() finishes.
+ * @param array[] The array
+ * @param low The first index of the range
+ * @param high One past the last index of the range
+ * @param target The index (in the whole array) of the value we want. low <= target < high
+ * @param is_less The comparator. is_less(a, b) is true when a goes before b
+ * @return The value that goes at index target if the array was sorted
+*/
+template <typename T, typename Compare = less<T>>
+static T floyd_rivest_select(T array[], size_t low, size_t high, size_t target, Compare is_less = Compare()) {
+    for (int pass = 0; pass < FLOYD_RIVEST_MAX_PASSES && high - low > FLOYD_RIVEST_CUTOFF; pass++)
+    {
+        const size_t n = high - low;
+        const double log_n = log((double)n);
+        const size_t sample_size = (size_t)(0.5 * pow((double)n, 2.0 / 3.0));
+        const size_t gap = (size_t)(0.5 * sqrt(sample_size * log_n));
+
+        //Move an evenly spaced sample to the front of the range
+        const size_t stride = n / sample_size;
+        for (size_t i = 0; i < sample_size; i++)
+        {
+            swap(array[low + i], array[low + i * stride]);
+        }
+
+        //Where the target should be in the sample, and the ranks of u and v around it.
+        //If one of them would fall off the end of the sample, there's no pivot on that side.
+        const size_t sample_rank = (size_t)((double)(target - low) * sample_size / n);
+        const bool has_u = sample_rank > gap;
+        const bool has_v = sample_rank + gap < sample_size - 1;
+        const size_t u_rank = has_u ? sample_rank - gap : 0;
+        const size_t v_rank = has_v ? sample_rank + gap : sample_size - 1;
+        const size_t sample_depth = 2 * floor_log2(sample_size);
+        const T u = select_kth(array, low, low + sample_size, low + u_rank, sample_depth, is_less);
+        const T v = select_kth(array, low + u_rank, low + sample_size, low + v_rank, sample_depth, is_less);
+
+        //Split off the far side first, over the whole range, then the near side, over just what's left
+        size_t middle_low = low;
+        size_t middle_high = high;
+        if (target - low < n / 2)
+        {
+            if (has_v)
+            {
+                middle_high = block_partition(array, low, high, [&](const T &value) { return !is_less(v, value); });
+            }
+            if (has_u && target < middle_high)
+            {
+                middle_low = block_partition(array, low, middle_high, [&](const T &value) { return is_less(value, u); });
+            }
+        }
+        else
+        {
+            if (has_u)
+            {
+                middle_low = block_partition(array, low, high, [&](const T &value) { return is_less(value, u); });
+            }
+            if (has_v && target >= middle_low)
+            {
+                middle_high = block_partition(array, middle_low, high, [&](const T &value) { return !is_less(v, value); });
+            }
+        }
+
+        //Go on with whichever part has the target. It's almost always the middle.
+        if (target < middle_low)
+        {
+            high = middle_low;
+        }
+        else if (target < middle_high)
+        {
+            low = middle_low;
+            high = middle_high;
+            if (has_u && has_v && !is_less(u, v))     //Everything in the middle is the same value
+            {
+                return u;
+            }
+        }
+        else
+        {
+            low = middle_high;
+        }
+    }
+
+    return select_kth(array, low, high, target, 2 * floor_log2(high - low), is_less);
+}
+
 /**
  * Quick select finds the kth smallest element
  * A returned s is the kth smallest element in the array
  * because of how indexing works, s = k + 1
+ * It used to recurse on lomuto_partition() with no limit. Now it's select_kth(), which can't go quadratic.
 */
 int quick_select(int array[], size_t left, size_t right, size_t k) {
     // TODO
     // DO NOT change the function header in any way, otherwise you will lose points.
 
-    size_t s = lomuto_partition(array, left, right);
-    if (s == k - 1)
+    return select_kth(array, left, right + 1, k - 1, 2 * floor_log2(right - left + 1));
+}
+
+/**
+ * quick_select() for any element type (int64_t, double, string, ...) and any comparator.
+ * It's the same engine: floyd_rivest_select() and select_kth() are loops over explicit bounds, so the stack stays the
+ * same size however big the array is, and no extra memory gets allocated besides a copy of the pivots.
+ * Like quick_select(), it moves the values around so the kth smallest ends up at index k - 1, with nothing bigger
+ * before it and nothing smaller after it. The comparator has to be a strict weak ordering, so no NaNs with doubles.
+ * @param array[] The array
+ * @param length The length of the array
+ * @param k Which smallest value to find (1 is the smallest). It has to be between 1 and length
+ * @param is_less The comparator. is_less(a, b) is true when a goes before b
+ * @return The kth smallest value
+*/
+template <typename T, typename Compare = less<T>>
+T select_smallest(T array[], const size_t length, size_t k, Compare is_less = Compare()) {
+    return floyd_rivest_select(array, 0, length, k - 1, is_less);
+}
+
+//The int version that main() uses is just select_smallest() on ints
+int quick_select(int array[], const size_t length, size_t k) {
+    return select_smallest(array, length, k);
+}
+
+/**
+ * Runs work(t, chunk_low, chunk_high) for t = 0...num_threads - 1 on num_threads threads at once, where the chunks split
+ * [low, high) into num_threads pieces that are as close to the same size as they can be. Returns once they're all done.
+*/
+template <typename Work>
+static void for_each_chunk(size_t low, size_t high, int num_threads, Work work) {
+    vector<thread> threads;
+    for (int t = 0; t < num_threads; t++)
     {
-        return array[s];
+        const size_t chunk_low = low + (high - low) * t / num_threads;
+        const size_t chunk_high = low + (high - low) * (t + 1) / num_threads;
+        threads.emplace_back(work, t, chunk_low, chunk_high);
     }
-    else if (s > k - 1)         //Our index exceeded the kth smallest element we want. Look to the left now
+    for (thread &worker : threads)
     {
-        return quick_select(array, left, s - 1, k);
+        worker.join();
     }
-    else                        //Our index is less than the kth smallest element we want. Look to the right now
+}
+
+/**
+ * Floyd-Rivest selection with the partitioning spread over num_threads threads. Finds the value that goes at index
+ * target of array[0...length) and puts it there, with everything before it no bigger and everything after no smaller.
+ * Each pass picks u <= v out of a sample so the target should be between them, like floyd_rivest_select(). Then every
+ * thread takes its own chunk of the range and counts how many of its values are < u, between u and v, and > v.
+ * A prefix sum of those counts tells each thread exactly where its values of each kind go, so they can all copy their
+ * chunk into scratch at the same time without touching each other's spots. Then the range gets copied back (also split
+ * up between the threads), and the next pass only looks at the part with the target, which is almost always the
+ * little middle part. Once it's down to PARALLEL_SELECT_CUTOFF values, floyd_rivest_select() finishes on one thread.
+ * @param array[] The array
+ * @param length The length of the array
+ * @param k Which smallest value to find (1 is the smallest)
+ * @param num_threads How many threads to use. Anything below 1 counts as 1
+ * @return The kth smallest value
+*/
+int parallel_select(int array[], const size_t length, size_t k, int num_threads) {
+    num_threads = max(num_threads, 1);
+    const size_t target = k - 1;
+    size_t low = 0;
+    size_t high = length;
+    unique_ptr<int[]> scratch;      //Not a vector, which would zero all of it on one thread before we even start
+
+    for (int pass = 0; pass < FLOYD_RIVEST_MAX_PASSES && num_threads > 1 && high - low > PARALLEL_SELECT_CUTOFF; pass++)
     {
-        return quick_select(array, s + 1, right, k);
+        const size_t n = high - low;
+
+        //Pick u and v out of an evenly spaced sample. The sample gets copied out so the range doesn't move yet.
+        //When there's no pivot on one side, the smallest (or biggest) int stands in for it, and nothing goes past it.
+        const size_t sample_size = (size_t)(0.5 * pow((double)n, 2.0 / 3.0));
+        const size_t gap = (size_t)(0.5 * sqrt(sample_size * log((double)n)));
+        vector<int> sample(sample_size);
+        for (size_t i = 0; i < sample_size; i++)
+        {
+            sample[i] = array[low + i * (n / sample_size)];
+        }
+        const size_t sample_rank = (size_t)((double)(target - low) * sample_size / n);
+        const size_t sample_depth = 2 * floor_log2(sample_size);
+        const int u = sample_rank > gap
+            ? select_kth(&sample[0], 0, sample_size, sample_rank - gap, sample_depth) : numeric_limits<int>::min();
+        const int v = sample_rank + gap < sample_size - 1
+            ? select_kth(&sample[0], 0, sample_size, sample_rank + gap, sample_depth) : numeric_limits<int>::max();
+
+        //Count each kind of value in each chunk. 0 is < u, 1 is between u and v, and 2 is > v.
+        //Two plain sums (instead of counts[kind]++) have nothing to wait on, so the compiler can vectorize them.
+        vector<BucketCounts> counts(num_threads);
+        for_each_chunk(low, high, num_threads, [&](int t, size_t chunk_low, size_t chunk_high) {
+            size_t below = 0, above = 0;
+            for (size_t i = chunk_low; i < chunk_high; i++)
+            {
+                below += array[i] < u;
+                above += array[i] > v;
+            }
+            counts[t] = {below, chunk_high - chunk_low - below - above, above};
+        });
+
+        //Prefix sum: every kind starts after all the kinds before it, and every chunk after the chunks before it
+        vector<BucketCounts> starts(num_threads);
+        size_t next = low;
+        for (int kind = 0; kind < 3; kind++)
+        {
+            for (int t = 0; t < num_threads; t++)
+            {
+                starts[t][kind] = next;
+                next += counts[t][kind];
+            }
+        }
+        const size_t middle_low = starts[0][1];
+        const size_t middle_high = starts[0][2];
+
+        //Scatter into scratch, then copy back. Both are split the same way, so each thread only writes its own spots.
+        if (!scratch)
+        {
+            scratch.reset(new int[length]);
+        }
+        for_each_chunk(low, high, num_threads, [&](int t, size_t chunk_low, size_t chunk_high) {
+            BucketCounts position = starts[t];
+            for (size_t i = chunk_low; i < chunk_high; i++)
+            {
+                scratch[position[(array[i] >= u) + (array[i] > v)]++] = array[i];
+            }
+        });
+        for_each_chunk(low, high, num_threads, [&](int, size_t chunk_low, size_t chunk_high) {
+            copy(scratch.get() + chunk_low, scratch.get() + chunk_high, array + chunk_low);
+        });
+
+        if (target < middle_low)
+        {
+            high = middle_low;
+        }
+        else if (target < middle_high)
+        {
+            low = middle_low;
+            high = middle_high;
+            if (u == v)     //Everything in the middle is the same value
+            {
+                return u;
+            }
+        }
+        else
+        {
+            low = middle_high;
+        }
     }
+
+    return floyd_rivest_select(array, low, high, target);
 }
 
-int quick_select(int array[], const size_t length, size_t k) {
-    return quick_select(array, 0, length - 1, k);
+/**
+ * Finds the order statistics ks[first...last) in array[low...high). Every target is in the range.
+ * Selecting the middle target with floyd_rivest_select() also partitions the range around it, so the targets below it
+ * are all on its left and the ones above it are on its right. We recurse on the left and loop on the right, so a range
+ * only ever gets partitioned for the targets that are actually in it.
+ * @param array[] The array
+ * @param low The first index of the range
+ * @param high One past the last index of the range
+ * @param ks The ranks (1 is the smallest), in increasing order
+ * @param first The first rank to find in this range
+ * @param last One past the last rank to find in this range
+ * @param results Gets the value for each rank, at the same index as in ks
+ * @param is_less The comparator. is_less(a, b) is true when a goes before b
+*/
+template <typename T, typename Compare>
+static void multi_select_range(T array[], size_t low, size_t high, const vector<size_t> &ks,
+                               size_t first, size_t last, vector<T> &results, Compare is_less) {
+    while (first < last)
+    {
+        const size_t middle = first + (last - first) / 2;
+        const size_t target = ks[middle] - 1;
+        const T value = floyd_rivest_select(array, low, high, target, is_less);
+
+        //Repeats of the same rank get the same answer
+        size_t same_first = middle;
+        size_t same_last = middle + 1;
+        while (same_first > first && ks[same_first - 1] == ks[middle])
+        {
+            same_first--;
+        }
+        while (same_last < last && ks[same_last] == ks[middle])
+        {
+            same_last++;
+        }
+        fill(results.begin() + same_first, results.begin() + same_last, value);
+
+        multi_select_range(array, low, target, ks, first, same_first, results, is_less);
+        low = target + 1;
+        first = same_last;
+    }
+}
+
+/**
+ * Finds several order statistics of the same array at once, like p50, p90, p99 and p999.
+ * Running quick_select() once per rank goes over the whole array every time. Here, each rank only costs a selection
+ * inside the piece that the ranks before it left over, so q ranks take about O(n lg q) instead of O(nq).
+ * Like quick_select(), it moves the values around.
+ * @param array[] The array
+ * @param length The length of the array
+ * @param ks The ranks to find (1 is the smallest), in increasing order. Repeats are fine. None can be bigger than length
+ * @param is_less The comparator. is_less(a, b) is true when a goes before b
+ * @return The kth smallest value for every k in ks, in the same order
+*/
+template <typename T, typename Compare = less<T>>
+vector<T> multi_select(T array[], const size_t length, const vector<size_t> &ks, Compare is_less = Compare()) {
+    vector<T> results(ks.size());
+    multi_select_range(array, 0, length, ks, 0, ks.size(), results, is_less);
+    return results;
+}
+
+/**
+ * A KLL sketch (Karnin, Lang and Liberty): approximate quantiles of a stream of ints in O(1/epsilon lg n) memory.
+ * It never needs the whole input at once and doesn't move anything around, unlike quick_select().
+ * Values go into level 0. Each level h has room for about k (2/3)^(top - h) values, so the top level holds k and the ones
+ * under it get smaller and smaller. When everything put together is over the total room, the lowest full level gets
+ * compacted: it's sorted, and every other value (starting at a random one of the first two) moves up a level, where
+ * it stands for 2 values. So a value in level h stands for 2^h of the original ones.
+ * Each compaction shifts any rank by at most one value's weight, in a random direction, so the errors mostly cancel out.
+ * The rank of a quantile is within about epsilon * n of the one asked for, with high probability.
+ * Two sketches with the same epsilon can be merged, and the result is a sketch of both streams together.
+*/
+class KllSketch {
+public:
+    explicit KllSketch(double epsilon, unsigned seed = 385)
+        : k_{max<size_t>(8, (size_t)ceil(KLL_ERROR_CONSTANT / epsilon))}, count_{0}, size_{0}, max_size_{0},
+          rng_{seed} {
+        grow();
+    }
+
+    /**
+     * Adds a value from the stream
+    */
+    void add(int value) {
+        levels_[0].push_back(value);
+        count_++;
+        size_++;
+        if (size_ >= max_size_) {
+            compress();
+        }
+    }
+
+    /**
+     * Adds everything in other into this sketch, as if this sketch had seen other's stream too.
+     * other has to have been made with the same epsilon.
+    */
+    void merge(const KllSketch &other) {
+        while (levels_.size() < other.levels_.size()) {
+            grow();
+        }
+        for (size_t h = 0; h < other.levels_.size(); h++) {
+            levels_[h].insert(levels_[h].end(), other.levels_[h].begin(), other.levels_[h].end());
+        }
+        count_ += other.count_;
+        size_ += other.size_;
+        while (size_ >= max_size_) {
+            compress();
+        }
+    }
+
+    /**
+     * Returns about the kth smallest value of everything added so far (1 is the smallest). k can't be more than count().
+    */
+    int quantile(size_t k) const {
+        vector<pair<int, size_t>> weighted;
+        weighted.reserve(size_);
+        for (size_t h = 0; h < levels_.size(); h++) {
+            for (int value : levels_[h]) {
+                weighted.push_back({value, (size_t)1 << h});
+            }
+        }
+        sort(weighted.begin(), weighted.end());
+
+        size_t rank = 0;
+        for (const pair<int, size_t> &item : weighted) {
+            rank += item.second;
+            if (rank >= k) {
+                return item.first;
+            }
+        }
+        return weighted.back().first;
+    }
+
+    /**
+     * Returns how many values have been added
+    */
+    size_t count() const {
+        return count_;
+    }
+
+    /**
+     * Returns how many values the sketch is actually holding
+    */
+    size_t retained() const {
+        return size_;
+    }
+
+private:
+    /**
+     * Returns how many values level h has room for
+    */
+    size_t capacity(size_t h) const {
+        const size_t depth = levels_.size() - h - 1;
+        return max<size_t>(2, (size_t)ceil(k_ * pow(2.0 / 3.0, (double)depth)));
+    }
+
+    /**
+     * Adds a level on top. Every level below it gets less room, so the total room has to be added up again.
+    */
+    void grow() {
+        levels_.emplace_back();
+        max_size_ = 0;
+        for (size_t h = 0; h < levels_.size(); h++) {
+            max_size_ += capacity(h);
+        }
+    }
+
+    /**
+     * Compacts the lowest level that's full into the one above it
+    */
+    void compress() {
+        for (size_t h = 0; h < levels_.size(); h++) {
+            if (levels_[h].size() < capacity(h)) {
+                continue;
+            }
+            if (h + 1 == levels_.size()) {
+                grow();
+            }
+
+            //With an odd number of values, the biggest one stays behind so the rest pair up
+            vector<int> &level = levels_[h];
+            sort(level.begin(), level.end());
+            const size_t paired = level.size() & ~(size_t)1;
+            for (size_t i = rng_() & 1; i < paired; i += 2) {
+                levels_[h + 1].push_back(level[i]);
+            }
+            level.erase(level.begin(), level.begin() + paired);
+            size_ -= paired / 2;
+            return;
+        }
+    }
+
+    size_t k_;                      // How many values the top level has room for
+    size_t count_;                  // How many values have been added
+    size_t size_;                   // How many values all the levels hold together
+    size_t max_size_;               // How many values all the levels have room for together
+    vector<vector<int>> levels_;
+    mt19937 rng_;
+};
+
+/**
+ * Checks select_smallest() (and multi_select()) on arrays made by make_values() of every length from 1 to 1500, which
+ * goes past FLOYD_RIVEST_CUTOFF, against sorting a copy. A few ks get tried for each length, always including 1 and
+ * length. The answer only has to be equivalent to the sorted one (neither goes before the other), since a comparator can
+ * call different values ties. The array also has to end up split around k - 1 the way select_smallest() promises.
+ * Prints "<name>: ok" or the first length and k that went wrong.
+ * @param name What to call the check in the output
+ * @param make_values Makes a random array of the length it's given
+ * @param is_less The comparator
+ * @return Whether everything passed
+*/
+template <typename T, typename MakeValues, typename Compare>
+bool check_selection(const string &name, MakeValues make_values, Compare is_less) {
+    mt19937 rng(385);
+    auto same = [&](const T &a, const T &b) { return !is_less(a, b) && !is_less(b, a); };
+
+    for (size_t length = 1; length <= 1500; length++)
+    {
+        const vector<T> original = make_values(length);
+        vector<T> sorted = original;
+        sort(sorted.begin(), sorted.end(), is_less);
+
+        for (size_t k : {(size_t)1, length, 1 + rng() % length, 1 + rng() % length})
+        {
+            vector<T> values = original;
+            const T result = select_smallest(values.data(), length, k, is_less);
+            bool split = same(values[k - 1], result);
+            for (size_t i = 0; i < length && split; i++)
+            {
+                split = i < k - 1 ? !is_less(result, values[i]) : i == k - 1 || !is_less(values[i], result);
+            }
+            if (!same(result, sorted[k - 1]) || !split)
+            {
+                cout << name << ": wrong for k = " << k << " of " << length << " values" << endl;
+                return false;
+            }
+        }
+
+        //All of the same ks at once
+        vector<T> values = original;
+        vector<size_t> ks = {1, (length + 1) / 2, length};
+        const vector<T> results = multi_select(values.data(), length, ks, is_less);
+        for (size_t i = 0; i < ks.size(); i++)
+        {
+            if (!same(results[i], sorted[ks[i] - 1]))
+            {
+                cout << name << ": multi_select() wrong for k = " << ks[i] << " of " << length << " values" << endl;
+                return false;
+            }
+        }
+    }
+    cout << name << ": ok" << endl;
+    return true;
+}
+
+/**
+ * Checks parallel_select() against nth_element() on inputs big enough to get partitioned across threads.
+ * main() only uses more than one thread if the machine has more than one core, so we ask for them here instead.
+ * Each input gets k = 1, the median, n and a random k, on 2, 3, 4 and 8 threads, and the array has to come back split
+ * around the answer.
+ * @return Whether every selection was right
+*/
+bool check_parallel_select() {
+    mt19937 rng(385);
+    const size_t length = 2 * PARALLEL_SELECT_CUTOFF + 7;
+    vector<int> distinct(length);
+    vector<int> duplicates(length);
+    for (size_t i = 0; i < length; i++)
+    {
+        distinct[i] = (int)rng();
+        duplicates[i] = (int)(rng() % 50);
+    }
+
+    for (const vector<int> *original : {&distinct, &duplicates})
+    {
+        for (size_t k : {(size_t)1, (length + 1) / 2, length, 1 + rng() % length})
+        {
+            vector<int> expected = *original;
+            nth_element(expected.begin(), expected.begin() + (k - 1), expected.end());
+            for (int num_threads : {2, 3, 4, 8})
+            {
+                vector<int> values = *original;
+                const int result = parallel_select(values.data(), length, k, num_threads);
+                const bool split = values[k - 1] == result
+                                && all_of(values.begin(), values.begin() + (k - 1), [&](int value) { return value <= result; })
+                                && all_of(values.begin() + k, values.end(), [&](int value) { return value >= result; });
+                if (result != expected[k - 1] || !split)
+                {
+                    cout << "parallel_select: wrong for k = " << k << " of " << length << " values on " << num_threads
+                         << " threads" << endl;
+                    return false;
+                }
+            }
+        }
+    }
+    cout << "parallel_select: ok" << endl;
+    return true;
+}
+
+/**
+ * Checks the templated selection engine on element types and comparators that the int command line never uses.
+ * Run it with ./quickselect check
+ * select_smallest() gets doubles, long longs with greater<> (so the kth biggest) and strings ordered by length with a
+ * lambda, which has lots of ties. All of them have duplicates, which is where Floyd-Rivest's shortcuts live.
+ * Then parallel_select() gets checked with more than one thread (see check_parallel_select()).
+ * @return The exit code for main()
+*/
+int run_self_check() {
+    mt19937 rng(385);
+    auto make_doubles = [&](size_t length) {
+        vector<double> values(length);
+        for (double &value : values)
+        {
+            value = (int)(rng() % 200) / 8.0 - 10;
+        }
+        return values;
+    };
+    auto make_long_longs = [&](size_t length) {
+        vector<long long> values(length);
+        for (long long &value : values)
+        {
+            value = (long long)(rng() % 1000) * 100000000000LL - 50000000000000LL;
+        }
+        return values;
+    };
+    auto make_strings = [&](size_t length) {
+        vector<string> values(length);
+        for (string &value : values)
+        {
+            value = string(rng() % 12, (char)('a' + rng() % 26));
+        }
+        return values;
+    };
+    auto shortest_first = [](const string &a, const string &b) { return a.size() < b.size(); };
+
+    //Stop at the first one that fails
+    bool passed = check_selection<double>("select_smallest<double>", make_doubles, less<double>());
+    passed = passed && check_selection<long long>("select_smallest<long long, greater>", make_long_longs, greater<long long>());
+    passed = passed && check_selection<string>("select_smallest<string, by length>", make_strings, shortest_first);
+    passed = passed && check_parallel_select();
+    return passed ? 0 : 1;
+}
+
+/**
+ * Benchmarks introselect (select_kth()) against Floyd-Rivest (floyd_rivest_select()). Run it with ./quickselect bench
+ * Each size gets one random array, and we find k = 1, n/2 and n - 1 in a fresh copy of it with both.
+ * The speedups are relative to introselect, and the Floyd-Rivest answer is checked against it.
+ * Then p50, p90, p99 and p999 get found with one Floyd-Rivest selection each, and then all at once with multi_select().
+ * Last, the median gets found with parallel_select() on 1, 2, 4, ... threads up to the number of hardware threads,
+ * relative to 1 thread (which is just floyd_rivest_select()).
+ * Then, for the approximate quantiles (KllSketch), we report how far the rank of each percentile it gives is from the
+ * real one, as a fraction of n (that's what epsilon bounds), for one sketch of the whole array and for two sketches of
+ * its halves merged together.
+ * @return The exit code for main()
+*/
+int run_benchmark() {
+    const int max_threads = max(1u, thread::hardware_concurrency());
+    vector<int> thread_counts;
+    for (int t = 1; t < max_threads; t *= 2)
+    {
+        thread_counts.push_back(t);
+    }
+    thread_counts.push_back(max_threads);
+
+    cout << setw(11) << "n" << setw(11) << "k" << setw(15) << "engine" << setw(12) << "time (s)" << setw(10) << "speedup" << endl;
+    cout << fixed << setprecision(3);
+
+    mt19937 rng(385);
+    for (size_t n : {10000000, 100000000})
+    {
+        vector<int> original(n);
+        for (size_t i = 0; i < n; i++)
+        {
+            original[i] = rng();
+        }
+
+        for (size_t k : {(size_t)1, n / 2, n - 1})
+        {
+            int expected = 0;
+            double baseline_time = 0;
+            for (const string engine : {"introselect", "floyd-rivest"})
+            {
+                vector<int> values = original;
+                auto start = chrono::steady_clock::now();
+                const int result = engine == "introselect" ? select_kth(&values[0], 0, n, k - 1, 2 * floor_log2(n))
+                                                           : floyd_rivest_select(&values[0], 0, n, k - 1);
+                const double time = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+                if (engine == "introselect")
+                {
+                    expected = result;
+                    baseline_time = time;
+                }
+                else if (result != expected)
+                {
+                    cerr << "Error: " << engine << " found " << result << " instead of " << expected << "." << endl;
+                    return 1;
+                }
+                cout << setw(11) << n << setw(11) << k << setw(15) << engine << setw(12) << time
+                     << setw(9) << baseline_time / time << "x" << endl;
+            }
+        }
+
+        const vector<size_t> percentiles = {n / 2, n / 10 * 9, n / 100 * 99, n / 1000 * 999};
+        vector<int> expected;
+        double baseline_time = 0;
+        for (const string engine : {"repeated", "multi-select"})
+        {
+            vector<int> values = original;
+            auto start = chrono::steady_clock::now();
+            vector<int> results;
+            if (engine == "repeated")
+            {
+                for (size_t k : percentiles)
+                {
+                    results.push_back(floyd_rivest_select(&values[0], 0, n, k - 1));
+                }
+            }
+            else
+            {
+                results = multi_select(&values[0], n, percentiles);
+            }
+            const double time = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+            if (engine == "repeated")
+            {
+                expected = results;
+                baseline_time = time;
+            }
+            else if (results != expected)
+            {
+                cerr << "Error: " << engine << " found different percentiles." << endl;
+                return 1;
+            }
+            cout << setw(11) << n << setw(11) << "p50-p999" << setw(15) << engine << setw(12) << time
+                 << setw(9) << baseline_time / time << "x" << endl;
+        }
+
+        int median = 0;
+        double one_thread_time = 0;
+        for (int t : thread_counts)
+        {
+            vector<int> values = original;
+            auto start = chrono::steady_clock::now();
+            const int result = parallel_select(&values[0], n, n / 2, t);
+            const double time = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+            if (t == 1)
+            {
+                median = result;
+                one_thread_time = time;
+            }
+            else if (result != median)
+            {
+                cerr << "Error: parallel x" << t << " found " << result << " instead of " << median << "." << endl;
+                return 1;
+            }
+            cout << setw(11) << n << setw(11) << n / 2 << setw(15) << "parallel x" + to_string(t) << setw(12) << time
+                 << setw(9) << one_thread_time / time << "x" << endl;
+        }
+    }
+
+    cout << endl << setw(11) << "n" << setw(10) << "epsilon" << setw(15) << "sketch" << setw(11) << "retained"
+         << setw(12) << "time (s)" << setw(16) << "max rank error" << endl;
+    for (size_t n : {10000000})
+    {
+        vector<int> sorted(n);
+        for (size_t i = 0; i < n; i++)
+        {
+            sorted[i] = rng();
+        }
+        const vector<int> original = sorted;
+        sort(sorted.begin(), sorted.end());
+        const vector<size_t> percentiles = {n / 2, n / 10 * 9, n / 100 * 99, n / 1000 * 999};
+
+        for (double epsilon : {0.01, 0.001})
+        {
+            for (const string kind : {"one stream", "merged halves"})
+            {
+                auto start = chrono::steady_clock::now();
+                KllSketch sketch(epsilon);
+                KllSketch second_half(epsilon, 386);
+                for (size_t i = 0; i < n; i++)
+                {
+                    (kind == "one stream" || i < n / 2 ? sketch : second_half).add(original[i]);
+                }
+                if (kind == "merged halves")
+                {
+                    sketch.merge(second_half);
+                }
+                const double time = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+                //The value's real ranks go from lower_bound + 1 to upper_bound. How far is k from that?
+                double max_error = 0;
+                for (size_t k : percentiles)
+                {
+                    const int value = sketch.quantile(k);
+                    const size_t first_rank = lower_bound(sorted.begin(), sorted.end(), value) - sorted.begin() + 1;
+                    const size_t last_rank = upper_bound(sorted.begin(), sorted.end(), value) - sorted.begin();
+                    const size_t error = k < first_rank ? first_rank - k : (k > last_rank ? k - last_rank : 0);
+                    max_error = max(max_error, (double)error / n);
+                }
+                cout << setw(11) << n << setw(10) << setprecision(3) << epsilon << setw(15) << kind << setw(11)
+                     << sketch.retained() << setw(12) << time << setw(16) << setprecision(5) << max_error << endl;
+            }
+        }
+    }
+    return 0;
 }
 
 int main(int argc, char *argv[]) {
-    if (argc != 2) {
-        cerr << "Usage: " << argv[0] << " <k>" << endl;
+    //"--approx [epsilon]" after k finds the answer with a KllSketch instead, without holding on to the input
+    if (argc < 2 || argc > 4 || (argc >= 3 && strcmp(argv[2], "--approx") != 0)) {
+        cerr << "Usage: " << argv[0] << " <k>[,<k>...] [--approx [epsilon]]" << endl
+             << "       " << argv[0] << " check | bench" << endl;
         return 1;
     }
+    const bool approx = argc >= 3;
+    double epsilon = APPROX_DEFAULT_EPSILON;
+    if (argc == 4) {
+        istringstream epsilon_iss(argv[3]);
+        if ( !(epsilon_iss >> epsilon) || !(epsilon > 0 && epsilon < 1) ) {
+            cerr << "Error: Invalid error bound '" << argv[3] << "'." << endl;
+            return 1;
+        }
+    }
 
-    int k;
-    istringstream iss;
-    iss.str(argv[1]);
-    if ( !(iss >> k) || k <= 0 ) {
+    //"bench" times the selection engines instead of reading any input
+    if (argc == 2 && strcmp(argv[1], "bench") == 0) {
+        return run_benchmark();
+    }
+
+    //"check" tests the templated engine on other element types and comparators instead of reading any input
+    if (argc == 2 && strcmp(argv[1], "check") == 0) {
+        return run_self_check();
+    }
+
+    //k can also be a list like 5,50,90 to find several at once. Each one has to be a positive integer.
+    vector<size_t> ks;
+    istringstream list_iss(argv[1]);
+    string k_token;
+    while (getline(list_iss, k_token, ','))
+    {
+        int k;
+        istringstream iss;
+        iss.str(k_token);
+        if ( !(iss >> k) || k <= 0 ) {
+            cerr << "Error: Invalid value '" << argv[1] << "' for k." << endl;
+            return 1;
+        }
+        ks.push_back(k);
+    }
+    if (ks.empty() || argv[1][strlen(argv[1]) - 1] == ',') {
         cerr << "Error: Invalid value '" << argv[1] << "' for k." << endl;
         return 1;
     }
 
     cout << "Enter sequence of integers, each followed by a space: " << flush;
-    int value, index = 0;
+    //Read the first line of integers. IntLineReader reads stdin in big blocks instead of one getchar() at a time.
+    //With --approx, it's read a chunk at a time and each chunk goes into the sketch, so values never holds all of it.
     vector<int> values;
-    string str;
-    str.reserve(11);
-    char c;
-    iss.clear();
-    while (true) {
-        c = getchar();
-        const bool eoln = c == '\r' || c == '\n';
-        if (isspace(c) || eoln) {
-            if (str.length() > 0) {
-                iss.str(str);
-                if (iss >> value) {
-                    values.push_back(value);
-                } else {
-                    cerr << "Error: Non-integer value '" << str
-                         << "' received at index " << index << "." << endl;
-                    return 1;
-                }
-                iss.clear();
-                ++index;
-            }
-            if (eoln) {
-                break;
+    string bad_token;
+    size_t bad_index;
+    IntLineReader reader;
+    KllSketch sketch(epsilon);
+    do {
+        values.clear();
+        if (!reader.read_line(values, bad_token, bad_index, approx ? APPROX_READ_CHUNK : numeric_limits<size_t>::max())) {
+            cerr << "Error: Non-integer value '" << bad_token
+                 << "' received at index " << bad_index << "." << endl;
+            return 1;
+        }
+        if (approx) {
+            for (int value : values) {
+                sketch.add(value);
             }
-            str.clear();
-        } else {
-            str += c;
         }
-    }
+    } while (!reader.line_finished());
 
-    int num_values = values.size();
+    size_t num_values = approx ? sketch.count() : values.size();
     if (num_values == 0) {
         cerr << "Error: Sequence of integers not received." << endl;
         return 1;
     }
 
     // TODO - error checking k against the size of the input
-    if (k > num_values)
+    for (size_t k : ks)
     {
-        if (num_values == 1)
+        if (k > num_values)
         {
-            cerr << "Error: Cannot find smallest element " << k << " with only " << num_values << " value." << endl;
+            if (num_values == 1)
+            {
+                cerr << "Error: Cannot find smallest element " << k << " with only " << num_values << " value." << endl;
+            }
+            else
+            {
+                cerr << "Error: Cannot find smallest element " << k << " with only " << num_values << " values." << endl;
+            }
+
+            return 1;
         }
-        else
+    }
+    
+    // TODO - call the quick_select function and display the result
+
+    if (approx)
+    {
+        for (size_t k : ks)
         {
-            cerr << "Error: Cannot find smallest element " << k << " with only " << num_values << " values." << endl;
+            cout << "Smallest element " << k << " (approximate): " << sketch.quantile(k) << endl;
         }
+        return 0;
+    }
 
-        return 1;
+    if (ks.size() == 1)
+    {
+        //Big enough inputs get partitioned on every core
+        const int num_threads = thread::hardware_concurrency();
+        int smallest_el = (size_t)num_values > PARALLEL_SELECT_CUTOFF && num_threads > 1
+                        ? parallel_select(&values[0], num_values, ks[0], num_threads)
+                        : quick_select(&values[0], num_values, ks[0]);
+        cout << "Smallest element " << ks[0] << ": " << smallest_el << endl;
+        return 0;
     }
-    
-    // TODO - call the quick_select function and display the result
 
-    int smallest_el = quick_select(&values[0], num_values, k);
-    cout << "Smallest element " << k << ": " << smallest_el << endl;
+    //multi_select() wants the ranks in order. We print them in the order they were asked for.
+    vector<size_t> sorted_ks = ks;
+    sort(sorted_ks.begin(), sorted_ks.end());
+    const vector<int> smallest_els = multi_select(&values[0], num_values, sorted_ks);
+    for (size_t k : ks)
+    {
+        cout << "Smallest element " << k << ": "
+             << smallest_els[lower_bound(sorted_ks.begin(), sorted_ks.end(), k) - sorted_ks.begin()] << endl;
+    }
     
     return 0;
 }
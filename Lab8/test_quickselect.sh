@@ -132,7 +132,8 @@ run_test_with_input() {
 }
 
 ############################################################
-run_test_with_args_and_input "lots of args" "" "Usage: ./quickselect <k>"
+run_test_with_args_and_input "lots of args" "" "Usage: ./quickselect <k>[,<k>...] [--approx [epsilon]]
+       ./quickselect check | bench"
 run_test_with_args_and_input "w" "" "Error: Invalid value 'w' for k."
 run_test_with_args_and_input "0" "" "Error: Invalid value '0' for k."
 run_test_with_args_and_input "-8" "" "Error: Invalid value '-8' for k."
@@ -155,6 +156,62 @@ run_test_with_args_and_input "10" "5 5 5 5 5 5 5 5 5 5 5 5" "Enter sequence of i
 run_test_with_args_and_input "12" "-1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1 -1" "Enter sequence of integers, each followed by a space: Smallest element 12: -1"
 run_test_with_args_and_input "10000" "$(echo {1..100000})" "Enter sequence of integers, each followed by a space: Smallest element 10000: 10000"
 run_test_with_args_and_input "8765" "$(echo {100000..1})" "Enter sequence of integers, each followed by a space: Smallest element 8765: 8765"
+# Floyd-Rivest (over 600 values): one value that's off on its own, with the sample full of duplicates
+run_test_with_args_and_input "1" "5 1 $(printf '5 %.0s' {1..998})" "Enter sequence of integers, each followed by a space: Smallest element 1: 1"
+run_test_with_args_and_input "1000" "5 9 $(printf '5 %.0s' {1..998})" "Enter sequence of integers, each followed by a space: Smallest element 1000: 9"
+# The templated engine on element types and comparators the command line never uses
+run_test_with_args_and_input "check" "" "select_smallest<double>: ok
+select_smallest<long long, greater>: ok
+select_smallest<string, by length>: ok
+parallel_select: ok"
+# Duplicate-heavy, organ pipe, sawtooth and scrambled inputs, for the block partition and the introselect fallback
+run_test_with_args_and_input "3" "3 3 1 2 2" "Enter sequence of integers, each followed by a space: Smallest element 3: 2"
+run_test_with_args_and_input "500" "$(awk 'BEGIN{for(i=0;i<1000;i++) printf "%d ", i%3}')" "Enter sequence of integers, each followed by a space: Smallest element 500: 1"
+run_test_with_args_and_input "77777" "$(printf '5 %.0s' {1..100000})" "Enter sequence of integers, each followed by a space: Smallest element 77777: 5"
+run_test_with_args_and_input "50001" "$(echo {1..50000} {50000..1})" "Enter sequence of integers, each followed by a space: Smallest element 50001: 25001"
+run_test_with_args_and_input "12345" "$(awk 'BEGIN{for(i=0;i<100000;i++) printf "%d ", i%1000}')" "Enter sequence of integers, each followed by a space: Smallest element 12345: 123"
+run_test_with_args_and_input "99999" "$(awk 'BEGIN{for(i=0;i<100000;i++) printf "%d ", (i*7919)%100003 - 50000}')" "Enter sequence of integers, each followed by a space: Smallest element 99999: 50001"
+# Several order statistics at once. They come out in the order they were asked for.
+run_test_with_args_and_input "5,1,3" "9 -2 7 7 4" "Enter sequence of integers, each followed by a space: Smallest element 5: 9
+Smallest element 1: -2
+Smallest element 3: 7"
+run_test_with_args_and_input "2,2" "9 -2 7 7 4" "Enter sequence of integers, each followed by a space: Smallest element 2: 4
+Smallest element 2: 4"
+run_test_with_args_and_input "1,100000,50000" "$(echo {100000..1})" "Enter sequence of integers, each followed by a space: Smallest element 1: 1
+Smallest element 100000: 100000
+Smallest element 50000: 50000"
+run_test_with_args_and_input "3,6" "9 -2 7 7 4" "Enter sequence of integers, each followed by a space: Error: Cannot find smallest element 6 with only 5 values."
+run_test_with_args_and_input "1,5," "" "Error: Invalid value '1,5,' for k."
+run_test_with_args_and_input ",1" "" "Error: Invalid value ',1' for k."
+run_test_with_args_and_input "1,,2" "" "Error: Invalid value '1,,2' for k."
+run_test_with_args_and_input "1,x" "" "Error: Invalid value '1,x' for k."
+run_test_with_args_and_input "1,0" "" "Error: Invalid value '1,0' for k."
+# Over PARALLEL_SELECT_CUTOFF values, which get partitioned on every core
+run_test_with_args_and_input "150000" "$(awk 'BEGIN{for(i=0;i<300000;i++) printf "%d ", (i*7919)%300007 - 150000}')" "Enter sequence of integers, each followed by a space: Smallest element 150000: -1"
+run_test_with_args_and_input "1" "$(awk 'BEGIN{for(i=0;i<300000;i++) printf "%d ", (i*7919)%300007 - 150000}')" "Enter sequence of integers, each followed by a space: Smallest element 1: -150000"
+run_test_with_args_and_input "300000" "$(awk 'BEGIN{for(i=0;i<300000;i++) printf "%d ", (i*7919)%300007 - 150000}')" "Enter sequence of integers, each followed by a space: Smallest element 300000: 150006"
+run_test_with_args_and_input "200000" "$(awk 'BEGIN{for(i=0;i<300000;i++) printf "%d ", i%7}')" "Enter sequence of integers, each followed by a space: Smallest element 200000: 4"
+# Approximate quantiles. Small inputs fit in the sketch without compacting, so those answers are exact.
+run_test_with_args_and_input "3 --approx" "9 -2 7 7 4" "Enter sequence of integers, each followed by a space: Smallest element 3 (approximate): 7"
+run_test_with_args_and_input "1,5 --approx" "9 -2 7 7 4" "Enter sequence of integers, each followed by a space: Smallest element 1 (approximate): -2
+Smallest element 5 (approximate): 9"
+run_test_with_args_and_input "2 --approx 0.5" "9 -2 7 7 4" "Enter sequence of integers, each followed by a space: Smallest element 2 (approximate): 4"
+run_test_with_args_and_input "60 --approx" "$(echo {100..1})" "Enter sequence of integers, each followed by a space: Smallest element 60 (approximate): 60"
+run_test_with_args_and_input "70000 --approx" "$(printf '5 %.0s' {1..100000})" "Enter sequence of integers, each followed by a space: Smallest element 70000 (approximate): 5"
+# The sketch is seeded, so these always come out the same. Both are within epsilon * n of the real answer, 50000.
+run_test_with_args_and_input "50000 --approx" "$(echo {100000..1})" "Enter sequence of integers, each followed by a space: Smallest element 50000 (approximate): 49957"
+run_test_with_args_and_input "50000 --approx 0.001" "$(echo {100000..1})" "Enter sequence of integers, each followed by a space: Smallest element 50000 (approximate): 50024"
+run_test_with_args_and_input "6 --approx" "9 -2 7 7 4" "Enter sequence of integers, each followed by a space: Error: Cannot find smallest element 6 with only 5 values."
+run_test_with_args_and_input "1 --approx" "1 x" "Enter sequence of integers, each followed by a space: Error: Non-integer value 'x' received at index 1."
+run_test_with_args_and_input "1 --approx" "" "Enter sequence of integers, each followed by a space: Error: Sequence of integers not received."
+run_test_with_args_and_input "3 --approx 0" "" "Error: Invalid error bound '0'."
+run_test_with_args_and_input "3 --approx 1" "" "Error: Invalid error bound '1'."
+run_test_with_args_and_input "3 --approx -0.1" "" "Error: Invalid error bound '-0.1'."
+run_test_with_args_and_input "3 --approx x" "" "Error: Invalid error bound 'x'."
+run_test_with_args_and_input "3 --exact" "" "Usage: ./quickselect <k>[,<k>...] [--approx [epsilon]]
+       ./quickselect check | bench"
+run_test_with_args_and_input "3 --approx 0.1 9" "" "Usage: ./quickselect <k>[,<k>...] [--approx [epsilon]]
+       ./quickselect check | bench"
 ############################################################
 echo
 echo "Total tests run: $num_tests"
@@ -0,0 +1,164 @@
+/*******************************************************************************
+ * Name        : rbtbench.cpp
+ * Author      : agent
+ * Version     : 1.0
+ * Date        : 10/19/2026
+ * Description : Benchmarks the red-black tree with each node allocator in nodeallocator.h, and building it with
+ *               bulk_load() against inserting one key at a time.
+ *               It lives in its own folder so the makefile one level up doesn't build it into testrbt.
+ ******************************************************************************/
+#include "../rbtree.h"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// The finds add up what they find and store it here, so the compiler can't skip them
+volatile long long checksum;
+
+/**
+ * Times inserting every key into an empty tree, finding every key (in a different order than they went in), and then
+ * deleting the tree
+ * @param name What to call the allocator in the output
+ * @param keys The keys to insert. They all have to be different
+ * @param lookups The keys to find
+ * @param times Gets how long inserting, finding and deleting took, in seconds
+ * @param baseline The times to compare against (the speedups are baseline / times), or nullptr if this is the baseline
+ * @return False if a key couldn't be found
+*/
+template <typename Allocator>
+bool run_benchmark(const string &name, const vector<int> &keys, const vector<int> &lookups,
+                   double times[3], const double *baseline) {
+    auto start = chrono::steady_clock::now();
+
+    RedBlackTree<int, int, Allocator> *rbt = new RedBlackTree<int, int, Allocator>();
+    for (int key : keys)
+    {
+        rbt->insert(key, key);
+    }
+    times[0] = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    start = chrono::steady_clock::now();
+    long long sum = 0;
+    for (int key : lookups)
+    {
+        typename RedBlackTree<int, int, Allocator>::iterator it = rbt->find(key);
+        if (it == rbt->end())
+        {
+            cerr << "Error: " << name << " lost key " << key << "." << endl;
+            delete rbt;
+            return false;
+        }
+        sum += it->value();
+    }
+    times[1] = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    start = chrono::steady_clock::now();
+    delete rbt;
+    times[2] = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    checksum = sum;
+
+    cout << setw(11) << keys.size() << setw(13) << name;
+    for (int i = 0; i < 3; i++)
+    {
+        cout << setw(10) << times[i] << setw(11) << (baseline == nullptr ? 1 : baseline[i] / times[i]) << "x";
+    }
+    cout << endl;
+    return true;
+}
+
+/**
+ * Times building a tree out of the key-value pairs with insert_elements() (one at a time) and then with bulk_load(),
+ * and checks that both trees have the same keys in the same order
+ * @param order What to call the order the pairs are in, in the output
+ * @param elements The key-value pairs. The keys all have to be different
+ * @return False if the trees don't match
+*/
+bool run_bulk_benchmark(const string &order, vector< pair<int, int> > &elements) {
+    // Each tree gets deleted before the next one is built, so they both start with the same memory free
+    vector<int> incremental_keys;
+    auto start = chrono::steady_clock::now();
+    RedBlackTree<int, int> *incremental = new RedBlackTree<int, int>();
+    incremental->insert_elements(elements);
+    const double incremental_time = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    for (RedBlackTree<int, int>::iterator it = incremental->begin(); it != incremental->end(); ++it)
+    {
+        incremental_keys.push_back(it->key());
+    }
+    delete incremental;
+
+    start = chrono::steady_clock::now();
+    RedBlackTree<int, int> *bulk = new RedBlackTree<int, int>();
+    bulk->bulk_load(elements);
+    const double bulk_time = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    size_t i = 0;
+    RedBlackTree<int, int>::iterator it = bulk->begin();
+    for (; it != bulk->end() && i < incremental_keys.size() && it->key() == incremental_keys[i]; ++it, ++i) { }
+    const bool same = it == bulk->end() && i == incremental_keys.size();
+    delete bulk;
+    if (!same)
+    {
+        cerr << "Error: bulk_load() built a different tree than insert_elements() for " << order << " keys." << endl;
+        return false;
+    }
+
+    cout << setw(11) << elements.size() << setw(10) << order << setw(17) << incremental_time << setw(12) << bulk_time
+         << setw(10) << incremental_time / bulk_time << "x" << endl;
+    return true;
+}
+
+int main() {
+    cout << setw(11) << "n" << setw(13) << "allocator" << setw(22) << "insert (s)" << setw(22) << "find (s)"
+         << setw(22) << "delete (s)" << endl;
+    cout << fixed << setprecision(3);
+
+    mt19937 rng(385);
+    for (size_t n : {100000, 1000000, 10000000})
+    {
+        // n different keys in a random order: shuffle 0, 1, ..., n - 1 and spread them out over all the ints
+        vector<int> keys(n);
+        for (size_t i = 0; i < n; i++)
+        {
+            keys[i] = (int)(i * 2654435761u);
+        }
+        shuffle(keys.begin(), keys.end(), rng);
+        vector<int> lookups = keys;
+        shuffle(lookups.begin(), lookups.end(), rng);
+
+        double baseline[3], times[3];
+        if (!run_benchmark<NewDeleteAllocator<int, int> >("new/delete", keys, lookups, baseline, nullptr)
+            || !run_benchmark<NodeArena<int, int> >("arena", keys, lookups, times, baseline))
+        {
+            return 1;
+        }
+    }
+
+    cout << endl << setw(11) << "n" << setw(10) << "order" << setw(17) << "incremental (s)" << setw(12) << "bulk (s)"
+         << setw(11) << "speedup" << endl;
+    for (size_t n : {100000, 1000000, 10000000})
+    {
+        vector< pair<int, int> > elements(n);
+        for (size_t i = 0; i < n; i++)
+        {
+            elements[i] = make_pair((int)i, (int)i);
+        }
+        shuffle(elements.begin(), elements.end(), rng);
+        if (!run_bulk_benchmark("random", elements))
+        {
+            return 1;
+        }
+        sort(elements.begin(), elements.end());
+        if (!run_bulk_benchmark("sorted", elements))
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,129 @@
+/*******************************************************************************
+ * Name        : nodeallocator.h
+ * Author      : agent
+ * Version     : 1.0
+ * Date        : 10/19/2026
+ * Description : Allocator policies for red-black tree nodes.
+ ******************************************************************************/
+#ifndef NODEALLOCATOR_H_
+#define NODEALLOCATOR_H_
+
+#include "node.h"
+#include <cstddef>
+#include <new>
+#include <vector>
+
+/**
+ * The allocator RedBlackTree used to have: one new per node and one delete per node.
+ * Every allocator policy has the same four members:
+ *   create(key, value)   makes a node
+ *   destroy(node)        gets rid of one node
+ *   release()            gets rid of the memory for every node at once, without running any destructors
+ *   releases_in_bulk     whether release() actually does that. If it's false, the tree has to destroy() every node
+ */
+template <typename K, typename V>
+class NewDeleteAllocator {
+public:
+    static constexpr bool releases_in_bulk = false;
+
+    Node<K, V>* create(const K &key, const V &value) {
+        return new Node<K, V>(key, value);
+    }
+
+    void destroy(Node<K, V> *node) {
+        delete node;
+    }
+
+    void release() { }
+};
+
+/**
+ * Hands out nodes from big chunks instead of asking malloc for each one. That's a lot less time in malloc, and nodes
+ * that get made one after the other end up next to each other in memory, so walking the tree misses the cache less.
+ * Chunks start at FIRST_CHUNK nodes and double up to MAX_CHUNK nodes, so a small tree doesn't grab a lot of memory and
+ * a big one doesn't need a lot of chunks.
+ * destroy() runs the node's destructor and puts its slot on a free list, and create() uses those first.
+ * release() frees every chunk in O(chunks). The tree runs the node destructors first if they actually do anything.
+ */
+template <typename K, typename V>
+class NodeArena {
+public:
+    static constexpr bool releases_in_bulk = true;
+
+    NodeArena() : next_{nullptr}, end_{nullptr}, free_list_{nullptr}, chunk_nodes_{FIRST_CHUNK} { }
+
+    ~NodeArena() {
+        release();
+    }
+
+    // Every node points into our chunks, so copying (or moving) the arena out from under them can't work
+    NodeArena(const NodeArena &) = delete;
+    NodeArena& operator=(const NodeArena &) = delete;
+
+    Node<K, V>* create(const K &key, const V &value) {
+        void *slot;
+        if (free_list_ != nullptr) {
+            slot = free_list_;
+            free_list_ = free_list_->next;
+        } else {
+            if (next_ == end_) {
+                add_chunk();
+            }
+            slot = next_++;
+        }
+        return new (slot) Node<K, V>(key, value);
+    }
+
+    void destroy(Node<K, V> *node) {
+        node->~Node<K, V>();
+        FreeSlot *slot = reinterpret_cast<FreeSlot*>(node);
+        slot->next = free_list_;
+        free_list_ = slot;
+    }
+
+    void release() {
+        for (Slot *chunk : chunks_) {
+            ::operator delete(chunk);
+        }
+        chunks_.clear();
+        next_ = end_ = nullptr;
+        free_list_ = nullptr;
+        chunk_nodes_ = FIRST_CHUNK;
+    }
+
+private:
+    static constexpr size_t FIRST_CHUNK = 64;
+    static constexpr size_t MAX_CHUNK = 1 << 16;
+
+    // What a slot holds once its node is gone: the next free slot
+    struct FreeSlot {
+        FreeSlot *next;
+    };
+
+    // Room for one node (or one FreeSlot), lined up for either
+    union Slot {
+        alignas(Node<K, V>) unsigned char node[sizeof(Node<K, V>)];
+        FreeSlot free;
+    };
+
+    /**
+     * Gets the next chunk from malloc and makes it the one we hand out from
+     */
+    void add_chunk() {
+        Slot *chunk = static_cast<Slot*>(::operator new(chunk_nodes_ * sizeof(Slot)));
+        chunks_.push_back(chunk);
+        next_ = chunk;
+        end_ = chunk + chunk_nodes_;
+        if (chunk_nodes_ < MAX_CHUNK) {
+            chunk_nodes_ *= 2;
+        }
+    }
+
+    std::vector<Slot*> chunks_;
+    Slot *next_;                // The next slot in the newest chunk that's never been used
+    Slot *end_;                 // One past the last slot in the newest chunk
+    FreeSlot *free_list_;       // Slots that were used and given back
+    size_t chunk_nodes_;        // How many nodes the next chunk gets
+};
+
+#endif /* NODEALLOCATOR_H_ */
@@ -10,6 +10,7 @@
 #define RBTREE_H_
 
 #include "node.h"
+#include "nodeallocator.h"
 #include "tree.h"
 #include "treeprinter.h"
 #include <iostream>
@@ -18,10 +19,13 @@
 #include <string>
 #include <sstream>
 #include <algorithm>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 // Forward declaration
-template <typename K, typename V>
+// Allocator is where the tree gets its nodes from (see nodeallocator.h). By default, they come out of a NodeArena.
+template <typename K, typename V, typename Allocator = NodeArena<K, V> >
 class RedBlackTree;
 
 /**
@@ -42,7 +46,7 @@ private:
     std::string message_;
 };
 
-template <typename K, typename V>
+template <typename K, typename V, typename Allocator = NodeArena<K, V> >
 class RedBlackTreeIterator {
 public:
     /**
@@ -149,41 +153,42 @@ private:
     // root pointer, which is needed for ++ and --
     // when the iterator value is end().
     Node<K, V> *node_ptr;
-    RedBlackTree<K, V> *tree;
-    friend class RedBlackTree<K, V>;
+    RedBlackTree<K, V, Allocator> *tree;
+    friend class RedBlackTree<K, V, Allocator>;
 
     /**
      * Constructor used to construct an iterator return value from a tree
      * pointer.
      */
-    RedBlackTreeIterator(Node<K, V> *p, RedBlackTree<K, V> *t) :
+    RedBlackTreeIterator(Node<K, V> *p, RedBlackTree<K, V, Allocator> *t) :
         node_ptr(p), tree(t) { }
 };
 
-template<typename K, typename V>
+template<typename K, typename V, typename Allocator>
 class RedBlackTree : public Tree {
 public:
-    typedef RedBlackTreeIterator<K, V> iterator;
+    typedef RedBlackTreeIterator<K, V, Allocator> iterator;
 
     /**
      * Constructor to create an empty red-black tree.
      */
-    explicit RedBlackTree() : root_{nullptr}, size_{0} { }
+    explicit RedBlackTree() : root_{nullptr}, leftmost_{nullptr}, rightmost_{nullptr}, size_{0} { }
 
     /**
      * Constructor to create a red-black tree with the elements from the
      * vector.
      */
     explicit RedBlackTree(std::vector< std::pair<K, V> > &elements) :
-                                            root_(nullptr), size_(0) {
+                                            root_(nullptr), leftmost_(nullptr), rightmost_(nullptr), size_(0) {
         insert_elements(elements);
     }
 
     /**
-     * Destructor.
+     * Destructor. Gives every node back to the allocator with clear(). After that, allocator_'s own destructor has
+     * nothing left to free.
      */
     ~RedBlackTree() {
-        delete_tree(root_);
+        clear();
     }
 
     /**
@@ -202,68 +207,95 @@ public:
         }
     }
 
+    /**
+     * Replaces everything in the red-black tree with the elements from the vector, in O(n) if they're already sorted
+     * by key and O(n log n) if they have to be sorted first.
+     * Instead of inserting them one at a time with a fixup each, this builds the tree bottom-up with the middle element
+     * as the root, the middle of each half as its children, and so on. That tree is as short as it can be: every level
+     * is full except maybe the deepest one. Making that deepest level red (if it isn't full) and everything else black
+     * gives every path the same number of black nodes, so it's already a valid red-black tree.
+     * Duplicate keys don't throw or print a warning like insert_elements() does. The first one in the vector is kept,
+     * the same as if they had been inserted in order.
+     * @param elements The key-value pairs to put in the tree, in any order
+     * @return How many duplicates got dropped
+     */
+    size_t bulk_load(const std::vector< std::pair<K, V> > &elements) {
+        clear();
+
+        // If the keys already go up strictly, we can build straight from the vector.
+        // Otherwise, sort a copy (stably, so the first of each duplicate stays first) and take out the duplicates.
+        bool strictly_sorted = true;
+        for (size_t i = 1, len = elements.size(); i < len && strictly_sorted; ++i) {
+            strictly_sorted = elements[i - 1].first < elements[i].first;
+        }
+
+        size_t duplicates = 0;
+        if (strictly_sorted) {
+            build_balanced(elements);
+        } else {
+            std::vector< std::pair<K, V> > sorted(elements);
+            auto by_key = [](const std::pair<K, V> &a, const std::pair<K, V> &b) { return a.first < b.first; };
+            auto same_key = [](const std::pair<K, V> &a, const std::pair<K, V> &b) {
+                return !(a.first < b.first) && !(b.first < a.first);
+            };
+            std::stable_sort(sorted.begin(), sorted.end(), by_key);
+            sorted.erase(std::unique(sorted.begin(), sorted.end(), same_key), sorted.end());
+            duplicates = elements.size() - sorted.size();
+            build_balanced(sorted);
+        }
+        return duplicates;
+    }
+
     /**
      * Inserts a key-value pair into the red black tree.
-     * const iterator &it indicates where to start the search for the place to
-     * insert the node. If it == end(), the search starts at the root.
+     * const iterator &it is a hint for where the key goes, like std::map's: the new key should go right before it
+     * (it == end() means after everything). If the hint is right, the key goes in without searching from the root, so
+     * inserting keys in order with insert(end(), ...) is O(1) amortized (plus the fixup). If it's wrong, we just search
+     * from the root.
      * Must throw a tree_exception if attempting to insert a key that is
-     * already present in the tree.
+     * already present in the tree. Nothing gets allocated unless the key actually goes in.
      */
     void insert(const iterator &it, const std::pair<K, V> &key_value) {
         const K& key = key_value.first;
-        Node<K, V> *x, *y;
-        if (it != end()) {
-            x = it.node_ptr;
-            y = x->parent;
-        } else {
-            x = root_;
-            y = nullptr;
+        Node<K, V> *parent = nullptr;
+        bool go_left = false;
+
+        if (!hinted_parent(it.node_ptr, key, parent, go_left)) {
+            // The hint didn't help, so search from the root (CLRS ch. 13's BST-like insertion). We stop as soon as we
+            // see the key, so duplicates don't need a find() of their own.
+            Node<K, V> *x = root_;
+            while (x != nullptr) {
+                parent = x;
+                const K& current_key = x->key();
+                if (key < current_key) {
+                    go_left = true;
+                    x = x->left;
+                } else if (current_key < key) {
+                    go_left = false;
+                    x = x->right;
+                } else {
+                    throw_duplicate(key);
+                }
+            }
         }
 
-        // Prepare a node to insert into the RBT
-        Node<K, V> *z = new Node<K, V>(key, key_value.second);
-        
-        // If we already have the key in the tree (aka we haven't gone through all the nodes and haven't seen it),
-        // don't add it in
-        if (find(key) != end()) {
-
-            // Use an ostringstream to create our error message string
-            std::ostringstream temp;
-            temp << "Attempt to insert duplicate key '" << key << "'.";
-            // delete the node that can't be inserted before throwing the exception
-            delete z;
-            throw tree_exception(temp.str());
-            //throw tree_exception("Attempt to insert duplicate key '" << key << "'.");
-            
-            return;
-		}
-
-        // The following code is purely based off of CLRS ch. 13's pseudo-code for insertion
-        // This performs a "BST-like" insertion operation.
-        while (x != nullptr){
-            y = x;
-            if (key < x->value()){
-                x = x->left;
+        // Now we know the key goes in, so make its node and hang it off parent.
+        // Newly inserted nodes are red (Node's constructor already does that) and have no children.
+        Node<K, V> *z = allocator_.create(key, key_value.second);
+        z->parent = parent;
+        if (parent == nullptr) {
+            root_ = leftmost_ = rightmost_ = z;
+        } else if (go_left) {
+            parent->left = z;
+            if (parent == leftmost_) {
+                leftmost_ = z;
             }
-            else{
-                x = x->right;
+        } else {
+            parent->right = z;
+            if (parent == rightmost_) {
+                rightmost_ = z;
             }
         }
-        z->parent = y;
-        if (y == nullptr){
-            root_ = z;
-        }
-        else if(key < y->value()){
-            y->left = z;
-        }
-        else{
-            y->right = z;
-        }
-        z->left = nullptr;
-        z->right = nullptr;
-
-        // Newly inserted nodes are red
-        z->color = RED;
         size_++;        // Increment size so we have it as a variable
 
         // After we are done, fix up the RBT to preserve RBT properties and balance it out
@@ -382,18 +414,9 @@ public:
      * Returns an iterator pointing to the first item in order.
      */
     iterator begin() {
-        Node<K, V> *curr = root_;
-
-        // if the tree is not empty, the first node
-        // in order is the farthest node left from root
-        if (curr != nullptr) {
-            while (curr->left != nullptr) {
-                curr = curr->left;
-            }
-        }
-
+        // The first node in order is the farthest node left from root, and insert() keeps track of it
         // build return value using private constructor
-        return iterator(curr, this);
+        return iterator(leftmost_, this);
     }
 
     /**
@@ -405,8 +428,86 @@ public:
 
 private:
     Node<K, V> *root_;
+    Node<K, V> *leftmost_;      // The smallest key's node (nullptr if the tree is empty)
+    Node<K, V> *rightmost_;     // The biggest key's node (nullptr if the tree is empty)
     size_t size_;
-    friend class RedBlackTreeIterator<K, V>;
+    Allocator allocator_;       // Every node in the tree comes from here
+    friend class RedBlackTreeIterator<K, V, Allocator>;
+
+    /**
+     * Empties the red-black tree, so it can be filled again (see bulk_load()).
+     * If the allocator can free all the nodes at once and they don't have destructors worth running (int keys and
+     * values, for example), release() does it without visiting a single node. Otherwise, delete_tree() destroys each
+     * node first. Either way, the root, both ends and the size go back to what an empty tree has.
+     */
+    void clear() {
+        if constexpr (!Allocator::releases_in_bulk || !std::is_trivially_destructible<Node<K, V> >::value) {
+            delete_tree(root_);
+        }
+        allocator_.release();
+        root_ = leftmost_ = rightmost_ = nullptr;
+        size_ = 0;
+    }
+
+    /**
+     * Builds the tree for bulk_load() out of an empty one
+     * @param sorted The key-value pairs, with keys going up strictly
+     */
+    void build_balanced(const std::vector< std::pair<K, V> > &sorted) {
+        if (sorted.empty()) {
+            return;
+        }
+
+        // The tree is as short as it can be, so it has height floor(log2(n)), and that level only has some nodes in it
+        // unless n + 1 is a power of 2
+        const size_t n = sorted.size();
+        int deepest = 0;
+        while ((n >> (deepest + 1)) != 0) {
+            deepest++;
+        }
+        const bool deepest_is_full = ((n + 1) & n) == 0;
+
+        root_ = build_balanced(sorted, 0, n, 0, deepest_is_full ? -1 : deepest);
+        leftmost_ = rightmost_ = root_;
+        while (leftmost_->left != nullptr) {
+            leftmost_ = leftmost_->left;
+        }
+        while (rightmost_->right != nullptr) {
+            rightmost_ = rightmost_->right;
+        }
+        size_ = n;
+    }
+
+    /**
+     * Recursively builds the subtree for sorted[low, high) with the middle element at the top.
+     * The left subtree gets built before the top node is made, so the nodes come out of the allocator in order and
+     * walking the tree in order walks through memory in order too.
+     * @param sorted The key-value pairs, with keys going up strictly
+     * @param low The first index in the subtree
+     * @param high One past the last index in the subtree
+     * @param level How deep the subtree's top node is (the root is 0)
+     * @param red_level The level to color red, or -1 if every node is black
+     * @return The subtree's top node, or nullptr if it's empty
+     */
+    Node<K, V>* build_balanced(const std::vector< std::pair<K, V> > &sorted, size_t low, size_t high,
+                               int level, int red_level) {
+        if (low == high) {
+            return nullptr;
+        }
+        const size_t mid = low + (high - low) / 2;
+        Node<K, V> *left = build_balanced(sorted, low, mid, level + 1, red_level);
+        Node<K, V> *node = allocator_.create(sorted[mid].first, sorted[mid].second);
+        node->color = level == red_level ? RED : BLACK;
+        node->left = left;
+        if (left != nullptr) {
+            left->parent = node;
+        }
+        node->right = build_balanced(sorted, mid + 1, high, level + 1, red_level);
+        if (node->right != nullptr) {
+            node->right->parent = node;
+        }
+        return node;
+    }
 
     /**
      * Deletes all nodes from the red-black tree.
@@ -419,8 +520,76 @@ private:
         if (n != nullptr) {
             delete_tree(n->left);
             delete_tree(n->right);
-            delete n;
+            allocator_.destroy(n);
+        }
+    }
+
+    /**
+     * Throws the tree_exception for inserting a key that's already in the tree
+     * Due to string concatenation being weird, we use an ostringstream to put the key in the message
+     * @param key The duplicate key
+     */
+    [[noreturn]] void throw_duplicate(const K &key) const {
+        std::ostringstream temp;
+        temp << "Attempt to insert duplicate key '" << key << "'.";
+        throw tree_exception(temp.str());
+    }
+
+    /**
+     * Checks whether key goes right before hint (see insert()). If it does, that's either as hint's left child or as
+     * the right child of the node before hint, whichever one is empty (exactly one of them always is).
+     * @param hint The node the key should go before, or nullptr for after the biggest key
+     * @param key The key we're inserting
+     * @param parent Gets the node to hang the new node off of
+     * @param go_left Gets whether the new node is parent's left child
+     * @return False if the hint is wrong and we have to search from the root
+     */
+    bool hinted_parent(Node<K, V> *hint, const K &key, Node<K, V> *&parent, bool &go_left) const {
+        if (root_ == nullptr) {
+            return hint == nullptr;             // An empty tree has nowhere to search, and parent stays nullptr
+        }
+
+        // The node before hint: the biggest key smaller than it
+        Node<K, V> *before;
+        if (hint == nullptr) {
+            before = rightmost_;
+        } else {
+            if (!(key < hint->key())) {
+                return false;
+            }
+            if (hint == leftmost_) {
+                parent = hint;
+                go_left = true;
+                return true;
+            }
+
+            // The biggest key in hint's left subtree, or if there isn't one, the first ancestor hint is right of
+            if (hint->left != nullptr) {
+                before = hint->left;
+                while (before->right != nullptr) {
+                    before = before->right;
+                }
+            } else {
+                Node<K, V> *child = hint;
+                before = hint->parent;
+                while (child == before->left) {
+                    child = before;
+                    before = before->parent;
+                }
+            }
+        }
+
+        if (!(before->key() < key)) {
+            return false;
+        }
+        if (before->right == nullptr) {
+            parent = before;
+            go_left = false;
+        } else {
+            parent = hint;
+            go_left = true;
         }
+        return true;
     }
 
     /**
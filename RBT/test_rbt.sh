@@ -362,6 +362,252 @@ Maximum width:            6
 Successful search cost:   3.400
 Unsuccessful search cost: 4.125
 Inorder traversal:        [Ateniese, Bonelli, Borowski, Compagnoni, Damopoulos, Duggan, Engling, Klappholz, Kleinberg, Mordohai, Naumann, Nicolosi, Portokalidis, Wang, Wetzel]"
+# Hinted inserts. A right hint, a wrong one or no hint at all should give the same tree as inserting without hints.
+run_test_with_args "--hint 10@ 20@ 30@ 40@ 50@" " 20
+ / \\
+10 40
+   / \\
+  30 50
+
+Height:                   2
+Total nodes:              5
+Leaf count:               3
+Internal nodes:           2
+Diameter:                 3
+Maximum width:            2
+Successful search cost:   2.200
+Unsuccessful search cost: 2.667
+Inorder traversal:        [10, 20, 30, 40, 50]"
+run_test_with_args "--hint 50@ 40@50 30@40 20@30 10@20" "   40
+   / \\
+  20 50
+ / \\
+10 30
+
+Height:                   2
+Total nodes:              5
+Leaf count:               3
+Internal nodes:           2
+Diameter:                 3
+Maximum width:            2
+Successful search cost:   2.200
+Unsuccessful search cost: 2.667
+Inorder traversal:        [10, 20, 30, 40, 50]"
+run_test_with_args "--hint 70@ 10@70 60@10 20@60 50@ 30@50 40@10" "   60
+   / \\
+  20 70
+ / \\
+10 40
+   / \\
+  30 50
+
+Height:                   3
+Total nodes:              7
+Leaf count:               4
+Internal nodes:           3
+Diameter:                 4
+Maximum width:            2
+Successful search cost:   2.714
+Unsuccessful search cost: 3.250
+Inorder traversal:        [10, 20, 30, 40, 50, 60, 70]"
+run_test_with_args "--hint 50@ 10@50 30@50 20@30 40@50 30@40 10@" "Warning: Attempt to insert duplicate key '30'.
+Warning: Attempt to insert duplicate key '10'.
+   30
+   / \\
+  /   \\
+ /     \\
+10     50
+ \\     /
+ 20   40
+
+Height:                   2
+Total nodes:              5
+Leaf count:               2
+Internal nodes:           3
+Diameter:                 4
+Maximum width:            2
+Successful search cost:   2.200
+Unsuccessful search cost: 2.667
+Inorder traversal:        [10, 20, 30, 40, 50]"
+run_test_with_args "--hint Jim@ Amy@Jim Kyle@ Jim@Kyle Bill@Jim" "Warning: Attempt to insert duplicate key 'Jim'.
+   Jim
+   / \\
+  /   \\
+Amy  Kyle
+  \\
+ Bill
+
+Height:                   2
+Total nodes:              4
+Leaf count:               2
+Internal nodes:           2
+Diameter:                 3
+Maximum width:            2
+Successful search cost:   2.000
+Unsuccessful search cost: 2.400
+Inorder traversal:        [Amy, Bill, Jim, Kyle]"
+run_test_with_args "--hint 5 7@x" "Error: Invalid integer '7@x' found at index 3."
+# Bulk loads. Sorted input gets built directly, and anything else gets sorted and has its duplicates dropped first.
+run_test_with_args "--bulk" "Duplicates dropped: 0
+Root is null.
+
+Height:                   -1
+Total nodes:              0
+Leaf count:               0
+Internal nodes:           0
+Diameter:                 0
+Maximum width:            0
+Successful search cost:   0.000
+Unsuccessful search cost: 0.000
+Inorder traversal:        []"
+run_test_with_args "--bulk 5" "Duplicates dropped: 0
+5
+
+Height:                   0
+Total nodes:              1
+Leaf count:               1
+Internal nodes:           0
+Diameter:                 0
+Maximum width:            1
+Successful search cost:   1.000
+Unsuccessful search cost: 1.000
+Inorder traversal:        [5]"
+run_test_with_args "--bulk 1 2 3 4 5 6 7" "Duplicates dropped: 0
+      4
+     / \\
+    /   \\
+   /     \\
+  2       6
+ / \\     / \\
+1   3   5   7
+
+Height:                   2
+Total nodes:              7
+Leaf count:               4
+Internal nodes:           3
+Diameter:                 4
+Maximum width:            4
+Successful search cost:   2.429
+Unsuccessful search cost: 3.000
+Inorder traversal:        [1, 2, 3, 4, 5, 6, 7]"
+run_test_with_args "--bulk 1 2 3 4 5 6 7 8" "Duplicates dropped: 0
+        5
+       / \\
+      /   \\
+     /     \\
+    3       7
+   / \\     / \\
+  2   4   6   8
+ /
+1
+
+Height:                   3
+Total nodes:              8
+Leaf count:               4
+Internal nodes:           4
+Diameter:                 5
+Maximum width:            4
+Successful search cost:   2.625
+Unsuccessful search cost: 3.222
+Inorder traversal:        [1, 2, 3, 4, 5, 6, 7, 8]"
+run_test_with_args "--bulk 8 3 5 1 7 2 6 4 3 8 1" "Duplicates dropped: 3
+        5
+       / \\
+      /   \\
+     /     \\
+    3       7
+   / \\     / \\
+  2   4   6   8
+ /
+1
+
+Height:                   3
+Total nodes:              8
+Leaf count:               4
+Internal nodes:           4
+Diameter:                 5
+Maximum width:            4
+Successful search cost:   2.625
+Unsuccessful search cost: 3.222
+Inorder traversal:        [1, 2, 3, 4, 5, 6, 7, 8]"
+run_test_with_args "--bulk 1 1 1 1" "Duplicates dropped: 3
+1
+
+Height:                   0
+Total nodes:              1
+Leaf count:               1
+Internal nodes:           0
+Diameter:                 0
+Maximum width:            1
+Successful search cost:   1.000
+Unsuccessful search cost: 1.000
+Inorder traversal:        [1]"
+run_test_with_args "--bulk 30 29 28 27 26 25 24 23 22 21 20 19 18 17 16 15 14 13 12 11 10 9 8 7 6 5 4 3 2 1" "Duplicates dropped: 0
+                             16
+                             / \\
+                            /   \\
+                           /     \\
+                          /       \\
+                         /         \\
+                        /           \\
+                       /             \\
+                      /               \\
+                     /                 \\
+                    /                   \\
+                   /                     \\
+                  /                       \\
+                 /                         \\
+                /                           \\
+               /                             \\
+              8                              24
+             / \\                             / \\
+            /   \\                           /   \\
+           /     \\                         /     \\
+          /       \\                       /       \\
+         /         \\                     /         \\
+        /           \\                   /           \\
+       /             \\                 /             \\
+      4              12               20             28
+     / \\             / \\             / \\             / \\
+    /   \\           /   \\           /   \\           /   \\
+   /     \\         /     \\         /     \\         /     \\
+  2       6       10     14       18     22       26     30
+ / \\     / \\     / \\     / \\     / \\     / \\     / \\     /
+1   3   5   7   9  11   13 15   17 19   21 23   25 27   29
+
+Height:                   4
+Total nodes:              30
+Leaf count:               15
+Internal nodes:           15
+Diameter:                 8
+Maximum width:            15
+Successful search cost:   4.133
+Unsuccessful search cost: 4.968
+Inorder traversal:        [1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30]"
+run_test_with_args "--bulk Jim Connie Mike Michelle John Amy Bill Kyle Jill Mike Jill" "Duplicates dropped: 2
+           Jim
+           / \\
+          /   \\
+         /     \\
+        /       \\
+       /         \\
+    Connie    Michelle
+     / \\         / \\
+    /   \\       /   \\
+  Bill Jill   Kyle Mike
+  /           /
+Amy         John
+
+Height:                   3
+Total nodes:              9
+Leaf count:               4
+Internal nodes:           5
+Diameter:                 6
+Maximum width:            4
+Successful search cost:   2.778
+Unsuccessful search cost: 3.400
+Inorder traversal:        [Amy, Bill, Connie, Jill, Jim, John, Kyle, Michelle, Mike]"
+run_test_with_args "--bulk 4 x" "Error: Invalid integer 'x' found at index 3."
 ############################################################
 echo
 echo "Total tests run: $num_tests"
@@ -47,6 +47,40 @@ void test_find(Tree *tree) {
     }
 }
 
+template <typename K, typename V>
+void test_red_black(Tree *tree) {
+    RedBlackTree<K, V> *rbt = static_cast<RedBlackTree<K, V> *>(tree);
+    int black_height = -1;
+    typename RedBlackTree<K, V>::iterator it = rbt->begin();
+    while (it != rbt->end()) {
+        ostringstream oss;
+        if (it->parent == nullptr && it->color != BLACK) {
+            oss << "Root '" << it->key() << "' is red.";
+            throw tree_exception(oss.str());
+        }
+        if (it->color == RED && ((it->left != nullptr && it->left->color == RED) ||
+                                 (it->right != nullptr && it->right->color == RED))) {
+            oss << "Red node '" << it->key() << "' has a red child.";
+            throw tree_exception(oss.str());
+        }
+        // Every path down to a missing child has to go through the same number of black nodes
+        if (it->left == nullptr || it->right == nullptr) {
+            int blacks = 0;
+            for (Node<K, V> *node = &*it; node != nullptr; node = node->parent) {
+                blacks += node->color == BLACK;
+            }
+            if (black_height == -1) {
+                black_height = blacks;
+            } else if (blacks != black_height) {
+                oss << "Path through node '" << it->key() << "' has " << blacks
+                    << " black nodes instead of " << black_height << ".";
+                throw tree_exception(oss.str());
+            }
+        }
+        ++it;
+    }
+}
+
 template <typename K, typename V>
 void display_stats(Tree *tree) {
     cout << tree->to_ascii_drawing() << endl << endl;
@@ -66,12 +100,86 @@ void display_stats(Tree *tree) {
 
     try {
         test_find<K, V>(tree);
+        test_red_black<K, V>(tree);
     } catch (const tree_exception &te) {
         cerr << "Error: " << te.what() << endl;
     }
 }
 
+template <typename K>
+bool parse_key(const string &arg, K &key) {
+    istringstream iss(arg);
+    return static_cast<bool>(iss >> key);
+}
+
+template <>
+bool parse_key<string>(const string &arg, string &key) {
+    key = arg;
+    return true;
+}
+
+/**
+ * Builds a tree out of argv[first...argc) with one of the other ways of
+ * filling it, and displays it like the default mode does.
+ * With bulk set, all of the keys go in with one bulk_load(), and we print how
+ * many duplicates it dropped.
+ * Otherwise, each argument is inserted with insert(it, ...). "key@hint" uses
+ * find(hint) as the hint, and "key@" uses end(). A plain "key" gets the
+ * insert(key, value) without a hint.
+ */
+template <typename K>
+void test_other_inserts(int argc, char *argv[], int first, bool bulk) {
+    RedBlackTree<K, K> *rbt = new RedBlackTree<K, K>();
+    vector< pair<K, K> > elements;
+    for (int i = first; i < argc; ++i) {
+        const string arg(argv[i]);
+        const size_t at = bulk ? string::npos : arg.find('@');
+        K key, hint;
+        if (!parse_key(arg.substr(0, at), key) ||
+                (at != string::npos && at + 1 < arg.size() &&
+                 !parse_key(arg.substr(at + 1), hint))) {
+            cerr << "Error: Invalid integer '" << argv[i]
+                 << "' found at index " << i << "." << endl;
+            delete rbt;
+            return;
+        }
+        if (bulk) {
+            elements.push_back(make_pair(key, key));
+            continue;
+        }
+        try {
+            if (at == string::npos) {
+                rbt->insert(key, key);
+            } else {
+                rbt->insert(at + 1 < arg.size() ? rbt->find(hint) : rbt->end(),
+                            make_pair(key, key));
+            }
+        } catch (const tree_exception &te) {
+            cerr << "Warning: " << te.what() << endl;
+        }
+    }
+    if (bulk) {
+        cout << "Duplicates dropped: " << rbt->bulk_load(elements) << endl;
+    }
+    display_stats<K, K>(rbt);
+    delete rbt;
+}
+
 int main(int argc, char *argv[]) {
+    // "--hint" and "--bulk" fill the tree with the hinted insert or
+    // bulk_load() (see test_other_inserts()). The keys come after them.
+    if (argc > 1 && (string(argv[1]) == "--hint" || string(argv[1]) == "--bulk")) {
+        const bool bulk = string(argv[1]) == "--bulk";
+        int value;
+        istringstream iss(argc > 2 ? argv[2] : "");
+        if (iss >> value) {
+            test_other_inserts<int>(argc, argv, 2, bulk);
+        } else {
+            test_other_inserts<string>(argc, argv, 2, bulk);
+        }
+        return 0;
+    }
+
     bool using_ints = false;
     if (argc > 1) {
         istringstream iss(argv[1]);